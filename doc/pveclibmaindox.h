@@ -266,6 +266,8 @@
 *  - vec_f128_ppc.h Operations on vector _Float128 values
 *  - vec_f64_ppc.h Operations on vector double values
 *  - vec_f32_ppc.h Operations on vector float values
+*  - vec_uint_ppc.hpp C++ fixed width (128-4096 bit) unsigned
+*  integer value types built on vec_int128_ppc.h and vec_int512_ppc.h
 *
 *  \note The list above is complete in the current public github as a
 *  first pass. A backlog of functions remain to be implemented
@@ -2266,6 +2268,14 @@ __attribute__ ((ifunc ("resolve_vec_mul128x128")));
 * function symbol branch (via the PLT) directly to the appropriate
 * platform specific implementation.
 *
+* The libpvec resolvers also honor the PVECLIB_CPU environment
+* variable (for example PVECLIB_CPU=power8). This forces an older
+* target, for A/B testing or to match a POWER8 compatibility mode
+* partition, without rebuilding. A newer target than the hardware ISA
+* level supports is ignored. The resolvers record their selection
+* and vec_runtime_target() reports which target each entry point
+* resolved to.
+*
 * \note The platform specific implementations we use here are compiled
 * from the same source files we used to build the static library
 * archive.
@@ -26,6 +26,10 @@
 
 #include <pveclib/vec_common_ppc.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file  vec_char_ppc.h
  * \brief Header package containing a collection of 128-bit SIMD
@@ -2665,4 +2669,8 @@ vec_vstribr_p (vui8_t vra)
 #endif
 }
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* VEC_CHAR_PPC_H_ */
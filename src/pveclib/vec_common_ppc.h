@@ -25,6 +25,10 @@
 #include <stdint.h>
 #include <altivec.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file  vec_common_ppc.h
  * \brief Common definitions and typedef used by the collection of
@@ -9236,4 +9240,8 @@ scalar_insert_uint64_to_uint128 (unsigned long long high,
   return t.ui128;
 }
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* VEC_COMMON_PPC_H_ */
@@ -5111,6 +5111,20 @@ extern __binary128
 __VEC_PWR_IMP (vec_xsmulqpo) (__binary128 vfa, __binary128 vfb);
 extern __binary128
 __VEC_PWR_IMP (vec_xssubqpo) (__binary128 vfa, __binary128 vfb);
+extern __binary128
+__VEC_PWR_IMP (vec_xsaddqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128
+__VEC_PWR_IMP (vec_xsdivqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128
+__VEC_PWR_IMP (vec_xsmaddqp_rm) (__binary128 vfa, __binary128 vfb, __binary128 vfc,
+				  int rmode);
+extern __binary128
+__VEC_PWR_IMP (vec_xsmsubqp_rm) (__binary128 vfa, __binary128 vfb, __binary128 vfc,
+				  int rmode);
+extern __binary128
+__VEC_PWR_IMP (vec_xsmulqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128
+__VEC_PWR_IMP (vec_xssubqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
 ///@endcond
 
 /** \brief Generate doubleword splat constant 63.
@@ -10337,6 +10351,128 @@ vec_signbitf128 (__binary128 f128)
 #endif
 }
 
+/*! \brief Rounding mode operand for the _rm operations,
+ *  round to Nearest Even. Same encoding as FPSCR<sub>RN</sub>.  */
+#define VEC_F128_RN_NEAREST 0
+/*! \brief Rounding mode operand for the _rm operations,
+ *  round toward Zero.  */
+#define VEC_F128_RN_ZERO 1
+/*! \brief Rounding mode operand for the _rm operations,
+ *  round toward +Infinity.  */
+#define VEC_F128_RN_UP 2
+/*! \brief Rounding mode operand for the _rm operations,
+ *  round toward -Infinity.  */
+#define VEC_F128_RN_DOWN 3
+/*! \brief Rounding mode operand for the _rm operations,
+ *  round to Odd. Same as the qpo operations.  */
+#define VEC_F128_RN_ODD 4
+
+/** \brief Round a Quad-Precision intermediate result (IR) and merge
+ *  the sign, exponent and significand into the final result.
+ *
+ *  This is the final step shared by the POWER8 soft-float
+ *  implementations of add/subtract, multiply, divide and
+ *  multiply-add. The IR is passed as the sign, the biased exponent
+ *  (splatted, 0 for denormal), the 113-bit truncated significand
+ *  right justified with the L-bit in bit 112, and the bits below the
+ *  significand left justified in q_grx. The high order bit of q_grx is
+ *  the Guard bit, any other nonzero bit counts as Sticky. See
+ *  \ref f128_softfloat_IRRN_0_2.
+ *
+ *  Rounding up may carry into the C-bit (adjust the exponent) or
+ *  promote a denormal to E_min. Exponent overflow returns Infinity for
+ *  round to nearest and when rounding away from zero, otherwise the
+ *  largest finite magnitude.
+ *
+ *  \note rmode is expected to be a constant in context so the
+ *  unused rounding modes fold away.
+ *
+ *  @param q_sign vector containing the sign bit of the result.
+ *  @param q_exp vector doublewords containing the biased exponent.
+ *  @param q_sig vector __int128 containing the truncated significand.
+ *  @param q_grx vector __int128 containing the GRX bits left justified.
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
+ *  @return a scalar __binary128 value.
+ */
+static inline __binary128
+vec_roundqp_rm (vui32_t q_sign, vui64_t q_exp, vui128_t q_sig,
+		vui128_t q_grx, const int rmode)
+{
+  const vui32_t q_zero = CONST_VINT128_W (0, 0, 0, 0);
+  const vui32_t q_ones = CONST_VINT128_W (-1, -1, -1, -1);
+  const vui64_t exp_naninf = vec_mask64_f128exp ();
+  vui128_t p_rnd;
+  int away = 0;
+
+  if (rmode == VEC_F128_RN_UP || rmode == VEC_F128_RN_DOWN)
+    {
+      // Round up the magnitude for +Inf of a positive IR
+      // or -Inf of a negative IR.
+      int neg = vec_cmpuq_all_ne ((vui128_t) q_sign, (vui128_t) q_zero);
+      away = (rmode == VEC_F128_RN_UP) ? !neg : neg;
+    }
+
+  if (rmode == VEC_F128_RN_ODD)
+    {
+      // Round to odd, OR nonzero GRX-bits into the low order bit
+      p_rnd = vec_addcuq (q_grx, (vui128_t) q_ones);
+      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_rnd);
+    }
+  else if (rmode != VEC_F128_RN_ZERO)
+    {
+      if (rmode == VEC_F128_RN_NEAREST)
+	{
+	  // const vui32_t rmask = CONST_VINT128_W(0x7fffffff, -1, -1, -1);
+	  vui32_t rmask = (vui32_t) vec_srqi ((vui128_t) q_ones, 1);
+	  // Carry if GRX > 0b100... or GRX == 0b100... and the
+	  // significand is odd (tie to even).
+	  p_rnd = vec_addecuq (q_grx, (vui128_t) rmask, q_sig);
+	}
+      else if (away)
+	{
+	  // Carry for any nonzero GRX-bits
+	  p_rnd = vec_addcuq (q_grx, (vui128_t) q_ones);
+	}
+      else
+	p_rnd = (vui128_t) q_zero;
+
+      q_sig = vec_adduqm (q_sig, p_rnd);
+      // Check for carry into the C-bit and adjust
+      if (__builtin_expect (vec_cmpuq_all_ge (q_sig,
+			    (vui128_t) vec_mask128_f128Cbit ()), 0))
+	{
+	  const vui64_t exp_one = vec_splat_u64 (1);
+	  q_sig = vec_srqi (q_sig, 1);
+	  q_exp = vec_addudm (q_exp, exp_one);
+	}
+      // A denormal that rounds up to the L-bit is now E_min
+      else if (__builtin_expect (vec_cmpud_all_eq (q_exp,
+						   (vui64_t) q_zero), 0))
+	{
+	  vui128_t l_bit;
+	  l_bit = vec_srqi ((vui128_t) q_sig, 112);
+	  q_exp = vec_splatd ((vui64_t) l_bit, VEC_DW_L);
+	}
+    }
+  // Check for exponent overflow
+  if (__builtin_expect ((vec_cmpud_all_ge (q_exp, exp_naninf)), 0))
+    {
+      vui32_t q_huge;
+      if (rmode == VEC_F128_RN_NEAREST || away)
+	q_huge = vec_mask128_f128exp ();
+      else
+	// const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
+	q_huge = vec_const128_f128_fmax ();
+      q_huge = vec_or (q_huge, q_sign);
+      return vec_xfer_vui32t_2_bin128 (q_huge);
+    }
+  // Merge sign, significand, and exponent into final result
+  q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
+  return vec_xsiexpqp (q_sig, q_exp);
+}
+
 /** \brief VSX Scalar Add Quad-Precision using round to Odd.
  *
  *  The quad-precision element of vectors vfa and vfb are added
@@ -10385,48 +10521,94 @@ vec_signbitf128 (__binary128 f128)
 extern __binary128
 vec_xsaddqpo (__binary128 vfa, __binary128 vfb);
 
-/** \brief VSX Scalar Add Quad-Precision using round to Odd.
+/** \brief VSX Scalar Add Quad-Precision using an explicit rounding mode.
  *
  *  The quad-precision element of vectors vfa and vfb are added
  *  to produce the quad-precision result.
- *  The rounding mode is round to odd.
+ *  The rounding mode is selected by rmode, one of
+ *  VEC_F128_RN_NEAREST, VEC_F128_RN_ZERO, VEC_F128_RN_UP,
+ *  VEC_F128_RN_DOWN or VEC_F128_RN_ODD. This avoids the fesetround()
+ *  calls otherwise needed around each operation, for example to
+ *  compute the lower and upper bounds of interval arithmetic.
  *
- *  For POWER9 use the xsaddqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
- *  For POWER7 and earlier us the compilers soft-float implementation.
+ *  This is the dynamic call ABI for IFUNC selection when dynamically
+ *  linked to the <I>libpvec.so</I> runtime library. The static
+ *  implementations are vec_xsaddqp_rm_PWR7 (BE only), vec_xsaddqp_rm_PWR8,
+ *  vec_xsaddqp_rm_PWR9 and vec_xsaddqp_rm_PWR10.
+ *
+ *  \note For POWER9/10 use the xsaddqp instruction with mffscrn to
+ *  set and restore FPSCR<sub>RN</sub>, or xsaddqpo for round to odd.
+ *  For POWER8 use the soft-float implementation from
+ *  vec_xsaddqp_rm_inline().
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode.
+ *  @return a scalar __binary128 value.
+ */
+extern __binary128
+vec_xsaddqp_rm (__binary128 vfa, __binary128 vfb, int rmode);
+
+/** \brief VSX Scalar Add Quad-Precision using an explicit rounding mode.
+ *
+ *  The quad-precision element of vectors vfa and vfb are added
+ *  to produce the quad-precision result.
+ *  The rounding mode is selected by rmode instead of the
+ *  FPSCR<sub>RN</sub> field.
+ *
+ *  For POWER9 use the xsaddqpo instruction for round to odd. Otherwise
+ *  swap rmode into FPSCR<sub>RN</sub> with mffscrn, execute
+ *  xsaddqp and restore the previous rounding mode.
+ *  For POWER8 use the soft-float implementation shared with
+ *  vec_xsaddqpo_inline(), rounding via vec_roundqp_rm().
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xsaddqpo instruction,
- *  the implementation may use that.
- *
- *  |processor|Latency|Throughput|
- *  |--------:|:-----:|:---------|
- *  |power8   | 54-71 | 1/cycle  |
- *  |power9   |   12  |1/12 cycle|
- *  |power10  | 12-13 | 2/cycle  |
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
  *  @return a scalar __binary128 value.
  */
 static inline __binary128
-vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
+vec_xsaddqp_rm_inline (__binary128 vfa, __binary128 vfb,
+		       const int rmode)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+  if (rmode == VEC_F128_RN_ODD)
+    {
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_addf128_round_to_odd (vfa, vfb);
+      // earlier GCC versions generate extra data moves for this.
+      result = __builtin_addf128_round_to_odd (vfa, vfb);
 #else
-  // No extra data moves here.
-  __asm__(
-      "xsaddqpo %0,%1,%2"
-      : "=v" (result)
-      : "v" (vfa), "v" (vfb)
-      : );
+      // No extra data moves here.
+      __asm__(
+	  "xsaddqpo %0,%1,%2"
+	  : "=v" (result)
+	  : "v" (vfa), "v" (vfb)
+	  : );
 #endif
+    }
+  else
+    {
+      // Swap rmode into FPSCR[RN] for this instruction only.
+      // mffscrn only updates the RN field, which is much
+      // cheaper than a full mtfsf (fesetround) sequence.
+      union { unsigned long long ull; double d; } rn_new;
+      double rn_old;
+
+      rn_new.ull = rmode & 3;
+      __asm__(
+	  "mffscrn %1,%4;\n"
+	  "\txsaddqp %0,%2,%3;\n"
+	  "\tmffscrn %1,%1;"
+	  : "=v" (result), "=&d" (rn_old)
+	  : "v" (vfa), "v" (vfb), "d" (rn_new.d)
+	  : );
+    }
   return result;
 #else // defined (_ARCH_PWR7)
   vui64_t q_exp, a_exp, b_exp, x_exp;
@@ -10450,7 +10632,6 @@ vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
   if (__builtin_expect (vec_cmpud_all_lt (x_exp, exp_naninf), 1))
     {
       const vui128_t xbitmask = vec_splat_u128 (1);
-      const vui128_t grx_mask = vec_splat_u128 (7);
       const vui64_t exp_min = vec_splat_u64 (1);
       const vui8_t t_sig_L = vec_splat_u8 (7);
       const vui8_t t_sig_C = vec_splat_u8 (15);
@@ -10545,7 +10726,11 @@ vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
 
       if (__builtin_expect (vec_cmpuq_all_eq (s_sig, (vui128_t) q_zero), 0))
 	{ // Special case of both zero with different sign
-	  q_sign = vec_sel (a_sign, (vui32_t) q_zero, diff_sign);
+	  // x - x is +0 except when rounding toward -Infinity
+	  vui32_t z_sign = (vui32_t) q_zero;
+	  if (rmode == VEC_F128_RN_DOWN)
+	    z_sign = vec_mask128_f128sign ();
+	  q_sign = vec_sel (a_sign, z_sign, diff_sign);
 	  return vec_xfer_vui32t_2_bin128 (q_sign);
 	}
 
@@ -10589,24 +10774,10 @@ vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
 	    s_sig = vec_seluq (s_sig, c_sig, (vb128_t) nrm_mask);
 	  }
 	}
-      // Round to odd from low order GRX-bits
-      p_tmp = (vui128_t) vec_and ((vui32_t) s_sig, (vui32_t) grx_mask);
-      p_odd = vec_addcuq (p_tmp, (vui128_t) q_ones);
+      // Round using the low order GRX-bits, left justified
+      p_tmp = vec_slqi (s_sig, 125);
       q_sig = vec_srqi (s_sig, 3);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
-      // Check for exponent overflow -> __FLT128_MAX__
-      if (__builtin_expect ((vec_cmpud_all_ge ( q_exp, exp_naninf)), 0))
-	{
-	  // return maximum finite exponent and significand
-	  // const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  const vui32_t f128_max = vec_const128_f128_fmax ();
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
-	}
-      // Merge sign, significand, and exponent into final result
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
-      result = vec_xsiexpqp (q_sig, q_exp);
-      return result;
+      return vec_roundqp_rm (q_sign, q_exp, q_sig, p_tmp, rmode);
     }
   else // One or both operands are NaN or Infinity
     {
@@ -10655,6 +10826,38 @@ vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
+/** \brief VSX Scalar Add Quad-Precision using round to Odd.
+ *
+ *  The quad-precision element of vectors vfa and vfb are added
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xsaddqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *  For POWER7 and earlier us the compilers soft-float implementation.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsaddqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 54-71 | 1/cycle  |
+ *  |power9   |   12  |1/12 cycle|
+ *  |power10  | 12-13 | 2/cycle  |
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @return a scalar __binary128 value.
+ */
+static inline __binary128
+vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xsaddqp_rm_inline (vfa, vfb, VEC_F128_RN_ODD);
+}
+
 /** \brief VSX Scalar Subtract Quad-Precision using round to Odd.
  *
  *  The quad-precision element of vector vfb is subtracted from vfa
@@ -10703,48 +10906,94 @@ vec_xsaddqpo_inline (__binary128 vfa, __binary128 vfb)
 extern __binary128
 vec_xssubqpo (__binary128 vfa, __binary128 vfb);
 
-/** \brief VSX Scalar Subtract Quad-Precision using round to Odd.
+/** \brief VSX Scalar Subtract Quad-Precision using an explicit rounding mode.
+ *
+ *  The quad-precision element of vectors vfa and vfb are subtracted
+ *  (vfa - vfb) to produce the quad-precision result.
+ *  The rounding mode is selected by rmode, one of
+ *  VEC_F128_RN_NEAREST, VEC_F128_RN_ZERO, VEC_F128_RN_UP,
+ *  VEC_F128_RN_DOWN or VEC_F128_RN_ODD. This avoids the fesetround()
+ *  calls otherwise needed around each operation, for example to
+ *  compute the lower and upper bounds of interval arithmetic.
+ *
+ *  This is the dynamic call ABI for IFUNC selection when dynamically
+ *  linked to the <I>libpvec.so</I> runtime library. The static
+ *  implementations are vec_xssubqp_rm_PWR7 (BE only), vec_xssubqp_rm_PWR8,
+ *  vec_xssubqp_rm_PWR9 and vec_xssubqp_rm_PWR10.
+ *
+ *  \note For POWER9/10 use the xssubqp instruction with mffscrn to
+ *  set and restore FPSCR<sub>RN</sub>, or xssubqpo for round to odd.
+ *  For POWER8 use the soft-float implementation from
+ *  vec_xssubqp_rm_inline().
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode.
+ *  @return a scalar __binary128 value.
+ */
+extern __binary128
+vec_xssubqp_rm (__binary128 vfa, __binary128 vfb, int rmode);
+
+/** \brief VSX Scalar Subtract Quad-Precision using an explicit rounding mode.
  *
  *  The quad-precision element of vector vfb is subtracted from vfa
  *  to produce the quad-precision result.
- *  The rounding mode is round to odd.
+ *  The rounding mode is selected by rmode instead of the
+ *  FPSCR<sub>RN</sub> field.
  *
- *  For POWER9 use the xssubqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
- *  For POWER7 and earlier us the compilers soft-float implementation.
+ *  For POWER9 use the xssubqpo instruction for round to odd. Otherwise
+ *  swap rmode into FPSCR<sub>RN</sub> with mffscrn, execute
+ *  xssubqp and restore the previous rounding mode.
+ *  For POWER8 use the soft-float implementation shared with
+ *  vec_xssubqpo_inline(), rounding via vec_roundqp_rm().
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xssubqpo instruction,
- *  the implementation may use that.
- *
- *  |processor|Latency|Throughput|
- *  |--------:|:-----:|:---------|
- *  |power8   | 51-70 | 1/cycle  |
- *  |power9   |   12  |1/12 cycle|
- *  |power10  | 12-13 | 2/cycle  |
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
  *  @return a scalar __binary128 value.
  */
 static inline __binary128
-vec_xssubqpo_inline (__binary128 vfa, __binary128 vfb)
+vec_xssubqp_rm_inline (__binary128 vfa, __binary128 vfb,
+		       const int rmode)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+  if (rmode == VEC_F128_RN_ODD)
+    {
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_subf128_round_to_odd (vfa, vfb);
+      // earlier GCC versions generate extra data moves for this.
+      result = __builtin_subf128_round_to_odd (vfa, vfb);
 #else
-  // No extra data moves here.
-  __asm__(
-      "xssubqpo %0,%1,%2"
-      : "=v" (result)
-      : "v" (vfa), "v" (vfb)
-      : );
+      // No extra data moves here.
+      __asm__(
+	  "xssubqpo %0,%1,%2"
+	  : "=v" (result)
+	  : "v" (vfa), "v" (vfb)
+	  : );
 #endif
+    }
+  else
+    {
+      // Swap rmode into FPSCR[RN] for this instruction only.
+      // mffscrn only updates the RN field, which is much
+      // cheaper than a full mtfsf (fesetround) sequence.
+      union { unsigned long long ull; double d; } rn_new;
+      double rn_old;
+
+      rn_new.ull = rmode & 3;
+      __asm__(
+	  "mffscrn %1,%4;\n"
+	  "\txssubqp %0,%2,%3;\n"
+	  "\tmffscrn %1,%1;"
+	  : "=v" (result), "=&d" (rn_old)
+	  : "v" (vfa), "v" (vfb), "d" (rn_new.d)
+	  : );
+    }
   return result;
 #else //  defined (_ARCH_PWR7)
   vui64_t q_exp, a_exp, b_exp, x_exp;
@@ -10768,7 +11017,6 @@ vec_xssubqpo_inline (__binary128 vfa, __binary128 vfb)
   if (__builtin_expect (vec_cmpud_all_lt (x_exp, exp_naninf), 1))
     {
       const vui128_t xbitmask = vec_splat_u128 (1);
-      const vui128_t grx_mask = vec_splat_u128 (7);
       const vui64_t exp_min = vec_splat_u64 (1);
       const vui8_t t_sig_L = vec_splat_u8 (7);
       const vui8_t t_sig_C = vec_splat_u8 (15);
@@ -10867,7 +11115,11 @@ vec_xssubqpo_inline (__binary128 vfa, __binary128 vfb)
 
       if (__builtin_expect (vec_cmpuq_all_eq (s_sig, (vui128_t) q_zero), 0))
 	{ // Special case of both zero with different sign
-	  q_sign = vec_sel (a_sign, (vui32_t) q_zero, diff_sign);
+	  // x - x is +0 except when rounding toward -Infinity
+	  vui32_t z_sign = (vui32_t) q_zero;
+	  if (rmode == VEC_F128_RN_DOWN)
+	    z_sign = vec_mask128_f128sign ();
+	  q_sign = vec_sel (a_sign, z_sign, diff_sign);
 	  return vec_xfer_vui32t_2_bin128 (q_sign);
 	}
 
@@ -10911,24 +11163,10 @@ vec_xssubqpo_inline (__binary128 vfa, __binary128 vfb)
 	    s_sig = vec_seluq (s_sig, c_sig, (vb128_t) nrm_mask);
 	  }
 	}
-      // Round to odd from low order GRX-bits
-      p_tmp = (vui128_t) vec_and ((vui32_t) s_sig, (vui32_t) grx_mask);
-      p_odd = vec_addcuq (p_tmp, (vui128_t) q_ones);
+      // Round using the low order GRX-bits, left justified
+      p_tmp = vec_slqi (s_sig, 125);
       q_sig = vec_srqi (s_sig, 3);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
-      // Check for exponent overflow -> __FLT128_MAX__
-      if (__builtin_expect ((vec_cmpud_all_ge ( q_exp, exp_naninf)), 0))
-	{
-	  // return maximum finite exponent and significand
-	  // const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  const vui32_t f128_max = vec_const128_f128_fmax ();
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
-	}
-      // Merge sign, significand, and exponent into final result
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
-      result = vec_xsiexpqp (q_sig, q_exp);
-      return result;
+      return vec_roundqp_rm (q_sign, q_exp, q_sig, p_tmp, rmode);
     }
   else // One or both operands are NaN or Infinity
     {
@@ -10977,6 +11215,38 @@ vec_xssubqpo_inline (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
+/** \brief VSX Scalar Subtract Quad-Precision using round to Odd.
+ *
+ *  The quad-precision element of vector vfb is subtracted from vfa
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xssubqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *  For POWER7 and earlier us the compilers soft-float implementation.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xssubqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 51-70 | 1/cycle  |
+ *  |power9   |   12  |1/12 cycle|
+ *  |power10  | 12-13 | 2/cycle  |
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @return a scalar __binary128 value.
+ */
+static inline __binary128
+vec_xssubqpo_inline (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xssubqp_rm_inline (vfa, vfb, VEC_F128_RN_ODD);
+}
+
 /** \brief VSX Scalar Convert Double-Precision to Quad-Precision format.
  *
  *  The left most double-precision element of vector f64 is converted
@@ -12315,47 +12585,94 @@ static inline vec_xscvuqqp_inline (vui128_t int128)
 extern __binary128
 vec_xsdivqpo (__binary128 vfa, __binary128 vfb);
 
-/** \brief VSX Scalar Divide Quad-Precision using round to Odd.
+/** \brief VSX Scalar Divide Quad-Precision using an explicit rounding mode.
  *
  *  The quad-precision element of vector vfa is divided by vfb
  *  to produce the quad-precision quotient result.
- *  The rounding mode is round to odd.
+ *  The rounding mode is selected by rmode, one of
+ *  VEC_F128_RN_NEAREST, VEC_F128_RN_ZERO, VEC_F128_RN_UP,
+ *  VEC_F128_RN_DOWN or VEC_F128_RN_ODD. This avoids the fesetround()
+ *  calls otherwise needed around each operation, for example to
+ *  compute the lower and upper bounds of interval arithmetic.
  *
- *  For POWER9 use the xsdivqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
+ *  This is the dynamic call ABI for IFUNC selection when dynamically
+ *  linked to the <I>libpvec.so</I> runtime library. The static
+ *  implementations are vec_xsdivqp_rm_PWR7 (BE only), vec_xsdivqp_rm_PWR8,
+ *  vec_xsdivqp_rm_PWR9 and vec_xsdivqp_rm_PWR10.
+ *
+ *  \note For POWER9/10 use the xsdivqp instruction with mffscrn to
+ *  set and restore FPSCR<sub>RN</sub>, or xsdivqpo for round to odd.
+ *  For POWER8 use the soft-float implementation from
+ *  vec_xsdivqp_rm_inline().
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode.
+ *  @return a scalar __binary128 value.
+ */
+extern __binary128
+vec_xsdivqp_rm (__binary128 vfa, __binary128 vfb, int rmode);
+
+/** \brief VSX Scalar Divide Quad-Precision using an explicit rounding mode.
+ *
+ *  The quad-precision element of vector vfa is divided by vfb
+ *  to produce the quad-precision result.
+ *  The rounding mode is selected by rmode instead of the
+ *  FPSCR<sub>RN</sub> field.
+ *
+ *  For POWER9 use the xsdivqpo instruction for round to odd. Otherwise
+ *  swap rmode into FPSCR<sub>RN</sub> with mffscrn, execute
+ *  xsdivqp and restore the previous rounding mode.
+ *  For POWER8 use the soft-float implementation shared with
+ *  vec_xsdivqpo_inline(), rounding via vec_roundqp_rm().
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xsdivqpo instruction,
- *  the implementation may use that.
- *
- *  |processor|Latency|Throughput|
- *  |--------:|:-----:|:---------|
- *  |power8   |160-240|    NA    |
- *  |power9   | 56-58 |1/45 cycle|
- *  |power10  | 57-59 |1/50 cycle|
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
  *  @return a scalar __binary128 value.
  */
 static inline __binary128
-vec_xsdivqpo_inline (__binary128 vfa, __binary128 vfb)
+vec_xsdivqp_rm_inline (__binary128 vfa, __binary128 vfb,
+		       const int rmode)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+  if (rmode == VEC_F128_RN_ODD)
+    {
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_divf128_round_to_odd (vfa, vfb);
+      // earlier GCC versions generate extra data moves for this.
+      result = __builtin_divf128_round_to_odd (vfa, vfb);
 #else
-  // No extra data moves here.
-  __asm__(
-      "xsdivqpo %0,%1,%2"
-      : "=v" (result)
-      : "v" (vfa), "v" (vfb)
-      : );
+      // No extra data moves here.
+      __asm__(
+	  "xsdivqpo %0,%1,%2"
+	  : "=v" (result)
+	  : "v" (vfa), "v" (vfb)
+	  : );
 #endif
+    }
+  else
+    {
+      // Swap rmode into FPSCR[RN] for this instruction only.
+      // mffscrn only updates the RN field, which is much
+      // cheaper than a full mtfsf (fesetround) sequence.
+      union { unsigned long long ull; double d; } rn_new;
+      double rn_old;
+
+      rn_new.ull = rmode & 3;
+      __asm__(
+	  "mffscrn %1,%4;\n"
+	  "\txsdivqp %0,%2,%3;\n"
+	  "\tmffscrn %1,%1;"
+	  : "=v" (result), "=&d" (rn_old)
+	  : "v" (vfa), "v" (vfb), "d" (rn_new.d)
+	  : );
+    }
 #elif  defined (_ARCH_PWR7)
   const vui64_t q_zero = { 0, 0 };
   const vui64_t q_ones = { -1, -1 };
@@ -12384,7 +12701,7 @@ vec_xsdivqpo_inline (__binary128 vfa, __binary128 vfb)
       const vui32_t hidden = vec_mask128_f128Lbit();
       const vi64_t exp_min = vec_splat_s64 ( 1 );
       const vui32_t q_inf = vec_mask128_f128exp ();
-      vui128_t a_sig, b_sig, p_sig_h, p_sig_l, p_odd;
+      vui128_t a_sig, b_sig, p_sig_h, p_sig_l;
       vui64_t exp_bias;
 
       if (__builtin_expect (vec_cmpud_any_eq (x_exp, exp_dnrm), 0))
@@ -12576,20 +12893,8 @@ vec_xsdivqpo_inline (__binary128 vfa, __binary128 vfb)
 	  q_sig = p_sig_h;
 	}
 
-      // Round to odd from lower product bits
-      p_odd = vec_addcuq (p_sig_l, (vui128_t) q_ones);
-      q_sig = (vui128_t)  vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
-
-      // Check for exponent overflow -> __FLT128_MAX__ (round to odd)
-      if (__builtin_expect ((vec_cmpud_all_ge (q_exp, exp_naninf)), 0))
-      {
-	  // Intermediate result is huge, unbiased exponent > 16383
-	  // so return __FLT128_MAX__ with the appropriate sign.
-	  // const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  const vui32_t f128_max = vec_const128_f128_fmax ();
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
-      }
+      // Round using the lower quotient bits
+      return vec_roundqp_rm (q_sign, q_exp, q_sig, p_sig_l, rmode);
     }
   else
     {
@@ -12652,13 +12957,41 @@ vec_xsdivqpo_inline (__binary128 vfa, __binary128 vfb)
 	    }
 	}
     }
-  // Merge sign, significand, and exponent into final result
-  q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
-  result = vec_xsiexpqp (q_sig, q_exp);
 #endif
   return result;
 }
 
+/** \brief VSX Scalar Divide Quad-Precision using round to Odd.
+ *
+ *  The quad-precision element of vector vfa is divided by vfb
+ *  to produce the quad-precision quotient result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xsdivqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsdivqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |160-240|    NA    |
+ *  |power9   | 56-58 |1/45 cycle|
+ *  |power10  | 57-59 |1/50 cycle|
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @return a scalar __binary128 value.
+ */
+static inline __binary128
+vec_xsdivqpo_inline (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xsdivqp_rm_inline (vfa, vfb, VEC_F128_RN_ODD);
+}
+
 /** \brief VSX Scalar Multiply-Add Quad-Precision using round to Odd.
  *
  *  The quad-precision element of vectors vfa * vfb + vfc
@@ -12708,50 +13041,98 @@ vec_xsdivqpo_inline (__binary128 vfa, __binary128 vfb)
 extern __binary128
 vec_xsmaddqpo (__binary128 vfa, __binary128 vfb, __binary128 vfc);
 
-/** \brief VSX Scalar Multiply-Add Quad-Precision using round to Odd.
+/** \brief VSX Scalar Multiply-Add Quad-Precision using an explicit rounding mode.
  *
  *  The quad-precision element of vectors vfa * vfb + vfc
  *  produce the quad-precision result.
- *  The rounding mode is round to odd.
+ *  The rounding mode is selected by rmode, one of
+ *  VEC_F128_RN_NEAREST, VEC_F128_RN_ZERO, VEC_F128_RN_UP,
+ *  VEC_F128_RN_DOWN or VEC_F128_RN_ODD. This avoids the fesetround()
+ *  calls otherwise needed around each operation, for example to
+ *  compute the lower and upper bounds of interval arithmetic.
  *
- *  For POWER9 use the xsmaddqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
- *  For POWER7 and earlier is the compilers soft-float implementation.
+ *  This is the dynamic call ABI for IFUNC selection when dynamically
+ *  linked to the <I>libpvec.so</I> runtime library. The static
+ *  implementations are vec_xsmaddqp_rm_PWR7 (BE only), vec_xsmaddqp_rm_PWR8,
+ *  vec_xsmaddqp_rm_PWR9 and vec_xsmaddqp_rm_PWR10.
+ *
+ *  \note For POWER9/10 use the xsmaddqp instruction with mffscrn to
+ *  set and restore FPSCR<sub>RN</sub>, or xsmaddqpo for round to odd.
+ *  For POWER8 use the soft-float implementation from
+ *  vec_xsmaddqp_rm_inline().
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param vfc 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode.
+ *  @return a scalar __binary128 value.
+ */
+extern __binary128
+vec_xsmaddqp_rm (__binary128 vfa, __binary128 vfb, __binary128 vfc, int rmode);
+
+/** \brief VSX Scalar Multiply-Add Quad-Precision using an explicit rounding mode.
+ *
+ *  The quad-precision element of vectors vfa and vfb are multiplied
+ *  and added to vfc to produce the quad-precision result.
+ *  The rounding mode is selected by rmode instead of the
+ *  FPSCR<sub>RN</sub> field.
+ *
+ *  For POWER9 use the xsmaddqpo instruction for round to odd. Otherwise
+ *  swap rmode into FPSCR<sub>RN</sub> with mffscrn, execute
+ *  xsmaddqp and restore the previous rounding mode.
+ *  For POWER8 use the soft-float implementation shared with
+ *  vec_xsmaddqpo_inline(), rounding via vec_roundqp_rm().
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xsmaddqpo instruction,
- *  the implementation may use that.
- *
- *  |processor|Latency|Throughput|
- *  |--------:|:-----:|:---------|
- *  |power8   | ~128  | 1/cycle  |
- *  |power9   |   24  |1/12 cycle|
- *  |power10  |   25  |1/18 cycle|
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
  *  @param vfc 128-bit vector treated as a scalar __binary128.
- *  @return The __binary128 result of  vfa * vfb + vfc
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
+ *  @return a scalar __binary128 value.
  */
 static inline __binary128
-vec_xsmaddqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
+vec_xsmaddqp_rm_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc,
+			const int rmode)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+  if (rmode == VEC_F128_RN_ODD)
+    {
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_fmaf128_round_to_odd (vfa, vfb, vfc);
+      // earlier GCC versions generate extra data moves for this.
+      result = __builtin_fmaf128_round_to_odd (vfa, vfb, vfc);
 #else
-  // No extra data moves here.
-  __asm__(
-      "xsmaddqpo %0,%1,%2"
-      : "+v" (vfc)
-      : "v" (vfa), "v" (vfb)
-      : );
-  result = vfc;
+      // No extra data moves here.
+      __asm__(
+	  "xsmaddqpo %0,%1,%2"
+	  : "+v" (vfc)
+	  : "v" (vfa), "v" (vfb)
+	  : );
+      result = vfc;
 #endif
+    }
+  else
+    {
+      // Swap rmode into FPSCR[RN] for this instruction only.
+      // mffscrn only updates the RN field, which is much
+      // cheaper than a full mtfsf (fesetround) sequence.
+      union { unsigned long long ull; double d; } rn_new;
+      double rn_old;
+
+      rn_new.ull = rmode & 3;
+      __asm__(
+	  "mffscrn %1,%4;\n"
+	  "\txsmaddqp %0,%2,%3;\n"
+	  "\tmffscrn %1,%1;"
+	  : "+v" (vfc), "=&d" (rn_old)
+	  : "v" (vfa), "v" (vfb), "d" (rn_new.d)
+	  : );
+      result = vfc;
+    }
   return result;
 #else  //_ARCH_PWR8 or _ARCH_PWR7
   const vui32_t q_zero = CONST_VINT128_W (0, 0, 0, 0);
@@ -12866,7 +13247,10 @@ vec_xsmaddqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
 		{ // Special case of both zero with different sign
 		  vui32_t diff_sign = vec_xor (q_sign, c_sign);
 		  diff_sign = (vui32_t) vec_setb_sq ((vi128_t) diff_sign);
-		  q_sign = vec_sel (q_sign, (vui32_t) q_zero, diff_sign);
+		  vui32_t z_sign = (vui32_t) q_zero;
+		  if (rmode == VEC_F128_RN_DOWN)
+		    z_sign = vec_mask128_f128sign ();
+		  q_sign = vec_sel (q_sign, z_sign, diff_sign);
 		  result = vec_xfer_vui32t_2_bin128 (q_sign);
 		}
 	  else
@@ -12963,7 +13347,10 @@ vec_xsmaddqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
 		{
 		  if (vec_cmpuq_all_eq (p_sig_l, (vui128_t) q_zero))
 		    { // Special case of both zero with different sign
-		      q_sign = vec_sel (q_sign, (vui32_t) q_zero, diff_sign);
+		      vui32_t z_sign = (vui32_t) q_zero;
+		      if (rmode == VEC_F128_RN_DOWN)
+			z_sign = vec_mask128_f128sign ();
+		      q_sign = vec_sel (q_sign, z_sign, diff_sign);
 		      //q_sign = vec_xor (q_sign, c_sign);
 		      return vec_xfer_vui32t_2_bin128 (q_sign);
 		    }
@@ -13262,33 +13649,8 @@ vec_xsmaddqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
 	    }
 	}
 
-      // Round to odd from lower product bits
-      p_odd = vec_addcuq (p_sig_l, (vui128_t) q_ones);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
-
-      // Check for exponent overflow -> __FLT128_MAX__ (round to odd)
-      if (__builtin_expect ((vec_cmpud_all_ge ( q_exp, exp_naninf)), 0))
-	{
-	  // Intermediate result is huge, unbiased exponent > 16383
-	  // so return __FLT128_MAX__ with the appropriate sign.
-	  // const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  const vui32_t f128_max = vec_const128_f128_fmax ();
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
-	}
-      else // combine sign, exp, and significand for return
-	{
-	  // Merge sign, significand, and exponent into final result
-	  q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
-	  vui32_t tmp, t128;
-	  // convert DW exp_naninf to QW expmask
-	  vui32_t expmask = vec_sld ((vui32_t) exp_naninf, q_zero, 14);
-	  // convert q_exp from DW to QW for QP format
-	  tmp = vec_sld ((vui32_t) q_exp, q_zero, 14);
-	  t128 = vec_sel ((vui32_t) q_sig, tmp, expmask);
-	  result = vec_xfer_vui32t_2_bin128 (t128);
-	  return result;
-	}
+      // Round using the lower product bits
+      return vec_roundqp_rm (q_sign, q_exp, q_sig, p_sig_l, rmode);
     }
   else
     { // One, two, or three operands are NaN or Infinity
@@ -13393,6 +13755,39 @@ vec_xsmaddqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
   return result;
 }
 
+/** \brief VSX Scalar Multiply-Add Quad-Precision using round to Odd.
+ *
+ *  The quad-precision element of vectors vfa * vfb + vfc
+ *  produce the quad-precision result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xsmaddqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *  For POWER7 and earlier is the compilers soft-float implementation.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsmaddqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | ~128  | 1/cycle  |
+ *  |power9   |   24  |1/12 cycle|
+ *  |power10  |   25  |1/18 cycle|
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param vfc 128-bit vector treated as a scalar __binary128.
+ *  @return The __binary128 result of  vfa * vfb + vfc
+ */
+static inline __binary128
+vec_xsmaddqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
+{
+  return vec_xsmaddqp_rm_inline (vfa, vfb, vfc, VEC_F128_RN_ODD);
+}
+
 /** \brief VSX Scalar Multiply-Sub Quad-Precision using round to Odd.
  *
  *  The quad-precision element of vectors vfa * vfb - vfc
@@ -13495,6 +13890,94 @@ vec_xsmsubqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
 #endif
 }
 
+/** \brief VSX Scalar Multiply-Sub Quad-Precision using an explicit rounding mode.
+ *
+ *  The quad-precision element of vectors vfa * vfb - vfc
+ *  produce the quad-precision result.
+ *  The rounding mode is selected by rmode, one of
+ *  VEC_F128_RN_NEAREST, VEC_F128_RN_ZERO, VEC_F128_RN_UP,
+ *  VEC_F128_RN_DOWN or VEC_F128_RN_ODD. This avoids the fesetround()
+ *  calls otherwise needed around each operation, for example to
+ *  compute the lower and upper bounds of interval arithmetic.
+ *
+ *  This is the dynamic call ABI for IFUNC selection when dynamically
+ *  linked to the <I>libpvec.so</I> runtime library. The static
+ *  implementations are vec_xsmsubqp_rm_PWR7 (BE only), vec_xsmsubqp_rm_PWR8,
+ *  vec_xsmsubqp_rm_PWR9 and vec_xsmsubqp_rm_PWR10.
+ *
+ *  \note For POWER9/10 use the xsmsubqp instruction with mffscrn to
+ *  set and restore FPSCR<sub>RN</sub>, or xsmsubqpo for round to odd.
+ *  For POWER8 use the soft-float implementation from
+ *  vec_xsmsubqp_rm_inline().
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param vfc 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode.
+ *  @return a scalar __binary128 value.
+ */
+extern __binary128
+vec_xsmsubqp_rm (__binary128 vfa, __binary128 vfb, __binary128 vfc, int rmode);
+
+/** \brief VSX Scalar Multiply-Sub Quad-Precision using an explicit
+ *  rounding mode.
+ *
+ *  The quad-precision element of vectors vfa * vfb - vfc
+ *  produce the quad-precision result.
+ *  The rounding mode is selected by rmode instead of the
+ *  FPSCR<sub>RN</sub> field.
+ *
+ *  For POWER9 use the xsmsubqpo instruction for round to odd. Otherwise
+ *  swap rmode into FPSCR<sub>RN</sub> with mffscrn, execute
+ *  xsmsubqp and restore the previous rounding mode.
+ *  For POWER8 negate vfc (unless NaN) and use
+ *  vec_xsmaddqp_rm_inline().
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param vfc 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
+ *  @return The __binary128 result of  vfa * vfb - vfc
+ */
+static inline __binary128
+vec_xsmsubqp_rm_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc,
+			const int rmode)
+{
+#if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+  __binary128 result;
+
+  if (rmode == VEC_F128_RN_ODD)
+    return vec_xsmsubqpo_inline (vfa, vfb, vfc);
+  else
+    {
+      // Swap rmode into FPSCR[RN] for this instruction only.
+      union { unsigned long long ull; double d; } rn_new;
+      double rn_old;
+
+      rn_new.ull = rmode & 3;
+      __asm__(
+	  "mffscrn %1,%4;\n"
+	  "\txsmsubqp %0,%2,%3;\n"
+	  "\tmffscrn %1,%1;"
+	  : "+v" (vfc), "=&d" (rn_old)
+	  : "v" (vfa), "v" (vfb), "d" (rn_new.d)
+	  : );
+      result = vfc;
+    }
+  return result;
+#else
+  __binary128 nsrc3;
+
+  nsrc3 = vec_self128 (vec_negf128 (vfc), vfc, vec_isnanf128(vfc));
+  return vec_xsmaddqp_rm_inline (vfa, vfb, nsrc3, rmode);
+#endif
+}
+
 /** \brief VSX Scalar Multiply Quad-Precision using round to Odd.
  *
  *  The quad-precision element of vectors vfa and vfb are multiplied
@@ -13543,48 +14026,94 @@ vec_xsmsubqpo_inline (__binary128 vfa, __binary128 vfb, __binary128 vfc)
 extern __binary128
 vec_xsmulqpo (__binary128 vfa, __binary128 vfb);
 
-/** \brief VSX Scalar Multiply Quad-Precision using round to Odd.
+/** \brief VSX Scalar Multiply Quad-Precision using an explicit rounding mode.
  *
  *  The quad-precision element of vectors vfa and vfb are multiplied
  *  to produce the quad-precision result.
- *  The rounding mode is round to odd.
+ *  The rounding mode is selected by rmode, one of
+ *  VEC_F128_RN_NEAREST, VEC_F128_RN_ZERO, VEC_F128_RN_UP,
+ *  VEC_F128_RN_DOWN or VEC_F128_RN_ODD. This avoids the fesetround()
+ *  calls otherwise needed around each operation, for example to
+ *  compute the lower and upper bounds of interval arithmetic.
  *
- *  For POWER9 use the xsmulqpo instruction.
- *  For POWER8 use this soft-float implementation using
- *  vector instruction generated by PVECLIB operations.
- *  For POWER7 and earlier is the compilers soft-float implementation.
+ *  This is the dynamic call ABI for IFUNC selection when dynamically
+ *  linked to the <I>libpvec.so</I> runtime library. The static
+ *  implementations are vec_xsmulqp_rm_PWR7 (BE only), vec_xsmulqp_rm_PWR8,
+ *  vec_xsmulqp_rm_PWR9 and vec_xsmulqp_rm_PWR10.
+ *
+ *  \note For POWER9/10 use the xsmulqp instruction with mffscrn to
+ *  set and restore FPSCR<sub>RN</sub>, or xsmulqpo for round to odd.
+ *  For POWER8 use the soft-float implementation from
+ *  vec_xsmulqp_rm_inline().
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode.
+ *  @return a scalar __binary128 value.
+ */
+extern __binary128
+vec_xsmulqp_rm (__binary128 vfa, __binary128 vfb, int rmode);
+
+/** \brief VSX Scalar Multiply Quad-Precision using an explicit rounding mode.
+ *
+ *  The quad-precision element of vectors vfa and vfb are multiplied
+ *  to produce the quad-precision result.
+ *  The rounding mode is selected by rmode instead of the
+ *  FPSCR<sub>RN</sub> field.
+ *
+ *  For POWER9 use the xsmulqpo instruction for round to odd. Otherwise
+ *  swap rmode into FPSCR<sub>RN</sub> with mffscrn, execute
+ *  xsmulqp and restore the previous rounding mode.
+ *  For POWER8 use the soft-float implementation shared with
+ *  vec_xsmulqpo_inline(), rounding via vec_roundqp_rm().
  *
  *  \note This operation <I>may not</I> follow the PowerISA
  *  relative to setting the FPSCR.
- *  However if the hardware target includes the xsmulqpo instruction,
- *  the implementation may use that.
- *
- *  |processor|Latency|Throughput|
- *  |--------:|:-----:|:---------|
- *  |power8   | 78-84 | 1/cycle  |
- *  |power9   |   24  |1/12 cycle|
- *  |power10  |   25  |1/18 cycle|
  *
  *  @param vfa 128-bit vector treated as a scalar __binary128.
  *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @param rmode rounding mode, one of VEC_F128_RN_NEAREST,
+ *  VEC_F128_RN_ZERO, VEC_F128_RN_UP, VEC_F128_RN_DOWN or
+ *  VEC_F128_RN_ODD.
  *  @return a scalar __binary128 value.
  */
 static inline __binary128
-vec_xsmulqpo_inline (__binary128 vfa, __binary128 vfb)
+vec_xsmulqp_rm_inline (__binary128 vfa, __binary128 vfb,
+		       const int rmode)
 {
   __binary128 result;
 #if defined (_ARCH_PWR9) && (__GNUC__ > 7)
+  if (rmode == VEC_F128_RN_ODD)
+    {
 #if defined (__FLOAT128__) && (__GNUC__ > 8)
-  // earlier GCC versions generate extra data moves for this.
-  result = __builtin_mulf128_round_to_odd (vfa, vfb);
+      // earlier GCC versions generate extra data moves for this.
+      result = __builtin_mulf128_round_to_odd (vfa, vfb);
 #else
-  // No extra data moves here.
-  __asm__(
-      "xsmulqpo %0,%1,%2"
-      : "=v" (result)
-      : "v" (vfa), "v" (vfb)
-      : );
+      // No extra data moves here.
+      __asm__(
+	  "xsmulqpo %0,%1,%2"
+	  : "=v" (result)
+	  : "v" (vfa), "v" (vfb)
+	  : );
 #endif
+    }
+  else
+    {
+      // Swap rmode into FPSCR[RN] for this instruction only.
+      // mffscrn only updates the RN field, which is much
+      // cheaper than a full mtfsf (fesetround) sequence.
+      union { unsigned long long ull; double d; } rn_new;
+      double rn_old;
+
+      rn_new.ull = rmode & 3;
+      __asm__(
+	  "mffscrn %1,%4;\n"
+	  "\txsmulqp %0,%2,%3;\n"
+	  "\tmffscrn %1,%1;"
+	  : "=v" (result), "=&d" (rn_old)
+	  : "v" (vfa), "v" (vfb), "d" (rn_new.d)
+	  : );
+    }
   return result;
 #else  //_ARCH_PWR8 or _ARCH_PWR7
   const vui32_t q_zero = CONST_VINT128_W(0, 0, 0, 0);
@@ -13592,7 +14121,7 @@ vec_xsmulqpo_inline (__binary128 vfa, __binary128 vfb)
   const vui64_t exp_naninf = vec_mask64_f128exp ();
   const vui32_t magmask = vec_mask128_f128mag ();
   vui64_t q_exp, x_exp;
-  vui128_t q_sig, a_sig, b_sig, p_sig_h, p_sig_l, p_odd;
+  vui128_t q_sig, a_sig, b_sig, p_sig_h, p_sig_l;
   vui32_t q_sign, a_sign, b_sign;
   vui128_t a_mag, b_mag;
 
@@ -13796,33 +14325,8 @@ vec_xsmulqpo_inline (__binary128 vfa, __binary128 vfb)
 	    }
 	}
 
-      // Round to odd from lower product bits
-      p_odd = vec_addcuq (p_sig_l, (vui128_t) q_ones);
-      q_sig = (vui128_t) vec_or ((vui32_t) q_sig, (vui32_t) p_odd);
-
-      // Check for exponent overflow -> __FLT128_MAX__ (round to odd)
-      if (__builtin_expect ((vec_cmpud_all_ge (q_exp, exp_naninf)), 0))
-	{
-	  // Intermediate result is huge, unbiased exponent > 16383
-	  // so return __FLT128_MAX__ with the appropriate sign.
-	  // const vui32_t f128_max = CONST_VINT128_W(0x7ffeffff, -1, -1, -1);
-	  const vui32_t f128_max = vec_const128_f128_fmax ();
-	  vui32_t f128_smax = vec_or ((vui32_t) f128_max, q_sign);
-	  return vec_xfer_vui32t_2_bin128 (f128_smax);
-	}
-      else // combine sign, exp, and significand for return
-	{
-	  // Merge sign, significand, and exponent into final result
-	  q_sig = (vui128_t) vec_or ((vui32_t) q_sig, q_sign);
-	  vui32_t tmp, t128;
-	  // convert DW exp_naninf to QW expmask
-	  vui32_t expmask = vec_sld ((vui32_t) exp_naninf, q_zero, 14);
-	  // convert q_exp from DW to QW for QP format
-	  tmp = vec_sld ((vui32_t) q_exp, q_zero, 14);
-	  t128 = vec_sel ((vui32_t) q_sig, tmp, expmask);
-	  result = vec_xfer_vui32t_2_bin128 (t128);
-	  return result;
-	}
+      // Round using the lower product bits
+      return vec_roundqp_rm (q_sign, q_exp, q_sig, p_sig_l, rmode);
     }
   else
     { // One or both operands are NaN or Infinity
@@ -13873,6 +14377,38 @@ vec_xsmulqpo_inline (__binary128 vfa, __binary128 vfb)
   return result;
 }
 
+/** \brief VSX Scalar Multiply Quad-Precision using round to Odd.
+ *
+ *  The quad-precision element of vectors vfa and vfb are multiplied
+ *  to produce the quad-precision result.
+ *  The rounding mode is round to odd.
+ *
+ *  For POWER9 use the xsmulqpo instruction.
+ *  For POWER8 use this soft-float implementation using
+ *  vector instruction generated by PVECLIB operations.
+ *  For POWER7 and earlier is the compilers soft-float implementation.
+ *
+ *  \note This operation <I>may not</I> follow the PowerISA
+ *  relative to setting the FPSCR.
+ *  However if the hardware target includes the xsmulqpo instruction,
+ *  the implementation may use that.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 78-84 | 1/cycle  |
+ *  |power9   |   24  |1/12 cycle|
+ *  |power10  |   25  |1/18 cycle|
+ *
+ *  @param vfa 128-bit vector treated as a scalar __binary128.
+ *  @param vfb 128-bit vector treated as a scalar __binary128.
+ *  @return a scalar __binary128 value.
+ */
+static inline __binary128
+vec_xsmulqpo_inline (__binary128 vfa, __binary128 vfb)
+{
+  return vec_xsmulqp_rm_inline (vfa, vfb, VEC_F128_RN_ODD);
+}
+
 /** \brief Scalar Insert Exponent Quad-Precision
  *
  *  Merge the sign (bit 0) and significand (bits 16:127) from sig
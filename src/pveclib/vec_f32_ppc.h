@@ -2285,4 +2285,457 @@ vec_xvxsigsp (vf32_t vrb)
   return result;
 }
 
+
+/** \brief Vector exp of an array of floats, u10 tier.
+ *
+ *  out[i] is e<SUP>x</SUP>, where x is in[i], with an error of less than 1
+ *  ULP. Overflow returns +Inf, underflow returns +0.0 or a subnormal
+ *  rounded once. exp(&plusmn;0.0) is 1.0, exp(-Inf) is +0.0. Each element
+ *  is computed with the double u35 kernel and rounded to float.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_exp_f32_u10_PWR7,
+ *  vec_exp_f32_u10_PWR8, vec_exp_f32_u10_PWR9,
+ *  and vec_exp_f32_u10_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_exp_f32_u10 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector exp of an array of floats, u35 tier.
+ *
+ *  out[i] is e<SUP>x</SUP>, where x is in[i], with an error of less than
+ *  3.5 ULP. Special values are as for vec_exp_f32_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_exp_f32_u35_PWR7,
+ *  vec_exp_f32_u35_PWR8, vec_exp_f32_u35_PWR9,
+ *  and vec_exp_f32_u35_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_exp_f32_u35 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector log of an array of floats, u10 tier.
+ *
+ *  out[i] is the natural logarithm of x, where x is in[i], with an error of
+ *  less than 1 ULP. log(&plusmn;0.0) is -Inf, log(x < 0.0) is NaN, log(1.0)
+ *  is +0.0 and log(+Inf) is +Inf. Subnormal x are handled in full. Each
+ *  element is computed with the double u35 kernel and rounded to float.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_log_f32_u10_PWR7,
+ *  vec_log_f32_u10_PWR8, vec_log_f32_u10_PWR9,
+ *  and vec_log_f32_u10_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_log_f32_u10 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector log of an array of floats, u35 tier.
+ *
+ *  out[i] is the natural logarithm of x, where x is in[i], with an error of
+ *  less than 3.5 ULP. Special values are as for vec_log_f32_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_log_f32_u35_PWR7,
+ *  vec_log_f32_u35_PWR8, vec_log_f32_u35_PWR9,
+ *  and vec_log_f32_u35_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_log_f32_u35 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector power of arrays of floats, u10 tier.
+ *
+ *  out[i] = x[i]<SUP>y[i]</SUP> with an error of less than 1 ULP, computed
+ *  as exp(y log|x|) with double-double log and exp kernels. Special values
+ *  follow C99 Annex F: pow(x, &plusmn;0.0) and pow(1.0, y) are 1.0 even for
+ *  NaN, negative x with non-integer y is NaN, negative x with odd integer y
+ *  gives a negative result, and pow(&plusmn;0.0, y < 0) is &plusmn;Inf.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_pow_f32_u10_PWR7,
+ *  vec_pow_f32_u10_PWR8, vec_pow_f32_u10_PWR9,
+ *  and vec_pow_f32_u10_PWR10.
+ *
+ *  @param out array of n floats.
+ *  @param x array of n bases.
+ *  @param y array of n exponents.
+ *  @param n number of elements.
+ */
+extern void
+vec_pow_f32_u10 (float *out, const float *x, const float *y,
+		 unsigned long n);
+
+/** \brief Vector power of arrays of floats, u35 tier.
+ *
+ *  Same as vec_pow_f32_u10(). The u10 kernel is already within this tier
+ *  and fast enough that a less accurate variant does not pay for itself, so
+ *  both names share it.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_pow_f32_u35_PWR7,
+ *  vec_pow_f32_u35_PWR8, vec_pow_f32_u35_PWR9,
+ *  and vec_pow_f32_u35_PWR10.
+ *
+ *  @param out array of n floats.
+ *  @param x array of n bases.
+ *  @param y array of n exponents.
+ *  @param n number of elements.
+ */
+extern void
+vec_pow_f32_u35 (float *out, const float *x, const float *y,
+		 unsigned long n);
+
+/** \brief Vector sin of an array of floats, u10 tier.
+ *
+ *  out[i] is sin(x), where x is in[i], with an error of less than 1 ULP.
+ *  The argument is reduced modulo pi/2 with a 3 part pi/2 for |x| <=
+ *  2<SUP>20</SUP> and with a 1280-bit 2/pi (Payne-Hanek) above, so the
+ *  bound holds for all finite x. sin(-0.0) is -0.0, sin(&plusmn;Inf) is
+ *  NaN. Each element is computed with the double u35 kernel and rounded to
+ *  float.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sin_f32_u10_PWR7,
+ *  vec_sin_f32_u10_PWR8, vec_sin_f32_u10_PWR9,
+ *  and vec_sin_f32_u10_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_sin_f32_u10 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector sin of an array of floats, u35 tier.
+ *
+ *  out[i] is sin(x), where x is in[i], with an error of less than 3.5 ULP.
+ *  Special values are as for vec_sin_f32_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sin_f32_u35_PWR7,
+ *  vec_sin_f32_u35_PWR8, vec_sin_f32_u35_PWR9,
+ *  and vec_sin_f32_u35_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_sin_f32_u35 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector cos of an array of floats, u10 tier.
+ *
+ *  out[i] is cos(x), where x is in[i], with an error of less than 1 ULP.
+ *  Argument reduction is as for the sin functions, so the bound holds for
+ *  all finite x. cos(&plusmn;Inf) is NaN. Each element is computed with the
+ *  double u35 kernel and rounded to float.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_cos_f32_u10_PWR7,
+ *  vec_cos_f32_u10_PWR8, vec_cos_f32_u10_PWR9,
+ *  and vec_cos_f32_u10_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_cos_f32_u10 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector cos of an array of floats, u35 tier.
+ *
+ *  out[i] is cos(x), where x is in[i], with an error of less than 3.5 ULP.
+ *  Special values are as for vec_cos_f32_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_cos_f32_u35_PWR7,
+ *  vec_cos_f32_u35_PWR8, vec_cos_f32_u35_PWR9,
+ *  and vec_cos_f32_u35_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_cos_f32_u35 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector tanh of an array of floats, u10 tier.
+ *
+ *  out[i] is the hyperbolic tangent of x, where x is in[i], with an error
+ *  of less than 1 ULP. Computed from e<SUP>2|x|</SUP> - 1 and
+ *  e<SUP>2|x|</SUP> + 1 for small and medium |x|, and saturates to
+ *  &plusmn;1.0 for large |x|. The sign of x (including -0.0) is kept. Each
+ *  element is computed with the double u35 kernel and rounded to float.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_tanh_f32_u10_PWR7,
+ *  vec_tanh_f32_u10_PWR8, vec_tanh_f32_u10_PWR9,
+ *  and vec_tanh_f32_u10_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_tanh_f32_u10 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector tanh of an array of floats, u35 tier.
+ *
+ *  out[i] is the hyperbolic tangent of x, where x is in[i], with an error
+ *  of less than 3.5 ULP. Special values are as for vec_tanh_f32_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_tanh_f32_u35_PWR7,
+ *  vec_tanh_f32_u35_PWR8, vec_tanh_f32_u35_PWR9,
+ *  and vec_tanh_f32_u35_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_tanh_f32_u35 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector sigmoid of an array of floats, u10 tier.
+ *
+ *  out[i] is the logistic function 1 / (1 + e<SUP>-x</SUP>), where x is
+ *  in[i], with an error of less than 1 ULP. sigmoid(+Inf) is 1.0 and
+ *  sigmoid(-Inf) is +0.0. For large negative x the result is e<SUP>x</SUP>,
+ *  so it underflows gradually. Each element is computed with the double u35
+ *  kernel and rounded to float.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sigmoid_f32_u10_PWR7,
+ *  vec_sigmoid_f32_u10_PWR8, vec_sigmoid_f32_u10_PWR9,
+ *  and vec_sigmoid_f32_u10_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_sigmoid_f32_u10 (float *out, const float *in, unsigned long n);
+
+/** \brief Vector sigmoid of an array of floats, u35 tier.
+ *
+ *  out[i] is the logistic function 1 / (1 + e<SUP>-x</SUP>), where x is
+ *  in[i], with an error of less than 3.5 ULP. Special values are as for
+ *  vec_sigmoid_f32_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sigmoid_f32_u35_PWR7,
+ *  vec_sigmoid_f32_u35_PWR8, vec_sigmoid_f32_u35_PWR9,
+ *  and vec_sigmoid_f32_u35_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_sigmoid_f32_u35 (float *out, const float *in, unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_cos_f32_u10) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_cos_f32_u35) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_exp_f32_u10) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_exp_f32_u35) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_log_f32_u10) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_log_f32_u35) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_pow_f32_u10) (float *out, const float *x,
+				const float *y, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_pow_f32_u35) (float *out, const float *x,
+				const float *y, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sigmoid_f32_u10) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sigmoid_f32_u35) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sin_f32_u10) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sin_f32_u35) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_tanh_f32_u10) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_tanh_f32_u35) (float *out, const float *in,
+				unsigned long n);
+///@endcond
+
+/** \brief Split an array of floats into mantissa and exponent.
+ *
+ *  For each element, mant[i] in [0.5, 1.0) (with the sign of in[i]) and
+ *  exp[i] satisfy in[i] = mant[i] 2<SUP>exp[i]</SUP>, as the C frexpf
+ *  function. Subnormal inputs are normalized. Zero, infinity and NaN are
+ *  returned unchanged with an exponent of 0.
+ *
+ *  The exponent is extracted with vec_xvxexpsp() and the mantissa built
+ *  with vec_xviexpsp(), so there is no per element branch or libm call.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_frexp_f32_PWR7,
+ *  vec_frexp_f32_PWR8, vec_frexp_f32_PWR9,
+ *  and vec_frexp_f32_PWR10.
+ *
+ *  @param mant array of n floats, may be the same as in.
+ *  @param exp array of n ints.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_frexp_f32 (float *mant, int *exp, const float *in,
+	       unsigned long n);
+
+/** \brief Scale an array of floats by powers of 2 from an array of exponents.
+ *
+ *  out[i] = in[i] 2<SUP>exp[i]</SUP>, as the C ldexpf function, for any int
+ *  exponent. The result is rounded once, so subnormal results are correctly
+ *  rounded, and overflows to infinity with the sign of in[i].
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_ldexp_f32_PWR7,
+ *  vec_ldexp_f32_PWR8, vec_ldexp_f32_PWR9,
+ *  and vec_ldexp_f32_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param exp array of n ints.
+ *  @param n number of elements.
+ */
+extern void
+vec_ldexp_f32 (float *out, const float *in, const int *exp,
+	       unsigned long n);
+
+/** \brief Scale an array of floats by the same power of 2.
+ *
+ *  out[i] = in[i] 2<SUP>exp</SUP>, as the C scalbnf function. Same as
+ *  vec_ldexp_f32() with every exponent equal to exp, which is the common
+ *  case for normalizing a column by a single scale factor.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_scalbn_f32_PWR7,
+ *  vec_scalbn_f32_PWR8, vec_scalbn_f32_PWR9,
+ *  and vec_scalbn_f32_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param exp power of 2 to scale by.
+ *  @param n number of elements.
+ */
+extern void
+vec_scalbn_f32 (float *out, const float *in, int exp,
+		unsigned long n);
+
+/** \brief Unbiased exponents of an array of floats as int.
+ *
+ *  out[i] is the exponent of in[i] as the C ilogbf function, the floor of
+ *  log2 |in[i]|. Subnormal inputs return their true exponent, down to -149.
+ *  Zero returns FP_ILOGB0, infinity INT_MAX and NaN FP_ILOGBNAN, with the
+ *  values from <math.h>.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_ilogb_f32_PWR7,
+ *  vec_ilogb_f32_PWR8, vec_ilogb_f32_PWR9,
+ *  and vec_ilogb_f32_PWR10.
+ *
+ *  @param out array of n ints.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_ilogb_f32 (int *out, const float *in, unsigned long n);
+
+/** \brief Unbiased exponents of an array of floats as float.
+ *
+ *  out[i] is the exponent of in[i] as a float, as the C logbf function.
+ *  logb(&plusmn;0.0) is -Inf, logb(&plusmn;Inf) is +Inf and NaN returns
+ *  NaN.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_logb_f32_PWR7,
+ *  vec_logb_f32_PWR8, vec_logb_f32_PWR9,
+ *  and vec_logb_f32_PWR10.
+ *
+ *  @param out array of n floats, may be the same as in.
+ *  @param in array of n floats.
+ *  @param n number of elements.
+ */
+extern void
+vec_logb_f32 (float *out, const float *in, unsigned long n);
+
+/** \brief Next representable floats toward an array of directions.
+ *
+ *  out[i] is the float adjacent to x[i] in the direction of y[i], as the C
+ *  nextafterf function. If x[i] equals y[i] the result is y[i]; if either
+ *  is NaN the result is NaN. Stepping from zero gives
+ *  &plusmn;2<SUP>-149</SUP>, stepping past the largest finite value gives
+ *  infinity.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_nextafter_f32_PWR7,
+ *  vec_nextafter_f32_PWR8, vec_nextafter_f32_PWR9,
+ *  and vec_nextafter_f32_PWR10.
+ *
+ *  @param out array of n floats.
+ *  @param x array of n starting values.
+ *  @param y array of n directions.
+ *  @param n number of elements.
+ */
+extern void
+vec_nextafter_f32 (float *out, const float *x, const float *y,
+		   unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_frexp_f32) (float *mant, int *exp,
+				const float *in, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_ilogb_f32) (int *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_ldexp_f32) (float *out, const float *in,
+				const int *exp, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_logb_f32) (float *out, const float *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_nextafter_f32) (float *out, const float *x,
+				    const float *y, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_scalbn_f32) (float *out, const float *in,
+				 int exp, unsigned long n);
+///@endcond
+
 #endif /* VEC_F32_PPC_H_ */
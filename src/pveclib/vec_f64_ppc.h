@@ -466,6 +466,63 @@ vec_absf64 (vf64_t vf64x)
 #endif
 }
 
+/** \brief Vector double-double add.
+ *
+ *  Each lane of (ah, al) and (bh, bl) is a double-double (IBM long
+ *  double) value, the unevaluated sum of a high double and a low
+ *  double whose magnitude is at most half an ULP of the high double.
+ *  Add them with an error of about 2 ULP of the 106-bit result
+ *  (2<SUP>-104</SUP> relative). This is the accurate (IEEE style)
+ *  double-double add, with the high and low parts each summed by
+ *  two-sum, so cancellation in the high part is handled.
+ *
+ *  If the double sum of the high parts is Inf or NaN, the result is
+ *  that sum with a low part of +0.0. If both the sum of the high
+ *  parts and the final sum are zero, the result is the sum of the
+ *  high parts, so -0.0 + -0.0 keeps its sign.
+ *
+ *  \note Two lanes (two IBM long double values) per pair of vectors.
+ *  Use vec_mergeh and vec_mergel to transpose the {high, low} vector
+ *  pairs loaded from long double arrays into high and low vectors.
+ *
+ *  @param rl pointer to the low doubles of the result.
+ *  @param ah vector double high parts of a.
+ *  @param al vector double low parts of a.
+ *  @param bh vector double high parts of b.
+ *  @param bl vector double low parts of b.
+ *  @return vector double high parts of the sum.
+ */
+static inline vf64_t
+vec_adddd (vf64_t *rl, vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl)
+{
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t s, e, t, f, v, z;
+  vb64_t ok;
+
+  /* Two-sum of the high parts and of the low parts.  */
+  z = vec_add (ah, bh);
+  v = vec_sub (z, ah);
+  e = vec_add (vec_sub (ah, vec_sub (z, v)), vec_sub (bh, v));
+  t = vec_add (al, bl);
+  v = vec_sub (t, al);
+  f = vec_add (vec_sub (al, vec_sub (t, v)), vec_sub (bl, v));
+  /* Renormalize twice with fast two-sum.  */
+  e = vec_add (e, t);
+  s = vec_add (z, e);
+  e = vec_sub (e, vec_sub (s, z));
+  e = vec_add (e, f);
+  t = vec_add (s, e);
+  e = vec_sub (e, vec_sub (t, s));
+  /* The renormalization loses the sign of a zero sum. Keep z where
+   * it and t are both zero.  */
+  ok = vec_and (vec_cmplt (vec_abs (z), inf),
+		vec_or (vec_cmpgt (vec_abs (z), zero),
+			vec_cmpgt (vec_abs (t), zero)));
+  *rl = vec_sel (zero, e, ok);
+  return vec_sel (z, t, ok);
+}
+
 /** \brief Return true if all 2x64-bit vector double values are Finite
  *  (Not NaN nor Inf).
  *
@@ -1071,6 +1128,53 @@ vec_copysignf64 (vf64_t vf64x, vf64_t vf64y)
 #endif
 }
 
+/** \brief Vector double-double divide.
+ *
+ *  Each lane of (ah, al) and (bh, bl) is a double-double (IBM long
+ *  double) value. Divide a by b with an error of a few ULP of the
+ *  106-bit result. The first quotient q1 = ah / bh is corrected by
+ *  (a - q1 b) / bh, where the product q1 b is formed with FMA.
+ *
+ *  If ah / bh is Inf, NaN or zero, or bh is Inf or NaN, the result
+ *  is ah / bh with a low part of +0.0. So a zero quotient keeps its
+ *  sign.
+ *
+ *  @param rl pointer to the low doubles of the quotient.
+ *  @param ah vector double high parts of the dividend.
+ *  @param al vector double low parts of the dividend.
+ *  @param bh vector double high parts of the divisor.
+ *  @param bl vector double low parts of the divisor.
+ *  @return vector double high parts of the quotient.
+ */
+static inline vf64_t
+vec_divdd (vf64_t *rl, vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl)
+{
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t q1, q2, p, pe, s, e, v;
+  vb64_t ok;
+
+  q1 = vec_div (ah, bh);
+  /* q1 b = p + pe to about 2^-106 relative.  */
+  p = vec_mul (q1, bh);
+  pe = vec_msub (q1, bh, p);
+  pe = vec_madd (q1, bl, pe);
+  /* a - q1 b. ah - p is exact except when q1 is far off.  */
+  s = vec_sub (ah, p);
+  v = vec_sub (s, ah);
+  e = vec_sub (vec_sub (ah, vec_sub (s, v)), vec_add (p, v));
+  e = vec_add (vec_sub (e, pe), al);
+  q2 = vec_div (vec_add (s, e), bh);
+  /* Fast two-sum of q1 and q2.  */
+  s = vec_add (q1, q2);
+  e = vec_sub (q2, vec_sub (s, q1));
+  ok = vec_and (vec_cmplt (vec_abs (q1), inf),
+		vec_cmplt (vec_abs (bh), inf));
+  ok = vec_and (ok, vec_cmpgt (vec_abs (q1), zero));
+  *rl = vec_sel (zero, e, ok);
+  return vec_sel (q1, s, ok);
+}
+
 /** \brief Return 2x64-bit vector boolean true values for each double
  *  element that is Finite (Not NaN nor Inf).
  *
@@ -1353,6 +1457,75 @@ vec_iszerof64 (vf64_t vf64)
   return (result);
 }
 
+/** \brief Vector double-double multiply-add.
+ *
+ *  Each lane of (ah, al), (bh, bl) and (ch, cl) is a double-double
+ *  (IBM long double) value. Compute a b + c, forming the product as
+ *  for vec_muldd() and adding c as for vec_adddd(). The product is
+ *  not rounded to double-double before the add, which makes this the
+ *  accumulation step for double-double dot products and polynomials.
+ *
+ *  @param rl pointer to the low doubles of the result.
+ *  @param ah vector double high parts of a.
+ *  @param al vector double low parts of a.
+ *  @param bh vector double high parts of b.
+ *  @param bl vector double low parts of b.
+ *  @param ch vector double high parts of c.
+ *  @param cl vector double low parts of c.
+ *  @return vector double high parts of a b + c.
+ */
+static inline vf64_t
+vec_madddd (vf64_t *rl, vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl,
+	    vf64_t ch, vf64_t cl)
+{
+  vf64_t p, e;
+
+  /* p + e = a b, e not yet renormalized against p.  */
+  p = vec_mul (ah, bh);
+  e = vec_msub (ah, bh, p);
+  e = vec_madd (ah, bl, e);
+  e = vec_madd (al, bh, e);
+  return vec_adddd (rl, p, e, ch, cl);
+}
+
+/** \brief Vector double-double multiply.
+ *
+ *  Each lane of (ah, al) and (bh, bl) is a double-double (IBM long
+ *  double) value. Multiply them with an error of about 2 ULP of the
+ *  106-bit result. The exact product of the high parts comes from
+ *  FMA, and the cross products are accumulated into its low part.
+ *  The al bl term is below the result precision and is dropped.
+ *
+ *  If ah bh is Inf, NaN or zero, the result is ah bh with a low part
+ *  of +0.0. So a zero product keeps its sign.
+ *
+ *  @param rl pointer to the low doubles of the product.
+ *  @param ah vector double high parts of a.
+ *  @param al vector double low parts of a.
+ *  @param bh vector double high parts of b.
+ *  @param bl vector double low parts of b.
+ *  @return vector double high parts of the product.
+ */
+static inline vf64_t
+vec_muldd (vf64_t *rl, vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl)
+{
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t p, e, s;
+  vb64_t ok;
+
+  p = vec_mul (ah, bh);
+  e = vec_msub (ah, bh, p);
+  e = vec_madd (ah, bl, e);
+  e = vec_madd (al, bh, e);
+  s = vec_add (p, e);
+  e = vec_sub (e, vec_sub (s, p));
+  ok = vec_and (vec_cmplt (vec_abs (p), inf),
+		vec_cmpgt (vec_abs (p), zero));
+  *rl = vec_sel (zero, e, ok);
+  return vec_sel (p, s, ok);
+}
+
 /** \brief Copy the pair of doubles from a vector to IBM long double.
  *
  *  @param lval vector double values containing the IBM long double.
@@ -1412,6 +1585,60 @@ vec_setb_dp (vf64_t vra)
   return vec_setb_sd ((vi64_t) vra);
 }
 
+/** \brief Vector double-double square root.
+ *
+ *  Each lane of (ah, al) is a double-double (IBM long double) value.
+ *  The double square root x of ah is corrected by one Newton step,
+ *  (a - x<SUP>2</SUP>) / 2x, with the residual ah - x<SUP>2</SUP>
+ *  exact from FMA. The error is about 1 ULP of the 106-bit result.
+ *
+ *  If ah is not positive and finite, the result is the double square
+ *  root of ah (&plusmn;0.0, +Inf or NaN) with a low part of +0.0.
+ *
+ *  @param rl pointer to the low doubles of the root.
+ *  @param ah vector double high parts of a.
+ *  @param al vector double low parts of a.
+ *  @return vector double high parts of the root.
+ */
+static inline vf64_t
+vec_sqrtdd (vf64_t *rl, vf64_t ah, vf64_t al)
+{
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t x, d, y, s;
+  vb64_t ok;
+
+  x = vec_sqrt (ah);
+  d = vec_add (vec_nmsub (x, x, ah), al);
+  y = vec_div (d, vec_add (x, x));
+  s = vec_add (x, y);
+  y = vec_sub (y, vec_sub (s, x));
+  ok = vec_and (vec_cmpgt (ah, zero), vec_cmplt (ah, inf));
+  *rl = vec_sel (zero, y, ok);
+  return vec_sel (x, s, ok);
+}
+
+/** \brief Vector double-double subtract.
+ *
+ *  Each lane of (ah, al) and (bh, bl) is a double-double (IBM long
+ *  double) value. Return a - b as vec_adddd() of a and -b.
+ *
+ *  @param rl pointer to the low doubles of the difference.
+ *  @param ah vector double high parts of a.
+ *  @param al vector double low parts of a.
+ *  @param bh vector double high parts of b.
+ *  @param bl vector double low parts of b.
+ *  @return vector double high parts of the difference.
+ */
+static inline vf64_t
+vec_subdd (vf64_t *rl, vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl)
+{
+  const vui64_t signmask = vec_mask64_f64sign ();
+
+  return vec_adddd (rl, ah, al, (vf64_t) vec_xor ((vui64_t) bh, signmask),
+		    (vf64_t) vec_xor ((vui64_t) bl, signmask));
+}
+
 /** \brief Copy the pair of doubles from a IBM long double to a vector
  * double.
  *
@@ -2074,4 +2301,671 @@ vec_xvxsigdp (vf64_t vrb)
   return result;
 }
 
+
+/** \brief Convert random doublewords to uniform doubles in [0.0, 1.0).
+ *
+ *  out[i] is the high 52 bits of in[i] as the fraction of a double
+ *  in [1.0, 2.0), minus 1.0. This needs only integer shift/OR and a
+ *  floating-point subtract per element, and every result is a
+ *  multiple of 2<SUP>-52</SUP>.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_rng_uniform_f64_PWR7,
+ *  vec_rng_uniform_f64_PWR8, vec_rng_uniform_f64_PWR9,
+ *  and vec_rng_uniform_f64_PWR10.
+ *
+ *  @param out array of n doubles.
+ *  @param in array of n random doublewords, for example from
+ *  vec_pcg64_fill_u64().
+ *  @param n number of values.
+ */
+extern void
+vec_rng_uniform_f64 (double *out, const unsigned long long *in,
+		     unsigned long n);
+
+/** \brief Convert random doublewords to standard normal doubles.
+ *
+ *  Box-Muller transform. Each pair in[2p], in[2p + 1] is converted
+ *  to u1 in (0.0, 1.0] and u2 in [0.0, 1.0) as for
+ *  vec_rng_uniform_f64(), and
+ *  out[2p] = sqrt(-2 log(u1)) cos(2 pi u2),
+ *  out[2p + 1] = sqrt(-2 log(u1)) sin(2 pi u2).
+ *  The log and sincos are vector polynomial kernels (no libm calls)
+ *  with errors of a few ULP.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_rng_normal_f64_PWR7,
+ *  vec_rng_normal_f64_PWR8, vec_rng_normal_f64_PWR9,
+ *  and vec_rng_normal_f64_PWR10.
+ *
+ *  @param out array of n doubles.
+ *  @param in array of n rounded up to even random doublewords.
+ *  @param n number of values.
+ */
+extern void
+vec_rng_normal_f64 (double *out, const unsigned long long *in,
+		    unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_rng_normal_f64) (double *out,
+				    const unsigned long long *in,
+				    unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_rng_uniform_f64) (double *out,
+				     const unsigned long long *in,
+				     unsigned long n);
+///@endcond
+
+/** \brief Vector exp of an array of doubles, u10 tier.
+ *
+ *  out[i] is e<SUP>x</SUP>, where x is in[i], with an error of less than 1
+ *  ULP. Overflow returns +Inf, underflow returns +0.0 or a subnormal
+ *  rounded once. exp(&plusmn;0.0) is 1.0, exp(-Inf) is +0.0.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_exp_f64_u10_PWR7,
+ *  vec_exp_f64_u10_PWR8, vec_exp_f64_u10_PWR9,
+ *  and vec_exp_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_exp_f64_u10 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector exp of an array of doubles, u35 tier.
+ *
+ *  out[i] is e<SUP>x</SUP>, where x is in[i], with an error of less than
+ *  3.5 ULP. Special values are as for vec_exp_f64_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_exp_f64_u35_PWR7,
+ *  vec_exp_f64_u35_PWR8, vec_exp_f64_u35_PWR9,
+ *  and vec_exp_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_exp_f64_u35 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector log of an array of doubles, u10 tier.
+ *
+ *  out[i] is the natural logarithm of x, where x is in[i], with an error of
+ *  less than 1 ULP. log(&plusmn;0.0) is -Inf, log(x < 0.0) is NaN, log(1.0)
+ *  is +0.0 and log(+Inf) is +Inf. Subnormal x are handled in full.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_log_f64_u10_PWR7,
+ *  vec_log_f64_u10_PWR8, vec_log_f64_u10_PWR9,
+ *  and vec_log_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_log_f64_u10 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector log of an array of doubles, u35 tier.
+ *
+ *  out[i] is the natural logarithm of x, where x is in[i], with an error of
+ *  less than 3.5 ULP. Special values are as for vec_log_f64_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_log_f64_u35_PWR7,
+ *  vec_log_f64_u35_PWR8, vec_log_f64_u35_PWR9,
+ *  and vec_log_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_log_f64_u35 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector power of arrays of doubles, u10 tier.
+ *
+ *  out[i] = x[i]<SUP>y[i]</SUP> with an error of less than 1 ULP, computed
+ *  as exp(y log|x|) with double-double log and exp kernels. Special values
+ *  follow C99 Annex F: pow(x, &plusmn;0.0) and pow(1.0, y) are 1.0 even for
+ *  NaN, negative x with non-integer y is NaN, negative x with odd integer y
+ *  gives a negative result, and pow(&plusmn;0.0, y < 0) is &plusmn;Inf.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_pow_f64_u10_PWR7,
+ *  vec_pow_f64_u10_PWR8, vec_pow_f64_u10_PWR9,
+ *  and vec_pow_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles.
+ *  @param x array of n bases.
+ *  @param y array of n exponents.
+ *  @param n number of elements.
+ */
+extern void
+vec_pow_f64_u10 (double *out, const double *x, const double *y,
+		 unsigned long n);
+
+/** \brief Vector power of arrays of doubles, u35 tier.
+ *
+ *  Same as vec_pow_f64_u10(). The u10 kernel is already within this tier
+ *  and fast enough that a less accurate variant does not pay for itself, so
+ *  both names share it.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_pow_f64_u35_PWR7,
+ *  vec_pow_f64_u35_PWR8, vec_pow_f64_u35_PWR9,
+ *  and vec_pow_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles.
+ *  @param x array of n bases.
+ *  @param y array of n exponents.
+ *  @param n number of elements.
+ */
+extern void
+vec_pow_f64_u35 (double *out, const double *x, const double *y,
+		 unsigned long n);
+
+/** \brief Vector sin of an array of doubles, u10 tier.
+ *
+ *  out[i] is sin(x), where x is in[i], with an error of less than 1 ULP.
+ *  The argument is reduced modulo pi/2 with a 3 part pi/2 for |x| <=
+ *  2<SUP>20</SUP> and with a 1280-bit 2/pi (Payne-Hanek) above, so the
+ *  bound holds for all finite x. sin(-0.0) is -0.0, sin(&plusmn;Inf) is
+ *  NaN.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sin_f64_u10_PWR7,
+ *  vec_sin_f64_u10_PWR8, vec_sin_f64_u10_PWR9,
+ *  and vec_sin_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_sin_f64_u10 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector sin of an array of doubles, u35 tier.
+ *
+ *  out[i] is sin(x), where x is in[i], with an error of less than 3.5 ULP.
+ *  Special values are as for vec_sin_f64_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sin_f64_u35_PWR7,
+ *  vec_sin_f64_u35_PWR8, vec_sin_f64_u35_PWR9,
+ *  and vec_sin_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_sin_f64_u35 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector cos of an array of doubles, u10 tier.
+ *
+ *  out[i] is cos(x), where x is in[i], with an error of less than 1 ULP.
+ *  Argument reduction is as for the sin functions, so the bound holds for
+ *  all finite x. cos(&plusmn;Inf) is NaN.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_cos_f64_u10_PWR7,
+ *  vec_cos_f64_u10_PWR8, vec_cos_f64_u10_PWR9,
+ *  and vec_cos_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_cos_f64_u10 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector cos of an array of doubles, u35 tier.
+ *
+ *  out[i] is cos(x), where x is in[i], with an error of less than 3.5 ULP.
+ *  Special values are as for vec_cos_f64_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_cos_f64_u35_PWR7,
+ *  vec_cos_f64_u35_PWR8, vec_cos_f64_u35_PWR9,
+ *  and vec_cos_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_cos_f64_u35 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector tanh of an array of doubles, u10 tier.
+ *
+ *  out[i] is the hyperbolic tangent of x, where x is in[i], with an error
+ *  of less than 1 ULP. Computed from e<SUP>2|x|</SUP> - 1 and
+ *  e<SUP>2|x|</SUP> + 1 for small and medium |x|, and saturates to
+ *  &plusmn;1.0 for large |x|. The sign of x (including -0.0) is kept.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_tanh_f64_u10_PWR7,
+ *  vec_tanh_f64_u10_PWR8, vec_tanh_f64_u10_PWR9,
+ *  and vec_tanh_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_tanh_f64_u10 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector tanh of an array of doubles, u35 tier.
+ *
+ *  out[i] is the hyperbolic tangent of x, where x is in[i], with an error
+ *  of less than 3.5 ULP. Special values are as for vec_tanh_f64_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_tanh_f64_u35_PWR7,
+ *  vec_tanh_f64_u35_PWR8, vec_tanh_f64_u35_PWR9,
+ *  and vec_tanh_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_tanh_f64_u35 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector sigmoid of an array of doubles, u10 tier.
+ *
+ *  out[i] is the logistic function 1 / (1 + e<SUP>-x</SUP>), where x is
+ *  in[i], with an error of less than 1 ULP. sigmoid(+Inf) is 1.0 and
+ *  sigmoid(-Inf) is +0.0. For large negative x the result is e<SUP>x</SUP>,
+ *  so it underflows gradually.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sigmoid_f64_u10_PWR7,
+ *  vec_sigmoid_f64_u10_PWR8, vec_sigmoid_f64_u10_PWR9,
+ *  and vec_sigmoid_f64_u10_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_sigmoid_f64_u10 (double *out, const double *in, unsigned long n);
+
+/** \brief Vector sigmoid of an array of doubles, u35 tier.
+ *
+ *  out[i] is the logistic function 1 / (1 + e<SUP>-x</SUP>), where x is
+ *  in[i], with an error of less than 3.5 ULP. Special values are as for
+ *  vec_sigmoid_f64_u10().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sigmoid_f64_u35_PWR7,
+ *  vec_sigmoid_f64_u35_PWR8, vec_sigmoid_f64_u35_PWR9,
+ *  and vec_sigmoid_f64_u35_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_sigmoid_f64_u35 (double *out, const double *in, unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_cos_f64_u10) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_cos_f64_u35) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_exp_f64_u10) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_exp_f64_u35) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_log_f64_u10) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_log_f64_u35) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_pow_f64_u10) (double *out, const double *x,
+				const double *y, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_pow_f64_u35) (double *out, const double *x,
+				const double *y, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sigmoid_f64_u10) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sigmoid_f64_u35) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sin_f64_u10) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sin_f64_u35) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_tanh_f64_u10) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_tanh_f64_u35) (double *out, const double *in,
+				unsigned long n);
+///@endcond
+
+/** \brief Split an array of doubles into mantissa and exponent.
+ *
+ *  For each element, mant[i] in [0.5, 1.0) (with the sign of in[i]) and
+ *  exp[i] satisfy in[i] = mant[i] 2<SUP>exp[i]</SUP>, as the C frexp
+ *  function. Subnormal inputs are normalized. Zero, infinity and NaN are
+ *  returned unchanged with an exponent of 0.
+ *
+ *  The exponent is extracted with vec_xvxexpdp() and the mantissa built
+ *  with vec_xviexpdp(), so there is no per element branch or libm call.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_frexp_f64_PWR7,
+ *  vec_frexp_f64_PWR8, vec_frexp_f64_PWR9,
+ *  and vec_frexp_f64_PWR10.
+ *
+ *  @param mant array of n doubles, may be the same as in.
+ *  @param exp array of n ints.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_frexp_f64 (double *mant, int *exp, const double *in,
+	       unsigned long n);
+
+/** \brief Scale an array of doubles by powers of 2 from an array of exponents.
+ *
+ *  out[i] = in[i] 2<SUP>exp[i]</SUP>, as the C ldexp function, for any int
+ *  exponent. The result is rounded once, so subnormal results are correctly
+ *  rounded, and overflows to infinity with the sign of in[i].
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_ldexp_f64_PWR7,
+ *  vec_ldexp_f64_PWR8, vec_ldexp_f64_PWR9,
+ *  and vec_ldexp_f64_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param exp array of n ints.
+ *  @param n number of elements.
+ */
+extern void
+vec_ldexp_f64 (double *out, const double *in, const int *exp,
+	       unsigned long n);
+
+/** \brief Scale an array of doubles by the same power of 2.
+ *
+ *  out[i] = in[i] 2<SUP>exp</SUP>, as the C scalbn function. Same as
+ *  vec_ldexp_f64() with every exponent equal to exp, which is the common
+ *  case for normalizing a column by a single scale factor.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_scalbn_f64_PWR7,
+ *  vec_scalbn_f64_PWR8, vec_scalbn_f64_PWR9,
+ *  and vec_scalbn_f64_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param exp power of 2 to scale by.
+ *  @param n number of elements.
+ */
+extern void
+vec_scalbn_f64 (double *out, const double *in, int exp,
+		unsigned long n);
+
+/** \brief Unbiased exponents of an array of doubles as int.
+ *
+ *  out[i] is the exponent of in[i] as the C ilogb function, the floor of
+ *  log2 |in[i]|. Subnormal inputs return their true exponent, down to
+ *  -1074. Zero returns FP_ILOGB0, infinity INT_MAX and NaN FP_ILOGBNAN,
+ *  with the values from <math.h>.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_ilogb_f64_PWR7,
+ *  vec_ilogb_f64_PWR8, vec_ilogb_f64_PWR9,
+ *  and vec_ilogb_f64_PWR10.
+ *
+ *  @param out array of n ints.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_ilogb_f64 (int *out, const double *in, unsigned long n);
+
+/** \brief Unbiased exponents of an array of doubles as double.
+ *
+ *  out[i] is the exponent of in[i] as a double, as the C logb function.
+ *  logb(&plusmn;0.0) is -Inf, logb(&plusmn;Inf) is +Inf and NaN returns
+ *  NaN.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_logb_f64_PWR7,
+ *  vec_logb_f64_PWR8, vec_logb_f64_PWR9,
+ *  and vec_logb_f64_PWR10.
+ *
+ *  @param out array of n doubles, may be the same as in.
+ *  @param in array of n doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_logb_f64 (double *out, const double *in, unsigned long n);
+
+/** \brief Next representable doubles toward an array of directions.
+ *
+ *  out[i] is the double adjacent to x[i] in the direction of y[i], as the C
+ *  nextafter function. If x[i] equals y[i] the result is y[i]; if either is
+ *  NaN the result is NaN. Stepping from zero gives
+ *  &plusmn;2<SUP>-1074</SUP>, stepping past the largest finite value gives
+ *  infinity.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_nextafter_f64_PWR7,
+ *  vec_nextafter_f64_PWR8, vec_nextafter_f64_PWR9,
+ *  and vec_nextafter_f64_PWR10.
+ *
+ *  @param out array of n doubles.
+ *  @param x array of n starting values.
+ *  @param y array of n directions.
+ *  @param n number of elements.
+ */
+extern void
+vec_nextafter_f64 (double *out, const double *x, const double *y,
+		   unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_frexp_f64) (double *mant, int *exp,
+				const double *in, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_ilogb_f64) (int *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_ldexp_f64) (double *out, const double *in,
+				const int *exp, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_logb_f64) (double *out, const double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_nextafter_f64) (double *out, const double *x,
+				    const double *y, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_scalbn_f64) (double *out, const double *in,
+				 int exp, unsigned long n);
+///@endcond
+
+#if defined (__LONG_DOUBLE_128__) && !defined (__LONG_DOUBLE_IEEE128__)
+/** \brief Add arrays of IBM long doubles.
+ *
+ *  out[i] = a[i] + b[i] in IBM double-double. Two values are processed per
+ *  pair of vectors using vec_adddd(). The result is within about 1 ulp of
+ *  the 106-bit significand.
+ *
+ *  \note Only declared when long double is IBM double-double
+ *  (not with -mabi=ieeelongdouble).
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_add_ldbl_PWR7,
+ *  vec_add_ldbl_PWR8, vec_add_ldbl_PWR9,
+ *  and vec_add_ldbl_PWR10.
+ *
+ *  @param out array of n long doubles, may be the same as a or b.
+ *  @param a array of n long doubles.
+ *  @param b array of n long doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_add_ldbl (long double *out, const long double *a,
+	      const long double *b, unsigned long n);
+
+/** \brief Subtract arrays of IBM long doubles.
+ *
+ *  out[i] = a[i] - b[i] in IBM double-double, using vec_subdd().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sub_ldbl_PWR7,
+ *  vec_sub_ldbl_PWR8, vec_sub_ldbl_PWR9,
+ *  and vec_sub_ldbl_PWR10.
+ *
+ *  @param out array of n long doubles, may be the same as a or b.
+ *  @param a array of n long doubles.
+ *  @param b array of n long doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_sub_ldbl (long double *out, const long double *a,
+	      const long double *b, unsigned long n);
+
+/** \brief Multiply arrays of IBM long doubles.
+ *
+ *  out[i] = a[i] * b[i] in IBM double-double, using vec_muldd().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_mul_ldbl_PWR7,
+ *  vec_mul_ldbl_PWR8, vec_mul_ldbl_PWR9,
+ *  and vec_mul_ldbl_PWR10.
+ *
+ *  @param out array of n long doubles, may be the same as a or b.
+ *  @param a array of n long doubles.
+ *  @param b array of n long doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_mul_ldbl (long double *out, const long double *a,
+	      const long double *b, unsigned long n);
+
+/** \brief Divide arrays of IBM long doubles.
+ *
+ *  out[i] = a[i] / b[i] in IBM double-double, using vec_divdd().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_div_ldbl_PWR7,
+ *  vec_div_ldbl_PWR8, vec_div_ldbl_PWR9,
+ *  and vec_div_ldbl_PWR10.
+ *
+ *  @param out array of n long doubles, may be the same as a or b.
+ *  @param a array of n dividends.
+ *  @param b array of n divisors.
+ *  @param n number of elements.
+ */
+extern void
+vec_div_ldbl (long double *out, const long double *a,
+	      const long double *b, unsigned long n);
+
+/** \brief Square roots of an array of IBM long doubles.
+ *
+ *  out[i] = sqrt(in[i]) in IBM double-double, using vec_sqrtdd().
+ *  Negative inputs return NaN.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sqrt_ldbl_PWR7,
+ *  vec_sqrt_ldbl_PWR8, vec_sqrt_ldbl_PWR9,
+ *  and vec_sqrt_ldbl_PWR10.
+ *
+ *  @param out array of n long doubles, may be the same as in.
+ *  @param in array of n long doubles.
+ *  @param n number of elements.
+ */
+extern void
+vec_sqrt_ldbl (long double *out, const long double *in,
+	       unsigned long n);
+
+/** \brief Fused multiply-add of arrays of IBM long doubles.
+ *
+ *  out[i] = a[i] * b[i] + c[i] in IBM double-double, using vec_madddd().
+ *  The product is formed with FMA and is not rounded to a long double
+ *  before the add.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_madd_ldbl_PWR7,
+ *  vec_madd_ldbl_PWR8, vec_madd_ldbl_PWR9,
+ *  and vec_madd_ldbl_PWR10.
+ *
+ *  @param out array of n long doubles, may be the same as a, b or c.
+ *  @param a array of n long doubles.
+ *  @param b array of n long doubles.
+ *  @param c array of n addends.
+ *  @param n number of elements.
+ */
+extern void
+vec_madd_ldbl (long double *out, const long double *a,
+	       const long double *b, const long double *c,
+	       unsigned long n);
+
+/** \brief Dot product of arrays of IBM long doubles.
+ *
+ *  Returns the sum of a[i] * b[i] for i in [0, n), accumulated in
+ *  double-double with vec_madddd() over 4 independent lanes. The
+ *  summation order differs from a scalar loop, so results may differ in
+ *  the last bits. Returns 0.0 for n == 0.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_dot_ldbl_PWR7,
+ *  vec_dot_ldbl_PWR8, vec_dot_ldbl_PWR9,
+ *  and vec_dot_ldbl_PWR10.
+ *
+ *  @param a array of n long doubles.
+ *  @param b array of n long doubles.
+ *  @param n number of elements.
+ *  @return the dot product as long double.
+ */
+extern long double
+vec_dot_ldbl (const long double *a, const long double *b,
+	      unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_add_ldbl) (long double *out, const long double *a,
+			       const long double *b, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_div_ldbl) (long double *out, const long double *a,
+			       const long double *b, unsigned long n);
+extern long double
+__VEC_PWR_IMP (vec_dot_ldbl) (const long double *a, const long double *b,
+			       unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_madd_ldbl) (long double *out, const long double *a,
+				const long double *b, const long double *c,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_mul_ldbl) (long double *out, const long double *a,
+			       const long double *b, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sqrt_ldbl) (long double *out, const long double *in,
+				unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sub_ldbl) (long double *out, const long double *a,
+			       const long double *b, unsigned long n);
+///@endcond
+#endif
+
 #endif /* VEC_F64_PPC_H_ */
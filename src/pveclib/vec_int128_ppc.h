@@ -28,6 +28,10 @@
 #include <pveclib/vec_common_ppc.h>
 #include <pveclib/vec_int64_ppc.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file  vec_int128_ppc.h
  * \brief Header package containing a collection of 128-bit computation
@@ -6409,6 +6413,497 @@ vec_minuq(vui128_t vra, vui128_t vrb)
   return (vui128_t) vec_sel ((vui32_t) vrb, (vui32_t) vra, minmask);
 }
 
+/** \brief Vector Minimum and Maximum Signed Quadword, in place.
+ *
+ *  The compare-exchange step of sorting networks.
+ *  Compare Quadwords *vra and *vrb as signed integers and return the
+ *  smaller value in *vra and the larger value in *vrb.
+ *  A single vec_cmpgtsq() mask selects both results.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   | 14-20 | 1/cycle  |
+ *  |power9   | 12-20 | 1/cycle  |
+ *  |power10  |  5-8  | 2/cycle  |
+ *
+ *  @param vra pointer to 128-bit vector __int128, returns the minimum.
+ *  @param vrb pointer to 128-bit vector __int128, returns the maximum.
+ */
+static inline void
+vec_minmaxsq (vi128_t *vra, vi128_t *vrb)
+{
+  vi128_t a = *vra, b = *vrb;
+  vb128_t gtmask;
+
+  gtmask = vec_cmpgtsq (a, b);
+  *vra = vec_selsq (a, b, gtmask);
+  *vrb = vec_selsq (b, a, gtmask);
+}
+
+/** \brief Vector Minimum and Maximum Unsigned Quadword, in place.
+ *
+ *  The compare-exchange step of sorting networks.
+ *  Compare Quadwords *vra and *vrb as unsigned integers and return
+ *  the smaller value in *vra and the larger value in *vrb.
+ *  A single vec_cmpgtuq() mask selects both results, where
+ *  vec_minuq() plus vec_maxuq() would compare twice.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power8   |  12   | 1/cycle  |
+ *  |power9   |  10   | 1/cycle  |
+ *  |power10  |  4-6  | 2/cycle  |
+ *
+ *  @param vra pointer to 128-bit vector unsigned __int128, returns
+ *  the minimum.
+ *  @param vrb pointer to 128-bit vector unsigned __int128, returns
+ *  the maximum.
+ */
+static inline void
+vec_minmaxuq (vui128_t *vra, vui128_t *vrb)
+{
+  vui128_t a = *vra, b = *vrb;
+  vb128_t gtmask;
+
+  gtmask = vec_cmpgtuq (a, b);
+  *vra = vec_seluq (a, b, gtmask);
+  *vrb = vec_seluq (b, a, gtmask);
+}
+
+/** \brief Hash a buffer to 128 bits.
+ *
+ *  As vec_hash64() with a second multiply-fold chain for the high
+ *  doubleword. The low doubleword of the result equals vec_hash64()
+ *  of the same buffer and seed.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_hash128_PWR7,
+ *  vec_hash128_PWR8, vec_hash128_PWR9, and vec_hash128_PWR10.
+ *
+ *  @param buf pointer to len bytes.
+ *  @param len number of bytes.
+ *  @param seed 64-bit seed.
+ *  @return the 128-bit hash.
+ */
+extern vui128_t
+vec_hash128 (const void *buf, unsigned long len, unsigned long long seed);
+
+/** \brief Hash an array of quadword keys to 64 bits.
+ *
+ *  Hash 2 keys per vector. out[i] is vec_hash64() of keys[i] in
+ *  little endian byte order (16 bytes) with the same seed.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_hash64_batch_u128_PWR7,
+ *  vec_hash64_batch_u128_PWR8, vec_hash64_batch_u128_PWR9,
+ *  and vec_hash64_batch_u128_PWR10.
+ *
+ *  @param out array of n hashes.
+ *  @param keys array of n keys.
+ *  @param n number of keys.
+ *  @param seed 64-bit seed.
+ */
+extern void
+vec_hash64_batch_u128 (unsigned long long *out, const vui128_t *keys,
+		       unsigned long n, unsigned long long seed);
+
+/** \brief Erase a quadword key from hash table t.
+ *
+ *  As vec_htab_erase_u64() for a table initialized by
+ *  vec_htab_init_u128().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_erase_u128_PWR7,
+ *  vec_htab_erase_u128_PWR8, vec_htab_erase_u128_PWR9,
+ *  and vec_htab_erase_u128_PWR10.
+ *
+ *  @param t hash table of quadword keys.
+ *  @param key to erase.
+ *  @return the slot the key occupied, or -1 if not found.
+ */
+extern long
+vec_htab_erase_u128 (vec_htab_t *t, vui128_t key);
+
+/** \brief Find a quadword key in hash table t.
+ *
+ *  As vec_htab_find_u64(), with candidate keys verified by
+ *  vec_cmpuq_all_eq() (vcmpequq. on POWER10).
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_find_u128_PWR7,
+ *  vec_htab_find_u128_PWR8, vec_htab_find_u128_PWR9,
+ *  and vec_htab_find_u128_PWR10.
+ *
+ *  @param t hash table of quadword keys.
+ *  @param key to find.
+ *  @return the slot of key, or -1 if not found.
+ */
+extern long
+vec_htab_find_u128 (const vec_htab_t *t, vui128_t key);
+
+/** \brief Find a batch of quadword keys in hash table t.
+ *
+ *  As vec_htab_find_batch_u64() for quadword keys. Each prefetch
+ *  covers the control group and the two cache lines of keys of the
+ *  first probe group.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_find_batch_u128_PWR7,
+ *  vec_htab_find_batch_u128_PWR8, vec_htab_find_batch_u128_PWR9,
+ *  and vec_htab_find_batch_u128_PWR10.
+ *
+ *  @param t hash table of quadword keys.
+ *  @param slots array of n results (slot or -1).
+ *  @param keys array of n keys to find.
+ *  @param n number of keys.
+ */
+extern void
+vec_htab_find_batch_u128 (const vec_htab_t *t, long *slots,
+			  const vui128_t *keys, unsigned long n);
+
+/** \brief Initialize hash table t for quadword keys.
+ *
+ *  As vec_htab_init_u64() with 16-byte keys.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_init_u128_PWR7,
+ *  vec_htab_init_u128_PWR8, vec_htab_init_u128_PWR9,
+ *  and vec_htab_init_u128_PWR10.
+ *
+ *  @param t hash table to initialize.
+ *  @param capacity number of keys the table must hold.
+ *  @return 0 for success, or -1 if the memory could not be allocated.
+ */
+extern int
+vec_htab_init_u128 (vec_htab_t *t, unsigned long capacity);
+
+/** \brief Insert a quadword key into hash table t.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_insert_u128_PWR7,
+ *  vec_htab_insert_u128_PWR8, vec_htab_insert_u128_PWR9,
+ *  and vec_htab_insert_u128_PWR10.
+ *
+ *  @param t hash table of quadword keys.
+ *  @param key to insert.
+ *  @return the slot of key (new, or existing if the key was already
+ *  present), or -1 if the table is at its limit.
+ */
+extern long
+vec_htab_insert_u128 (vec_htab_t *t, vui128_t key);
+
+/** \brief Lower bound of a signed quadword key in a sorted array.
+ *
+ *  Return the index of the first element of array[0..n) that is not
+ *  less than key (n if there is none). The array must be sorted
+ *  ascending as signed __int128.
+ *
+ *  The search is branch free: each step selects the next base with
+ *  the vec_cmpsq_all_lt() result and prefetches both candidate
+ *  midpoints of the following step.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_lower_bound_s128_PWR7,
+ *  vec_lower_bound_s128_PWR8, vec_lower_bound_s128_PWR9,
+ *  and vec_lower_bound_s128_PWR10.
+ *
+ *  @param array sorted array of n vector __int128.
+ *  @param n number of elements.
+ *  @param key the search key.
+ *  @return index of the lower bound.
+ */
+extern unsigned long
+vec_lower_bound_s128 (const vi128_t *array, unsigned long n, vi128_t key);
+
+/** \brief Lower bound of an unsigned quadword key in a sorted array.
+ *
+ *  Return the index of the first element of array[0..n) that is not
+ *  less than key (n if there is none). The array must be sorted
+ *  ascending as unsigned __int128.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_lower_bound_u128_PWR7,
+ *  vec_lower_bound_u128_PWR8, vec_lower_bound_u128_PWR9,
+ *  and vec_lower_bound_u128_PWR10.
+ *
+ *  @param array sorted array of n vector unsigned __int128.
+ *  @param n number of elements.
+ *  @param key the search key.
+ *  @return index of the lower bound.
+ */
+extern unsigned long
+vec_lower_bound_u128 (const vui128_t *array, unsigned long n,
+		      vui128_t key);
+
+/** \brief Number of interleaved streams of a vec_pcg64_t generator.  */
+#define VEC_PCG64_STREAMS 4
+
+/** \brief State of VEC_PCG64_STREAMS interleaved PCG64 generators.
+ *
+ *  Each stream is the PCG 128-bit LCG with the XSL-RR 64-bit output
+ *  function (pcg_setseq_128_xsl_rr_64, the pcg64 of the PCG library)
+ *  with its own increment. Initialize with vec_pcg64_init().
+ */
+typedef struct
+{
+  /** LCG state of each stream.  */
+  vui128_t state[VEC_PCG64_STREAMS];
+  /** LCG increment (odd) of each stream.  */
+  vui128_t inc[VEC_PCG64_STREAMS];
+} vec_pcg64_t;
+
+/** \brief Initialize a PCG64 generator.
+ *
+ *  Stream j is seeded as pcg64 with initstate seed and initseq
+ *  (seq * VEC_PCG64_STREAMS) + j, so distinct seq values give
+ *  disjoint sets of streams.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_pcg64_init_PWR7,
+ *  vec_pcg64_init_PWR8, vec_pcg64_init_PWR9,
+ *  and vec_pcg64_init_PWR10.
+ *
+ *  @param g pointer to the generator state.
+ *  @param seed 128-bit initial state.
+ *  @param seq 128-bit sequence selector.
+ */
+extern void
+vec_pcg64_init (vec_pcg64_t *g, vui128_t seed, vui128_t seq);
+
+/** \brief Fill an array with PCG64 random doublewords.
+ *
+ *  out[4k + j] is output k of stream j. All streams are stepped with
+ *  vec_mulluq() and vec_adduqm() in each iteration, so the 128-bit
+ *  multiplies of the 4 streams overlap. Each call advances every
+ *  stream by ceil(n / 4) steps, any outputs of the last step beyond
+ *  n are discarded.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_pcg64_fill_u64_PWR7,
+ *  vec_pcg64_fill_u64_PWR8, vec_pcg64_fill_u64_PWR9,
+ *  and vec_pcg64_fill_u64_PWR10.
+ *
+ *  @param g pointer to the generator state.
+ *  @param out array of n doublewords.
+ *  @param n number of values.
+ */
+extern void
+vec_pcg64_fill_u64 (vec_pcg64_t *g, unsigned long long *out,
+		    unsigned long n);
+
+/** \brief Fill an array with Philox4x32-10 random words.
+ *
+ *  Counter based generator. out[4i + j] is word j of
+ *  Philox4x32-10 (ctr + i, key), where word 0 of the counter is its
+ *  low order 32 bits and word 0 of the key is the low order 32 bits
+ *  of key. The results match the Random123 philox4x32 known answers.
+ *  4 counters are computed per iteration, with each round computing
+ *  the 64-bit products with vec_muleuw() and vec_mulouw().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_philox4x32_fill_u32_PWR7,
+ *  vec_philox4x32_fill_u32_PWR8, vec_philox4x32_fill_u32_PWR9,
+ *  and vec_philox4x32_fill_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param n number of values.
+ *  @param ctr 128-bit counter of the first block.
+ *  @param key 64-bit key.
+ *  @return the counter following the last block used, ctr +
+ *  ceil(n / 4), to continue the sequence.
+ */
+extern vui128_t
+vec_philox4x32_fill_u32 (unsigned int *out, unsigned long n, vui128_t ctr,
+			 unsigned long long key);
+
+/** \brief Inclusive prefix sum of an array of quadwords.
+ *
+ *  out[i] = init + in[0] + ... + in[i], modulo 2<SUP>128</SUP>.
+ *  The sum of each pair of elements is computed independently of
+ *  the running sum, so the dependent vec_adduqm() chain is one add
+ *  per 2 elements. out may equal in.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_prefix_sum_u128_PWR7,
+ *  vec_prefix_sum_u128_PWR8, vec_prefix_sum_u128_PWR9,
+ *  and vec_prefix_sum_u128_PWR10.
+ *
+ *  @param out array of n vector unsigned __int128.
+ *  @param in array of n vector unsigned __int128.
+ *  @param n number of elements.
+ *  @param init the initial sum (carry in from a previous block).
+ *  @return the sum of init and all n elements.
+ */
+extern vui128_t
+vec_prefix_sum_u128 (vui128_t *out, const vui128_t *in, unsigned long n,
+		     vui128_t init);
+
+/** \brief Inclusive 128-bit prefix sum of an array of doublewords.
+ *
+ *  out[i] = init + in[0] + ... + in[i], where each doubleword is
+ *  zero extended to a quadword before the add. Unlike
+ *  vec_prefix_sum_u64() this can not overflow for any n (with init
+ *  of zero), which makes it suitable for summing 64-bit counters.
+ *  If out is NULL only the total is computed, using 2 independent
+ *  accumulators.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_prefix_sum_u64_u128_PWR7,
+ *  vec_prefix_sum_u64_u128_PWR8, vec_prefix_sum_u64_u128_PWR9,
+ *  and vec_prefix_sum_u64_u128_PWR10.
+ *
+ *  @param out array of n vector unsigned __int128, or NULL.
+ *  @param in array of n unsigned long long.
+ *  @param n number of elements.
+ *  @param init the initial sum (carry in from a previous block).
+ *  @return the sum of init and all n elements.
+ */
+extern vui128_t
+vec_prefix_sum_u64_u128 (vui128_t *out, const unsigned long long *in,
+			 unsigned long n, vui128_t init);
+
+/** \brief Sort an array of signed quadwords.
+ *
+ *  Sort n elements of array ascending, in place.
+ *  As vec_sort_u128() with the sign bit of each key flipped on entry
+ *  and restored on exit.
+ *
+ *  @param array of n vector __int128.
+ *  @param n number of elements.
+ */
+extern void
+vec_sort_s128 (vi128_t *array, unsigned long n);
+
+/** \brief Sort an array of unsigned quadwords.
+ *
+ *  Sort n elements of array ascending, in place.
+ *  Blocks of 16 quadwords are sorted in registers by a bitonic
+ *  network of vec_minmaxuq() operations, then merged bottom up by a
+ *  branch free two-way merge.
+ *  For n of 65536 or more this switches to an LSD radix sort of
+ *  8-bit digits, skipping digits that are the same for all keys
+ *  (for example the high bytes of small decimal(38) values).
+ *  The sort is not stable.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sort_u128_PWR7,
+ *  vec_sort_u128_PWR8, vec_sort_u128_PWR9, and vec_sort_u128_PWR10.
+ *
+ *  \note Uses a temporary buffer of n elements. If that cannot be
+ *  allocated the array is sorted in place by a shell sort.
+ *
+ *  @param array of n vector unsigned __int128.
+ *  @param n number of elements.
+ */
+extern void
+vec_sort_u128 (vui128_t *array, unsigned long n);
+
+/** \brief 256-bit sum of an array of quadwords.
+ *
+ *  Sum the n elements of in without loss. The low quadword is
+ *  accumulated with vec_adduqm(), and the carry from vec_addcuq() is
+ *  added into the high quadword with vec_addeuqm(). Two accumulators
+ *  are used to hide the latency of the carry chain.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sum_u128_PWR7,
+ *  vec_sum_u128_PWR8, vec_sum_u128_PWR9, and vec_sum_u128_PWR10.
+ *
+ *  @param high pointer to the high quadword of the sum.
+ *  @param in array of n vector unsigned __int128.
+ *  @param n number of elements.
+ *  @return the low quadword of the sum.
+ */
+extern vui128_t
+vec_sum_u128 (vui128_t *high, const vui128_t *in, unsigned long n);
+
+/** \brief Upper bound of a signed quadword key in a sorted array.
+ *
+ *  Return the index of the first element of array[0..n) that is
+ *  greater than key (n if there is none). The array must be sorted
+ *  ascending as signed __int128.
+ *
+ *  @param array sorted array of n vector __int128.
+ *  @param n number of elements.
+ *  @param key the search key.
+ *  @return index of the upper bound.
+ */
+extern unsigned long
+vec_upper_bound_s128 (const vi128_t *array, unsigned long n, vi128_t key);
+
+/** \brief Upper bound of an unsigned quadword key in a sorted array.
+ *
+ *  Return the index of the first element of array[0..n) that is
+ *  greater than key (n if there is none). The array must be sorted
+ *  ascending as unsigned __int128.
+ *
+ *  @param array sorted array of n vector unsigned __int128.
+ *  @param n number of elements.
+ *  @param key the search key.
+ *  @return index of the upper bound.
+ */
+extern unsigned long
+vec_upper_bound_u128 (const vui128_t *array, unsigned long n,
+		      vui128_t key);
+
+///@cond INTERNAL
+extern vui128_t
+__VEC_PWR_IMP (vec_hash128) (const void *buf, unsigned long len,
+			     unsigned long long seed);
+extern void
+__VEC_PWR_IMP (vec_hash64_batch_u128) (unsigned long long *out,
+				       const vui128_t *keys,
+				       unsigned long n,
+				       unsigned long long seed);
+extern long
+__VEC_PWR_IMP (vec_htab_erase_u128) (vec_htab_t *t, vui128_t key);
+extern long
+__VEC_PWR_IMP (vec_htab_find_u128) (const vec_htab_t *t, vui128_t key);
+extern void
+__VEC_PWR_IMP (vec_htab_find_batch_u128) (const vec_htab_t *t, long *slots,
+					  const vui128_t *keys,
+					  unsigned long n);
+extern int
+__VEC_PWR_IMP (vec_htab_init_u128) (vec_htab_t *t, unsigned long capacity);
+extern long
+__VEC_PWR_IMP (vec_htab_insert_u128) (vec_htab_t *t, vui128_t key);
+extern unsigned long
+__VEC_PWR_IMP (vec_lower_bound_s128) (const vi128_t *array,
+				      unsigned long n, vi128_t key);
+extern unsigned long
+__VEC_PWR_IMP (vec_lower_bound_u128) (const vui128_t *array,
+				      unsigned long n, vui128_t key);
+extern void
+__VEC_PWR_IMP (vec_pcg64_fill_u64) (vec_pcg64_t *g, unsigned long long *out,
+				    unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_pcg64_init) (vec_pcg64_t *g, vui128_t seed,
+				vui128_t seq);
+extern vui128_t
+__VEC_PWR_IMP (vec_philox4x32_fill_u32) (unsigned int *out, unsigned long n,
+					 vui128_t ctr, unsigned long long key);
+extern vui128_t
+__VEC_PWR_IMP (vec_prefix_sum_u128) (vui128_t *out, const vui128_t *in,
+				     unsigned long n, vui128_t init);
+extern vui128_t
+__VEC_PWR_IMP (vec_prefix_sum_u64_u128) (vui128_t *out,
+					 const unsigned long long *in,
+					 unsigned long n, vui128_t init);
+extern void
+__VEC_PWR_IMP (vec_sort_s128) (vi128_t *array, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sort_u128) (vui128_t *array, unsigned long n);
+extern vui128_t
+__VEC_PWR_IMP (vec_sum_u128) (vui128_t *high, const vui128_t *in,
+			      unsigned long n);
+extern unsigned long
+__VEC_PWR_IMP (vec_upper_bound_s128) (const vi128_t *array,
+				      unsigned long n, vi128_t key);
+extern unsigned long
+__VEC_PWR_IMP (vec_upper_bound_u128) (const vui128_t *array,
+				      unsigned long n, vui128_t key);
+///@endcond
+
 /** \brief Vector Modulo by const 10e31 Signed Quadword.
  *
  *  Compute the remainder of a 128 bit values vra % 10e31.
@@ -11336,4 +11831,9 @@ vec_vsrq_byte (vui128_t vra, vui8_t vrb)
   return (result);
 }
 #endif
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* VEC_INT128_PPC_H_ */
@@ -25,6 +25,10 @@
 
 #include <pveclib/vec_char_ppc.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file  vec_int16_ppc.h
  * \brief Header package containing a collection of 128-bit SIMD
@@ -1407,4 +1411,8 @@ vec_vmrgoh (vui16_t vra, vui16_t vrb)
 #endif
 }
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* VEC_INT16_PPC_H_ */
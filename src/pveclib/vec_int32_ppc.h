@@ -25,6 +25,10 @@
 
 #include <pveclib/vec_int16_ppc.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file  vec_int32_ppc.h
  * \brief Header package containing a collection of 128-bit SIMD
@@ -3836,4 +3840,940 @@ vec_vupkluw (vui32_t vra)
 #endif
 }
 
+/** \brief Difference of two sorted sets of words.
+ *
+ *  Store the elements of a not present in b to out, ascending.
+ *  Blocks of 4 elements of a are compared with all elements of
+ *  a block of b at once (vec_sld rotations and vec_cmpeq) and
+ *  the unmatched elements packed by vec_perm. If one set is more than
+ *  32 times larger galloping search is used instead.
+ *  The elements of a and b must be strictly increasing.
+ *  out must not overlap a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_difference_u32_PWR7,
+ *  vec_difference_u32_PWR8, vec_difference_u32_PWR9,
+ *  and vec_difference_u32_PWR10.
+ *
+ *  @param out array of na elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ *  @return the number of elements stored to out.
+ */
+extern unsigned long
+vec_difference_u32 (unsigned int *out, const unsigned int *a,
+		    unsigned long na, const unsigned int *b,
+		    unsigned long nb);
+
+/** \brief Intersection of two sorted sets of words.
+ *
+ *  Store the elements present in both a and b to out, ascending.
+ *  Blocks of 4 elements of a are compared with all elements of
+ *  a block of b at once (vec_sld rotations and vec_cmpeq) and
+ *  the matches packed by vec_perm. If one set is more than 32 times larger
+ *  the elements of the smaller set are found by galloping search.
+ *  The elements of a and b must be strictly increasing.
+ *  out must not overlap a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_intersect_u32_PWR7,
+ *  vec_intersect_u32_PWR8, vec_intersect_u32_PWR9,
+ *  and vec_intersect_u32_PWR10.
+ *
+ *  @param out array of min(na,nb) elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ *  @return the number of elements stored to out.
+ */
+extern unsigned long
+vec_intersect_u32 (unsigned int *out, const unsigned int *a,
+		   unsigned long na, const unsigned int *b,
+		   unsigned long nb);
+
+/** \brief Union of two sorted sets of words.
+ *
+ *  Store the elements present in a or b (or both) to out,
+ *  ascending. Uses a branch free two-way merge, or copies runs of
+ *  the larger set found by galloping search if one set is more
+ *  than 32 times larger.
+ *  The elements of a and b must be strictly increasing.
+ *  out must not overlap a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_union_u32_PWR7,
+ *  vec_union_u32_PWR8, vec_union_u32_PWR9,
+ *  and vec_union_u32_PWR10.
+ *
+ *  @param out array of na+nb elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ *  @return the number of elements stored to out.
+ */
+extern unsigned long
+vec_union_u32 (unsigned int *out, const unsigned int *a,
+	       unsigned long na, const unsigned int *b,
+	       unsigned long nb);
+
+///@cond INTERNAL
+extern unsigned long
+__VEC_PWR_IMP (vec_difference_u32) (unsigned int *out,
+				    const unsigned int *a, unsigned long na,
+				    const unsigned int *b, unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_intersect_u32) (unsigned int *out,
+				   const unsigned int *a, unsigned long na,
+				   const unsigned int *b, unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_union_u32) (unsigned int *out,
+			       const unsigned int *a, unsigned long na,
+			       const unsigned int *b, unsigned long nb);
+///@endcond
+
+/** \brief Number of words needed to pack n words of width bits.
+ *
+ *  Each full block of 128 values packs into bits vectors
+ *  (4 * bits words). The remaining values pack into
+ *  ((n % 128) * bits + 31) / 32 words.
+ *
+ *  @param n number of values.
+ *  @param bits bit width of each packed value (0-32). Larger
+ *  widths are treated as 32, as the pack and unpack functions do.
+ *  @return the number of words.
+ */
+static inline unsigned long
+vec_bitpack_words_u32 (unsigned long n, unsigned int bits)
+{
+  if (bits > 32)
+    bits = 32;
+  return (n / 128) * 4 * bits + ((n % 128) * bits + 31) / 32;
+}
+
+/** \brief Pack an array of words.
+ *
+ *  Store the low order bits bits of each value.
+ *  Values are packed in blocks of 128, each word element of the
+ *  vector an independent lane, SIMD-BP128 style.
+ *  Values that do not fit in bits bits are truncated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitpack_u32_PWR7,
+ *  vec_bitpack_u32_PWR8, vec_bitpack_u32_PWR9,
+ *  and vec_bitpack_u32_PWR10.
+ *
+ *  @param out array of vec_bitpack_words_u32(n, bits) words.
+ *  @param in array of n words.
+ *  @param n number of values.
+ *  @param bits bit width of each packed value (0-32).
+ *  @return the number of words stored to out.
+ */
+extern unsigned long
+vec_bitpack_u32 (unsigned int *out, const unsigned int *in, unsigned long n,
+		 unsigned int bits);
+
+/** \brief Unpack an array of words.
+ *
+ *  Unpack n values of bits bits from in, as stored by
+ *  vec_bitpack_u32().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitunpack_u32_PWR7,
+ *  vec_bitunpack_u32_PWR8, vec_bitunpack_u32_PWR9,
+ *  and vec_bitunpack_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in packed array from vec_bitpack_u32().
+ *  @param n number of values.
+ *  @param bits bit width of each packed value (0-32).
+ */
+extern void
+vec_bitunpack_u32 (unsigned int *out, const unsigned int *in, unsigned long n,
+		   unsigned int bits);
+
+/** \brief Frame of reference pack an array of words.
+ *
+ *  Store (in[i] - base) in bits bits.
+ *  Values are packed in blocks of 128, each word element of the
+ *  vector an independent lane, SIMD-BP128 style.
+ *  Values that do not fit in bits bits are truncated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitpack_for_u32_PWR7,
+ *  vec_bitpack_for_u32_PWR8, vec_bitpack_for_u32_PWR9,
+ *  and vec_bitpack_for_u32_PWR10.
+ *
+ *  @param out array of vec_bitpack_words_u32(n, bits) words.
+ *  @param in array of n words.
+ *  @param n number of values.
+ *  @param base value subtracted from every element.
+ *  @param bits bit width of each packed value (0-32).
+ *  @return the number of words stored to out.
+ */
+extern unsigned long
+vec_bitpack_for_u32 (unsigned int *out, const unsigned int *in,
+		     unsigned long n, unsigned int base, unsigned int bits);
+
+/** \brief Unpack an array of words (frame of reference).
+ *
+ *  Unpack n values of bits bits from in, as stored by
+ *  vec_bitpack_for_u32() and add base to each value.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitunpack_for_u32_PWR7,
+ *  vec_bitunpack_for_u32_PWR8, vec_bitunpack_for_u32_PWR9,
+ *  and vec_bitunpack_for_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in packed array from vec_bitpack_for_u32().
+ *  @param n number of values.
+ *  @param base value added to every element.
+ *  @param bits bit width of each packed value (0-32).
+ */
+extern void
+vec_bitunpack_for_u32 (unsigned int *out, const unsigned int *in,
+		       unsigned long n, unsigned int base, unsigned int bits);
+
+/** \brief Delta pack an array of words.
+ *
+ *  Store the difference from the previous value in the same lane,
+ *  (in[i] - in[i-4]) in bits bits, with init for the first 4 values.
+ *  Values are packed in blocks of 128, each word element of the vector
+ *  an independent lane, SIMD-BP128 style. Values that do not fit in
+ *  bits bits are truncated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitpack_delta_u32_PWR7,
+ *  vec_bitpack_delta_u32_PWR8, vec_bitpack_delta_u32_PWR9,
+ *  and vec_bitpack_delta_u32_PWR10.
+ *
+ *  @param out array of vec_bitpack_words_u32(n, bits) words.
+ *  @param in array of n words.
+ *  @param n number of values.
+ *  @param init the value preceding the first 4 elements.
+ *  @param bits bit width of each packed value (0-32).
+ *  @return the number of words stored to out.
+ */
+extern unsigned long
+vec_bitpack_delta_u32 (unsigned int *out, const unsigned int *in,
+		       unsigned long n, unsigned int init, unsigned int bits);
+
+/** \brief Unpack an array of words (delta).
+ *
+ *  Unpack n values of bits bits from in, as stored by
+ *  vec_bitpack_delta_u32() and add the previous value in the same lane
+ *  (a prefix sum per lane).
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitunpack_delta_u32_PWR7,
+ *  vec_bitunpack_delta_u32_PWR8, vec_bitunpack_delta_u32_PWR9,
+ *  and vec_bitunpack_delta_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in packed array from vec_bitpack_delta_u32().
+ *  @param n number of values.
+ *  @param init the value preceding the first 4 elements.
+ *  @param bits bit width of each packed value (0-32).
+ */
+extern void
+vec_bitunpack_delta_u32 (unsigned int *out, const unsigned int *in,
+			 unsigned long n, unsigned int init,
+			 unsigned int bits);
+
+///@cond INTERNAL
+extern unsigned long
+__VEC_PWR_IMP (vec_bitpack_u32) (unsigned int *out, const unsigned int *in,
+				 unsigned long n, unsigned int bits);
+extern void
+__VEC_PWR_IMP (vec_bitunpack_u32) (unsigned int *out, const unsigned int *in,
+				   unsigned long n, unsigned int bits);
+extern unsigned long
+__VEC_PWR_IMP (vec_bitpack_for_u32) (unsigned int *out, const unsigned int *in,
+				     unsigned long n, unsigned int base,
+				     unsigned int bits);
+extern void
+__VEC_PWR_IMP (vec_bitunpack_for_u32) (unsigned int *out,
+				       const unsigned int *in, unsigned long n,
+				       unsigned int base, unsigned int bits);
+extern unsigned long
+__VEC_PWR_IMP (vec_bitpack_delta_u32) (unsigned int *out,
+				       const unsigned int *in, unsigned long n,
+				       unsigned int init, unsigned int bits);
+extern void
+__VEC_PWR_IMP (vec_bitunpack_delta_u32) (unsigned int *out,
+					 const unsigned int *in,
+					 unsigned long n, unsigned int init,
+					 unsigned int bits);
+///@endcond
+
+/** \brief Maximum Stream-VByte encoded size of n words.
+ *
+ *  @param n number of words.
+ *  @return the number of bytes to allocate for vec_svb_encode_u32().
+ */
+static inline unsigned long
+vec_svb_bound_u32 (unsigned long n)
+{
+  return (n + 3) / 4 + 4 * n;
+}
+
+/** \brief Stream-VByte encode an array of words.
+ *
+ *  Store a control byte for each group of 4 values (2 bits per
+ *  value, the byte length - 1) followed by the low order 1-4 bytes
+ *  of each value, little endian. Each full group is compacted by a
+ *  single vec_perm.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_svb_encode_u32_PWR7,
+ *  vec_svb_encode_u32_PWR8, vec_svb_encode_u32_PWR9,
+ *  and vec_svb_encode_u32_PWR10.
+ *
+ *  @param out array of vec_svb_bound_u32(n) bytes.
+ *  @param in array of n words.
+ *  @param n number of values.
+ *  @return the number of bytes stored to out.
+ */
+extern unsigned long
+vec_svb_encode_u32 (unsigned char *out, const unsigned int *in,
+		    unsigned long n);
+
+/** \brief Stream-VByte decode an array of words.
+ *
+ *  Decode n values as stored by vec_svb_encode_u32(). Each group of
+ *  4 values is one 16 byte load, a vec_perm selected by the control
+ *  byte, and one 16 byte store. Does not read past the encoded
+ *  data.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_svb_decode_u32_PWR7,
+ *  vec_svb_decode_u32_PWR8, vec_svb_decode_u32_PWR9,
+ *  and vec_svb_decode_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in encoded bytes from vec_svb_encode_u32().
+ *  @param n number of values.
+ *  @return the number of bytes read from in.
+ */
+extern unsigned long
+vec_svb_decode_u32 (unsigned int *out, const unsigned char *in,
+		    unsigned long n);
+
+/** \brief Maximum LEB128 encoded size of n words.
+ *
+ *  @param n number of words.
+ *  @return the number of bytes to allocate for vec_leb128_encode_u32().
+ */
+static inline unsigned long
+vec_leb128_bound_u32 (unsigned long n)
+{
+  return 5 * n;
+}
+
+/** \brief LEB128 (protobuf varint) encode an array of words.
+ *
+ *  Store each value 7 bits per byte, low order first, with the high
+ *  bit set on all but the last byte.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_leb128_encode_u32_PWR7,
+ *  vec_leb128_encode_u32_PWR8, vec_leb128_encode_u32_PWR9,
+ *  and vec_leb128_encode_u32_PWR10.
+ *
+ *  @param out array of vec_leb128_bound_u32(n) bytes.
+ *  @param in array of n words.
+ *  @param n number of values.
+ *  @return the number of bytes stored to out.
+ */
+extern unsigned long
+vec_leb128_encode_u32 (unsigned char *out, const unsigned int *in,
+		       unsigned long n);
+
+/** \brief LEB128 (protobuf varint) decode an array of words.
+ *
+ *  Decode n varints from the len bytes at in. Varints of up to 10
+ *  bytes are accepted and truncated to 32 bits, as for protobuf
+ *  int32 fields. 16 bytes are checked at a time, so runs of single
+ *  byte varints are decoded 16 per iteration.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_leb128_decode_u32_PWR7,
+ *  vec_leb128_decode_u32_PWR8, vec_leb128_decode_u32_PWR9,
+ *  and vec_leb128_decode_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in encoded bytes.
+ *  @param len number of bytes at in.
+ *  @param n number of values.
+ *  @return the number of bytes read from in, or -1 if in ends
+ *  within a varint or a varint is longer than 10 bytes.
+ */
+extern long
+vec_leb128_decode_u32 (unsigned int *out, const unsigned char *in,
+		       unsigned long len, unsigned long n);
+
+/** \brief Inclusive prefix sum of an array of words.
+ *
+ *  out[i] = init + in[0] + ... + in[i], modulo 2<SUP>32</SUP>.
+ *  Each vector is scanned in register by 2 shifted adds
+ *  (vec_sldqi() by 1 and 2 words), then the splatted running sum is
+ *  added. out may equal in.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_prefix_sum_u32_PWR7,
+ *  vec_prefix_sum_u32_PWR8, vec_prefix_sum_u32_PWR9,
+ *  and vec_prefix_sum_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in array of n words.
+ *  @param n number of elements.
+ *  @param init the initial sum (carry in from a previous block).
+ *  @return the sum of init and all n elements.
+ */
+extern unsigned int
+vec_prefix_sum_u32 (unsigned int *out, const unsigned int *in,
+		    unsigned long n, unsigned int init);
+
+/** \brief Exclusive prefix sum of an array of words.
+ *
+ *  out[i] = init + in[0] + ... + in[i-1], modulo 2<SUP>32</SUP>.
+ *  As vec_prefix_sum_u32() with the input subtracted from each sum.
+ *  out may equal in.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_prefix_sum_excl_u32_PWR7,
+ *  vec_prefix_sum_excl_u32_PWR8, vec_prefix_sum_excl_u32_PWR9,
+ *  and vec_prefix_sum_excl_u32_PWR10.
+ *
+ *  @param out array of n words.
+ *  @param in array of n words.
+ *  @param n number of elements.
+ *  @param init the initial sum (carry in from a previous block).
+ *  @return the sum of init and all n elements.
+ */
+extern unsigned int
+vec_prefix_sum_excl_u32 (unsigned int *out, const unsigned int *in,
+			 unsigned long n, unsigned int init);
+
+///@cond INTERNAL
+extern long
+__VEC_PWR_IMP (vec_leb128_decode_u32) (unsigned int *out,
+				       const unsigned char *in,
+				       unsigned long len, unsigned long n);
+extern unsigned long
+__VEC_PWR_IMP (vec_leb128_encode_u32) (unsigned char *out,
+				       const unsigned int *in,
+				       unsigned long n);
+extern unsigned int
+__VEC_PWR_IMP (vec_prefix_sum_excl_u32) (unsigned int *out,
+					 const unsigned int *in,
+					 unsigned long n, unsigned int init);
+extern unsigned int
+__VEC_PWR_IMP (vec_prefix_sum_u32) (unsigned int *out,
+				    const unsigned int *in,
+				    unsigned long n, unsigned int init);
+extern unsigned long
+__VEC_PWR_IMP (vec_svb_decode_u32) (unsigned int *out,
+				    const unsigned char *in, unsigned long n);
+extern unsigned long
+__VEC_PWR_IMP (vec_svb_encode_u32) (unsigned char *out,
+				    const unsigned int *in, unsigned long n);
+///@endcond
+
+/** \brief Q15/Q31 rounding mode, truncate (round toward -infinity).  */
+#define VEC_Q_RND_TRUNC 0
+/** \brief Q15/Q31 rounding mode, round to nearest, ties up.  */
+#define VEC_Q_RND_NEAREST 1
+/** \brief Q15/Q31 rounding mode, round to nearest, ties to even
+ *  (convergent rounding).  */
+#define VEC_Q_RND_EVEN 2
+
+/** \brief Block FIR filter of Q15 samples.
+ *
+ *  out[i] = sat(rnd(coef[0]*in[i+ntaps-1] + ... +
+ *  coef[ntaps-1]*in[i])), for i = 0 to n-1. The input holds the
+ *  ntaps-1 history samples followed by the n new samples.
+ *
+ *  Eight outputs are accumulated per vector with vec_mule/vec_mulo
+ *  of a splatted tap, each Q30 product widened to a doubleword so
+ *  the sum is exact. The sum is then rounded and saturated to Q15.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q15_fir_PWR7,
+ *  vec_q15_fir_PWR8, vec_q15_fir_PWR9,
+ *  and vec_q15_fir_PWR10.
+ *
+ *  @param out array of n Q15 outputs.
+ *  @param in array of n+ntaps-1 Q15 samples.
+ *  @param n number of outputs.
+ *  @param coef array of ntaps Q15 coefficients.
+ *  @param ntaps number of taps.
+ *  @param rnd rounding mode VEC_Q_RND_TRUNC, VEC_Q_RND_NEAREST or
+ *  VEC_Q_RND_EVEN.
+ */
+extern void
+vec_q15_fir (short *out, const short *in, unsigned long n,
+	     const short *coef, unsigned long ntaps, int rnd);
+
+/** \brief Saturating dot product of Q15 arrays.
+ *
+ *  The Q30 products are summed exactly in 64-bit, then rounded to
+ *  Q15 and saturated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q15_dot_PWR7,
+ *  vec_q15_dot_PWR8, vec_q15_dot_PWR9,
+ *  and vec_q15_dot_PWR10.
+ *
+ *  @param a array of n Q15 values.
+ *  @param b array of n Q15 values.
+ *  @param n number of elements.
+ *  @param rnd rounding mode.
+ *  @return the Q15 saturated sum of a[i]*b[i].
+ */
+extern short
+vec_q15_dot (const short *a, const short *b, unsigned long n, int rnd);
+
+/** \brief Biquad (second order IIR) cascade of Q15 samples.
+ *
+ *  Each section computes the direct form I recurrence
+ *  y[n] = sat(rnd((b0*x[n] + b1*x[n-1] + b2*x[n-2] + a1*y[n-1] +
+ *  a2*y[n-2]) >> (15-shift))), with coefficients {b0, b1, b2, a1,
+ *  a2} in Q(15-shift). Note the feedback coefficients are added, so
+ *  are the negated a1, a2 of the usual transfer function. The output
+ *  of each section is the input of the next.
+ *
+ *  The feed-forward sums are computed exactly, in doublewords, with
+ *  vectors over blocks of samples. The feedback terms are applied
+ *  per sample in 64-bit. out may equal in.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q15_biquad_PWR7,
+ *  vec_q15_biquad_PWR8, vec_q15_biquad_PWR9,
+ *  and vec_q15_biquad_PWR10.
+ *
+ *  @param out array of n Q15 outputs.
+ *  @param in array of n Q15 samples.
+ *  @param n number of samples.
+ *  @param coef array of 5*stages coefficients.
+ *  @param state array of 4*stages values {x[n-1], x[n-2], y[n-1],
+ *  y[n-2]}, zero initially and updated for the next block.
+ *  @param stages number of sections.
+ *  @param shift coefficient scale (0-14), to allow coefficients
+ *  up to +-2<SUP>shift</SUP>.
+ *  @param rnd rounding mode.
+ */
+extern void
+vec_q15_biquad (short *out, const short *in, unsigned long n,
+		const short *coef, short *state, unsigned long stages,
+		int shift, int rnd);
+
+/** \brief Complex multiply of Q15 arrays.
+ *
+ *  Elements are interleaved {real, imaginary} halfword pairs.
+ *  out[k] = sat(rnd(a[k]*b[k])), with full precision products and
+ *  one rounding per part. out may equal a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q15_cmul_PWR7,
+ *  vec_q15_cmul_PWR8, vec_q15_cmul_PWR9,
+ *  and vec_q15_cmul_PWR10.
+ *
+ *  @param out array of n complex (2n halfword) results.
+ *  @param a array of n complex values.
+ *  @param b array of n complex values.
+ *  @param n number of complex elements.
+ *  @param rnd rounding mode.
+ */
+extern void
+vec_q15_cmul (short *out, const short *a, const short *b,
+	      unsigned long n, int rnd);
+
+/** \brief Block FIR filter of Q31 samples.
+ *
+ *  As vec_q15_fir() for Q31 samples and coefficients. Each Q62
+ *  product (vec_mulesw/vec_mulosw) is truncated to Q48 and summed in
+ *  64-bit, giving 15 bits of headroom and an error below
+ *  ntaps * 2<SUP>-48</SUP>.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q31_fir_PWR7,
+ *  vec_q31_fir_PWR8, vec_q31_fir_PWR9,
+ *  and vec_q31_fir_PWR10.
+ *
+ *  @param out array of n Q31 outputs.
+ *  @param in array of n+ntaps-1 Q31 samples.
+ *  @param n number of outputs.
+ *  @param coef array of ntaps Q31 coefficients.
+ *  @param ntaps number of taps.
+ *  @param rnd rounding mode.
+ */
+extern void
+vec_q31_fir (int *out, const int *in, unsigned long n,
+	     const int *coef, unsigned long ntaps, int rnd);
+
+/** \brief Saturating dot product of Q31 arrays.
+ *
+ *  Each Q62 product is truncated to Q48 and summed in 64-bit, then
+ *  rounded to Q31 and saturated. Exact to within n * 2<SUP>-48</SUP>
+ *  for n up to 2<SUP>15</SUP>.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q31_dot_PWR7,
+ *  vec_q31_dot_PWR8, vec_q31_dot_PWR9,
+ *  and vec_q31_dot_PWR10.
+ *
+ *  @param a array of n Q31 values.
+ *  @param b array of n Q31 values.
+ *  @param n number of elements.
+ *  @param rnd rounding mode.
+ *  @return the Q31 saturated sum of a[i]*b[i].
+ */
+extern int
+vec_q31_dot (const int *a, const int *b, unsigned long n, int rnd);
+
+/** \brief Complex multiply of Q31 arrays.
+ *
+ *  As vec_q15_cmul() for interleaved {real, imaginary} word pairs,
+ *  with full precision Q62 products.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_q31_cmul_PWR7,
+ *  vec_q31_cmul_PWR8, vec_q31_cmul_PWR9,
+ *  and vec_q31_cmul_PWR10.
+ *
+ *  @param out array of n complex (2n word) results.
+ *  @param a array of n complex values.
+ *  @param b array of n complex values.
+ *  @param n number of complex elements.
+ *  @param rnd rounding mode.
+ */
+extern void
+vec_q31_cmul (int *out, const int *a, const int *b, unsigned long n,
+	      int rnd);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_q15_biquad) (short *out, const short *in,
+				unsigned long n, const short *coef,
+				short *state, unsigned long stages,
+				int shift, int rnd);
+extern void
+__VEC_PWR_IMP (vec_q15_cmul) (short *out, const short *a, const short *b,
+			      unsigned long n, int rnd);
+extern short
+__VEC_PWR_IMP (vec_q15_dot) (const short *a, const short *b,
+			     unsigned long n, int rnd);
+extern void
+__VEC_PWR_IMP (vec_q15_fir) (short *out, const short *in, unsigned long n,
+			     const short *coef, unsigned long ntaps, int rnd);
+extern void
+__VEC_PWR_IMP (vec_q31_cmul) (int *out, const int *a, const int *b,
+			      unsigned long n, int rnd);
+extern int
+__VEC_PWR_IMP (vec_q31_dot) (const int *a, const int *b, unsigned long n,
+			     int rnd);
+extern void
+__VEC_PWR_IMP (vec_q31_fir) (int *out, const int *in, unsigned long n,
+			     const int *coef, unsigned long ntaps, int rnd);
+///@endcond
+
+/** \brief Rows of A per packed panel for vec_gemm_s8() and
+ *  vec_gemm_s16().  */
+#define VEC_GEMM_MR 8
+/** \brief Columns of B per packed panel for vec_gemm_s8() and
+ *  vec_gemm_s16().  */
+#define VEC_GEMM_NR 8
+
+/** \brief Bytes required by vec_gemm_pack_a_s8() for an m x k
+ *  matrix.
+ *
+ *  Each panel is VEC_GEMM_MR rows of k (rounded up to a multiple of
+ *  4) bytes plus a word of row sum for each row.
+ *
+ *  @param m number of rows.
+ *  @param k number of columns.
+ *  @return size of the packed A array in bytes.
+ */
+static inline unsigned long
+vec_gemm_pack_a_s8_size (unsigned long m, unsigned long k)
+{
+  return ((m + VEC_GEMM_MR - 1) / VEC_GEMM_MR)
+      * (VEC_GEMM_MR * ((k + 3) & ~3UL) + 4 * VEC_GEMM_MR);
+}
+
+/** \brief Bytes required by vec_gemm_pack_b_s8() for a k x n
+ *  matrix.
+ *
+ *  @param k number of rows.
+ *  @param n number of columns.
+ *  @return size of the packed B array in bytes.
+ */
+static inline unsigned long
+vec_gemm_pack_b_s8_size (unsigned long k, unsigned long n)
+{
+  return ((n + VEC_GEMM_NR - 1) / VEC_GEMM_NR)
+      * (VEC_GEMM_NR * ((k + 3) & ~3UL));
+}
+
+/** \brief Halfwords required by vec_gemm_pack_a_s16() for an m x k
+ *  matrix.
+ *
+ *  @param m number of rows.
+ *  @param k number of columns.
+ *  @return size of the packed A array in halfwords.
+ */
+static inline unsigned long
+vec_gemm_pack_a_s16_size (unsigned long m, unsigned long k)
+{
+  return ((m + VEC_GEMM_MR - 1) / VEC_GEMM_MR)
+      * (VEC_GEMM_MR * ((k + 1) & ~1UL));
+}
+
+/** \brief Halfwords required by vec_gemm_pack_b_s16() for a k x n
+ *  matrix.
+ *
+ *  @param k number of rows.
+ *  @param n number of columns.
+ *  @return size of the packed B array in halfwords.
+ */
+static inline unsigned long
+vec_gemm_pack_b_s16_size (unsigned long k, unsigned long n)
+{
+  return ((n + VEC_GEMM_NR - 1) / VEC_GEMM_NR)
+      * (VEC_GEMM_NR * ((k + 1) & ~1UL));
+}
+
+/** \brief Pack a row major int8 matrix A for vec_gemm_s8().
+ *
+ *  Panels of VEC_GEMM_MR rows, with 4 consecutive k values per word
+ *  and the rows of each group of 4 adjacent. Rows beyond m and k
+ *  beyond k are zero. Each panel ends with 128 times the sum of each
+ *  row, to correct for the bias of the packed B.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_gemm_pack_a_s8_PWR7,
+ *  vec_gemm_pack_a_s8_PWR8, vec_gemm_pack_a_s8_PWR9,
+ *  and vec_gemm_pack_a_s8_PWR10.
+ *
+ *  @param pa array of vec_gemm_pack_a_s8_size(m,k) bytes.
+ *  @param a m x k matrix.
+ *  @param lda row stride of a in elements.
+ *  @param m number of rows.
+ *  @param k number of columns.
+ */
+extern void
+vec_gemm_pack_a_s8 (signed char *pa, const signed char *a,
+		    unsigned long lda, unsigned long m, unsigned long k);
+
+/** \brief Pack a row major int8 matrix B for vec_gemm_s8().
+ *
+ *  Panels of VEC_GEMM_NR columns, with 4 consecutive k values per
+ *  word. The multiply-sum instructions (vmsummbm, xvi8ger4pp) treat
+ *  B as unsigned, so each element is stored biased by +128.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_gemm_pack_b_s8_PWR7,
+ *  vec_gemm_pack_b_s8_PWR8, vec_gemm_pack_b_s8_PWR9,
+ *  and vec_gemm_pack_b_s8_PWR10.
+ *
+ *  @param pb array of vec_gemm_pack_b_s8_size(k,n) bytes.
+ *  @param b k x n matrix.
+ *  @param ldb row stride of b in elements.
+ *  @param k number of rows.
+ *  @param n number of columns.
+ */
+extern void
+vec_gemm_pack_b_s8 (unsigned char *pb, const signed char *b,
+		    unsigned long ldb, unsigned long k, unsigned long n);
+
+/** \brief Int8 matrix multiply with int32 results.
+ *
+ *  C = A * B (or C += A * B if accum is nonzero) for packed A (m x k)
+ *  and B (k x n), modulo 2<SUP>32</SUP>. Each VEC_GEMM_MR x
+ *  VEC_GEMM_NR tile of C is accumulated in registers over all k,
+ *  using vmsummbm on POWER7-9 and the MMA xvi8ger4pp rank-4 update
+ *  on POWER10.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_gemm_s8_PWR7,
+ *  vec_gemm_s8_PWR8, vec_gemm_s8_PWR9,
+ *  and vec_gemm_s8_PWR10.
+ *
+ *  @param c row major m x n result.
+ *  @param ldc row stride of c in elements.
+ *  @param pa A packed by vec_gemm_pack_a_s8().
+ *  @param pb B packed by vec_gemm_pack_b_s8().
+ *  @param m rows of A and C.
+ *  @param n columns of B and C.
+ *  @param k columns of A and rows of B.
+ *  @param accum nonzero to add to the existing contents of c.
+ */
+extern void
+vec_gemm_s8 (int *c, unsigned long ldc, const signed char *pa,
+	     const unsigned char *pb, unsigned long m, unsigned long n,
+	     unsigned long k, int accum);
+
+/** \brief Pack a row major int16 matrix A for vec_gemm_s16().
+ *
+ *  As vec_gemm_pack_a_s8() with 2 consecutive k values per word and
+ *  no row sums.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_gemm_pack_a_s16_PWR7,
+ *  vec_gemm_pack_a_s16_PWR8, vec_gemm_pack_a_s16_PWR9,
+ *  and vec_gemm_pack_a_s16_PWR10.
+ *
+ *  @param pa array of vec_gemm_pack_a_s16_size(m,k) halfwords.
+ *  @param a m x k matrix.
+ *  @param lda row stride of a in elements.
+ *  @param m number of rows.
+ *  @param k number of columns.
+ */
+extern void
+vec_gemm_pack_a_s16 (short *pa, const short *a, unsigned long lda,
+		     unsigned long m, unsigned long k);
+
+/** \brief Pack a row major int16 matrix B for vec_gemm_s16().
+ *
+ *  As vec_gemm_pack_b_s8() with 2 consecutive k values per word and
+ *  no bias.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_gemm_pack_b_s16_PWR7,
+ *  vec_gemm_pack_b_s16_PWR8, vec_gemm_pack_b_s16_PWR9,
+ *  and vec_gemm_pack_b_s16_PWR10.
+ *
+ *  @param pb array of vec_gemm_pack_b_s16_size(k,n) halfwords.
+ *  @param b k x n matrix.
+ *  @param ldb row stride of b in elements.
+ *  @param k number of rows.
+ *  @param n number of columns.
+ */
+extern void
+vec_gemm_pack_b_s16 (short *pb, const short *b, unsigned long ldb,
+		     unsigned long k, unsigned long n);
+
+/** \brief Int16 matrix multiply with int32 results.
+ *
+ *  As vec_gemm_s8() for int16 elements, using vmsumshm on POWER7-9
+ *  and the MMA xvi16ger2pp rank-2 update on POWER10.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_gemm_s16_PWR7,
+ *  vec_gemm_s16_PWR8, vec_gemm_s16_PWR9,
+ *  and vec_gemm_s16_PWR10.
+ *
+ *  @param c row major m x n result.
+ *  @param ldc row stride of c in elements.
+ *  @param pa A packed by vec_gemm_pack_a_s16().
+ *  @param pb B packed by vec_gemm_pack_b_s16().
+ *  @param m rows of A and C.
+ *  @param n columns of B and C.
+ *  @param k columns of A and rows of B.
+ *  @param accum nonzero to add to the existing contents of c.
+ */
+extern void
+vec_gemm_s16 (int *c, unsigned long ldc, const short *pa,
+	      const short *pb, unsigned long m, unsigned long n,
+	      unsigned long k, int accum);
+
+/** \brief Dot product of int8 arrays.
+ *
+ *  The sum of a[i]*b[i] modulo 2<SUP>32</SUP>, 32 elements per
+ *  iteration with vmsummbm.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_dot_s8_PWR7,
+ *  vec_dot_s8_PWR8, vec_dot_s8_PWR9,
+ *  and vec_dot_s8_PWR10.
+ *
+ *  @param a array of n bytes.
+ *  @param b array of n bytes.
+ *  @param n number of elements.
+ *  @return the int32 dot product.
+ */
+extern int
+vec_dot_s8 (const signed char *a, const signed char *b, unsigned long n);
+
+/** \brief Dot product of int16 arrays.
+ *
+ *  The sum of a[i]*b[i] modulo 2<SUP>32</SUP>, 16 elements per
+ *  iteration with vmsumshm.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_dot_s16_PWR7,
+ *  vec_dot_s16_PWR8, vec_dot_s16_PWR9,
+ *  and vec_dot_s16_PWR10.
+ *
+ *  @param a array of n halfwords.
+ *  @param b array of n halfwords.
+ *  @param n number of elements.
+ *  @return the int32 dot product.
+ */
+extern int
+vec_dot_s16 (const short *a, const short *b, unsigned long n);
+
+/** \brief Dot product of int16 arrays with an int64 result.
+ *
+ *  The exact sum of a[i]*b[i], for n up to 2<SUP>33</SUP>.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_dot_s16_s64_PWR7,
+ *  vec_dot_s16_s64_PWR8, vec_dot_s16_s64_PWR9,
+ *  and vec_dot_s16_s64_PWR10.
+ *
+ *  @param a array of n halfwords.
+ *  @param b array of n halfwords.
+ *  @param n number of elements.
+ *  @return the int64 dot product.
+ */
+extern long long
+vec_dot_s16_s64 (const short *a, const short *b, unsigned long n);
+
+///@cond INTERNAL
+extern int
+__VEC_PWR_IMP (vec_dot_s16) (const short *a, const short *b,
+			     unsigned long n);
+extern long long
+__VEC_PWR_IMP (vec_dot_s16_s64) (const short *a, const short *b,
+				 unsigned long n);
+extern int
+__VEC_PWR_IMP (vec_dot_s8) (const signed char *a, const signed char *b,
+			    unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_gemm_pack_a_s16) (short *pa, const short *a,
+				     unsigned long lda, unsigned long m,
+				     unsigned long k);
+extern void
+__VEC_PWR_IMP (vec_gemm_pack_a_s8) (signed char *pa, const signed char *a,
+				    unsigned long lda, unsigned long m,
+				    unsigned long k);
+extern void
+__VEC_PWR_IMP (vec_gemm_pack_b_s16) (short *pb, const short *b,
+				     unsigned long ldb, unsigned long k,
+				     unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_gemm_pack_b_s8) (unsigned char *pb, const signed char *b,
+				    unsigned long ldb, unsigned long k,
+				    unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_gemm_s16) (int *c, unsigned long ldc, const short *pa,
+			      const short *pb, unsigned long m,
+			      unsigned long n, unsigned long k, int accum);
+extern void
+__VEC_PWR_IMP (vec_gemm_s8) (int *c, unsigned long ldc,
+			     const signed char *pa, const unsigned char *pb,
+			     unsigned long m, unsigned long n, unsigned long k,
+			     int accum);
+///@endcond
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* VEC_INT32_PPC_H_ */
@@ -26,6 +26,10 @@
 
 #include <pveclib/vec_int128_ppc.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file  vec_int512_ppc.h
  * \brief Header package containing a collection of multiple precision
@@ -2104,6 +2108,10 @@ vec_mul2048x2048 (__VEC_U_4096 *p4096,
  *  On Big Endian systems the least significant quadword is
  *  quadword elements [M-1], [N-1], and [M+N-1].
  *  The most significant is quadword element 0.
+ *  \note The common fixed sizes (2x2, 4x4, 8x8, 16x16, 8x1 and 16x1
+ *  quadwords, in either operand order) are dispatched to fully
+ *  unrolled implementations that hold the partial product row in
+ *  vector registers. Other sizes use the generic loop.
  *
  *  |processor|Latency|Throughput|
  *  |--------:|:-----:|:---------|
@@ -2137,6 +2145,8 @@ vec_mul128_byMN  (vui128_t *p,
  *  On Big Endian systems the least significant quadword is
  *  quadword elements [M-1], [N-1], and [M+N-1].
  *  The most significant is quadword element 0.
+ *  \note The 2x2 and 4x4 cases are dispatched to the straight line
+ *  vec_mul1024x1024() and vec_mul2048x2048() implementations.
  *
  *  |processor|  Latency   |Throughput|
  *  |--------:|:----------:|:---------|
@@ -2154,6 +2164,43 @@ vec_mul512_byMN  (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
 
+/** \brief Vector Unsigned Integer Quadword 4xMxN Multiply, using
+ *  multiple threads.
+ *
+ *  Compute the 4xM+N quadword product of two quadword arrays m1, m2,
+ *  splitting the work across the runtime worker pool.
+ *  The product is returned as 4xM+N quadword array p.
+ *
+ *  The larger operand is split into equal slices of 512-bit blocks.
+ *  Each pool thread computes the product of one slice and the whole
+ *  smaller operand (via vec_mul512_byMN()) into private scratch
+ *  storage. The partial products are then summed into p with carry
+ *  propagation. The result is identical to vec_mul512_byMN().
+ *
+ *  If the pool is configured for a single thread
+ *  (see vec_pool_set_threads() in vec_runtime_ppc.h), M*N is less than 256 512-bit block
+ *  products, or the scratch storage can not be allocated,
+ *  this falls back to vec_mul512_byMN() on the calling thread.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The static implementations are vec_mul512_byMN_parallel_PWR8 and
+ *  vec_mul512_byMN_parallel_PWR9. For static calls the __VEC_PWR_IMP()
+ *  macro will add appropriate suffix based on the compile -mcpu= option.
+ *  \note The storage order for quadwords matches the system endian,
+ *  as for vec_mul512_byMN().
+ *  \note The storage for p must not overlap m1 or m2.
+ *
+ *  @param p pointer to vector result as a unsigned (M+N)x512-bit integer in storage.
+ *  @param m1 pointer to vector representation of a unsigned Mx512-bit integer.
+ *  @param m2 pointer ro vector representation of a unsigned Nx512-bit integer.
+ *  @param M long int specifying the number of 4x quadwords in m1.
+ *  @param N long int specifying the number of 4x quadwords in m2.
+ */
+extern void
+vec_mul512_byMN_parallel  (__VEC_U_512 *p,
+                  __VEC_U_512 *m1, __VEC_U_512 *m2,
+		  unsigned long M, unsigned long N);
+
 ///@cond INTERNAL
 /* Doxygen can not handle macros or attributes */
 extern __VEC_U_256
@@ -2201,6 +2248,15 @@ extern void
 __VEC_PWR_IMP (vec_mul512_byMN) (__VEC_U_512 *p,
                   __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N);
+
+extern void
+__VEC_PWR_IMP (vec_mul512_byMN_parallel) (__VEC_U_512 *p,
+                  __VEC_U_512 *m1, __VEC_U_512 *m2,
+		  unsigned long M, unsigned long N);
 ///@endcond
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* SRC_PVECLIB_VEC_INT512_PPC_H_ */
@@ -26,6 +26,10 @@
 
 #include <pveclib/vec_int32_ppc.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 /*!
  * \file vec_int64_ppc.h
  * \brief Header package containing a collection of 128-bit SIMD
@@ -3807,6 +3811,80 @@ vec_minud (vui64_t vra, vui64_t vrb)
   return r;
 }
 
+/** \brief Vector Minimum and Maximum Signed Doubleword, in place.
+ *
+ *  The compare-exchange step of sorting networks.
+ *  For each doubleword element [0|1] of *vra and *vrb compare as
+ *  signed integers and return the smaller value in *vra and the
+ *  larger value in *vrb.
+ *
+ *  For POWER8 and later this is vminsd/vmaxsd. For POWER7,
+ *  where doubleword compare is emulated, a single vec_cmpgtsd()
+ *  mask selects both results.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power7   | 10-16 | 1/cycle  |
+ *  |power8   | 2     | 2/cycle  |
+ *  |power9   | 3     | 2/cycle  |
+ *
+ *  @param vra pointer to 128-bit vector long int, returns the minimum.
+ *  @param vrb pointer to 128-bit vector long int, returns the maximum.
+ */
+static inline void
+vec_minmaxsd (vi64_t *vra, vi64_t *vrb)
+{
+  vi64_t a = *vra, b = *vrb;
+#ifdef _ARCH_PWR8
+  *vra = vec_minsd (a, b);
+  *vrb = vec_maxsd (a, b);
+#else
+  vb64_t gtmask;
+
+  gtmask = vec_cmpgtsd (a, b);
+  *vra = vec_sel (a, b, gtmask);
+  *vrb = vec_sel (b, a, gtmask);
+#endif
+}
+
+/** \brief Vector Minimum and Maximum Unsigned Doubleword, in place.
+ *
+ *  The compare-exchange step of sorting networks.
+ *  For each doubleword element [0|1] of *vra and *vrb compare as
+ *  unsigned integers and return the smaller value in *vra and the
+ *  larger value in *vrb.
+ *
+ *  For POWER8 and later this is vminud/vmaxud. For POWER7,
+ *  where doubleword compare is emulated, a single vec_cmpgtud()
+ *  mask selects both results.
+ *
+ *  |processor|Latency|Throughput|
+ *  |--------:|:-----:|:---------|
+ *  |power7   | 8-14  | 1/cycle  |
+ *  |power8   | 2     | 2/cycle  |
+ *  |power9   | 3     | 2/cycle  |
+ *
+ *  @param vra pointer to 128-bit vector unsigned long int, returns
+ *  the minimum.
+ *  @param vrb pointer to 128-bit vector unsigned long int, returns
+ *  the maximum.
+ */
+static inline void
+vec_minmaxud (vui64_t *vra, vui64_t *vrb)
+{
+  vui64_t a = *vra, b = *vrb;
+#ifdef _ARCH_PWR8
+  *vra = vec_minud (a, b);
+  *vrb = vec_maxud (a, b);
+#else
+  vb64_t gtmask;
+
+  gtmask = vec_cmpgtud (a, b);
+  *vra = vec_sel (a, b, gtmask);
+  *vrb = vec_sel (b, a, gtmask);
+#endif
+}
+
 /** \brief Vector Modulo Double Unsigned Doubleword.
  *
  *  A vectorized 128-bit by 64=bit modulo divide returning
@@ -4727,6 +4805,1214 @@ vec_signextll_word (vi32_t vra)
   return result;
 }
 
+/** \brief Merge a bitonic sequence of doublewords held in vectors.
+ *
+ *  The 2*nv unsigned doubleword elements of v[0] ... v[nv-1],
+ *  in memory order, must form a bitonic sequence (for example an
+ *  ascending run followed by a descending run).
+ *  The result is sorted ascending in memory order.
+ *
+ *  The vector distance steps (nv/2 down to 1) are lane parallel
+ *  vec_minmaxud() compare-exchanges across vectors. The final
+ *  distance 1 step transposes pairs of vectors with vec_mrghd() /
+ *  vec_mrgld() so it is also a compare-exchange across vectors.
+ *
+ *  \note nv must be a power of 2 (2, 4, 8 or 16) and should be a
+ *  constant so the network is fully unrolled.
+ *
+ *  @param v array of nv 128-bit vector unsigned long int.
+ *  @param nv number of vectors.
+ */
+static inline void
+vec_bitonic_mergeud (vui64_t *v, const unsigned int nv)
+{
+  vui64_t x, y;
+  unsigned int d, i;
+
+  for (d = nv / 2; d > 0; d /= 2)
+    for (i = 0; i < nv; i++)
+      if ((i & d) == 0)
+	vec_minmaxud (&v[i], &v[i + d]);
+
+  for (i = 0; i < nv; i += 2)
+    {
+      x = vec_mrghd (v[i], v[i + 1]);
+      y = vec_mrgld (v[i], v[i + 1]);
+      vec_minmaxud (&x, &y);
+      v[i] = vec_mrghd (x, y);
+      v[i + 1] = vec_mrgld (x, y);
+    }
+}
+
+///@cond INTERNAL
+/* Sort the 2*nv doublewords of v[0..nv-1] ascending in memory order.
+ * Bitonic sort the two columns (doubleword lanes) across vectors,
+ * transpose the columns into two sorted runs, then reverse the
+ * second run and bitonic merge.  */
+static inline void
+vec_sortnud_inline (vui64_t *v, const unsigned int nv)
+{
+  vui64_t t[16];
+  unsigned int k, j, i, l;
+
+  for (k = 2; k <= nv; k *= 2)
+    for (j = k / 2; j > 0; j /= 2)
+      for (i = 0; i < nv; i++)
+	{
+	  l = i ^ j;
+	  if (l > i)
+	    {
+	      if ((i & k) == 0)
+		vec_minmaxud (&v[i], &v[l]);
+	      else
+		vec_minmaxud (&v[l], &v[i]);
+	    }
+	}
+
+  for (i = 0; i < nv / 2; i++)
+    {
+      t[i] = vec_mrghd (v[2 * i], v[2 * i + 1]);
+      t[nv - 1 - i] = vec_swapd (vec_mrgld (v[2 * i], v[2 * i + 1]));
+    }
+  for (i = 0; i < nv; i++)
+    v[i] = t[i];
+
+  vec_bitonic_mergeud (v, nv);
+}
+
+/* Signed sort as unsigned sort of the sign flipped keys.  */
+static inline void
+vec_sortnsd_inline (vi64_t *v, const unsigned int nv)
+{
+  const vui64_t signmask = CONST_VINT128_DW (0x8000000000000000UL,
+					      0x8000000000000000UL);
+  unsigned int i;
+
+  for (i = 0; i < nv; i++)
+    v[i] = (vi64_t) vec_xor ((vui64_t) v[i], signmask);
+  vec_sortnud_inline ((vui64_t *) v, nv);
+  for (i = 0; i < nv; i++)
+    v[i] = (vi64_t) vec_xor ((vui64_t) v[i], signmask);
+}
+///@endcond
+
+/** \brief Vector Sort 8 Signed Doublewords.
+ *
+ *  Sort the 8 signed doubleword elements of v[0] ... v[3]
+ *  ascending in memory order, entirely in registers.
+ *  The keys are sign flipped and sorted as unsigned.
+ *
+ *  @param v array of 4 x 128-bit vector long int.
+ */
+static inline void
+vec_sort8sd (vi64_t v[4])
+{
+  vec_sortnsd_inline (v, 4);
+}
+
+/** \brief Vector Sort 8 Unsigned Doublewords.
+ *
+ *  Sort the 8 unsigned doubleword elements of v[0] ... v[3]
+ *  ascending in memory order, entirely in registers.
+ *  This is 6 column compare-exchanges plus 6 merge
+ *  compare-exchanges, 12 vec_minmaxud() operations in total.
+ *
+ *  @param v array of 4 x 128-bit vector unsigned long int.
+ */
+static inline void
+vec_sort8ud (vui64_t v[4])
+{
+  vec_sortnud_inline (v, 4);
+}
+
+/** \brief Vector Sort 16 Signed Doublewords.
+ *
+ *  Sort the 16 signed doubleword elements of v[0] ... v[7]
+ *  ascending in memory order, entirely in registers.
+ *
+ *  @param v array of 8 x 128-bit vector long int.
+ */
+static inline void
+vec_sort16sd (vi64_t v[8])
+{
+  vec_sortnsd_inline (v, 8);
+}
+
+/** \brief Vector Sort 16 Unsigned Doublewords.
+ *
+ *  Sort the 16 unsigned doubleword elements of v[0] ... v[7]
+ *  ascending in memory order, entirely in registers.
+ *
+ *  @param v array of 8 x 128-bit vector unsigned long int.
+ */
+static inline void
+vec_sort16ud (vui64_t v[8])
+{
+  vec_sortnud_inline (v, 8);
+}
+
+/** \brief Vector Sort 32 Signed Doublewords.
+ *
+ *  Sort the 32 signed doubleword elements of v[0] ... v[15]
+ *  ascending in memory order.
+ *
+ *  @param v array of 16 x 128-bit vector long int.
+ */
+static inline void
+vec_sort32sd (vi64_t v[16])
+{
+  vec_sortnsd_inline (v, 16);
+}
+
+/** \brief Vector Sort 32 Unsigned Doublewords.
+ *
+ *  Sort the 32 unsigned doubleword elements of v[0] ... v[15]
+ *  ascending in memory order.
+ *  Uses 16 of the 64 VSRs for the data (POWER8 and later) so it
+ *  stays in registers for the full network.
+ *
+ *  @param v array of 16 x 128-bit vector unsigned long int.
+ */
+static inline void
+vec_sort32ud (vui64_t v[16])
+{
+  vec_sortnud_inline (v, 16);
+}
+
+/** \brief Merge two sorted arrays of signed doublewords.
+ *
+ *  Merge na elements from a and nb elements from b, both sorted
+ *  ascending, into out (na+nb elements). out must not overlap a or b.
+ *  Blocks of 8 elements are merged with vec_bitonic_mergeud().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_merge_s64_PWR7,
+ *  vec_merge_s64_PWR8, vec_merge_s64_PWR9, and vec_merge_s64_PWR10.
+ *
+ *  @param out array of na+nb elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ */
+extern void
+vec_merge_s64 (long long *out, const long long *a, unsigned long na,
+	       const long long *b, unsigned long nb);
+
+/** \brief Merge two sorted arrays of unsigned doublewords.
+ *
+ *  Merge na elements from a and nb elements from b, both sorted
+ *  ascending, into out (na+nb elements). out must not overlap a or b.
+ *  Blocks of 8 elements are merged with vec_bitonic_mergeud().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_merge_u64_PWR7,
+ *  vec_merge_u64_PWR8, vec_merge_u64_PWR9, and vec_merge_u64_PWR10.
+ *
+ *  @param out array of na+nb elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ */
+extern void
+vec_merge_u64 (unsigned long long *out, const unsigned long long *a,
+	       unsigned long na, const unsigned long long *b,
+	       unsigned long nb);
+
+/** \brief Sort an array of signed doublewords.
+ *
+ *  Sort n elements of array ascending, in place.
+ *  Blocks of 32 elements are sorted in registers (vec_sort32sd()),
+ *  then merged bottom up with the vectorized two-way merge.
+ *  The sort is not stable.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sort_s64_PWR7,
+ *  vec_sort_s64_PWR8, vec_sort_s64_PWR9, and vec_sort_s64_PWR10.
+ *  The PWR7 implementation uses the single compare form of
+ *  vec_minmaxsd().
+ *
+ *  \note Uses a temporary buffer of n elements. If that cannot be
+ *  allocated the array is sorted in place by a scalar shell sort.
+ *
+ *  @param array of n signed doublewords.
+ *  @param n number of elements.
+ */
+extern void
+vec_sort_s64 (long long *array, unsigned long n);
+
+/** \brief Sort an array of signed doubleword keys with payload.
+ *
+ *  As vec_sort_s64() for keys, moving the corresponding payload
+ *  elements with the keys. The order of equal keys is unspecified.
+ *
+ *  @param keys array of n signed doublewords.
+ *  @param payload array of n doublewords.
+ *  @param n number of elements.
+ */
+extern void
+vec_sort_s64_kv (long long *keys, unsigned long long *payload,
+		 unsigned long n);
+
+/** \brief Sort an array of unsigned doublewords.
+ *
+ *  Sort n elements of array ascending, in place.
+ *  Blocks of 32 elements are sorted in registers (vec_sort32ud()),
+ *  then merged bottom up with the vectorized two-way merge.
+ *  The sort is not stable.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_sort_u64_PWR7,
+ *  vec_sort_u64_PWR8, vec_sort_u64_PWR9, and vec_sort_u64_PWR10.
+ *  The PWR7 implementation uses the single compare form of
+ *  vec_minmaxud().
+ *
+ *  \note Uses a temporary buffer of n elements. If that cannot be
+ *  allocated the array is sorted in place by a scalar shell sort.
+ *
+ *  @param array of n unsigned doublewords.
+ *  @param n number of elements.
+ */
+extern void
+vec_sort_u64 (unsigned long long *array, unsigned long n);
+
+/** \brief Sort an array of unsigned doubleword keys with payload.
+ *
+ *  As vec_sort_u64() for keys, moving the corresponding payload
+ *  elements with the keys. The order of equal keys is unspecified.
+ *
+ *  @param keys array of n unsigned doublewords.
+ *  @param payload array of n doublewords.
+ *  @param n number of elements.
+ */
+extern void
+vec_sort_u64_kv (unsigned long long *keys, unsigned long long *payload,
+		 unsigned long n);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_merge_s64) (long long *out, const long long *a,
+			       unsigned long na, const long long *b,
+			       unsigned long nb);
+extern void
+__VEC_PWR_IMP (vec_merge_u64) (unsigned long long *out,
+			       const unsigned long long *a, unsigned long na,
+			       const unsigned long long *b, unsigned long nb);
+extern void
+__VEC_PWR_IMP (vec_sort_s64) (long long *array, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sort_s64_kv) (long long *keys,
+				 unsigned long long *payload,
+				 unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sort_u64) (unsigned long long *array, unsigned long n);
+extern void
+__VEC_PWR_IMP (vec_sort_u64_kv) (unsigned long long *keys,
+				 unsigned long long *payload,
+				 unsigned long n);
+///@endcond
+
+/** \brief Difference of two sorted sets of doublewords.
+ *
+ *  Store the elements of a not present in b to out, ascending.
+ *  Blocks of 2 elements of a are compared with all elements of
+ *  a block of b at once (vec_swapd and vec_cmpequd) and the
+ *  unmatched elements packed by vec_perm. If one set is more than
+ *  32 times larger galloping search is used instead.
+ *  The elements of a and b must be strictly increasing.
+ *  out must not overlap a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_difference_u64_PWR7,
+ *  vec_difference_u64_PWR8, vec_difference_u64_PWR9,
+ *  and vec_difference_u64_PWR10.
+ *
+ *  @param out array of na elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ *  @return the number of elements stored to out.
+ */
+extern unsigned long
+vec_difference_u64 (unsigned long long *out, const unsigned long long *a,
+		    unsigned long na, const unsigned long long *b,
+		    unsigned long nb);
+
+/** \brief Intersection of two sorted sets of doublewords.
+ *
+ *  Store the elements present in both a and b to out, ascending.
+ *  Blocks of 2 elements of a are compared with all elements of
+ *  a block of b at once (vec_swapd and vec_cmpequd) and the matches
+ *  packed by vec_perm. If one set is more than 32 times larger
+ *  the elements of the smaller set are found by galloping search.
+ *  The elements of a and b must be strictly increasing.
+ *  out must not overlap a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_intersect_u64_PWR7,
+ *  vec_intersect_u64_PWR8, vec_intersect_u64_PWR9,
+ *  and vec_intersect_u64_PWR10.
+ *
+ *  @param out array of min(na,nb) elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ *  @return the number of elements stored to out.
+ */
+extern unsigned long
+vec_intersect_u64 (unsigned long long *out, const unsigned long long *a,
+		   unsigned long na, const unsigned long long *b,
+		   unsigned long nb);
+
+/** \brief Union of two sorted sets of doublewords.
+ *
+ *  Store the elements present in a or b (or both) to out,
+ *  ascending. Uses a branch free two-way merge, or copies runs of
+ *  the larger set found by galloping search if one set is more
+ *  than 32 times larger.
+ *  The elements of a and b must be strictly increasing.
+ *  out must not overlap a or b.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_union_u64_PWR7,
+ *  vec_union_u64_PWR8, vec_union_u64_PWR9,
+ *  and vec_union_u64_PWR10.
+ *
+ *  @param out array of na+nb elements for the result.
+ *  @param a sorted array of na elements.
+ *  @param na number of elements in a.
+ *  @param b sorted array of nb elements.
+ *  @param nb number of elements in b.
+ *  @return the number of elements stored to out.
+ */
+extern unsigned long
+vec_union_u64 (unsigned long long *out, const unsigned long long *a,
+	       unsigned long na, const unsigned long long *b,
+	       unsigned long nb);
+
+///@cond INTERNAL
+extern unsigned long
+__VEC_PWR_IMP (vec_difference_u64) (unsigned long long *out,
+				    const unsigned long long *a,
+				    unsigned long na,
+				    const unsigned long long *b,
+				    unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_intersect_u64) (unsigned long long *out,
+				   const unsigned long long *a,
+				   unsigned long na,
+				   const unsigned long long *b,
+				   unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_union_u64) (unsigned long long *out,
+			       const unsigned long long *a, unsigned long na,
+			       const unsigned long long *b, unsigned long nb);
+///@endcond
+
+/** \brief Open addressing hash table of doubleword or quadword keys.
+ *
+ *  The slots are divided into groups of 16, each with a 16-byte
+ *  control group holding a 7-bit hash tag per full slot. A lookup
+ *  compares all 16 control bytes of a group with the tag of the key
+ *  in one vector compare, and only compares the keys of slots with a
+ *  matching tag. The table stores keys only. The slot index returned
+ *  by insert and find is stable until the slot is erased, so it can
+ *  index a caller owned value array of vec_htab_slots() elements.
+ *
+ *  Initialize with vec_htab_init_u64() or vec_htab_init_u128() and
+ *  release with vec_htab_free(). A table only holds keys of the type
+ *  it was initialized for. The fields are read only for the caller.
+ */
+typedef struct
+{
+  /** Control bytes, 16 per group.  */
+  unsigned char *ctrl;
+  /** Keys, 16 per group (unsigned long long or vui128_t).  */
+  void *keys;
+  /** Number of groups minus one (groups is a power of 2).  */
+  unsigned long gmask;
+  /** Number of full slots.  */
+  unsigned long count;
+  /** Maximum full slots (7/8 of the slots).  */
+  unsigned long limit;
+} vec_htab_t;
+
+/** \brief Return the number of slots of hash table t.
+ *
+ *  @param t an initialized hash table.
+ *  @return the number of slots (16 * groups).
+ */
+static inline unsigned long
+vec_htab_slots (const vec_htab_t *t)
+{
+  return (t->gmask + 1) * 16;
+}
+
+/** \brief Release the memory of hash table t.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_free_PWR7,
+ *  vec_htab_free_PWR8, vec_htab_free_PWR9, and vec_htab_free_PWR10.
+ *
+ *  @param t hash table initialized by vec_htab_init_u64() or
+ *  vec_htab_init_u128().
+ */
+extern void
+vec_htab_free (vec_htab_t *t);
+
+/** \brief Erase a doubleword key from hash table t.
+ *
+ *  The slot is marked deleted. Deleted slots are reused by insert
+ *  but continue the probe sequence of find.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_erase_u64_PWR7,
+ *  vec_htab_erase_u64_PWR8, vec_htab_erase_u64_PWR9,
+ *  and vec_htab_erase_u64_PWR10.
+ *
+ *  @param t hash table of doubleword keys.
+ *  @param key to erase.
+ *  @return the slot the key occupied, or -1 if not found.
+ */
+extern long
+vec_htab_erase_u64 (vec_htab_t *t, unsigned long long key);
+
+/** \brief Find a doubleword key in hash table t.
+ *
+ *  The 16 control bytes of each probe group are compared with the
+ *  key tag by vec_cmpeq and the matches walked with
+ *  vec_cntlz_lsbb_bi(). Candidate keys are verified by vec_cmpequd.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_find_u64_PWR7,
+ *  vec_htab_find_u64_PWR8, vec_htab_find_u64_PWR9,
+ *  and vec_htab_find_u64_PWR10.
+ *
+ *  @param t hash table of doubleword keys.
+ *  @param key to find.
+ *  @return the slot of key, or -1 if not found.
+ */
+extern long
+vec_htab_find_u64 (const vec_htab_t *t, unsigned long long key);
+
+/** \brief Find a batch of doubleword keys in hash table t.
+ *
+ *  As vec_htab_find_u64() for keys[0..n-1], storing the results in
+ *  slots[0..n-1]. The hash and first probe group of each key are
+ *  computed and prefetched 8 keys ahead, so several cache misses are
+ *  overlapped. Use this for large tables.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_find_batch_u64_PWR7,
+ *  vec_htab_find_batch_u64_PWR8, vec_htab_find_batch_u64_PWR9,
+ *  and vec_htab_find_batch_u64_PWR10.
+ *
+ *  @param t hash table of doubleword keys.
+ *  @param slots array of n results (slot or -1).
+ *  @param keys array of n keys to find.
+ *  @param n number of keys.
+ */
+extern void
+vec_htab_find_batch_u64 (const vec_htab_t *t, long *slots,
+			 const unsigned long long *keys, unsigned long n);
+
+/** \brief Initialize hash table t for doubleword keys.
+ *
+ *  Allocates a power of 2 number of 16 slot groups with room for at
+ *  least capacity keys at a load factor of 7/8 or less.
+ *  Control groups and keys are cache line aligned.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_init_u64_PWR7,
+ *  vec_htab_init_u64_PWR8, vec_htab_init_u64_PWR9,
+ *  and vec_htab_init_u64_PWR10.
+ *
+ *  @param t hash table to initialize.
+ *  @param capacity number of keys the table must hold.
+ *  @return 0 for success, or -1 if the memory could not be allocated.
+ */
+extern int
+vec_htab_init_u64 (vec_htab_t *t, unsigned long capacity);
+
+/** \brief Insert a doubleword key into hash table t.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_htab_insert_u64_PWR7,
+ *  vec_htab_insert_u64_PWR8, vec_htab_insert_u64_PWR9,
+ *  and vec_htab_insert_u64_PWR10.
+ *
+ *  @param t hash table of doubleword keys.
+ *  @param key to insert.
+ *  @return the slot of key (new, or existing if the key was already
+ *  present), or -1 if the table is at its limit.
+ */
+extern long
+vec_htab_insert_u64 (vec_htab_t *t, unsigned long long key);
+
+///@cond INTERNAL
+extern void
+__VEC_PWR_IMP (vec_htab_free) (vec_htab_t *t);
+extern long
+__VEC_PWR_IMP (vec_htab_erase_u64) (vec_htab_t *t, unsigned long long key);
+extern long
+__VEC_PWR_IMP (vec_htab_find_u64) (const vec_htab_t *t,
+				   unsigned long long key);
+extern void
+__VEC_PWR_IMP (vec_htab_find_batch_u64) (const vec_htab_t *t, long *slots,
+					 const unsigned long long *keys,
+					 unsigned long n);
+extern int
+__VEC_PWR_IMP (vec_htab_init_u64) (vec_htab_t *t, unsigned long capacity);
+extern long
+__VEC_PWR_IMP (vec_htab_insert_u64) (vec_htab_t *t, unsigned long long key);
+///@endcond
+
+/** \brief Hash a buffer to 64 bits.
+ *
+ *  Multiply-fold hash in the style of wyhash. Buffers longer than 64
+ *  bytes are processed as 64 byte stripes by 4 independent
+ *  multiply-fold chains, 2 per vector, using vec_vmuleud() and
+ *  vec_vmuloud(). The bytes are read as little endian doublewords, so
+ *  the result does not depend on the system endian.
+ *
+ *  \note Not a cryptographic hash.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_hash64_PWR7,
+ *  vec_hash64_PWR8, vec_hash64_PWR9, and vec_hash64_PWR10.
+ *  The POWER9 implementation uses vmsumudm and POWER10 the native
+ *  vmuleud/vmuloud instructions.
+ *
+ *  @param buf pointer to len bytes.
+ *  @param len number of bytes.
+ *  @param seed 64-bit seed.
+ *  @return the 64-bit hash.
+ */
+extern unsigned long long
+vec_hash64 (const void *buf, unsigned long len, unsigned long long seed);
+
+/** \brief Hash an array of word keys to 64 bits.
+ *
+ *  Hash 4 keys per vector. out[i] is vec_hash64() of keys[i] in
+ *  little endian byte order (4 bytes) with the same seed.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_hash64_batch_u32_PWR7,
+ *  vec_hash64_batch_u32_PWR8, vec_hash64_batch_u32_PWR9,
+ *  and vec_hash64_batch_u32_PWR10.
+ *
+ *  @param out array of n hashes.
+ *  @param keys array of n keys.
+ *  @param n number of keys.
+ *  @param seed 64-bit seed.
+ */
+extern void
+vec_hash64_batch_u32 (unsigned long long *out, const unsigned int *keys,
+		      unsigned long n, unsigned long long seed);
+
+/** \brief Hash an array of doubleword keys to 64 bits.
+ *
+ *  Hash 2 keys per vector. out[i] is vec_hash64() of keys[i] in
+ *  little endian byte order (8 bytes) with the same seed.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_hash64_batch_u64_PWR7,
+ *  vec_hash64_batch_u64_PWR8, vec_hash64_batch_u64_PWR9,
+ *  and vec_hash64_batch_u64_PWR10.
+ *
+ *  @param out array of n hashes.
+ *  @param keys array of n keys.
+ *  @param n number of keys.
+ *  @param seed 64-bit seed.
+ */
+extern void
+vec_hash64_batch_u64 (unsigned long long *out,
+		      const unsigned long long *keys, unsigned long n,
+		      unsigned long long seed);
+
+///@cond INTERNAL
+extern unsigned long long
+__VEC_PWR_IMP (vec_hash64) (const void *buf, unsigned long len,
+			    unsigned long long seed);
+extern void
+__VEC_PWR_IMP (vec_hash64_batch_u32) (unsigned long long *out,
+				      const unsigned int *keys,
+				      unsigned long n, unsigned long long seed);
+extern void
+__VEC_PWR_IMP (vec_hash64_batch_u64) (unsigned long long *out,
+				      const unsigned long long *keys,
+				      unsigned long n, unsigned long long seed);
+///@endcond
+
+/** \brief Number of doublewords needed to pack n doublewords of width bits.
+ *
+ *  Each full block of 128 values packs into bits vectors
+ *  (2 * bits doublewords). The remaining values pack into
+ *  ((n % 128) * bits + 63) / 64 doublewords.
+ *
+ *  @param n number of values.
+ *  @param bits bit width of each packed value (0-64). Larger
+ *  widths are treated as 64, as the pack and unpack functions do.
+ *  @return the number of doublewords.
+ */
+static inline unsigned long
+vec_bitpack_doublewords_u64 (unsigned long n, unsigned int bits)
+{
+  if (bits > 64)
+    bits = 64;
+  return (n / 128) * 2 * bits + ((n % 128) * bits + 63) / 64;
+}
+
+/** \brief Pack an array of doublewords.
+ *
+ *  Store the low order bits bits of each value.
+ *  Values are packed in blocks of 128, each doubleword element of the
+ *  vector an independent lane, SIMD-BP128 style.
+ *  Values that do not fit in bits bits are truncated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitpack_u64_PWR7,
+ *  vec_bitpack_u64_PWR8, vec_bitpack_u64_PWR9,
+ *  and vec_bitpack_u64_PWR10.
+ *
+ *  @param out array of vec_bitpack_doublewords_u64(n, bits) doublewords.
+ *  @param in array of n doublewords.
+ *  @param n number of values.
+ *  @param bits bit width of each packed value (0-64).
+ *  @return the number of doublewords stored to out.
+ */
+extern unsigned long
+vec_bitpack_u64 (unsigned long long *out, const unsigned long long *in,
+		 unsigned long n, unsigned int bits);
+
+/** \brief Unpack an array of doublewords.
+ *
+ *  Unpack n values of bits bits from in, as stored by
+ *  vec_bitpack_u64().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitunpack_u64_PWR7,
+ *  vec_bitunpack_u64_PWR8, vec_bitunpack_u64_PWR9,
+ *  and vec_bitunpack_u64_PWR10.
+ *
+ *  @param out array of n doublewords.
+ *  @param in packed array from vec_bitpack_u64().
+ *  @param n number of values.
+ *  @param bits bit width of each packed value (0-64).
+ */
+extern void
+vec_bitunpack_u64 (unsigned long long *out, const unsigned long long *in,
+		   unsigned long n, unsigned int bits);
+
+/** \brief Frame of reference pack an array of doublewords.
+ *
+ *  Store (in[i] - base) in bits bits.
+ *  Values are packed in blocks of 128, each doubleword element of the
+ *  vector an independent lane, SIMD-BP128 style.
+ *  Values that do not fit in bits bits are truncated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitpack_for_u64_PWR7,
+ *  vec_bitpack_for_u64_PWR8, vec_bitpack_for_u64_PWR9,
+ *  and vec_bitpack_for_u64_PWR10.
+ *
+ *  @param out array of vec_bitpack_doublewords_u64(n, bits) doublewords.
+ *  @param in array of n doublewords.
+ *  @param n number of values.
+ *  @param base value subtracted from every element.
+ *  @param bits bit width of each packed value (0-64).
+ *  @return the number of doublewords stored to out.
+ */
+extern unsigned long
+vec_bitpack_for_u64 (unsigned long long *out, const unsigned long long *in,
+		     unsigned long n, unsigned long long base,
+		     unsigned int bits);
+
+/** \brief Unpack an array of doublewords (frame of reference).
+ *
+ *  Unpack n values of bits bits from in, as stored by
+ *  vec_bitpack_for_u64() and add base to each value.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitunpack_for_u64_PWR7,
+ *  vec_bitunpack_for_u64_PWR8, vec_bitunpack_for_u64_PWR9,
+ *  and vec_bitunpack_for_u64_PWR10.
+ *
+ *  @param out array of n doublewords.
+ *  @param in packed array from vec_bitpack_for_u64().
+ *  @param n number of values.
+ *  @param base value added to every element.
+ *  @param bits bit width of each packed value (0-64).
+ */
+extern void
+vec_bitunpack_for_u64 (unsigned long long *out, const unsigned long long *in,
+		       unsigned long n, unsigned long long base,
+		       unsigned int bits);
+
+/** \brief Delta pack an array of doublewords.
+ *
+ *  Store the difference from the previous value in the same lane,
+ *  (in[i] - in[i-2]) in bits bits, with init for the first 2 values.
+ *  Values are packed in blocks of 128, each doubleword element of the
+ *  vector an independent lane, SIMD-BP128 style. Values that do not fit
+ *  in bits bits are truncated.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitpack_delta_u64_PWR7,
+ *  vec_bitpack_delta_u64_PWR8, vec_bitpack_delta_u64_PWR9,
+ *  and vec_bitpack_delta_u64_PWR10.
+ *
+ *  @param out array of vec_bitpack_doublewords_u64(n, bits) doublewords.
+ *  @param in array of n doublewords.
+ *  @param n number of values.
+ *  @param init the value preceding the first 2 elements.
+ *  @param bits bit width of each packed value (0-64).
+ *  @return the number of doublewords stored to out.
+ */
+extern unsigned long
+vec_bitpack_delta_u64 (unsigned long long *out, const unsigned long long *in,
+		       unsigned long n, unsigned long long init,
+		       unsigned int bits);
+
+/** \brief Unpack an array of doublewords (delta).
+ *
+ *  Unpack n values of bits bits from in, as stored by
+ *  vec_bitpack_delta_u64() and add the previous value in the same lane
+ *  (a prefix sum per lane).
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitunpack_delta_u64_PWR7,
+ *  vec_bitunpack_delta_u64_PWR8, vec_bitunpack_delta_u64_PWR9,
+ *  and vec_bitunpack_delta_u64_PWR10.
+ *
+ *  @param out array of n doublewords.
+ *  @param in packed array from vec_bitpack_delta_u64().
+ *  @param n number of values.
+ *  @param init the value preceding the first 2 elements.
+ *  @param bits bit width of each packed value (0-64).
+ */
+extern void
+vec_bitunpack_delta_u64 (unsigned long long *out, const unsigned long long *in,
+			 unsigned long n, unsigned long long init,
+			 unsigned int bits);
+
+///@cond INTERNAL
+extern unsigned long
+__VEC_PWR_IMP (vec_bitpack_u64) (unsigned long long *out,
+				 const unsigned long long *in, unsigned long n,
+				 unsigned int bits);
+extern void
+__VEC_PWR_IMP (vec_bitunpack_u64) (unsigned long long *out,
+				   const unsigned long long *in,
+				   unsigned long n, unsigned int bits);
+extern unsigned long
+__VEC_PWR_IMP (vec_bitpack_for_u64) (unsigned long long *out,
+				     const unsigned long long *in,
+				     unsigned long n, unsigned long long base,
+				     unsigned int bits);
+extern void
+__VEC_PWR_IMP (vec_bitunpack_for_u64) (unsigned long long *out,
+				       const unsigned long long *in,
+				       unsigned long n,
+				       unsigned long long base,
+				       unsigned int bits);
+extern unsigned long
+__VEC_PWR_IMP (vec_bitpack_delta_u64) (unsigned long long *out,
+				       const unsigned long long *in,
+				       unsigned long n,
+				       unsigned long long init,
+				       unsigned int bits);
+extern void
+__VEC_PWR_IMP (vec_bitunpack_delta_u64) (unsigned long long *out,
+					 const unsigned long long *in,
+					 unsigned long n,
+					 unsigned long long init,
+					 unsigned int bits);
+///@endcond
+
+/** \brief Maximum LEB128 encoded size of n doublewords.
+ *
+ *  @param n number of doublewords.
+ *  @return the number of bytes to allocate for vec_leb128_encode_u64().
+ */
+static inline unsigned long
+vec_leb128_bound_u64 (unsigned long n)
+{
+  return 10 * n;
+}
+
+/** \brief LEB128 (protobuf varint) encode an array of doublewords.
+ *
+ *  Store each value 7 bits per byte, low order first, with the high
+ *  bit set on all but the last byte. Up to 8 bytes are spread by
+ *  one pdepd (POWER10) or shift and mask sequence.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_leb128_encode_u64_PWR7,
+ *  vec_leb128_encode_u64_PWR8, vec_leb128_encode_u64_PWR9,
+ *  and vec_leb128_encode_u64_PWR10.
+ *
+ *  @param out array of vec_leb128_bound_u64(n) bytes.
+ *  @param in array of n doublewords.
+ *  @param n number of values.
+ *  @return the number of bytes stored to out.
+ */
+extern unsigned long
+vec_leb128_encode_u64 (unsigned char *out, const unsigned long long *in,
+		       unsigned long n);
+
+/** \brief LEB128 (protobuf varint) decode an array of doublewords.
+ *
+ *  Decode n varints of up to 10 bytes from the len bytes at in.
+ *  16 bytes are checked at a time, so runs of single byte varints
+ *  are decoded 16 per iteration. Otherwise the varint length is
+ *  found with vec_cntlz_lsbb_bi() (POWER9 and later) and the 7-bit
+ *  groups compacted with pextd (POWER10) or shift and mask.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_leb128_decode_u64_PWR7,
+ *  vec_leb128_decode_u64_PWR8, vec_leb128_decode_u64_PWR9,
+ *  and vec_leb128_decode_u64_PWR10.
+ *
+ *  @param out array of n doublewords.
+ *  @param in encoded bytes.
+ *  @param len number of bytes at in.
+ *  @param n number of values.
+ *  @return the number of bytes read from in, or -1 if in ends
+ *  within a varint or a varint is longer than 10 bytes.
+ */
+extern long
+vec_leb128_decode_u64 (unsigned long long *out, const unsigned char *in,
+		       unsigned long len, unsigned long n);
+
+///@cond INTERNAL
+extern long
+__VEC_PWR_IMP (vec_leb128_decode_u64) (unsigned long long *out,
+				       const unsigned char *in,
+				       unsigned long len, unsigned long n);
+extern unsigned long
+__VEC_PWR_IMP (vec_leb128_encode_u64) (unsigned char *out,
+				       const unsigned long long *in,
+				       unsigned long n);
+///@endcond
+
+/** \brief Population count of a bitmap.
+ *
+ *  Return the number of bits set in the n doublewords at a.
+ *  Runs of 32 doublewords are reduced with a Harley-Seal carry save
+ *  adder tree, needing one vec_popcntd() per 16 vectors.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_count_PWR7,
+ *  vec_bitmap_count_PWR8, vec_bitmap_count_PWR9,
+ *  and vec_bitmap_count_PWR10.
+ *
+ *  @param a bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @return the number of bits set.
+ */
+extern unsigned long long
+vec_bitmap_count (const unsigned long long *a, unsigned long n);
+
+/** \brief Bitmap AND and population count.
+ *
+ *  Compute out[i] = a[i] & b[i] and return the number of bits
+ *  set in the result. The result is only counted if out is NULL.
+ *  Uses a Harley-Seal carry save adder tree as vec_bitmap_count().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_and_count_PWR7,
+ *  vec_bitmap_and_count_PWR8, vec_bitmap_and_count_PWR9,
+ *  and vec_bitmap_and_count_PWR10.
+ *
+ *  @param out NULL or the result bitmap of n doublewords.
+ *  @param a bitmap of n doublewords.
+ *  @param b bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @return the number of bits set in the result.
+ */
+extern unsigned long long
+vec_bitmap_and_count (unsigned long long *out, const unsigned long long *a,
+		      const unsigned long long *b, unsigned long n);
+
+/** \brief Bitmap ANDNOT and population count.
+ *
+ *  Compute out[i] = a[i] & ~b[i] and return the number of bits
+ *  set in the result. The result is only counted if out is NULL.
+ *  Uses a Harley-Seal carry save adder tree as vec_bitmap_count().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_andnot_count_PWR7,
+ *  vec_bitmap_andnot_count_PWR8, vec_bitmap_andnot_count_PWR9,
+ *  and vec_bitmap_andnot_count_PWR10.
+ *
+ *  @param out NULL or the result bitmap of n doublewords.
+ *  @param a bitmap of n doublewords.
+ *  @param b bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @return the number of bits set in the result.
+ */
+extern unsigned long long
+vec_bitmap_andnot_count (unsigned long long *out, const unsigned long long *a,
+			 const unsigned long long *b, unsigned long n);
+
+/** \brief Bitmap OR and population count.
+ *
+ *  Compute out[i] = a[i] | b[i] and return the number of bits
+ *  set in the result. The result is only counted if out is NULL.
+ *  Uses a Harley-Seal carry save adder tree as vec_bitmap_count().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_or_count_PWR7,
+ *  vec_bitmap_or_count_PWR8, vec_bitmap_or_count_PWR9,
+ *  and vec_bitmap_or_count_PWR10.
+ *
+ *  @param out NULL or the result bitmap of n doublewords.
+ *  @param a bitmap of n doublewords.
+ *  @param b bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @return the number of bits set in the result.
+ */
+extern unsigned long long
+vec_bitmap_or_count (unsigned long long *out, const unsigned long long *a,
+		     const unsigned long long *b, unsigned long n);
+
+/** \brief Bitmap XOR and population count.
+ *
+ *  Compute out[i] = a[i] ^ b[i] and return the number of bits
+ *  set in the result. The result is only counted if out is NULL.
+ *  Uses a Harley-Seal carry save adder tree as vec_bitmap_count().
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_xor_count_PWR7,
+ *  vec_bitmap_xor_count_PWR8, vec_bitmap_xor_count_PWR9,
+ *  and vec_bitmap_xor_count_PWR10.
+ *
+ *  @param out NULL or the result bitmap of n doublewords.
+ *  @param a bitmap of n doublewords.
+ *  @param b bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @return the number of bits set in the result.
+ */
+extern unsigned long long
+vec_bitmap_xor_count (unsigned long long *out, const unsigned long long *a,
+		      const unsigned long long *b, unsigned long n);
+
+/** \brief Find the next set bit of a bitmap.
+ *
+ *  Skips zero quadwords and returns the position from vec_ctzq() of
+ *  the first non zero quadword.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_next_set_PWR7,
+ *  vec_bitmap_next_set_PWR8, vec_bitmap_next_set_PWR9,
+ *  and vec_bitmap_next_set_PWR10.
+ *
+ *  @param a bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @param pos starting bit position.
+ *  @return the position of the first set bit at or after pos, or -1.
+ */
+extern long
+vec_bitmap_next_set (const unsigned long long *a, unsigned long n,
+		     unsigned long pos);
+
+/** \brief Rank of a bitmap position.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_rank_PWR7,
+ *  vec_bitmap_rank_PWR8, vec_bitmap_rank_PWR9,
+ *  and vec_bitmap_rank_PWR10.
+ *
+ *  @param a bitmap of at least (pos + 63) / 64 doublewords.
+ *  @param pos bit position.
+ *  @return the number of bits set before position pos.
+ */
+extern unsigned long long
+vec_bitmap_rank (const unsigned long long *a, unsigned long pos);
+
+/** \brief Select the set bit of a bitmap with rank k.
+ *
+ *  The inverse of vec_bitmap_rank(). Uses pdepd on POWER10 to select
+ *  within the doubleword.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_select_PWR7,
+ *  vec_bitmap_select_PWR8, vec_bitmap_select_PWR9,
+ *  and vec_bitmap_select_PWR10.
+ *
+ *  @param a bitmap of n doublewords.
+ *  @param n number of doublewords.
+ *  @param k rank (0 for the first set bit).
+ *  @return the position of the set bit with k set bits before it,
+ *  or -1 if fewer than k + 1 bits are set.
+ */
+extern long
+vec_bitmap_select (const unsigned long long *a, unsigned long n,
+		   unsigned long long k);
+
+/** \brief Intersect a Roaring array container with a bitmap container.
+ *
+ *  Store the values of in whose bits are set in bm to out, in order.
+ *  Branch free.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_and_array_u16_PWR7,
+ *  vec_bitmap_and_array_u16_PWR8, vec_bitmap_and_array_u16_PWR9,
+ *  and vec_bitmap_and_array_u16_PWR10.
+ *
+ *  @param out array of n values for the result.
+ *  @param in array of n values.
+ *  @param n number of values.
+ *  @param bm bitmap of 1024 doublewords.
+ *  @return the number of values stored to out.
+ */
+extern unsigned long
+vec_bitmap_and_array_u16 (unsigned short *out, const unsigned short *in,
+			  unsigned long n, const unsigned long long *bm);
+
+/** \brief Set the bits of a Roaring array container in a bitmap.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_set_array_u16_PWR7,
+ *  vec_bitmap_set_array_u16_PWR8, vec_bitmap_set_array_u16_PWR9,
+ *  and vec_bitmap_set_array_u16_PWR10.
+ *
+ *  @param bm bitmap of 1024 doublewords.
+ *  @param in array of n values.
+ *  @param n number of values.
+ */
+extern void
+vec_bitmap_set_array_u16 (unsigned long long *bm, const unsigned short *in,
+			  unsigned long n);
+
+/** \brief Convert a Roaring bitmap container to an array container.
+ *
+ *  Store the positions of the set bits, ascending. Zero quadwords are
+ *  skipped with one vector compare.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_bitmap_to_array_u16_PWR7,
+ *  vec_bitmap_to_array_u16_PWR8, vec_bitmap_to_array_u16_PWR9,
+ *  and vec_bitmap_to_array_u16_PWR10.
+ *
+ *  @param out array for vec_bitmap_count(bm, n) values.
+ *  @param bm bitmap of n doublewords.
+ *  @param n number of doublewords (at most 1024).
+ *  @return the number of values stored to out.
+ */
+extern unsigned long
+vec_bitmap_to_array_u16 (unsigned short *out, const unsigned long long *bm,
+			 unsigned long n);
+
+///@cond INTERNAL
+extern unsigned long long
+__VEC_PWR_IMP (vec_bitmap_and_count) (unsigned long long *out,
+				      const unsigned long long *a,
+				      const unsigned long long *b,
+				      unsigned long n);
+extern unsigned long
+__VEC_PWR_IMP (vec_bitmap_and_array_u16) (unsigned short *out,
+					  const unsigned short *in,
+					  unsigned long n,
+					  const unsigned long long *bm);
+extern unsigned long long
+__VEC_PWR_IMP (vec_bitmap_andnot_count) (unsigned long long *out,
+					 const unsigned long long *a,
+					 const unsigned long long *b,
+					 unsigned long n);
+extern unsigned long long
+__VEC_PWR_IMP (vec_bitmap_count) (const unsigned long long *a,
+				  unsigned long n);
+extern long
+__VEC_PWR_IMP (vec_bitmap_next_set) (const unsigned long long *a,
+				     unsigned long n, unsigned long pos);
+extern unsigned long long
+__VEC_PWR_IMP (vec_bitmap_or_count) (unsigned long long *out,
+				     const unsigned long long *a,
+				     const unsigned long long *b,
+				     unsigned long n);
+extern unsigned long long
+__VEC_PWR_IMP (vec_bitmap_rank) (const unsigned long long *a,
+				 unsigned long pos);
+extern long
+__VEC_PWR_IMP (vec_bitmap_select) (const unsigned long long *a,
+				   unsigned long n, unsigned long long k);
+extern void
+__VEC_PWR_IMP (vec_bitmap_set_array_u16) (unsigned long long *bm,
+					  const unsigned short *in,
+					  unsigned long n);
+extern unsigned long
+__VEC_PWR_IMP (vec_bitmap_to_array_u16) (unsigned short *out,
+					 const unsigned long long *bm,
+					 unsigned long n);
+extern unsigned long long
+__VEC_PWR_IMP (vec_bitmap_xor_count) (unsigned long long *out,
+				      const unsigned long long *a,
+				      const unsigned long long *b,
+				      unsigned long n);
+///@endcond
+
+/** \brief Inclusive prefix sum of an array of doublewords.
+ *
+ *  out[i] = init + in[0] + ... + in[i], modulo 2<SUP>64</SUP>.
+ *  Each vector is scanned in register by one shifted add
+ *  (vec_sldqi() by 1 doubleword), then the splatted running sum is
+ *  added. out may equal in. See vec_prefix_sum_u64_u128() for a
+ *  running sum that can not overflow.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_prefix_sum_u64_PWR7,
+ *  vec_prefix_sum_u64_PWR8, vec_prefix_sum_u64_PWR9,
+ *  and vec_prefix_sum_u64_PWR10.
+ *
+ *  @param out array of n doublewords.
+ *  @param in array of n doublewords.
+ *  @param n number of elements.
+ *  @param init the initial sum (carry in from a previous block).
+ *  @return the sum of init and all n elements.
+ */
+extern unsigned long long
+vec_prefix_sum_u64 (unsigned long long *out, const unsigned long long *in,
+		    unsigned long n, unsigned long long init);
+
+/** \brief Exclusive prefix sum of an array of doublewords.
+ *
+ *  out[i] = init + in[0] + ... + in[i-1], modulo 2<SUP>64</SUP>.
+ *  As vec_prefix_sum_u64() with the input subtracted from each sum.
+ *  out may equal in.
+ *
+ *  \note This is the dynamic call ABI for IFUNC selection.
+ *  The runtime implementations are vec_prefix_sum_excl_u64_PWR7,
+ *  vec_prefix_sum_excl_u64_PWR8, vec_prefix_sum_excl_u64_PWR9,
+ *  and vec_prefix_sum_excl_u64_PWR10.
+ *
+ *  @param out array of n doublewords.
+ *  @param in array of n doublewords.
+ *  @param n number of elements.
+ *  @param init the initial sum (carry in from a previous block).
+ *  @return the sum of init and all n elements.
+ */
+extern unsigned long long
+vec_prefix_sum_excl_u64 (unsigned long long *out,
+			 const unsigned long long *in, unsigned long n,
+			 unsigned long long init);
+
+///@cond INTERNAL
+extern unsigned long long
+__VEC_PWR_IMP (vec_prefix_sum_excl_u64) (unsigned long long *out,
+					 const unsigned long long *in,
+					 unsigned long n,
+					 unsigned long long init);
+extern unsigned long long
+__VEC_PWR_IMP (vec_prefix_sum_u64) (unsigned long long *out,
+				    const unsigned long long *in,
+				    unsigned long n, unsigned long long init);
+///@endcond
+
 /** \brief Vector splat doubleword.
  *  Duplicate the selected doubleword element across the doubleword
  *  elements of the result. This is effectively the
@@ -6931,4 +8217,8 @@ vec_vextsw2d (vi32_t vra)
   return result;
 }
 
+#ifdef __cplusplus
+}
+#endif
+
 #endif /* VEC_INT64_PPC_H_ */
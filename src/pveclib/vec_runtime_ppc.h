@@ -0,0 +1,153 @@
+/*
+ Copyright (c) [2026] Steven Munroe
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_runtime_ppc.h
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_PVECLIB_VEC_RUNTIME_PPC_H_
+#define SRC_PVECLIB_VEC_RUNTIME_PPC_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * \file  vec_runtime_ppc.h
+ * \brief Header declaring the runtime services of the PVECLIB
+ * callable libraries.
+ *
+ * Unlike the other PVECLIB headers, nothing here is a static inline
+ * vector operation. These are plain C interfaces to state held by the
+ * runtime libraries (libpvec and libpvecstatic), such as the worker
+ * pool used by the parallel multiply operations and the IFUNC
+ * target selection of libpvec. Applications must link with one of
+ * these libraries to use them.
+ */
+
+/** \brief Set the number of threads used by the runtime worker pool.
+ *
+ *  The count includes the calling thread, so nthreads of 1 (the
+ *  default) disables multithreading and nthreads of N uses N-1 worker
+ *  threads. Worker threads are created lazily on the next parallel
+ *  operation and any existing workers are stopped.
+ *
+ *  @param nthreads number of threads to use (0 is treated as 1).
+ *  @return the number of threads configured, after clamping to the
+ *  supported maximum (256).
+ */
+extern int
+vec_pool_set_threads (unsigned int nthreads);
+
+/** \brief Return the number of threads used by the runtime worker
+ *  pool, including the calling thread.
+ */
+extern unsigned int
+vec_pool_get_threads (void);
+
+/** \brief Set the CPU affinity list for runtime worker pool threads.
+ *
+ *  Worker thread i is bound to cpus[(i+1) % ncpus]. Entry 0 is
+ *  applied to the thread calling vec_pool_run() for the duration of
+ *  each parallel run, and its previous affinity is restored on
+ *  return. A NULL cpus or zero ncpus removes the binding. Running
+ *  workers are restarted to pick up the new binding.
+ *
+ *  @param cpus array of CPU numbers.
+ *  @param ncpus number of entries in cpus.
+ *  @return the number of entries accepted or -1 if any CPU number
+ *  is out of range.
+ */
+extern int
+vec_pool_set_affinity (const int *cpus, unsigned int ncpus);
+
+/** \brief Run ntasks calls of fn(arg, task) across the runtime
+ *  worker pool and wait for completion.
+ *
+ *  Tasks are numbered 0 to ntasks-1 and may run in any order on any
+ *  pool thread, including the caller. Concurrent calls from different
+ *  application threads are serialized. A call made from within a
+ *  running task (a nested run) does not wait for the pool; its tasks
+ *  run inline on the calling thread.
+ *
+ *  @param fn task function.
+ *  @param arg argument passed to each task.
+ *  @param ntasks number of tasks.
+ */
+extern void
+vec_pool_run (void (*fn) (void *, unsigned long), void *arg,
+	      unsigned long ntasks);
+
+/*! \brief Return the -mcpu= target ("power7", "power8", "power9"
+ * or "power10") the IFUNC entry point fname resolved to.
+ *
+ * If fname is NULL, return the target the resolvers select now,
+ * after applying any PVECLIB_CPU environment override. Returns NULL
+ * if fname has not been resolved yet (with lazy binding entry points
+ * are resolved at their first call) or is not a libpvec entry point.
+ *
+ * PVECLIB_CPU is read once when libpvec is loaded, and only affects
+ * entry points resolved after that. With BIND_NOW (-z now or
+ * LD_BIND_NOW) all entry points are resolved earlier and use the
+ * hardware target. vec_runtime_override_missed() reports if this
+ * happened.
+ *
+ * \note Only the dynamic library (libpvec) provides this function.
+ * Static (libpvecstatic) calls bind to the __VEC_PWR_IMP() target
+ * at compile time.
+ *
+ * @param fname name of the dynamic entry point, for example
+ * "vec_mul512x512", or NULL.
+ * @return target name or NULL.
+ */
+extern const char *
+vec_runtime_target (const char *fname);
+
+/*! \brief Return the number of IFUNC entry points resolved so far.
+ * Use with vec_runtime_resolved_name() to list them.
+ * Only the dynamic library (libpvec) provides this function.
+ */
+extern unsigned int
+vec_runtime_resolved_count (void);
+
+/*! \brief Return the name of the index'th resolved entry point,
+ * or NULL if index is out of range or another thread is still
+ * recording that entry.
+ * Only the dynamic library (libpvec) provides this function.
+ */
+extern const char *
+vec_runtime_resolved_name (unsigned int index);
+
+/*! \brief Return the number of entry points that were resolved
+ * before libpvec read PVECLIB_CPU, to a target other than the one it
+ * selects.
+ *
+ * Nonzero means the override was accepted but is not in effect for
+ * those entry points, usually because of BIND_NOW. libpvec also
+ * reports this once on stderr. Zero if PVECLIB_CPU is not set, was
+ * not accepted, or applies to every entry point.
+ * Only the dynamic library (libpvec) provides this function.
+ */
+extern unsigned int
+vec_runtime_override_missed (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SRC_PVECLIB_VEC_RUNTIME_PPC_H_ */
@@ -0,0 +1,551 @@
+/*
+ Copyright (c) [2026] Steven Munroe
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_uint_ppc.hpp
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_PVECLIB_VEC_UINT_PPC_HPP_
+#define SRC_PVECLIB_VEC_UINT_PPC_HPP_
+
+#ifndef __cplusplus
+#error "vec_uint_ppc.hpp requires a C++17 (or later) compiler"
+#endif
+
+#include <cstdint>
+#include <type_traits>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int512_ppc.h>
+
+/*!
+ * \file  vec_uint_ppc.hpp
+ * \brief C++ fixed width unsigned integer value types layered on
+ * vec_int128_ppc.h and vec_int512_ppc.h.
+ *
+ * The template pvec::uint<Bits> (for Bits in 128, 256, 512, 1024,
+ * 2048, and 4096) is a plain value type holding Bits/128 quadwords
+ * in vector registers (or storage when spilled).
+ * It has no constructors/destructors with side effects and is
+ * trivially copyable. No storage is allocated by any operation.
+ *
+ * The operators are resolved at compile time (via if constexpr) to
+ * the existing PVECLIB kernels for that width:
+ * - add: vec_adduqm(), vec_addcq()/vec_addeuqm() and
+ * vec_add512cu()/vec_add512ecu()/vec_add512um().
+ * - subtract: vec_subuqm(), vec_subcuq()/vec_subeuqm()/vec_subecuq().
+ * - multiply (modulo 2**Bits): vec_mulluq(), vec_mul256x256_inline(),
+ * vec_mul512x512_inline(), and the target qualified
+ * vec_mul1024x1024(), vec_mul2048x2048() and vec_mul512_byMN()
+ * runtime functions.
+ * - divide/modulo by a 128-bit divisor: vec_vdivuq_inline() and
+ * vec_divdqu_inline() applied from the high order quadword down.
+ *
+ * For up to 512x512 multiplies everything is static inline so the
+ * compiler can schedule across call sites. The 1024-bit and wider
+ * multiplies call the __VEC_PWR_IMP() qualified implementation
+ * directly (a local call into libpvecstatic, not through the PLT).
+ * Applications using Bits >= 1024 multiplies need to link
+ * libpvecstatic.
+ *
+ * The full (double width) product is available via pvec::mul_full()
+ * for Bits up to 2048.
+ *
+ * \note The C headers provide their own extern "C" linkage, so this
+ * header may be included before or after any other PVECLIB header.
+ *
+ * \note The storage order for quadwords matches the system endian
+ * (the same as __VEC_U_512 and friends). On Little Endian the least
+ * significant quadword is element 0 and on Big Endian the least
+ * significant quadword is element (Bits/128 - 1). Use the
+ * pvec::uint<Bits>::limb() accessor for an endian neutral view.
+ *
+ * For example:
+ * \code
+#include <pveclib/vec_uint_ppc.hpp>
+
+pvec::uint<512>
+poly_step (pvec::uint<512> a, pvec::uint<512> b, pvec::uint<512> c)
+{
+  // Compiles to vec_mul512x512_inline + vec_add512um.
+  return a * b + c;
+}
+ * \endcode
+ */
+
+namespace pvec
+{
+
+///@cond INTERNAL
+namespace detail
+{
+  /* Bit cast between types of identical size and layout.
+     The memcpy is elided by the compiler after inlining.  */
+  template<typename T, typename S>
+  static inline T
+  bit_cast (const S &s)
+  {
+    static_assert (sizeof (T) == sizeof (S), "bit_cast size mismatch");
+    T t;
+    __builtin_memcpy (&t, &s, sizeof (T));
+    return t;
+  }
+
+  template<unsigned Bits>
+  struct valid_width
+  {
+    static constexpr bool value = (Bits == 128) || (Bits == 256)
+	|| (Bits == 512) || (Bits == 1024) || (Bits == 2048)
+	|| (Bits == 4096);
+  };
+}
+///@endcond
+
+/** \brief Fixed width unsigned integer of Bits (128-4096) bits.
+ *
+ *  Arithmetic is modulo 2**Bits, matching the C/C++ unsigned integer
+ *  semantics.
+ */
+template<unsigned Bits>
+struct uint
+{
+  static_assert (detail::valid_width<Bits>::value,
+		 "pvec::uint<Bits> supports Bits of 128, 256, 512, "
+		 "1024, 2048 and 4096");
+
+  /// Number of quadwords (limbs) in this value.
+  static constexpr unsigned quadwords = Bits / 128;
+
+  ///@cond INTERNAL
+  vui128_t vx[quadwords];
+  ///@endcond
+
+  /// Default constructor is trivial (the value is uninitialized).
+  uint () = default;
+
+  /// Zero extend a 64-bit scalar.
+  explicit uint (uint64_t v)
+  {
+    const vui128_t zero = (vui128_t) ((unsigned __int128) 0);
+    for (unsigned i = 0; i < quadwords; i++)
+      vx[i] = zero;
+    limb (0) = (vui128_t) ((unsigned __int128) v);
+  }
+
+  /// Zero extend a quadword.
+  explicit uint (vui128_t v)
+  {
+    const vui128_t zero = (vui128_t) ((unsigned __int128) 0);
+    for (unsigned i = 0; i < quadwords; i++)
+      vx[i] = zero;
+    limb (0) = v;
+  }
+
+  /// Storage index of the i-th quadword counting from the low order.
+  static constexpr unsigned
+  ndx (unsigned i)
+  {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    return i;
+#else
+    return (quadwords - 1) - i;
+#endif
+  }
+
+  /// The i-th quadword counting from the low order (0).
+  vui128_t &
+  limb (unsigned i)
+  {
+    return vx[ndx (i)];
+  }
+
+  /// The i-th quadword counting from the low order (0).
+  vui128_t
+  limb (unsigned i) const
+  {
+    return vx[ndx (i)];
+  }
+
+  /// Return the zero value.
+  static uint
+  zero ()
+  {
+    return uint ((uint64_t) 0);
+  }
+};
+
+static_assert (std::is_trivially_copyable<uint<128>>::value, "");
+static_assert (std::is_trivially_copyable<uint<512>>::value, "");
+static_assert (std::is_trivially_copyable<uint<4096>>::value, "");
+static_assert (sizeof (uint<512>) == sizeof (__VEC_U_512), "");
+static_assert (sizeof (uint<4096>) == sizeof (__VEC_U_4096), "");
+
+/** \brief Add modulo 2**Bits. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator+ (const uint<Bits> &a, const uint<Bits> &b)
+{
+  uint<Bits> r;
+  if constexpr (Bits == 128)
+    {
+      r.vx[0] = vec_adduqm (a.vx[0], b.vx[0]);
+    }
+  else if constexpr (Bits == 256)
+    {
+      vui128_t c;
+      r.limb (0) = vec_addcq (&c, a.limb (0), b.limb (0));
+      r.limb (1) = vec_addeuqm (a.limb (1), b.limb (1), c);
+    }
+  else if constexpr (Bits == 512)
+    {
+      __VEC_U_512 s = vec_add512um (detail::bit_cast<__VEC_U_512> (a),
+				    detail::bit_cast<__VEC_U_512> (b));
+      r = detail::bit_cast<uint<Bits>> (s);
+    }
+  else
+    {
+      /* Add 512-bit blocks from the low order up, passing the carry.  */
+      constexpr unsigned blocks = Bits / 512;
+      const __VEC_U_512 *ap = (const __VEC_U_512 *) a.vx;
+      const __VEC_U_512 *bp = (const __VEC_U_512 *) b.vx;
+      __VEC_U_512 *rp = (__VEC_U_512 *) r.vx;
+      __VEC_U_512x1 sum;
+      unsigned i;
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define __PVEC_NDXB(__i) (__i)
+#else
+#define __PVEC_NDXB(__i) ((blocks - 1) - (__i))
+#endif
+      sum.x640 = vec_add512cu (ap[__PVEC_NDXB(0)], bp[__PVEC_NDXB(0)]);
+      rp[__PVEC_NDXB(0)] = sum.x2.v0x512;
+      for (i = 1; i < (blocks - 1); i++)
+	{
+	  sum.x640 = vec_add512ecu (ap[__PVEC_NDXB(i)], bp[__PVEC_NDXB(i)],
+				    sum.x2.v1x128);
+	  rp[__PVEC_NDXB(i)] = sum.x2.v0x512;
+	}
+      rp[__PVEC_NDXB(blocks - 1)] = vec_add512eum (ap[__PVEC_NDXB(blocks - 1)],
+						   bp[__PVEC_NDXB(blocks - 1)],
+						   sum.x2.v1x128);
+#undef __PVEC_NDXB
+    }
+  return r;
+}
+
+/** \brief Subtract modulo 2**Bits. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator- (const uint<Bits> &a, const uint<Bits> &b)
+{
+  uint<Bits> r;
+  if constexpr (Bits == 128)
+    {
+      r.vx[0] = vec_subuqm (a.vx[0], b.vx[0]);
+    }
+  else
+    {
+      vui128_t c;
+      unsigned i;
+      r.limb (0) = vec_subuqm (a.limb (0), b.limb (0));
+      c = vec_subcuq (a.limb (0), b.limb (0));
+      for (i = 1; i < (uint<Bits>::quadwords - 1); i++)
+	{
+	  r.limb (i) = vec_subeuqm (a.limb (i), b.limb (i), c);
+	  c = vec_subecuq (a.limb (i), b.limb (i), c);
+	}
+      r.limb (i) = vec_subeuqm (a.limb (i), b.limb (i), c);
+    }
+  return r;
+}
+
+/** \brief Full (2 x Bits) product of two Bits-bit values.
+ *
+ *  Supported for Bits of 128 through 2048. Each width maps to
+ *  vec_mul128x128_inline(), vec_mul256x256_inline(),
+ *  vec_mul512x512_inline(), vec_mul1024x1024() and
+ *  vec_mul2048x2048() respectively.
+ */
+template<unsigned Bits>
+static inline uint<2 * Bits>
+mul_full (const uint<Bits> &a, const uint<Bits> &b)
+{
+  static_assert (Bits <= 2048, "mul_full supports Bits up to 2048");
+  if constexpr (Bits == 128)
+    {
+      return detail::bit_cast<uint<256>> (
+	  vec_mul128x128_inline (a.vx[0], b.vx[0]));
+    }
+  else if constexpr (Bits == 256)
+    {
+      return detail::bit_cast<uint<512>> (
+	  vec_mul256x256_inline (detail::bit_cast<__VEC_U_256> (a),
+				 detail::bit_cast<__VEC_U_256> (b)));
+    }
+  else if constexpr (Bits == 512)
+    {
+      return detail::bit_cast<uint<1024>> (
+	  vec_mul512x512_inline (detail::bit_cast<__VEC_U_512> (a),
+				 detail::bit_cast<__VEC_U_512> (b)));
+    }
+  else if constexpr (Bits == 1024)
+    {
+      uint<2048> p;
+      __VEC_PWR_IMP (vec_mul1024x1024) ((__VEC_U_2048 *) p.vx,
+					(__VEC_U_1024 *) a.vx,
+					(__VEC_U_1024 *) b.vx);
+      return p;
+    }
+  else
+    {
+      uint<4096> p;
+      __VEC_PWR_IMP (vec_mul2048x2048) ((__VEC_U_4096 *) p.vx,
+					(__VEC_U_2048 *) a.vx,
+					(__VEC_U_2048 *) b.vx);
+      return p;
+    }
+}
+
+/** \brief Multiply modulo 2**Bits (the low order half of the
+ *  full product).
+ */
+template<unsigned Bits>
+static inline uint<Bits>
+operator* (const uint<Bits> &a, const uint<Bits> &b)
+{
+  uint<Bits> r;
+  if constexpr (Bits == 128)
+    {
+      r.vx[0] = vec_mulluq (a.vx[0], b.vx[0]);
+    }
+  else if constexpr (Bits < 4096)
+    {
+      uint<2 * Bits> p = mul_full (a, b);
+      for (unsigned i = 0; i < uint<Bits>::quadwords; i++)
+	r.limb (i) = p.limb (i);
+    }
+  else
+    {
+      /* No 8192-bit product type. Use the 512-bit blocked MxN
+         multiply and keep the low order 4096-bits.  */
+      __VEC_U_512 p[16];
+      __VEC_PWR_IMP (vec_mul512_byMN) (p, (__VEC_U_512 *) a.vx,
+				       (__VEC_U_512 *) b.vx, 8, 8);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+      __builtin_memcpy (r.vx, &p[0], sizeof (r.vx));
+#else
+      __builtin_memcpy (r.vx, &p[8], sizeof (r.vx));
+#endif
+    }
+  return r;
+}
+
+/** \brief Divide a Bits-bit value by a 128-bit divisor.
+ *
+ *  Returns the quotient and stores the 128-bit remainder into *rem
+ *  (if rem is not NULL). The results are undefined if d is zero.
+ *
+ *  Wider values divide from the high order quadword down with
+ *  vec_divdqu_inline(). The partial remainder is always less than
+ *  the divisor so each partial quotient fits in 128-bits.
+ */
+template<unsigned Bits>
+static inline uint<Bits>
+divmod (const uint<Bits> &a, vui128_t d, vui128_t *rem)
+{
+  uint<Bits> q;
+  if constexpr (Bits == 128)
+    {
+      q.vx[0] = vec_vdivuq_inline (a.vx[0], d);
+      if (rem)
+	*rem = vec_vmoduq_inline (a.vx[0], d);
+    }
+  else
+    {
+      vui128_t r = (vui128_t) ((unsigned __int128) 0);
+      for (unsigned i = uint<Bits>::quadwords; i-- > 0;)
+	{
+	  __VEC_U_128RQ rq = vec_divdqu_inline (r, a.limb (i), d);
+	  q.limb (i) = rq.Q;
+	  r = rq.R;
+	}
+      if (rem)
+	*rem = r;
+    }
+  return q;
+}
+
+/** \brief Divide by a 128-bit divisor. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator/ (const uint<Bits> &a, const uint<128> &d)
+{
+  return divmod (a, d.vx[0], (vui128_t *) 0);
+}
+
+/** \brief Modulo by a 128-bit divisor. */
+template<unsigned Bits>
+static inline uint<128>
+operator% (const uint<Bits> &a, const uint<128> &d)
+{
+  uint<128> r;
+  (void) divmod (a, d.vx[0], &r.vx[0]);
+  return r;
+}
+
+/** \brief Bitwise AND. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator& (const uint<Bits> &a, const uint<Bits> &b)
+{
+  uint<Bits> r;
+  for (unsigned i = 0; i < uint<Bits>::quadwords; i++)
+    r.vx[i] = (vui128_t) vec_and ((vui32_t) a.vx[i], (vui32_t) b.vx[i]);
+  return r;
+}
+
+/** \brief Bitwise OR. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator| (const uint<Bits> &a, const uint<Bits> &b)
+{
+  uint<Bits> r;
+  for (unsigned i = 0; i < uint<Bits>::quadwords; i++)
+    r.vx[i] = (vui128_t) vec_or ((vui32_t) a.vx[i], (vui32_t) b.vx[i]);
+  return r;
+}
+
+/** \brief Bitwise XOR. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator^ (const uint<Bits> &a, const uint<Bits> &b)
+{
+  uint<Bits> r;
+  for (unsigned i = 0; i < uint<Bits>::quadwords; i++)
+    r.vx[i] = (vui128_t) vec_xor ((vui32_t) a.vx[i], (vui32_t) b.vx[i]);
+  return r;
+}
+
+/** \brief Bitwise NOT. */
+template<unsigned Bits>
+static inline uint<Bits>
+operator~ (const uint<Bits> &a)
+{
+  uint<Bits> r;
+  for (unsigned i = 0; i < uint<Bits>::quadwords; i++)
+    r.vx[i] = (vui128_t) vec_nor ((vui32_t) a.vx[i], (vui32_t) a.vx[i]);
+  return r;
+}
+
+/** \brief Equal. */
+template<unsigned Bits>
+static inline bool
+operator== (const uint<Bits> &a, const uint<Bits> &b)
+{
+  for (unsigned i = 0; i < uint<Bits>::quadwords; i++)
+    if (!vec_cmpuq_all_eq (a.vx[i], b.vx[i]))
+      return false;
+  return true;
+}
+
+/** \brief Not equal. */
+template<unsigned Bits>
+static inline bool
+operator!= (const uint<Bits> &a, const uint<Bits> &b)
+{
+  return !(a == b);
+}
+
+/** \brief Less than (unsigned). */
+template<unsigned Bits>
+static inline bool
+operator< (const uint<Bits> &a, const uint<Bits> &b)
+{
+  for (unsigned i = uint<Bits>::quadwords; i-- > 1;)
+    if (!vec_cmpuq_all_eq (a.limb (i), b.limb (i)))
+      return vec_cmpuq_all_lt (a.limb (i), b.limb (i));
+  return vec_cmpuq_all_lt (a.limb (0), b.limb (0));
+}
+
+/** \brief Greater than (unsigned). */
+template<unsigned Bits>
+static inline bool
+operator> (const uint<Bits> &a, const uint<Bits> &b)
+{
+  return b < a;
+}
+
+/** \brief Less than or equal (unsigned). */
+template<unsigned Bits>
+static inline bool
+operator<= (const uint<Bits> &a, const uint<Bits> &b)
+{
+  return !(b < a);
+}
+
+/** \brief Greater than or equal (unsigned). */
+template<unsigned Bits>
+static inline bool
+operator>= (const uint<Bits> &a, const uint<Bits> &b)
+{
+  return !(a < b);
+}
+
+template<unsigned Bits>
+static inline uint<Bits> &
+operator+= (uint<Bits> &a, const uint<Bits> &b)
+{
+  return a = a + b;
+}
+
+template<unsigned Bits>
+static inline uint<Bits> &
+operator-= (uint<Bits> &a, const uint<Bits> &b)
+{
+  return a = a - b;
+}
+
+template<unsigned Bits>
+static inline uint<Bits> &
+operator*= (uint<Bits> &a, const uint<Bits> &b)
+{
+  return a = a * b;
+}
+
+template<unsigned Bits>
+static inline uint<Bits> &
+operator/= (uint<Bits> &a, const uint<128> &d)
+{
+  return a = a / d;
+}
+
+/// 128-bit unsigned integer.
+typedef uint<128> uint128_t;
+/// 256-bit unsigned integer.
+typedef uint<256> uint256_t;
+/// 512-bit unsigned integer.
+typedef uint<512> uint512_t;
+/// 1024-bit unsigned integer.
+typedef uint<1024> uint1024_t;
+/// 2048-bit unsigned integer.
+typedef uint<2048> uint2048_t;
+/// 4096-bit unsigned integer.
+typedef uint<4096> uint4096_t;
+
+} /* namespace pvec */
+
+#endif /* SRC_PVECLIB_VEC_UINT_PPC_HPP_ */
@@ -13527,5 +13527,7 @@ test_vec_f128 (void)
 
   rc += test_div_qpo ();
   rc += test_div_qpo_xtra ();
+
+  rc += test_qp_rm ();
   return (rc);
 }
@@ -22,7 +22,10 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <float.h>
+#include <limits.h>
+#include <math.h>
 
 #include "arith128.h"
 #include <testsuite/arith128_print.h>
@@ -2225,6 +2228,172 @@ test_f32_indentity_array ()
   return rc;
 }
 
+#define test_exp_f32_u10 __VEC_PWR_IMP(vec_exp_f32_u10)
+#define test_exp_f32_u35 __VEC_PWR_IMP(vec_exp_f32_u35)
+#define test_log_f32_u10 __VEC_PWR_IMP(vec_log_f32_u10)
+#define test_log_f32_u35 __VEC_PWR_IMP(vec_log_f32_u35)
+#define test_pow_f32_u10 __VEC_PWR_IMP(vec_pow_f32_u10)
+#define test_sin_f32_u10 __VEC_PWR_IMP(vec_sin_f32_u10)
+#define test_sin_f32_u35 __VEC_PWR_IMP(vec_sin_f32_u35)
+#define test_cos_f32_u10 __VEC_PWR_IMP(vec_cos_f32_u10)
+#define test_cos_f32_u35 __VEC_PWR_IMP(vec_cos_f32_u35)
+#define test_tanh_f32_u35 __VEC_PWR_IMP(vec_tanh_f32_u35)
+#define test_sigmoid_f32_u10 __VEC_PWR_IMP(vec_sigmoid_f32_u10)
+#define test_sigmoid_f32_u35 __VEC_PWR_IMP(vec_sigmoid_f32_u35)
+
+/* Check out[0..n) against the correctly rounded expect within ulps,
+ * using the distance of the sign magnitude bits in monotonic order.
+ * ulps 0 requires the same bits, including the sign of zero.  */
+static int
+test_mathf_check (const char *name, const float *out, const float *in,
+		  const float *expect, int n, int ulps)
+{
+  int i, rc = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      int ia, ib, ok;
+
+      memcpy (&ia, &out[i], sizeof (ia));
+      memcpy (&ib, &expect[i], sizeof (ib));
+      if (ia < 0)
+	ia = (int) 0x80000000U - ia;
+      if (ib < 0)
+	ib = (int) 0x80000000U - ib;
+      if (expect[i] != expect[i])
+	ok = (out[i] != out[i]);
+      else if (ulps == 0)
+	ok = (memcmp (&out[i], &expect[i], sizeof (float)) == 0);
+      else
+	ok = (ia - ib <= ulps && ib - ia <= ulps);
+      if (!ok)
+	{
+	  printf ("%s (%a) = %a expected %a\n", name, in[i], out[i],
+		  expect[i]);
+	  rc += 1;
+	}
+    }
+  return rc;
+}
+
+int
+test_vec_math_f32 (void)
+{
+  /* 1e5 takes the double reduction path of the u35 sin/cos.  */
+  const float x[7] = { -80.0f, 0.5f, 1.0f, 3.0f, 100.0f, 1e5f, 0x1p-20f };
+  const float e_exp[7] = { 0x1.7fd974p-116f, 0x1.a61298p+0f,
+    0x1.5bf0a8p+1f, 0x1.415e5cp+4f, __builtin_inff (), __builtin_inff (),
+    0x1.00001p+0f };
+  const float e_log[7] = { __builtin_nanf (""), -0x1.62e43p-1f, 0.0f,
+    0x1.193ea8p+0f, 0x1.26bb1cp+2f, 0x1.7069e2p+3f, -0x1.bb9d3cp+3f };
+  const float e_sin[7] = { 0x1.fcdefap-1f, 0x1.eaee88p-2f,
+    0x1.aed548p-1f, 0x1.210386p-3f, -0x1.03425cp-1f, 0x1.24daaap-5f,
+    0x1p-20f };
+  const float e_cos[7] = { -0x1.c4256ap-4f, 0x1.c1528p-1f, 0x1.14a28p-1f,
+    -0x1.fae04cp-1f, 0x1.b981dcp-1f, -0x1.ffac38p-1f, 0x1p+0f };
+  const float e_tanh[7] = { -0x1p+0f, 0x1.d9353ep-2f, 0x1.85efacp-1f,
+    0x1.fd77d2p-1f, 0x1p+0f, 0x1p+0f, 0x1p-20f };
+  const float e_sig[7] = { 0x1.7fd974p-116f, 0x1.3eb2fep-1f,
+    0x1.764d5p-1f, 0x1.e7b7ccp-1f, 0x1p+0f, 0x1p+0f, 0x1.000008p-1f };
+  const float px[2] = { 2.0f, -2.0f }, py[2] = { 0.5f, -3.0f };
+  const float e_pow[2] = { 0x1.6a09e6p+0f, -0x1p-3f };
+  float out[7];
+  int rc = 0;
+
+  printf ("\ntest_vec_math_f32 Elementary functions\n");
+
+  test_exp_f32_u10 (out, x, 7);
+  rc += test_mathf_check ("vec_exp_f32_u10", out, x, e_exp, 7, 1);
+  test_exp_f32_u35 (out, x, 7);
+  rc += test_mathf_check ("vec_exp_f32_u35", out, x, e_exp, 7, 3);
+  test_log_f32_u10 (out, x, 7);
+  rc += test_mathf_check ("vec_log_f32_u10", out, x, e_log, 7, 1);
+  test_log_f32_u35 (out, x, 7);
+  rc += test_mathf_check ("vec_log_f32_u35", out, x, e_log, 7, 3);
+  test_sin_f32_u10 (out, x, 7);
+  rc += test_mathf_check ("vec_sin_f32_u10", out, x, e_sin, 7, 1);
+  test_sin_f32_u35 (out, x, 7);
+  rc += test_mathf_check ("vec_sin_f32_u35", out, x, e_sin, 7, 3);
+  test_cos_f32_u10 (out, x, 7);
+  rc += test_mathf_check ("vec_cos_f32_u10", out, x, e_cos, 7, 1);
+  test_cos_f32_u35 (out, x, 7);
+  rc += test_mathf_check ("vec_cos_f32_u35", out, x, e_cos, 7, 3);
+  test_tanh_f32_u35 (out, x, 7);
+  rc += test_mathf_check ("vec_tanh_f32_u35", out, x, e_tanh, 7, 3);
+  test_sigmoid_f32_u10 (out, x, 7);
+  rc += test_mathf_check ("vec_sigmoid_f32_u10", out, x, e_sig, 7, 1);
+  test_sigmoid_f32_u35 (out, x, 7);
+  rc += test_mathf_check ("vec_sigmoid_f32_u35", out, x, e_sig, 7, 3);
+  test_pow_f32_u10 (out, px, py, 2);
+  rc += test_mathf_check ("vec_pow_f32_u10", out, px, e_pow, 2, 1);
+
+  return (rc);
+}
+
+#define test_frexp_f32 __VEC_PWR_IMP(vec_frexp_f32)
+#define test_ldexp_f32 __VEC_PWR_IMP(vec_ldexp_f32)
+#define test_scalbn_f32 __VEC_PWR_IMP(vec_scalbn_f32)
+#define test_ilogb_f32 __VEC_PWR_IMP(vec_ilogb_f32)
+#define test_logb_f32 __VEC_PWR_IMP(vec_logb_f32)
+#define test_nextafter_f32 __VEC_PWR_IMP(vec_nextafter_f32)
+
+int
+test_vec_fpexp_f32 (void)
+{
+  const float inf = __builtin_inff ();
+  const float nan = __builtin_nanf ("");
+  const float x[7] = { 6.0f, -0x1p-149f, 0x1.8p-140f, -0.0f, inf, nan,
+    0x1.fffffep127f };
+  const float em[7] = { 0.75f, -0.5f, 0.75f, -0.0f, inf, nan,
+    0x1.fffffep-1f };
+  const int ee[7] = { 3, -148, -139, 0, 0, 0, 128 };
+  const int ei[7] = { 2, -149, -140, FP_ILOGB0, INT_MAX, FP_ILOGBNAN, 127 };
+  const float el[7] = { 2.0f, -149.0f, -140.0f, -inf, inf, nan, 127.0f };
+  /* 6.0 2^-151 is a tie between subnormals and rounds to even.
+   * 0x1.8p-140 2^-10 is 0.75 of the smallest subnormal and rounds
+   * up.  */
+  const int k[7] = { -151, 149, -10, 5, -3, 0, 2 };
+  const float ek[7] = { 0x1p-148f, -1.0f, 0x1p-149f, -0.0f, inf, nan,
+    inf };
+  const float es[7] = { inf, -0x1p+2f, 0x1.8p+11f, -0.0f, inf, nan, inf };
+  const float y[7] = { 7.0f, 0.0f, -inf, 1.0f, 0.0f, 1.0f, inf };
+  const float en[7] = { 0x1.800002p+2f, -0.0f, 0x1.7f8p-140f, 0x1p-149f,
+    0x1.fffffep127f, nan, inf };
+  float out[7];
+  int e[7];
+  int rc = 0;
+
+  printf ("\ntest_vec_fpexp_f32 frexp, ldexp, ilogb, logb, nextafter\n");
+
+  test_frexp_f32 (out, e, x, 7);
+  rc += test_mathf_check ("vec_frexp_f32", out, x, em, 7, 0);
+  if (memcmp (e, ee, sizeof (ee)) != 0)
+    {
+      printf ("vec_frexp_f32 exp %d %d %d %d %d %d %d\n", e[0], e[1], e[2],
+	      e[3], e[4], e[5], e[6]);
+      rc += 1;
+    }
+  test_ilogb_f32 (e, x, 7);
+  if (memcmp (e, ei, sizeof (ei)) != 0)
+    {
+      printf ("vec_ilogb_f32 %d %d %d %d %d %d %d\n", e[0], e[1], e[2],
+	      e[3], e[4], e[5], e[6]);
+      rc += 1;
+    }
+  test_logb_f32 (out, x, 7);
+  rc += test_mathf_check ("vec_logb_f32", out, x, el, 7, 0);
+  test_ldexp_f32 (out, x, k, 7);
+  rc += test_mathf_check ("vec_ldexp_f32", out, x, ek, 7, 0);
+  test_scalbn_f32 (out, x, 151, 7);
+  rc += test_mathf_check ("vec_scalbn_f32", out, x, es, 7, 0);
+  test_scalbn_f32 (&out[1], &out[1], -151, 2);
+  rc += test_mathf_check ("vec_scalbn_f32", &out[1], &es[1], &x[1], 2, 0);
+  test_nextafter_f32 (out, x, y, 7);
+  rc += test_mathf_check ("vec_nextafter_f32", out, x, en, 7, 0);
+
+  return (rc);
+}
+
 int
 test_setb_sp (void)
 {
@@ -2328,6 +2497,8 @@ test_vec_f32 (void)
   rc += test_lvgfsx ();
   rc += test_stvgfsx ();
   rc += test_f32_indentity_array ();
+  rc += test_vec_math_f32 ();
+  rc += test_vec_fpexp_f32 ();
 
   return (rc);
 }
@@ -22,7 +22,10 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <float.h>
+#include <limits.h>
+#include <math.h>
 
 #include "arith128.h"
 #include <testsuite/arith128_print.h>
@@ -3020,6 +3023,519 @@ test_indentity_array ()
   return rc;
 }
 
+#define test_rng_uniform_f64 __VEC_PWR_IMP(vec_rng_uniform_f64)
+#define test_rng_normal_f64 __VEC_PWR_IMP(vec_rng_normal_f64)
+#define test_philox4x32_fill_u32 __VEC_PWR_IMP(vec_philox4x32_fill_u32)
+
+#define TEST_RNG_MAX 4096
+static unsigned long long test_rng_in[TEST_RNG_MAX];
+static double test_rng_out[TEST_RNG_MAX];
+
+int
+test_vec_rng_f64 (void)
+{
+  /* sqrt(-2 log(0.5)).  */
+  const double r = 1.1774100225154747;
+  double sum, sum2, e;
+  unsigned long i;
+  int rc = 0;
+
+  printf ("\ntest_vec_rng_f64 Uniform and normal doubles\n");
+
+  test_rng_in[0] = 0;
+  test_rng_in[1] = 0xffffffffffffffffULL;
+  test_rng_in[2] = 0x8000000000000000ULL;
+  test_rng_in[3] = 0x0000000000000fffULL;
+  test_rng_in[4] = 0x4000000000001000ULL;
+  test_rng_uniform_f64 (test_rng_out, test_rng_in, 5);
+  if (test_rng_out[0] != 0.0 || test_rng_out[1] != (1.0 - 0x1p-52)
+      || test_rng_out[2] != 0.5 || test_rng_out[3] != 0.0
+      || test_rng_out[4] != (0.25 + 0x1p-52))
+    {
+      printf ("vec_rng_uniform_f64 %a %a %a %a %a\n", test_rng_out[0],
+	      test_rng_out[1], test_rng_out[2], test_rng_out[3],
+	      test_rng_out[4]);
+      rc += 1;
+    }
+
+  /* u1 of 1.0 gives 0.0. u1 of 0.5 with u2 of 0.0, 0.25 and 0.5
+   * gives r on the axes.  */
+  test_rng_in[0] = 0;
+  test_rng_in[1] = 0x1234567800000000ULL;
+  test_rng_in[2] = 0x8000000000000000ULL;
+  test_rng_in[3] = 0;
+  test_rng_in[4] = 0x8000000000000000ULL;
+  test_rng_in[5] = 0x4000000000000000ULL;
+  test_rng_in[6] = 0x8000000000000000ULL;
+  test_rng_in[7] = 0x8000000000000000ULL;
+  test_rng_normal_f64 (test_rng_out, test_rng_in, 8);
+  {
+    const double expect[8] = { 0.0, 0.0, r, 0.0, 0.0, r, -r, 0.0 };
+
+    for (i = 0; i < 8; i++)
+      {
+	e = test_rng_out[i] - expect[i];
+	if (e > 1.0e-15 || e < -1.0e-15)
+	  {
+	    printf ("vec_rng_normal_f64 [%lu] %a expected %a\n", i,
+		    test_rng_out[i], expect[i]);
+	    rc += 1;
+	  }
+      }
+  }
+
+  /* Sample mean and variance of 4096 normals.  */
+  test_philox4x32_fill_u32 ((unsigned int *) test_rng_in, 2 * TEST_RNG_MAX,
+			    (vui128_t) CONST_VINT128_DW (0, 0), 12345);
+  test_rng_normal_f64 (test_rng_out, test_rng_in, TEST_RNG_MAX - 1);
+  sum = sum2 = 0.0;
+  for (i = 0; i < TEST_RNG_MAX - 1; i++)
+    {
+      sum += test_rng_out[i];
+      sum2 += test_rng_out[i] * test_rng_out[i];
+    }
+  sum /= (TEST_RNG_MAX - 1);
+  sum2 /= (TEST_RNG_MAX - 1);
+  if (sum > 0.1 || sum < -0.1 || sum2 > 1.1 || sum2 < 0.9)
+    {
+      printf ("vec_rng_normal_f64 mean %g variance %g\n", sum, sum2);
+      rc += 1;
+    }
+
+  return (rc);
+}
+
+#define test_exp_f64_u10 __VEC_PWR_IMP(vec_exp_f64_u10)
+#define test_exp_f64_u35 __VEC_PWR_IMP(vec_exp_f64_u35)
+#define test_log_f64_u10 __VEC_PWR_IMP(vec_log_f64_u10)
+#define test_log_f64_u35 __VEC_PWR_IMP(vec_log_f64_u35)
+#define test_pow_f64_u10 __VEC_PWR_IMP(vec_pow_f64_u10)
+#define test_sin_f64_u10 __VEC_PWR_IMP(vec_sin_f64_u10)
+#define test_sin_f64_u35 __VEC_PWR_IMP(vec_sin_f64_u35)
+#define test_cos_f64_u10 __VEC_PWR_IMP(vec_cos_f64_u10)
+#define test_cos_f64_u35 __VEC_PWR_IMP(vec_cos_f64_u35)
+#define test_tanh_f64_u10 __VEC_PWR_IMP(vec_tanh_f64_u10)
+#define test_tanh_f64_u35 __VEC_PWR_IMP(vec_tanh_f64_u35)
+#define test_sigmoid_f64_u10 __VEC_PWR_IMP(vec_sigmoid_f64_u10)
+#define test_sigmoid_f64_u35 __VEC_PWR_IMP(vec_sigmoid_f64_u35)
+
+/* Distance in ULPs between a and b, as the difference of the sign
+ * magnitude bits mapped to a monotonic integer order.  */
+static unsigned long long
+test_math_ulps (double a, double b)
+{
+  long long ia, ib;
+
+  memcpy (&ia, &a, sizeof (ia));
+  memcpy (&ib, &b, sizeof (ib));
+  if (ia < 0)
+    ia = 0x8000000000000000LL - ia;
+  if (ib < 0)
+    ib = 0x8000000000000000LL - ib;
+  return (ia > ib) ? (ia - ib) : (ib - ia);
+}
+
+/* Check out[0..n) against the correctly rounded expect within ulps.
+ * ulps 0 requires the same bits, including the sign of zero and NaN.  */
+static int
+test_math_check (const char *name, const double *out, const double *in,
+		 const double *expect, int n, unsigned long long ulps)
+{
+  int i, rc = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      int ok;
+
+      if (expect[i] != expect[i])
+	ok = (out[i] != out[i]);
+      else if (ulps == 0)
+	ok = (memcmp (&out[i], &expect[i], sizeof (double)) == 0);
+      else
+	ok = (test_math_ulps (out[i], expect[i]) <= ulps);
+      if (!ok)
+	{
+	  printf ("%s (%a) = %a expected %a\n", name, in[i], out[i],
+		  expect[i]);
+	  rc += 1;
+	}
+    }
+  return rc;
+}
+
+int
+test_vec_math_f64 (void)
+{
+  const double inf = __builtin_inf ();
+  const double nan = __builtin_nan ("");
+  double out[8];
+  int rc = 0;
+
+  printf ("\ntest_vec_math_f64 Elementary functions\n");
+
+  /* Correctly rounded references. The u10 results may be 1 ULP off
+   * (when the exact value is near a rounding boundary), u35 3 ULP.
+   * Odd counts exercise the partial vector tail.  */
+  {
+    const double x[8] = { -700.5, -1.0, 0x1p-30, 0.5, 1.0, 10.25, 709.5,
+      -740.0 };
+    const double e[8] = { 0x1.4ff475c68ca02p-1011, 0x1.78b56362cef38p-2,
+      0x1.00000004p+0, 0x1.a61298e1e069cp+0, 0x1.5bf0a8b145769p+1,
+      0x1.b9ea2aed2a0f1p+14, 0x1.81e9b4b52d0c9p+1023,
+      0x0.0000000000055p-1022 };
+
+    test_exp_f64_u10 (out, x, 7);
+    rc += test_math_check ("vec_exp_f64_u10", out, x, e, 7, 1);
+    test_exp_f64_u10 (out, x, 8);
+    rc += test_math_check ("vec_exp_f64_u10", out, x, e, 8, 1);
+    test_exp_f64_u35 (out, x, 7);
+    rc += test_math_check ("vec_exp_f64_u35", out, x, e, 7, 3);
+  }
+  {
+    const double x[8] = { 0x1p-1074, 0x1p-1022, 0.75, 1.0 + 0x1p-40, 2.0,
+      10.0, 1e300, 0x1.fffffffffffffp1023 };
+    const double e[8] = { -0x1.74385446d71c3p+9, -0x1.6232bdd7abcd2p+9,
+      -0x1.269621134db92p-2, 0x1.ffffffffffp-41, 0x1.62e42fefa39efp-1,
+      0x1.26bb1bbb55516p+1, 0x1.5963447f87fb5p+9,
+      0x1.62e42fefa39efp+9 };
+
+    test_log_f64_u10 (out, x, 8);
+    rc += test_math_check ("vec_log_f64_u10", out, x, e, 8, 1);
+    test_log_f64_u35 (out, x, 8);
+    rc += test_math_check ("vec_log_f64_u35", out, x, e, 8, 3);
+  }
+  {
+    /* Includes arguments that need the Payne-Hanek reduction.  */
+    const double x[8] = { 0x1p-30, 0.5, 1.0, 3.0, 100.0, 1e6, 1e22,
+      0x1p1023 };
+    const double s[8] = { 0x1p-30, 0x1.eaee8744b05fp-2,
+      0x1.aed548f090ceep-1, 0x1.210386db6d55bp-3, -0x1.03425b78c4db8p-1,
+      -0x1.6664b2568d867p-2, -0x1.b453ab76bf397p-1, 0x1.205248cbdb76p-1 };
+    const double c[8] = { 0x1p+0, 0x1.c1528065b7d5p-1,
+      0x1.14a280fb5068cp-1, -0x1.fae04be85e5d2p-1, 0x1.b981dbf665fdfp-1,
+      0x1.df9df9906d32cp-1, 0x1.0be2cef01c8f4p-1, -0x1.a719f26c232bfp-1 };
+
+    test_sin_f64_u10 (out, x, 8);
+    rc += test_math_check ("vec_sin_f64_u10", out, x, s, 8, 1);
+    test_sin_f64_u35 (out, x, 8);
+    rc += test_math_check ("vec_sin_f64_u35", out, x, s, 8, 3);
+    test_cos_f64_u10 (out, x, 8);
+    rc += test_math_check ("vec_cos_f64_u10", out, x, c, 8, 1);
+    test_cos_f64_u35 (out, x, 8);
+    rc += test_math_check ("vec_cos_f64_u35", out, x, c, 8, 3);
+  }
+  {
+    const double x[8] = { -30.0, -1.0, 0x1p-30, 0.125, 0.5, 2.0, 19.0,
+      23.0 };
+    const double e[8] = { -0x1p+0, -0x1.85efab514f394p-1, 0x1p-30,
+      0x1.fd5992bc4b835p-4, 0x1.d9353d7568af3p-2, 0x1.ed9505e1bc3d4p-1,
+      0x1.fffffffffffffp-1, 0x1p+0 };
+
+    test_tanh_f64_u10 (out, x, 8);
+    rc += test_math_check ("vec_tanh_f64_u10", out, x, e, 8, 1);
+    test_tanh_f64_u35 (out, x, 8);
+    rc += test_math_check ("vec_tanh_f64_u35", out, x, e, 8, 3);
+  }
+  {
+    const double x[8] = { -740.0, -30.0, -1.0, 0.0, 0x1p-30, 1.0, 30.0,
+      40.0 };
+    const double e[8] = { 0x0.0000000000055p-1022, 0x1.a56e0c2ac7cbfp-44,
+      0x1.136561454ba86p-2, 0x1p-1, 0x1.00000002p-1,
+      0x1.764d4f5d5a2bdp-1, 0x1.ffffffffffcb5p-1, 0x1p+0 };
+
+    test_sigmoid_f64_u10 (out, x, 8);
+    rc += test_math_check ("vec_sigmoid_f64_u10", out, x, e, 8, 1);
+    test_sigmoid_f64_u35 (out, x, 8);
+    rc += test_math_check ("vec_sigmoid_f64_u35", out, x, e, 8, 3);
+  }
+  {
+    const double x[8] = { 2.0, 10.0, 0.5, 1.5, -2.0, -3.0, 1e-300, 7.0 };
+    const double y[8] = { 0.5, -3.0, 1074.0, 100.25, 3.0, -5.0, -1.0,
+      1.0 / 3 };
+    const double e[8] = { 0x1.6a09e667f3bcdp+0, 0x1.0624dd2f1a9fcp-10,
+      0x0.0000000000001p-1022, 0x1.8f9f20247e3a3p+58, -0x1p+3,
+      -0x1.0db20a88f4696p-8, 0x1.7e43c8800759bp+996,
+      0x1.e9b5dba58189dp+0 };
+
+    test_pow_f64_u10 (out, x, y, 8);
+    rc += test_math_check ("vec_pow_f64_u10", out, x, e, 8, 1);
+  }
+
+  /* C99 Annex F special values, exact.  */
+  {
+    const double x[6] = { 0.0, -0.0, inf, -inf, nan, 710.0 };
+    const double e[6] = { 1.0, 1.0, inf, 0.0, nan, inf };
+
+    test_exp_f64_u10 (out, x, 6);
+    rc += test_math_check ("vec_exp_f64_u10", out, x, e, 6, 0);
+  }
+  {
+    const double x[6] = { 0.0, -0.0, -1.0, 1.0, inf, nan };
+    const double e[6] = { -inf, -inf, nan, 0.0, inf, nan };
+
+    test_log_f64_u10 (out, x, 6);
+    rc += test_math_check ("vec_log_f64_u10", out, x, e, 6, 0);
+    test_log_f64_u35 (out, x, 6);
+    rc += test_math_check ("vec_log_f64_u35", out, x, e, 6, 0);
+  }
+  {
+    const double x[4] = { -0.0, inf, -inf, nan };
+    const double s[4] = { -0.0, nan, nan, nan };
+    const double c[4] = { 1.0, nan, nan, nan };
+    const double t[4] = { -0.0, 1.0, -1.0, nan };
+    const double g[4] = { 0.5, 1.0, 0.0, nan };
+
+    test_sin_f64_u10 (out, x, 4);
+    rc += test_math_check ("vec_sin_f64_u10", out, x, s, 4, 0);
+    test_sin_f64_u35 (out, x, 4);
+    rc += test_math_check ("vec_sin_f64_u35", out, x, s, 4, 0);
+    test_cos_f64_u10 (out, x, 4);
+    rc += test_math_check ("vec_cos_f64_u10", out, x, c, 4, 0);
+    test_tanh_f64_u10 (out, x, 4);
+    rc += test_math_check ("vec_tanh_f64_u10", out, x, t, 4, 0);
+    test_sigmoid_f64_u10 (out, x, 4);
+    rc += test_math_check ("vec_sigmoid_f64_u10", out, x, g, 4, 0);
+  }
+  {
+    const double x[8] = { nan, 1.0, -8.0, -0.0, -0.0, 0.5, -1.0, -inf };
+    const double y[8] = { 0.0, nan, 1.0 / 3, -3.0, -2.0, -inf, inf, -3.0 };
+    const double e[8] = { 1.0, 1.0, nan, -inf, inf, inf, 1.0, -0.0 };
+
+    test_pow_f64_u10 (out, x, y, 8);
+    rc += test_math_check ("vec_pow_f64_u10", out, x, e, 8, 0);
+  }
+
+  return (rc);
+}
+
+#define test_frexp_f64 __VEC_PWR_IMP(vec_frexp_f64)
+#define test_ldexp_f64 __VEC_PWR_IMP(vec_ldexp_f64)
+#define test_scalbn_f64 __VEC_PWR_IMP(vec_scalbn_f64)
+#define test_ilogb_f64 __VEC_PWR_IMP(vec_ilogb_f64)
+#define test_logb_f64 __VEC_PWR_IMP(vec_logb_f64)
+#define test_nextafter_f64 __VEC_PWR_IMP(vec_nextafter_f64)
+
+int
+test_vec_fpexp_f64 (void)
+{
+  const double inf = __builtin_inf ();
+  const double nan = __builtin_nan ("");
+  const double x[7] = { 6.0, -0x1p-1074, 0x1.8p-1030, -0.0, inf, nan,
+    0x1.fffffffffffffp1023 };
+  double out[7];
+  int e[7];
+  int rc = 0;
+
+  printf ("\ntest_vec_fpexp_f64 frexp, ldexp, ilogb, logb, nextafter\n");
+
+  {
+    const double em[7] = { 0.75, -0.5, 0.75, -0.0, inf, nan,
+      0x1.fffffffffffffp-1 };
+    const int ee[7] = { 3, -1073, -1029, 0, 0, 0, 1024 };
+
+    test_frexp_f64 (out, e, x, 7);
+    rc += test_math_check ("vec_frexp_f64", out, x, em, 7, 0);
+    if (memcmp (e, ee, sizeof (ee)) != 0)
+      {
+	printf ("vec_frexp_f64 exp %d %d %d %d %d %d %d\n", e[0], e[1],
+		e[2], e[3], e[4], e[5], e[6]);
+	rc += 1;
+      }
+  }
+  {
+    const int ee[7] = { 2, -1074, -1030, FP_ILOGB0, INT_MAX, FP_ILOGBNAN,
+      1023 };
+    const double el[7] = { 2.0, -1074.0, -1030.0, -inf, inf, nan, 1023.0 };
+
+    test_ilogb_f64 (e, x, 7);
+    if (memcmp (e, ee, sizeof (ee)) != 0)
+      {
+	printf ("vec_ilogb_f64 %d %d %d %d %d %d %d\n", e[0], e[1], e[2],
+		e[3], e[4], e[5], e[6]);
+	rc += 1;
+      }
+    test_logb_f64 (out, x, 7);
+    rc += test_math_check ("vec_logb_f64", out, x, el, 7, 0);
+  }
+  {
+    /* 6.0 2^-1076 is a tie between subnormals and rounds to even.
+     * 0x1.8p-1030 2^-45 is 0.75 of the smallest subnormal and rounds
+     * up.  */
+    const int k[7] = { -1076, 1074, -45, 5, -3, 0, 2 };
+    const double el[7] = { 0x1p-1073, -0x1p+0, 0x1p-1074, -0.0, inf, nan,
+      inf };
+
+    test_ldexp_f64 (out, x, k, 7);
+    rc += test_math_check ("vec_ldexp_f64", out, x, el, 7, 0);
+  }
+  {
+    /* Scaling the subnormals up by 2^1076 and back is exact.  */
+    const double es[7] = { inf, -0x1p+2, 0x1.8p+46, -0.0, inf, nan, inf };
+
+    test_scalbn_f64 (out, x, 1076, 7);
+    rc += test_math_check ("vec_scalbn_f64", out, x, es, 7, 0);
+    test_scalbn_f64 (&out[1], &out[1], -1076, 2);
+    rc += test_math_check ("vec_scalbn_f64", &out[1], &es[1], &x[1], 2, 0);
+  }
+  {
+    const double y[7] = { 7.0, 0.0, -inf, 1.0, 0.0, 1.0, inf };
+    const double en[7] = { 0x1.8000000000001p+2, -0.0,
+      0x1.7ffffffffffp-1030, 0x1p-1074, 0x1.fffffffffffffp1023, nan, inf };
+
+    test_nextafter_f64 (out, x, y, 7);
+    rc += test_math_check ("vec_nextafter_f64", out, x, en, 7, 0);
+  }
+
+  return (rc);
+}
+
+#if defined (__LONG_DOUBLE_128__) && !defined (__LONG_DOUBLE_IEEE128__)
+#define test_add_ldbl __VEC_PWR_IMP(vec_add_ldbl)
+#define test_sub_ldbl __VEC_PWR_IMP(vec_sub_ldbl)
+#define test_mul_ldbl __VEC_PWR_IMP(vec_mul_ldbl)
+#define test_div_ldbl __VEC_PWR_IMP(vec_div_ldbl)
+#define test_sqrt_ldbl __VEC_PWR_IMP(vec_sqrt_ldbl)
+#define test_madd_ldbl __VEC_PWR_IMP(vec_madd_ldbl)
+#define test_dot_ldbl __VEC_PWR_IMP(vec_dot_ldbl)
+
+/* Compare n IBM long doubles as {high, low} double pairs, each within
+ * ulps.  */
+static int
+test_ldbl_check (const char *name, const long double *out,
+		 const double *expect, int n, unsigned long long ulps)
+{
+  double t[2 * 5];
+
+  memcpy (t, out, n * sizeof (long double));
+  return test_math_check (name, t, expect, expect, 2 * n, ulps);
+}
+
+int
+test_vec_ldbl_f64 (void)
+{
+  const double inf = __builtin_inf ();
+  const double nan = __builtin_nan ("");
+  /* a[0] = (1 + 2^-52)^2 needs both halves. The others are
+   * single doubles, including specials.  */
+  const double ad[2 * 5] = { 0x1.0000000000002p+0, 0x1p-104, 2.0, 0.0, 3.0,
+    0.0, 4.0, 0.0, inf, 0.0 };
+  const double bd[2 * 5] = { 0x1.0000000000001p+0, 0.0, 0.5, 0.0, -1.0,
+    0.0, 0.5, 0.0, 0.0, 0.0 };
+  long double a[5], b[5], c[5], out[5];
+  double t[2];
+  long double r;
+  int rc = 0;
+
+  printf ("\ntest_vec_ldbl_f64 add, sub, mul, div, sqrt, madd, dot\n");
+
+  memcpy (a, ad, sizeof (a));
+  memcpy (b, bd, sizeof (b));
+  {
+    /* 2 + 3 2^-52 is a tie in the high part, the low part keeps the
+     * rest exactly.  */
+    const double e[2 * 5] = { 0x1.0000000000002p+1, -0x1.ffffffffffffep-53,
+      2.5, 0.0, 2.0, 0.0, 4.5, 0.0, inf, 0.0 };
+
+    test_add_ldbl (out, a, b, 5);
+    rc += test_ldbl_check ("vec_add_ldbl", out, e, 5, 0);
+  }
+  {
+    const double e[2 * 5] = { 0x1.0000000000001p-52, 0.0, 1.5, 0.0, 4.0, 0.0,
+      3.5, 0.0, inf, 0.0 };
+
+    test_sub_ldbl (out, a, b, 5);
+    rc += test_ldbl_check ("vec_sub_ldbl", out, e, 5, 0);
+  }
+  {
+    /* (1 + 2^-52)^2 = 1 + 2^-51 + 2^-104 is exact in double-double.  */
+    const double e[2 * 5] = { 0x1.0000000000002p+0, 0x1p-104, 1.0, 0.0,
+      -3.0, 0.0, 2.0, 0.0, nan, 0.0 };
+
+    test_mul_ldbl (out, b, b, 1);
+    test_mul_ldbl (&out[1], &a[1], &b[1], 4);
+    rc += test_ldbl_check ("vec_mul_ldbl", out, e, 4, 0);
+    memcpy (t, &out[4], sizeof (t));
+    if (t[0] == t[0])
+      {
+	printf ("vec_mul_ldbl (inf * 0.0) = %a %a expected NaN\n", t[0],
+		t[1]);
+	rc += 1;
+      }
+  }
+  {
+    const double e[2 * 5] = { 0x1.0000000000001p+0, 0.0, 4.0, 0.0, -3.0,
+      -0.0, 8.0, 0.0, inf, 0.0 };
+
+    test_div_ldbl (out, a, b, 5);
+    rc += test_ldbl_check ("vec_div_ldbl", out, e, 5, 0);
+  }
+  {
+    /* sqrt (1 + 2^-51 + 2^-104) = 1 + 2^-52 exactly. The low parts of
+     * sqrt (2.0) and sqrt (3.0) may be 1 ulp off.  */
+    const double e[2 * 5] = { 0x1.0000000000001p+0, 0.0, 0x1.6a09e667f3bcdp+0,
+      -0x1.bdd3413b26456p-54, 0x1.bb67ae8584caap+0, 0x1.cec95d0b5c1e3p-54,
+      2.0, 0.0, inf, 0.0 };
+
+    test_sqrt_ldbl (out, a, 5);
+    rc += test_ldbl_check ("vec_sqrt_ldbl", out, e, 5, 1);
+    test_sqrt_ldbl (out, &b[2], 1);
+    memcpy (t, out, sizeof (t));
+    if (t[0] == t[0])
+      {
+	printf ("vec_sqrt_ldbl (-1.0) = %a %a expected NaN\n", t[0], t[1]);
+	rc += 1;
+      }
+  }
+  {
+    /* (1 + 2^-52)^2 - 1 keeps the 2^-104 term.  */
+    const double cd[2 * 5] = { -1.0, 0.0, 1.0, 0.0, 3.0, 0.0, -2.0, 0.0,
+      1.0, 0.0 };
+    const double e[2 * 5] = { 0x1p-51, 0x1p-104, 2.0, 0.0, 0.0, 0.0,
+      0.0, 0.0, nan, 0.0 };
+
+    memcpy (c, cd, sizeof (c));
+    test_madd_ldbl (out, b, b, c, 1);
+    test_madd_ldbl (&out[1], &a[1], &b[1], &c[1], 4);
+    rc += test_ldbl_check ("vec_madd_ldbl", out, e, 5, 0);
+  }
+  {
+    /* b[0]^2 + 0.25 + 1.0 + 0.25 + 0.0, n = 5 and n = 3 cover the
+     * unrolled loop and both tails.  */
+    const double e5[2] = { 0x1.4000000000001p+1, 0x1p-104 };
+    const double e3[2] = { 0x1.2000000000001p+1, 0x1p-104 };
+
+    r = test_dot_ldbl (b, b, 5);
+    memcpy (t, &r, sizeof (t));
+    rc += test_math_check ("vec_dot_ldbl", t, e5, e5, 2, 0);
+    r = test_dot_ldbl (b, b, 3);
+    memcpy (t, &r, sizeof (t));
+    rc += test_math_check ("vec_dot_ldbl", t, e3, e3, 2, 0);
+    r = test_dot_ldbl (b, b, 0);
+    memcpy (t, &r, sizeof (t));
+    if (t[0] != 0.0)
+      {
+	printf ("vec_dot_ldbl (n = 0) = %a expected 0.0\n", t[0]);
+	rc += 1;
+      }
+  }
+  {
+    /* An exact zero result keeps its sign.  */
+    const long double x[2] = { -1.0L, -0.0L };
+    const long double y[2] = { 0.0L, 1.0L };
+    const double e[2] = { -0.0, 0.0 };
+
+    test_mul_ldbl (out, &x[0], &y[0], 1);
+    rc += test_ldbl_check ("vec_mul_ldbl (-1.0 * 0.0)", out, e, 1, 0);
+    test_div_ldbl (out, &x[1], &y[1], 1);
+    rc += test_ldbl_check ("vec_div_ldbl (-0.0 / 1.0)", out, e, 1, 0);
+    test_add_ldbl (out, &x[1], &x[1], 1);
+    rc += test_ldbl_check ("vec_add_ldbl (-0.0 + -0.0)", out, e, 1, 0);
+  }
+
+  return (rc);
+}
+#endif
+
 int
 test_vec_f64 (void)
 {
@@ -3043,6 +3559,12 @@ test_vec_f64 (void)
   rc += test_lvgdfdx ();
   rc += test_stvgdfdx ();
   rc += test_indentity_array ();
+  rc += test_vec_rng_f64 ();
+  rc += test_vec_math_f64 ();
+  rc += test_vec_fpexp_f64 ();
+#if defined (__LONG_DOUBLE_128__) && !defined (__LONG_DOUBLE_IEEE128__)
+  rc += test_vec_ldbl_f64 ();
+#endif
 
   return (rc);
 }
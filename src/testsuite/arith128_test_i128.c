@@ -13925,6 +13925,574 @@ test_signextq_w(void)
     return (rc);
   }
 
+#define test_sort_u128 __VEC_PWR_IMP(vec_sort_u128)
+#define test_sort_s128 __VEC_PWR_IMP(vec_sort_s128)
+#define test_lower_bound_u128 __VEC_PWR_IMP(vec_lower_bound_u128)
+#define test_upper_bound_u128 __VEC_PWR_IMP(vec_upper_bound_u128)
+#define test_lower_bound_s128 __VEC_PWR_IMP(vec_lower_bound_s128)
+#define test_upper_bound_s128 __VEC_PWR_IMP(vec_upper_bound_s128)
+
+/* Large enough to reach the radix sort (65536 quadwords).  */
+#define TEST_SORTQ_MAX 65543
+static vui128_t test_sortq_keys[TEST_SORTQ_MAX];
+
+static unsigned long long
+test_sortq_rand (unsigned long long *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 7;
+  *x ^= *x << 17;
+  return *x;
+}
+
+static int
+check_sortq (char *prefix, vui128_t *keys, unsigned long n,
+	     vui128_t sum, int sgn)
+{
+  vui128_t s = (vui128_t) CONST_VINT128_DW (0, 0);
+  unsigned long i;
+  int rc = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      if (i > 0 && (sgn ? vec_cmpsq_all_gt ((vi128_t) keys[i - 1],
+					    (vi128_t) keys[i])
+			: vec_cmpuq_all_gt (keys[i - 1], keys[i])))
+	{
+	  printf ("%s n=%lu not sorted at %lu\n", prefix, n, i);
+	  print_vint128x ("  ", keys[i - 1]);
+	  print_vint128x ("  ", keys[i]);
+	  rc = 1;
+	  break;
+	}
+      s = vec_adduqm (s, keys[i]);
+    }
+  rc += check_vuint128x (prefix, s, sum);
+  return rc;
+}
+
+int
+test_vec_sort_u128 (void)
+{
+  static const unsigned long sizes[] =
+    { 0, 1, 2, 15, 16, 17, 100, 523, TEST_SORTQ_MAX };
+  const vui128_t one = (vui128_t) CONST_VINT128_DW (0, 1);
+  unsigned long long x = 0x0123456789abcdefULL;
+  vui128_t sum, key;
+  vi128_t s1, s2, skey;
+  unsigned long i, n, t, lb, ub;
+  int rc = 0;
+
+  printf ("\ntest_vec_sort_u128 Sort and search quadword arrays\n");
+
+  s1 = (vi128_t) CONST_VINT128_DW (0, 5);
+  s2 = (vi128_t) CONST_VINT128_DW (-1, -3);
+  vec_minmaxsq (&s1, &s2);
+  rc += check_vuint128x ("vec_minmaxsq min:", (vui128_t) s1,
+			 (vui128_t) CONST_VINT128_DW (-1, -3));
+  rc += check_vuint128x ("vec_minmaxsq max:", (vui128_t) s2,
+			 (vui128_t) CONST_VINT128_DW (0, 5));
+
+  for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+    {
+      n = sizes[t];
+      sum = (vui128_t) CONST_VINT128_DW (0, 0);
+      for (i = 0; i < n; i++)
+	{
+	  test_sortq_keys[i] = (vui128_t) CONST_VINT128_DW (
+	      test_sortq_rand (&x), test_sortq_rand (&x));
+	  sum = vec_adduqm (sum, test_sortq_keys[i]);
+	}
+      test_sort_u128 (test_sortq_keys, n);
+      rc += check_sortq ("vec_sort_u128:", test_sortq_keys, n, sum, 0);
+
+      /* Fresh unsorted keys, about half of them negative.  */
+      sum = (vui128_t) CONST_VINT128_DW (0, 0);
+      for (i = 0; i < n; i++)
+	{
+	  test_sortq_keys[i] = (vui128_t) CONST_VINT128_DW (
+	      test_sortq_rand (&x), test_sortq_rand (&x));
+	  sum = vec_adduqm (sum, test_sortq_keys[i]);
+	}
+      test_sort_s128 ((vi128_t *) test_sortq_keys, n);
+      rc += check_sortq ("vec_sort_s128:", test_sortq_keys, n, sum, 1);
+
+      /* Small keys with duplicates, for the search. For the radix
+         sort most digits are constant and their passes are skipped.  */
+      sum = (vui128_t) CONST_VINT128_DW (0, 0);
+      for (i = 0; i < n; i++)
+	{
+	  test_sortq_keys[i] = (vui128_t) CONST_VINT128_DW (
+	      0, test_sortq_rand (&x) % 64);
+	  sum = vec_adduqm (sum, test_sortq_keys[i]);
+	}
+      test_sort_u128 (test_sortq_keys, n);
+      rc += check_sortq ("vec_sort_u128 dup:", test_sortq_keys, n, sum, 0);
+      for (key = (vui128_t) CONST_VINT128_DW (0, 0);
+	   vec_cmpuq_all_le (key, (vui128_t) CONST_VINT128_DW (0, 65));
+	   key = vec_adduqm (key, one))
+	{
+	  for (lb = 0; lb < n && vec_cmpuq_all_lt (test_sortq_keys[lb], key);
+	       lb++)
+	    ;
+	  for (ub = lb; ub < n && vec_cmpuq_all_le (test_sortq_keys[ub], key);
+	       ub++)
+	    ;
+	  if (test_lower_bound_u128 (test_sortq_keys, n, key) != lb
+	      || test_upper_bound_u128 (test_sortq_keys, n, key) != ub)
+	    {
+	      printf ("vec_lower/upper_bound_u128 n=%lu failed\n", n);
+	      rc += 1;
+	      break;
+	    }
+	}
+
+      /* Signed small keys -32 to 31, searched from -33 to 32.  */
+      sum = (vui128_t) CONST_VINT128_DW (0, 0);
+      for (i = 0; i < n; i++)
+	{
+	  long long v = (long long) (test_sortq_rand (&x) % 64) - 32;
+	  test_sortq_keys[i] = (vui128_t) CONST_VINT128_DW (
+	      (v < 0) ? -1LL : 0LL, v);
+	  sum = vec_adduqm (sum, test_sortq_keys[i]);
+	}
+      test_sort_s128 ((vi128_t *) test_sortq_keys, n);
+      rc += check_sortq ("vec_sort_s128 dup:", test_sortq_keys, n, sum, 1);
+      for (skey = (vi128_t) CONST_VINT128_DW (-1LL, -33LL);
+	   vec_cmpsq_all_le (skey, (vi128_t) CONST_VINT128_DW (0, 32));
+	   skey = (vi128_t) vec_adduqm ((vui128_t) skey, one))
+	{
+	  const vi128_t *sk = (const vi128_t *) test_sortq_keys;
+
+	  for (lb = 0; lb < n && vec_cmpsq_all_lt (sk[lb], skey); lb++)
+	    ;
+	  for (ub = lb; ub < n && vec_cmpsq_all_le (sk[ub], skey); ub++)
+	    ;
+	  if (test_lower_bound_s128 (sk, n, skey) != lb
+	      || test_upper_bound_s128 (sk, n, skey) != ub)
+	    {
+	      printf ("vec_lower/upper_bound_s128 n=%lu failed\n", n);
+	      rc += 1;
+	      break;
+	    }
+	}
+    }
+
+  return (rc);
+}
+
+#define test_htab_init_u128 __VEC_PWR_IMP(vec_htab_init_u128)
+#define test_htab_insert_u128 __VEC_PWR_IMP(vec_htab_insert_u128)
+#define test_htab_find_u128 __VEC_PWR_IMP(vec_htab_find_u128)
+#define test_htab_find_batch_u128 __VEC_PWR_IMP(vec_htab_find_batch_u128)
+#define test_htab_erase_u128 __VEC_PWR_IMP(vec_htab_erase_u128)
+#define test_htab_free __VEC_PWR_IMP(vec_htab_free)
+
+#define TEST_HTABQ_MAX 1000
+static vui128_t test_htabq_keys[2 * TEST_HTABQ_MAX];
+static long test_htabq_slots[TEST_HTABQ_MAX];
+static long test_htabq_found[2 * TEST_HTABQ_MAX];
+
+int
+test_vec_htab_u128 (void)
+{
+  unsigned long long x = 0x2545f4914f6cdd1dULL;
+  unsigned long i, n = TEST_HTABQ_MAX;
+  vui128_t *tkeys;
+  vec_htab_t t;
+  long slot;
+  int rc = 0;
+
+  printf ("\ntest_vec_htab_u128 Hash table of quadwords\n");
+
+  if (test_htab_init_u128 (&t, n) != 0)
+    {
+      printf ("vec_htab_init_u128 failed\n");
+      return 1;
+    }
+  tkeys = t.keys;
+
+  /* Keys differ only in the high doubleword, the second n are never
+   * present.  */
+  for (i = 0; i < 2 * n; i++)
+    test_htabq_keys[i] = (vui128_t) CONST_VINT128_DW (
+	(test_sortq_rand (&x) << 1) | (i >= n), 0x5555);
+
+  for (i = 0; i < n; i++)
+    {
+      test_htabq_slots[i] = test_htab_insert_u128 (&t, test_htabq_keys[i]);
+      if (test_htabq_slots[i] < 0
+	  || !vec_cmpuq_all_eq (tkeys[test_htabq_slots[i]],
+				test_htabq_keys[i]))
+	{
+	  printf ("vec_htab_insert_u128 %lu failed\n", i);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  test_htab_find_batch_u128 (&t, test_htabq_found, test_htabq_keys, 2 * n);
+  for (i = 0; i < 2 * n; i++)
+    {
+      slot = (i < n) ? test_htabq_slots[i] : -1;
+      if (test_htabq_found[i] != slot
+	  || test_htab_find_u128 (&t, test_htabq_keys[i]) != slot)
+	{
+	  printf ("vec_htab_find_u128 %lu returned %ld expected %ld\n", i,
+		  test_htabq_found[i], slot);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  for (i = 0; i < n; i += 2)
+    test_htab_erase_u128 (&t, test_htabq_keys[i]);
+  for (i = 0; i < n; i++)
+    {
+      slot = (i & 1) ? test_htabq_slots[i] : -1;
+      if (test_htab_find_u128 (&t, test_htabq_keys[i]) != slot)
+	{
+	  printf ("vec_htab_find_u128 after erase %lu failed\n", i);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  test_htab_free (&t);
+  return (rc);
+}
+
+#define test_hash64q __VEC_PWR_IMP(vec_hash64)
+#define test_hash128 __VEC_PWR_IMP(vec_hash128)
+#define test_hash64_batch_u128 __VEC_PWR_IMP(vec_hash64_batch_u128)
+
+#define TEST_HASHQ_MAX 67
+static vui128_t test_hashq_keys[TEST_HASHQ_MAX];
+static unsigned long long test_hashq_out[TEST_HASHQ_MAX];
+static unsigned char test_hashq_buf[4 * TEST_HASHQ_MAX];
+
+/* Known answers for vec_hash128 (high and low doublewords) of the
+ * bytes 0, 1, 2, ... at each length, and for vec_hash64_batch_u128,
+ * with seed 0x0123456789abcdef. Computed with a separate scalar
+ * model of the algorithm.  */
+static const struct
+{
+  unsigned long len;
+  unsigned long long hi, lo;
+} test_hashq_kat[] =
+  {
+    {   0, 0x28adecd1d56ef0feULL, 0x2b4e3df129b1f482ULL },
+    {   3, 0xe148a50e8c1a257fULL, 0x8de67ed7fd6c66adULL },
+    {   8, 0xb5f1a3c9f039f14bULL, 0x1bf01b62e28a0e81ULL },
+    {   9, 0xdba36505045bbf99ULL, 0x50cc26280f301c5aULL },
+    {  16, 0x5944a017d89cd484ULL, 0x4a7b905ed45afd42ULL },
+    {  17, 0xc1398e63705ad113ULL, 0x638610d285d40f1dULL },
+    {  33, 0xaa3fbf8e26d24939ULL, 0x7a1fdad3c5e36391ULL },
+    {  64, 0x6a77e265ac2951a1ULL, 0x0eb3d045cc02f8abULL },
+    {  65, 0x38f82b0bbb943285ULL, 0x1aca47c92b7eb2a7ULL },
+    { 129, 0xce38a423f3e5ea91ULL, 0x875db9d801a89018ULL },
+    { 256, 0x1cfc0cbfd1212cc3ULL, 0x4e89eb04cbb261c2ULL },
+  };
+
+static const unsigned long long test_hashq_kat_h[3] =
+  {
+    0xa8396416f68eda29ULL,
+    0x1d10408f850202ebULL,
+    0xab5d6b905f6ab157ULL
+  };
+
+int
+test_vec_hash_u128 (void)
+{
+  unsigned long long x = 0x6a09e667f3bcc908ULL;
+  unsigned long long seed = 0x3c6ef372fe94f82bULL;
+  unsigned long long e;
+  unsigned char b[16];
+  __VEC_U_128 h, k;
+  unsigned long i, j;
+  int rc = 0;
+
+  printf ("\ntest_vec_hash_u128 Multiply-fold hash\n");
+
+  {
+    const unsigned long long s1 = 0x0123456789abcdefULL;
+    unsigned char kb[256];
+    vui128_t kq[3];
+
+    for (i = 0; i < 256; i++)
+      kb[i] = (unsigned char) i;
+    for (i = 0; i < (sizeof (test_hashq_kat) / sizeof (test_hashq_kat[0]));
+	 i++)
+      {
+	h.vx1 = test_hash128 (kb, test_hashq_kat[i].len, s1);
+	if (h.ulong.upper != test_hashq_kat[i].hi
+	    || h.ulong.lower != test_hashq_kat[i].lo)
+	  {
+	    printf ("vec_hash128 len %lu %016llx %016llx expected %016llx "
+		    "%016llx\n", test_hashq_kat[i].len,
+		    (unsigned long long) h.ulong.upper,
+		    (unsigned long long) h.ulong.lower,
+		    test_hashq_kat[i].hi, test_hashq_kat[i].lo);
+	    rc += 1;
+	  }
+      }
+
+    kq[0] = (vui128_t) CONST_VINT128_DW (0, 0);
+    kq[1] = (vui128_t) CONST_VINT128_DW (0x8000000000000000UL, 1);
+    kq[2] = (vui128_t) CONST_VINT128_DW (0x0123456789abcdefUL,
+					 0xfedcba9876543210UL);
+    test_hash64_batch_u128 (test_hashq_out, kq, 3, s1);
+    for (i = 0; i < 3; i++)
+      if (test_hashq_out[i] != test_hashq_kat_h[i])
+	{
+	  printf ("vec_hash64_batch_u128 [%lu] %016llx expected %016llx\n",
+		  i, test_hashq_out[i], test_hashq_kat_h[i]);
+	  rc += 1;
+	}
+  }
+
+  for (i = 0; i < sizeof (test_hashq_buf); i++)
+    test_hashq_buf[i] = (unsigned char) test_sortq_rand (&x);
+  for (i = 0; i < TEST_HASHQ_MAX; i++)
+    test_hashq_keys[i] = (vui128_t) CONST_VINT128_DW (
+	test_sortq_rand (&x), test_sortq_rand (&x));
+
+  /* The low doubleword of vec_hash128 is vec_hash64.  */
+  for (i = 0; i <= sizeof (test_hashq_buf); i++)
+    {
+      h.vx1 = test_hash128 (test_hashq_buf, i, seed);
+      e = test_hash64q (test_hashq_buf, i, seed);
+      if (h.ulong.lower != e || h.ulong.upper == e)
+	{
+	  printf ("vec_hash128 len %lu %016llx %016llx expected low "
+		  "%016llx\n", i, (unsigned long long) h.ulong.upper,
+		  (unsigned long long) h.ulong.lower, e);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  /* Batch results match vec_hash64 of the little endian key.  */
+  for (j = TEST_HASHQ_MAX - 1; j <= TEST_HASHQ_MAX; j++)
+    {
+      test_hash64_batch_u128 (test_hashq_out, test_hashq_keys, j, seed);
+      for (i = 0; i < j; i++)
+	{
+	  int n;
+
+	  k.vx1 = test_hashq_keys[i];
+	  for (n = 0; n < 8; n++)
+	    {
+	      b[n] = (unsigned char) (k.ulong.lower >> (8 * n));
+	      b[n + 8] = (unsigned char) (k.ulong.upper >> (8 * n));
+	    }
+	  e = test_hash64q (b, 16, seed);
+	  if (test_hashq_out[i] != e)
+	    {
+	      printf ("vec_hash64_batch_u128 n=%lu [%lu] %016llx expected "
+		      "%016llx\n", j, i, test_hashq_out[i], e);
+	      rc += 1;
+	      break;
+	    }
+	}
+    }
+
+  return (rc);
+}
+
+#define test_prefix_sum_u128 __VEC_PWR_IMP(vec_prefix_sum_u128)
+#define test_prefix_sum_u64_u128 __VEC_PWR_IMP(vec_prefix_sum_u64_u128)
+#define test_sum_u128 __VEC_PWR_IMP(vec_sum_u128)
+
+#define TEST_SCANQ_MAX 67
+static vui128_t test_scanq_in[TEST_SCANQ_MAX];
+static vui128_t test_scanq_out[TEST_SCANQ_MAX];
+static unsigned long long test_scanq_in64[TEST_SCANQ_MAX];
+
+int
+test_vec_scan_u128 (void)
+{
+  unsigned long long x = 0x452821e638d01377ULL;
+  unsigned __int128 s, h;
+  __VEC_U_128 init, r, t;
+  unsigned long i, n;
+  int rc = 0;
+
+  printf ("\ntest_vec_scan_u128 Prefix sum quadwords\n");
+
+  /* Values near the maximum so the sums carry out of the low
+   * doubleword (u64) and out of the quadword (u128).  */
+  for (i = 0; i < TEST_SCANQ_MAX; i++)
+    {
+      test_scanq_in64[i] = -1ULL - (test_sortq_rand (&x) & 0xff);
+      test_scanq_in[i] = (vui128_t) CONST_VINT128_DW (
+	  -1ULL - (test_sortq_rand (&x) & 0xff), test_sortq_rand (&x));
+    }
+  init.ulong.upper = 1;
+  init.ulong.lower = -1ULL;
+
+  for (n = 0; n <= TEST_SCANQ_MAX; n += (n < 8) ? 1 : 59)
+    {
+      r.vx1 = test_prefix_sum_u128 (test_scanq_out, test_scanq_in, n,
+				    init.vx1);
+      for (i = 0, s = init.ui128; i < n; i++)
+	{
+	  t.vx1 = test_scanq_in[i];
+	  s += t.ui128;
+	  t.vx1 = test_scanq_out[i];
+	  if (t.ui128 != s)
+	    {
+	      printf ("vec_prefix_sum_u128 n=%lu [%lu] failed\n", n, i);
+	      rc += 1;
+	      break;
+	    }
+	}
+      if (r.ui128 != s)
+	{
+	  printf ("vec_prefix_sum_u128 n=%lu sum failed\n", n);
+	  rc += 1;
+	}
+
+      r.vx1 = test_prefix_sum_u64_u128 (test_scanq_out, test_scanq_in64, n,
+					init.vx1);
+      for (i = 0, s = init.ui128; i < n; i++)
+	{
+	  s += test_scanq_in64[i];
+	  t.vx1 = test_scanq_out[i];
+	  if (t.ui128 != s)
+	    {
+	      printf ("vec_prefix_sum_u64_u128 n=%lu [%lu] failed\n", n, i);
+	      rc += 1;
+	      break;
+	    }
+	}
+      if (r.ui128 != s)
+	{
+	  printf ("vec_prefix_sum_u64_u128 n=%lu sum failed\n", n);
+	  rc += 1;
+	}
+      r.vx1 = test_prefix_sum_u64_u128 (NULL, test_scanq_in64, n, init.vx1);
+      if (r.ui128 != s)
+	{
+	  printf ("vec_prefix_sum_u64_u128 n=%lu total failed\n", n);
+	  rc += 1;
+	}
+
+      for (i = 0, s = 0, h = 0; i < n; i++)
+	{
+	  t.vx1 = test_scanq_in[i];
+	  s += t.ui128;
+	  h += (s < t.ui128);
+	}
+      r.vx1 = test_sum_u128 (&t.vx1, test_scanq_in, n);
+      if (r.ui128 != s || t.ui128 != h)
+	{
+	  printf ("vec_sum_u128 n=%lu %016llx %016llx expected high "
+		  "%016llx\n", n, (unsigned long long) t.ulong.upper,
+		  (unsigned long long) t.ulong.lower, (unsigned long long) h);
+	  rc += 1;
+	}
+    }
+
+  return (rc);
+}
+
+#define test_pcg64_init __VEC_PWR_IMP(vec_pcg64_init)
+#define test_pcg64_fill_u64 __VEC_PWR_IMP(vec_pcg64_fill_u64)
+#define test_philox4x32_fill_u32 __VEC_PWR_IMP(vec_philox4x32_fill_u32)
+
+static unsigned long long test_rngq_out64[16];
+static unsigned int test_rngq_out32[16];
+static unsigned int test_rngq_tmp32[16];
+
+int
+test_vec_rng_u128 (void)
+{
+  /* pcg64 seeded with (42, 54), stream 2 of seq 13.  */
+  static const unsigned long long pcg_kat[3] = {
+      0x86b1da1d72062b68ULL, 0x1304aa46c9853d39ULL, 0xa3670e9e0dd50358ULL };
+  /* Random123 kat_vectors for philox4x32 10 rounds.  */
+  static const unsigned int philox_kat[3][10] = {
+      { 0, 0, 0, 0, 0, 0,
+	0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8 },
+      { 0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff,
+	0xffffffff, 0xffffffff,
+	0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd },
+      { 0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344,
+	0xa4093822, 0x299f31d0,
+	0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1 } };
+  vec_pcg64_t g;
+  __VEC_U_128 ctr, next;
+  unsigned long long key;
+  unsigned long i;
+  int k, rc = 0;
+
+  printf ("\ntest_vec_rng_u128 PCG64 and Philox4x32\n");
+
+  test_pcg64_init (&g, (vui128_t) CONST_VINT128_DW (0, 42),
+		   (vui128_t) CONST_VINT128_DW (0, 13));
+  test_pcg64_fill_u64 (&g, test_rngq_out64, 12);
+  for (i = 0; i < 3; i++)
+    if (test_rngq_out64[4 * i + 2] != pcg_kat[i])
+      {
+	printf ("vec_pcg64_fill_u64 [%lu] %016llx expected %016llx\n",
+		4 * i + 2, test_rngq_out64[4 * i + 2], pcg_kat[i]);
+	rc += 1;
+      }
+  /* A partial fill steps all streams.  */
+  test_pcg64_init (&g, (vui128_t) CONST_VINT128_DW (0, 42),
+		   (vui128_t) CONST_VINT128_DW (0, 13));
+  test_pcg64_fill_u64 (&g, test_rngq_out64, 3);
+  test_pcg64_fill_u64 (&g, test_rngq_out64, 7);
+  if (test_rngq_out64[2] != pcg_kat[1] || test_rngq_out64[6] != pcg_kat[2])
+    {
+      printf ("vec_pcg64_fill_u64 partial fill failed\n");
+      rc += 1;
+    }
+
+  for (k = 0; k < 3; k++)
+    {
+      ctr.ulong.lower = ((unsigned long long) philox_kat[k][1] << 32)
+	  | philox_kat[k][0];
+      ctr.ulong.upper = ((unsigned long long) philox_kat[k][3] << 32)
+	  | philox_kat[k][2];
+      key = ((unsigned long long) philox_kat[k][5] << 32) | philox_kat[k][4];
+      test_philox4x32_fill_u32 (test_rngq_out32, 4, ctr.vx1, key);
+      for (i = 0; i < 4; i++)
+	if (test_rngq_out32[i] != philox_kat[k][6 + i])
+	  {
+	    printf ("vec_philox4x32_fill_u32 kat %d [%lu] %08x expected "
+		    "%08x\n", k, i, test_rngq_out32[i], philox_kat[k][6 + i]);
+	    rc += 1;
+	  }
+    }
+
+  /* Continue from the returned counter, across a carry out of the
+   * low counter word.  */
+  ctr.ulong.upper = 0x0123456789abcdefULL;
+  ctr.ulong.lower = 0x00000001fffffffeULL;
+  key = 0x299f31d0a4093822ULL;
+  test_philox4x32_fill_u32 (test_rngq_out32, 16, ctr.vx1, key);
+  next.vx1 = test_philox4x32_fill_u32 (test_rngq_tmp32, 7, ctr.vx1, key);
+  if (next.ulong.lower != 0x0000000200000000ULL
+      || next.ulong.upper != ctr.ulong.upper)
+    {
+      printf ("vec_philox4x32_fill_u32 next counter failed\n");
+      rc += 1;
+    }
+  test_philox4x32_fill_u32 (&test_rngq_tmp32[8], 8, next.vx1, key);
+  for (i = 0; i < 16; i++)
+    if (i != 7 && test_rngq_tmp32[i] != test_rngq_out32[i])
+      {
+	printf ("vec_philox4x32_fill_u32 continue [%lu] %08x expected "
+		"%08x\n", i, test_rngq_tmp32[i], test_rngq_out32[i]);
+	rc += 1;
+	break;
+      }
+
+  return (rc);
+}
+
 int
 test_vec_i128 (void)
 {
@@ -13999,6 +14567,11 @@ test_vec_i128 (void)
   rc += test_vec_divext_QW ();
   rc += test_vec_div_QW ();
 #endif
+  rc += test_vec_sort_u128 ();
+  rc += test_vec_htab_u128 ();
+  rc += test_vec_hash_u128 ();
+  rc += test_vec_scan_u128 ();
+  rc += test_vec_rng_u128 ();
   return (rc);
 }
 
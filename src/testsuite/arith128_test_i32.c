@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 //#define __DEBUG_PRINT__
 #include <testsuite/arith128_print.h>
@@ -2598,6 +2599,811 @@ test_setbw (void)
   return (rc);
 }
 
+extern unsigned long
+__VEC_PWR_IMP (vec_difference_u32) (unsigned int *out,
+	const unsigned int *a, unsigned long na,
+	const unsigned int *b, unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_intersect_u32) (unsigned int *out,
+	const unsigned int *a, unsigned long na,
+	const unsigned int *b, unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_union_u32) (unsigned int *out,
+	const unsigned int *a, unsigned long na,
+	const unsigned int *b, unsigned long nb);
+#define test_difference_u32 __VEC_PWR_IMP(vec_difference_u32)
+#define test_intersect_u32 __VEC_PWR_IMP(vec_intersect_u32)
+#define test_union_u32 __VEC_PWR_IMP(vec_union_u32)
+
+#define TEST_SET_MAX32 2000
+static unsigned int test_set_u32_a[TEST_SET_MAX32];
+static unsigned int test_set_u32_b[TEST_SET_MAX32];
+static unsigned int test_set_u32_out[2 * TEST_SET_MAX32];
+static unsigned int test_set_u32_ref[2 * TEST_SET_MAX32];
+
+/* Fill s with n strictly increasing elements, with gaps of 1 to
+ * gap.  */
+static void
+test_set_fill_u32 (unsigned int *s, unsigned long n, unsigned int gap,
+		   unsigned long long *x)
+{
+  unsigned int v = 0;
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    {
+      *x ^= *x << 13;
+      *x ^= *x >> 7;
+      *x ^= *x << 17;
+      v += 1 + (*x % gap);
+      s[i] = v;
+    }
+}
+
+/* Scalar reference: op 0 difference, 1 intersect, 2 union.  */
+static unsigned long
+test_set_ref_u32 (unsigned int *out, const unsigned int *a, unsigned long na,
+		  const unsigned int *b, unsigned long nb, int op)
+{
+  unsigned long i = 0, j = 0, o = 0;
+
+  while (i < na || j < nb)
+    {
+      int ina = (i < na) && (j >= nb || a[i] <= b[j]);
+      int inb = (j < nb) && (i >= na || b[j] <= a[i]);
+      unsigned int v = ina ? a[i] : b[j];
+
+      if ((op == 0 && ina && !inb) || (op == 1 && ina && inb) || op == 2)
+	out[o++] = v;
+      i += ina;
+      j += inb;
+    }
+  return o;
+}
+
+int
+test_vec_set_u32 (void)
+{
+  /* Pairs of set sizes, including sizes skewed enough for galloping
+   * search.  */
+  static const unsigned long sizes[][2] =
+    { { 0, 0 }, { 0, 5 }, { 7, 0 }, { 1, 1 }, { 3, 5 }, { 17, 16 },
+      { 100, 97 }, { 1000, 1000 }, { 1999, 1003 }, { 10, 1900 },
+      { 1900, 10 }, { 1, TEST_SET_MAX32 } };
+  static const char *names[] =
+    { "vec_difference_u32", "vec_intersect_u32", "vec_union_u32" };
+  unsigned long long x = 0x9e3779b97f4a7c15ULL;
+  unsigned long t, n, m, na, nb;
+  unsigned int gap;
+  int op, rc = 0;
+
+  printf ("\ntest_vec_set_u32 Sorted set operations\n");
+
+  for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+    for (gap = 2; gap <= 8; gap *= 2)
+      {
+	na = sizes[t][0];
+	nb = sizes[t][1];
+	test_set_fill_u32 (test_set_u32_a, na, gap, &x);
+	test_set_fill_u32 (test_set_u32_b, nb, gap, &x);
+	for (op = 0; op < 3; op++)
+	  {
+	    if (op == 0)
+	      n = test_difference_u32 (test_set_u32_out, test_set_u32_a, na,
+				       test_set_u32_b, nb);
+	    else if (op == 1)
+	      n = test_intersect_u32 (test_set_u32_out, test_set_u32_a, na,
+				      test_set_u32_b, nb);
+	    else
+	      n = test_union_u32 (test_set_u32_out, test_set_u32_a, na,
+				  test_set_u32_b, nb);
+	    m = test_set_ref_u32 (test_set_u32_ref, test_set_u32_a, na,
+				  test_set_u32_b, nb, op);
+	    if (n != m
+		|| memcmp (test_set_u32_out, test_set_u32_ref,
+			   m * sizeof (unsigned int)) != 0)
+	      {
+		printf ("%s na=%lu nb=%lu gap=%u returned %lu expected %lu\n",
+			names[op], na, nb, gap, n, m);
+		rc += 1;
+	      }
+	  }
+      }
+
+  return (rc);
+}
+
+#define test_bitpack_u32 __VEC_PWR_IMP(vec_bitpack_u32)
+#define test_bitunpack_u32 __VEC_PWR_IMP(vec_bitunpack_u32)
+#define test_bitpack_for_u32 __VEC_PWR_IMP(vec_bitpack_for_u32)
+#define test_bitunpack_for_u32 __VEC_PWR_IMP(vec_bitunpack_for_u32)
+#define test_bitpack_delta_u32 __VEC_PWR_IMP(vec_bitpack_delta_u32)
+#define test_bitunpack_delta_u32 __VEC_PWR_IMP(vec_bitunpack_delta_u32)
+
+#define TEST_BITPACK_MAX32 (3 * 128 + 37)
+static unsigned int test_bitpack_in32[TEST_BITPACK_MAX32];
+static unsigned int test_bitpack_pk32[TEST_BITPACK_MAX32];
+static unsigned int test_bitpack_out32[TEST_BITPACK_MAX32];
+
+static unsigned int
+test_bitpack_rand32 (unsigned long long *x, unsigned int bits)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 7;
+  *x ^= *x << 17;
+  return (bits < 32) ? (unsigned int) *x & ((1U << bits) - 1)
+		     : (unsigned int) *x;
+}
+
+int
+test_vec_bitpack_u32 (void)
+{
+  static const unsigned long sizes[] = { 0, 5, 128, 129, 256,
+					 TEST_BITPACK_MAX32 };
+  unsigned long long x = 0x243f6a8885a308d3ULL;
+  const unsigned int base = 1000000;
+  unsigned long i, t, n, w;
+  unsigned int bits;
+  int rc = 0;
+
+  printf ("\ntest_vec_bitpack_u32 Bit packing of words\n");
+
+  for (bits = 0; bits <= 32; bits++)
+    for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+      {
+	n = sizes[t];
+	for (i = 0; i < n; i++)
+	  test_bitpack_in32[i] = test_bitpack_rand32 (&x, bits);
+	w = test_bitpack_u32 (test_bitpack_pk32, test_bitpack_in32, n, bits);
+	test_bitunpack_u32 (test_bitpack_out32, test_bitpack_pk32, n, bits);
+	if (w != vec_bitpack_words_u32 (n, bits)
+	    || memcmp (test_bitpack_out32, test_bitpack_in32,
+		       n * sizeof (unsigned int)) != 0)
+	  {
+	    printf ("vec_bitpack_u32 bits=%u n=%lu failed\n", bits, n);
+	    rc += 1;
+	  }
+
+	for (i = 0; i < n; i++)
+	  test_bitpack_in32[i] = base + test_bitpack_rand32 (&x, bits);
+	test_bitpack_for_u32 (test_bitpack_pk32, test_bitpack_in32, n, base,
+			      bits);
+	test_bitunpack_for_u32 (test_bitpack_out32, test_bitpack_pk32, n,
+				base, bits);
+	if (memcmp (test_bitpack_out32, test_bitpack_in32,
+		    n * sizeof (unsigned int)) != 0)
+	  {
+	    printf ("vec_bitpack_for_u32 bits=%u n=%lu failed\n", bits, n);
+	    rc += 1;
+	  }
+
+	/* Each lane increasing by at most bits bits.  */
+	for (i = 0; i < n; i++)
+	  test_bitpack_in32[i] = ((i < 4) ? base : test_bitpack_in32[i - 4])
+				 + test_bitpack_rand32 (&x, bits);
+	test_bitpack_delta_u32 (test_bitpack_pk32, test_bitpack_in32, n,
+				base, bits);
+	test_bitunpack_delta_u32 (test_bitpack_out32, test_bitpack_pk32, n,
+				  base, bits);
+	if (memcmp (test_bitpack_out32, test_bitpack_in32,
+		    n * sizeof (unsigned int)) != 0)
+	  {
+	    printf ("vec_bitpack_delta_u32 bits=%u n=%lu failed\n", bits, n);
+	    rc += 1;
+	  }
+      }
+
+  return (rc);
+}
+
+#define test_svb_encode_u32 __VEC_PWR_IMP(vec_svb_encode_u32)
+#define test_svb_decode_u32 __VEC_PWR_IMP(vec_svb_decode_u32)
+#define test_leb128_encode_u32 __VEC_PWR_IMP(vec_leb128_encode_u32)
+#define test_leb128_decode_u32 __VEC_PWR_IMP(vec_leb128_decode_u32)
+
+#define TEST_VARINT_MAX32 203
+static unsigned int test_varint_in32[TEST_VARINT_MAX32];
+static unsigned int test_varint_out32[TEST_VARINT_MAX32];
+static unsigned char test_varint_buf32[5 * TEST_VARINT_MAX32];
+static unsigned char test_varint_ref32[5 * TEST_VARINT_MAX32];
+
+int
+test_vec_varint_u32 (void)
+{
+  static const unsigned long sizes[] = { 0, 1, 3, 4, 15, 16, 17, 33,
+					 TEST_VARINT_MAX32 };
+  unsigned long long x = 0x13198a2e03707344ULL;
+  unsigned long i, t, n, w, m;
+  long r;
+  int mix, rc = 0;
+
+  printf ("\ntest_vec_varint_u32 Stream-VByte and LEB128 words\n");
+
+  /* mix 0 all single byte values, 1 random lengths.  */
+  for (mix = 0; mix < 2; mix++)
+    for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+      {
+	n = sizes[t];
+	for (i = 0; i < n; i++)
+	  {
+	    x ^= x << 13;
+	    x ^= x >> 7;
+	    x ^= x << 17;
+	    test_varint_in32[i] = mix ? (unsigned int) x >> (x % 32)
+				      : (unsigned int) x & 0x7f;
+	  }
+
+	/* Stream-VByte: the size is the control bytes plus the byte
+	 * length of each value.  */
+	m = (n + 3) / 4;
+	for (i = 0; i < n; i++)
+	  m += 1 + (test_varint_in32[i] > 0xff)
+	       + (test_varint_in32[i] > 0xffff)
+	       + (test_varint_in32[i] > 0xffffff);
+	w = test_svb_encode_u32 (test_varint_buf32, test_varint_in32, n);
+	if (w != m
+	    || test_svb_decode_u32 (test_varint_out32, test_varint_buf32, n)
+	       != m
+	    || memcmp (test_varint_out32, test_varint_in32,
+		       n * sizeof (unsigned int)) != 0)
+	  {
+	    printf ("vec_svb_u32 n=%lu returned %lu expected %lu\n", n, w, m);
+	    rc += 1;
+	  }
+
+	/* LEB128 against a byte at a time encoder.  */
+	m = 0;
+	for (i = 0; i < n; i++)
+	  {
+	    unsigned int v = test_varint_in32[i];
+
+	    while (v > 0x7f)
+	      {
+		test_varint_ref32[m++] = (v & 0x7f) | 0x80;
+		v >>= 7;
+	      }
+	    test_varint_ref32[m++] = v;
+	  }
+	w = test_leb128_encode_u32 (test_varint_buf32, test_varint_in32, n);
+	r = test_leb128_decode_u32 (test_varint_out32, test_varint_ref32, m,
+				    n);
+	if (w != m || memcmp (test_varint_buf32, test_varint_ref32, m) != 0
+	    || r != (long) m
+	    || memcmp (test_varint_out32, test_varint_in32,
+		       n * sizeof (unsigned int)) != 0)
+	  {
+	    printf ("vec_leb128_u32 n=%lu returned %lu/%ld expected %lu\n", n,
+		    w, r, m);
+	    rc += 1;
+	  }
+	if (n > 0
+	    && test_leb128_decode_u32 (test_varint_out32, test_varint_ref32,
+				       m - 1, n) != -1)
+	  {
+	    printf ("vec_leb128_decode_u32 n=%lu truncated input\n", n);
+	    rc += 1;
+	  }
+      }
+
+  return (rc);
+}
+
+#define test_prefix_sum_u32 __VEC_PWR_IMP(vec_prefix_sum_u32)
+#define test_prefix_sum_excl_u32 __VEC_PWR_IMP(vec_prefix_sum_excl_u32)
+
+#define TEST_SCAN_MAX32 203
+static unsigned int test_scan_in32[TEST_SCAN_MAX32];
+static unsigned int test_scan_out32[TEST_SCAN_MAX32];
+
+int
+test_vec_scan_u32 (void)
+{
+  unsigned long long x = 0xa4093822299f31d0ULL;
+  unsigned int init = 0xfffffff0, s, r;
+  unsigned long i, n;
+  int rc = 0;
+
+  printf ("\ntest_vec_scan_u32 Prefix sum words\n");
+
+  for (i = 0; i < TEST_SCAN_MAX32; i++)
+    {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      test_scan_in32[i] = (unsigned int) (x >> 16);
+    }
+
+  for (n = 0; n <= TEST_SCAN_MAX32; n += (n < 20) ? 1 : 61)
+    {
+      r = test_prefix_sum_u32 (test_scan_out32, test_scan_in32, n, init);
+      for (i = 0, s = init; i < n; i++)
+	{
+	  s += test_scan_in32[i];
+	  if (test_scan_out32[i] != s)
+	    {
+	      printf ("vec_prefix_sum_u32 n=%lu [%lu] %08x expected %08x\n",
+		      n, i, test_scan_out32[i], s);
+	      rc += 1;
+	      break;
+	    }
+	}
+      if (r != s)
+	{
+	  printf ("vec_prefix_sum_u32 n=%lu sum %08x expected %08x\n",
+		  n, r, s);
+	  rc += 1;
+	}
+
+      /* In place, out == in.  */
+      memcpy (test_scan_out32, test_scan_in32, n * sizeof (unsigned int));
+      r = test_prefix_sum_excl_u32 (test_scan_out32, test_scan_out32, n,
+				    init);
+      for (i = 0, s = init; i < n; i++)
+	{
+	  if (test_scan_out32[i] != s)
+	    {
+	      printf ("vec_prefix_sum_excl_u32 n=%lu [%lu] %08x expected "
+		      "%08x\n", n, i, test_scan_out32[i], s);
+	      rc += 1;
+	      break;
+	    }
+	  s += test_scan_in32[i];
+	}
+      if (r != s)
+	{
+	  printf ("vec_prefix_sum_excl_u32 n=%lu sum %08x expected %08x\n",
+		  n, r, s);
+	  rc += 1;
+	}
+    }
+
+  return (rc);
+}
+
+#define test_q15_fir __VEC_PWR_IMP(vec_q15_fir)
+#define test_q15_dot __VEC_PWR_IMP(vec_q15_dot)
+#define test_q15_biquad __VEC_PWR_IMP(vec_q15_biquad)
+#define test_q15_cmul __VEC_PWR_IMP(vec_q15_cmul)
+#define test_q31_fir __VEC_PWR_IMP(vec_q31_fir)
+#define test_q31_dot __VEC_PWR_IMP(vec_q31_dot)
+#define test_q31_cmul __VEC_PWR_IMP(vec_q31_cmul)
+
+#define TEST_DSP_MAX 200
+#define TEST_DSP_TAPS 12
+
+static short test_dsp_in16[TEST_DSP_MAX + TEST_DSP_TAPS];
+static short test_dsp_out16[TEST_DSP_MAX];
+static short test_dsp_ref16[TEST_DSP_MAX];
+static int test_dsp_in32[TEST_DSP_MAX + TEST_DSP_TAPS];
+static int test_dsp_out32[TEST_DSP_MAX];
+
+/* Reference shift right by s with rounding, from the remainder of
+ * the floor division.  */
+static long long
+test_dsp_rnd (long long x, int s, int rnd)
+{
+  long long q = x >> s;
+  long long r2 = (x - (q << s)) * 2;
+  long long d = 1LL << s;
+
+  if ((rnd == VEC_Q_RND_NEAREST && r2 >= d)
+      || (rnd == VEC_Q_RND_EVEN && (r2 > d || (r2 == d && (q & 1)))))
+    q++;
+  return q;
+}
+
+static long long
+test_dsp_sat (long long x, long long lim)
+{
+  if (x >= lim)
+    return lim - 1;
+  if (x < -lim)
+    return -lim;
+  return x;
+}
+
+static void
+test_dsp_fill (int full)
+{
+  unsigned long long x = 0x2545f4914f6cdd1dULL + full;
+  unsigned long i;
+
+  for (i = 0; i < TEST_DSP_MAX + TEST_DSP_TAPS; i++)
+    {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      if (full)
+	{
+	  /* Full scale, to exercise the saturation.  */
+	  test_dsp_in16[i] = (x & 1) ? -32768 : 32767;
+	  test_dsp_in32[i] = (x & 1) ? (int) 0x80000000 : 0x7fffffff;
+	}
+      else
+	{
+	  test_dsp_in16[i] = (short) (x >> 24);
+	  test_dsp_in32[i] = (int) (x >> 16);
+	}
+    }
+}
+
+/* Sample at a time reference for a biquad cascade with shift 1,
+ * in place over y.  */
+static void
+test_dsp_biquad_ref (short *y, unsigned long n, const short *bq,
+		     unsigned long stages)
+{
+  unsigned long i, k;
+
+  for (k = 0; k < stages; k++)
+    {
+      const short *b = &bq[5 * k];
+      long long x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+      for (i = 0; i < n; i++)
+	{
+	  long long x0 = y[i];
+	  long long acc = b[0] * x0 + b[1] * x1 + b[2] * x2
+	      + b[3] * y1 + b[4] * y2;
+
+	  x2 = x1;
+	  x1 = x0;
+	  y2 = y1;
+	  y1 = test_dsp_sat (test_dsp_rnd (acc, 14, VEC_Q_RND_EVEN),
+			     32768);
+	  y[i] = y1;
+	}
+    }
+}
+
+int
+test_vec_dsp_q15 (void)
+{
+  const short half[] = { 16384, 16384, 16384, 16384 };
+  const short one[] = { 1, 3, 1, 3 };
+  short coef[TEST_DSP_TAPS], bq[10], state[8], r;
+  unsigned long i, k, n, ntaps;
+  int full, rnd, rc = 0;
+
+  printf ("\ntest_vec_dsp_q15 Q15 FIR, dot, biquad and cmul\n");
+
+  /* 0.5 * 2^-15 and 1.5 * 2^-15 in each rounding mode.  */
+  r = test_q15_dot (half, one, 1, VEC_Q_RND_TRUNC);
+  r += 10 * test_q15_dot (half, one, 1, VEC_Q_RND_NEAREST);
+  r += 100 * test_q15_dot (half, one, 1, VEC_Q_RND_EVEN);
+  r += 1000 * test_q15_dot (&half[1], &one[1], 1, VEC_Q_RND_EVEN);
+  if (r != 2010)
+    {
+      printf ("vec_q15_dot rounding %d expected 2010\n", r);
+      rc += 1;
+    }
+
+  for (full = 0; full < 2; full++)
+    {
+      test_dsp_fill (full);
+      for (rnd = VEC_Q_RND_TRUNC; rnd <= VEC_Q_RND_EVEN; rnd++)
+	for (n = 0; n <= TEST_DSP_MAX; n += (n < 20) ? 1 : 30)
+	  {
+	    long long acc;
+
+	    ntaps = 1 + n % TEST_DSP_TAPS;
+	    for (k = 0; k < ntaps; k++)
+	      coef[k] = full ? -32768 : test_dsp_in16[k + 5] / (int) ntaps;
+	    test_q15_fir (test_dsp_out16, test_dsp_in16, n, coef, ntaps,
+			  rnd);
+	    for (i = 0; i < n; i++)
+	      {
+		for (k = 0, acc = 0; k < ntaps; k++)
+		  acc += coef[k] * test_dsp_in16[i + ntaps - 1 - k];
+		acc = test_dsp_sat (test_dsp_rnd (acc, 15, rnd), 32768);
+		if (test_dsp_out16[i] != acc)
+		  {
+		    printf ("vec_q15_fir n=%lu taps=%lu rnd=%d [%lu] %d "
+			    "expected %lld\n", n, ntaps, rnd, i,
+			    test_dsp_out16[i], acc);
+		    rc += 1;
+		    break;
+		  }
+	      }
+
+	    for (i = 0, acc = 0; i < n; i++)
+	      acc += test_dsp_in16[i] * test_dsp_in16[i + 1];
+	    acc = test_dsp_sat (test_dsp_rnd (acc, 15, rnd), 32768);
+	    r = test_q15_dot (test_dsp_in16, &test_dsp_in16[1], n, rnd);
+	    if (r != acc)
+	      {
+		printf ("vec_q15_dot n=%lu rnd=%d %d expected %lld\n", n,
+			rnd, r, acc);
+		rc += 1;
+	      }
+
+	    test_q15_cmul (test_dsp_out16, test_dsp_in16,
+			   &test_dsp_in16[3], n / 2, rnd);
+	    for (i = 0; i < n / 2; i++)
+	      {
+		long long ar = test_dsp_in16[2 * i];
+		long long ai = test_dsp_in16[2 * i + 1];
+		long long br = test_dsp_in16[2 * i + 3];
+		long long bi = test_dsp_in16[2 * i + 4];
+		long long re, im;
+
+		re = test_dsp_sat (test_dsp_rnd (ar * br - ai * bi, 15, rnd),
+				   32768);
+		im = test_dsp_sat (test_dsp_rnd (ar * bi + ai * br, 15, rnd),
+				   32768);
+		if (test_dsp_out16[2 * i] != re
+		    || test_dsp_out16[2 * i + 1] != im)
+		  {
+		    printf ("vec_q15_cmul n=%lu rnd=%d [%lu] %d,%d "
+			    "expected %lld,%lld\n", n / 2, rnd, i,
+			    test_dsp_out16[2 * i], test_dsp_out16[2 * i + 1],
+			    re, im);
+		    rc += 1;
+		    break;
+		  }
+	      }
+	  }
+    }
+
+  /* Two section biquad cascade with shift 1, in two blocks and in
+   * place, against a sample at a time reference.  */
+  test_dsp_fill (0);
+  for (k = 0; k < 10; k++)
+    bq[k] = test_dsp_in16[k + 40] / 4;
+  memset (state, 0, sizeof (state));
+  memcpy (test_dsp_out16, test_dsp_in16, sizeof (test_dsp_out16));
+  test_q15_biquad (test_dsp_out16, test_dsp_out16, 77, bq, state, 2, 1,
+		   VEC_Q_RND_EVEN);
+  test_q15_biquad (&test_dsp_out16[77], &test_dsp_out16[77],
+		   TEST_DSP_MAX - 77, bq, state, 2, 1, VEC_Q_RND_EVEN);
+  memcpy (test_dsp_ref16, test_dsp_in16, sizeof (test_dsp_ref16));
+  test_dsp_biquad_ref (test_dsp_ref16, TEST_DSP_MAX, bq, 2);
+  for (i = 0; i < TEST_DSP_MAX; i++)
+    if (test_dsp_out16[i] != test_dsp_ref16[i])
+      {
+	printf ("vec_q15_biquad [%lu] %d expected %d\n", i,
+		test_dsp_out16[i], test_dsp_ref16[i]);
+	rc += 1;
+	break;
+      }
+
+  /* A gain 6 low pass {2, 2, 2} in Q14 at full scale DC, where the
+   * feed-forward sum exceeds a 32-bit word and must saturate.  */
+  bq[0] = bq[1] = bq[2] = 32767;
+  bq[3] = bq[4] = 0;
+  memset (state, 0, sizeof (state));
+  for (i = 0; i < TEST_DSP_MAX; i++)
+    test_dsp_out16[i] = (i < 50) ? -32768 : 32767;
+  memcpy (test_dsp_ref16, test_dsp_out16, sizeof (test_dsp_ref16));
+  test_q15_biquad (test_dsp_out16, test_dsp_out16, TEST_DSP_MAX, bq, state,
+		   1, 1, VEC_Q_RND_EVEN);
+  test_dsp_biquad_ref (test_dsp_ref16, TEST_DSP_MAX, bq, 1);
+  for (i = 0; i < TEST_DSP_MAX; i++)
+    if (test_dsp_out16[i] != test_dsp_ref16[i])
+      {
+	printf ("vec_q15_biquad full scale [%lu] %d expected %d\n", i,
+		test_dsp_out16[i], test_dsp_ref16[i]);
+	rc += 1;
+	break;
+      }
+
+  return (rc);
+}
+
+int
+test_vec_dsp_q31 (void)
+{
+  int coef[TEST_DSP_TAPS], r;
+  unsigned long i, k, n, ntaps;
+  int full, rnd, rc = 0;
+
+  printf ("\ntest_vec_dsp_q31 Q31 FIR, dot and cmul\n");
+
+  for (full = 0; full < 2; full++)
+    {
+      test_dsp_fill (full);
+      for (rnd = VEC_Q_RND_TRUNC; rnd <= VEC_Q_RND_EVEN; rnd++)
+	for (n = 0; n <= TEST_DSP_MAX; n += (n < 20) ? 1 : 30)
+	  {
+	    long long acc;
+
+	    ntaps = 1 + n % TEST_DSP_TAPS;
+	    for (k = 0; k < ntaps; k++)
+	      coef[k] = full ? (int) 0x80000000
+			     : test_dsp_in32[k + 5] / (int) ntaps;
+	    test_q31_fir (test_dsp_out32, test_dsp_in32, n, coef, ntaps,
+			  rnd);
+	    for (i = 0; i < n; i++)
+	      {
+		for (k = 0, acc = 0; k < ntaps; k++)
+		  acc += ((long long) coef[k]
+			  * test_dsp_in32[i + ntaps - 1 - k]) >> 14;
+		acc = test_dsp_sat (test_dsp_rnd (acc, 17, rnd),
+				    0x80000000LL);
+		if (test_dsp_out32[i] != acc)
+		  {
+		    printf ("vec_q31_fir n=%lu taps=%lu rnd=%d [%lu] %d "
+			    "expected %lld\n", n, ntaps, rnd, i,
+			    test_dsp_out32[i], acc);
+		    rc += 1;
+		    break;
+		  }
+	      }
+
+	    for (i = 0, acc = 0; i < n; i++)
+	      acc += ((long long) test_dsp_in32[i] * test_dsp_in32[i + 1])
+		  >> 14;
+	    acc = test_dsp_sat (test_dsp_rnd (acc, 17, rnd), 0x80000000LL);
+	    r = test_q31_dot (test_dsp_in32, &test_dsp_in32[1], n, rnd);
+	    if (r != acc)
+	      {
+		printf ("vec_q31_dot n=%lu rnd=%d %d expected %lld\n", n,
+			rnd, r, acc);
+		rc += 1;
+	      }
+
+	    test_q31_cmul (test_dsp_out32, test_dsp_in32,
+			   &test_dsp_in32[3], n / 2, rnd);
+	    for (i = 0; i < n / 2; i++)
+	      {
+		__int128 ar = test_dsp_in32[2 * i];
+		__int128 ai = test_dsp_in32[2 * i + 1];
+		__int128 br = test_dsp_in32[2 * i + 3];
+		__int128 bi = test_dsp_in32[2 * i + 4];
+		__int128 im = ar * bi + ai * br;
+		long long re;
+
+		/* The only Q62 sum beyond a doubleword is 2^63, which
+		 * saturates anyway.  */
+		if (im > 0x7fffffffffffffffLL)
+		  im = 0x7fffffffffffffffLL;
+		re = test_dsp_sat (test_dsp_rnd ((long long) (ar * br - ai * bi),
+						 31, rnd), 0x80000000LL);
+		im = test_dsp_sat (test_dsp_rnd ((long long) im, 31, rnd),
+				   0x80000000LL);
+		if (test_dsp_out32[2 * i] != re
+		    || test_dsp_out32[2 * i + 1] != im)
+		  {
+		    printf ("vec_q31_cmul n=%lu rnd=%d [%lu] %d,%d "
+			    "expected %lld,%lld\n", n / 2, rnd, i,
+			    test_dsp_out32[2 * i], test_dsp_out32[2 * i + 1],
+			    re, (long long) im);
+		    rc += 1;
+		    break;
+		  }
+	      }
+	  }
+    }
+
+  return (rc);
+}
+
+#define test_dot_s8 __VEC_PWR_IMP(vec_dot_s8)
+#define test_dot_s16 __VEC_PWR_IMP(vec_dot_s16)
+#define test_dot_s16_s64 __VEC_PWR_IMP(vec_dot_s16_s64)
+#define test_gemm_pack_a_s8 __VEC_PWR_IMP(vec_gemm_pack_a_s8)
+#define test_gemm_pack_b_s8 __VEC_PWR_IMP(vec_gemm_pack_b_s8)
+#define test_gemm_s8 __VEC_PWR_IMP(vec_gemm_s8)
+#define test_gemm_pack_a_s16 __VEC_PWR_IMP(vec_gemm_pack_a_s16)
+#define test_gemm_pack_b_s16 __VEC_PWR_IMP(vec_gemm_pack_b_s16)
+#define test_gemm_s16 __VEC_PWR_IMP(vec_gemm_s16)
+
+/* Largest m, n and k tested, not multiples of the panel sizes.  */
+#define TEST_GEMM_MAX 21
+#define TEST_DOT_MAX 512
+
+static short test_gemm_a[TEST_DOT_MAX];
+static short test_gemm_b[TEST_DOT_MAX];
+static signed char test_gemm_a8[TEST_DOT_MAX];
+static signed char test_gemm_b8[TEST_DOT_MAX];
+static short test_gemm_pa[3 * VEC_GEMM_MR * 22];
+static short test_gemm_pb[3 * VEC_GEMM_NR * 22];
+static signed char test_gemm_pa8[3 * (VEC_GEMM_MR * 24 + 32)];
+static unsigned char test_gemm_pb8[3 * VEC_GEMM_NR * 24];
+static int test_gemm_c[TEST_GEMM_MAX * TEST_GEMM_MAX];
+
+int
+test_vec_gemm (void)
+{
+  unsigned long long x = 0x6a09e667f3bcc908ULL;
+  unsigned long i, j, l, m, n, k;
+  long long ref;
+  int full, rc = 0;
+
+  printf ("\ntest_vec_gemm int8/int16 dot product and GEMM\n");
+
+  for (full = 0; full < 2; full++)
+    {
+      for (i = 0; i < TEST_DOT_MAX; i++)
+	{
+	  x ^= x << 13;
+	  x ^= x >> 7;
+	  x ^= x << 17;
+	  /* The extremes (-128 * -128, -32768 * -32768) are the edge
+	   * cases of the +128 bias and of the int16 pair sums.  */
+	  test_gemm_a[i] = full ? -32768 : (short) (x >> 8);
+	  test_gemm_b[i] = full ? -32768 : (short) (x >> 32);
+	  test_gemm_a8[i] = full ? -128 : (signed char) (x >> 24);
+	  test_gemm_b8[i] = full ? -128 : (signed char) (x >> 40);
+	}
+
+      for (n = 0; n <= TEST_DOT_MAX; n += (n < 40) ? 1 : 37)
+	{
+	  unsigned int s8 = 0, s16 = 0;
+	  long long s64 = 0;
+
+	  for (i = 0; i < n; i++)
+	    {
+	      s8 += test_gemm_a8[i] * test_gemm_b8[i];
+	      s16 += test_gemm_a[i] * test_gemm_b[i];
+	      s64 += test_gemm_a[i] * test_gemm_b[i];
+	    }
+	  if (test_dot_s8 (test_gemm_a8, test_gemm_b8, n) != (int) s8
+	      || test_dot_s16 (test_gemm_a, test_gemm_b, n) != (int) s16
+	      || test_dot_s16_s64 (test_gemm_a, test_gemm_b, n) != s64)
+	    {
+	      printf ("vec_dot_s8/s16/s16_s64 n=%lu full=%d %d %d %lld "
+		      "expected %d %d %lld\n", n, full,
+		      test_dot_s8 (test_gemm_a8, test_gemm_b8, n),
+		      test_dot_s16 (test_gemm_a, test_gemm_b, n),
+		      test_dot_s16_s64 (test_gemm_a, test_gemm_b, n),
+		      (int) s8, (int) s16, s64);
+	      rc += 1;
+	    }
+	}
+
+      /* A is m x k with stride 23, B is k x n with stride 21.  */
+      for (m = 1; m <= TEST_GEMM_MAX; m += 4)
+	for (n = 1; n <= TEST_GEMM_MAX; n += 5)
+	  for (k = 1; k <= TEST_GEMM_MAX; k += 3)
+	    {
+	      int err8 = 0, err16 = 0;
+
+	      test_gemm_pack_a_s8 (test_gemm_pa8, test_gemm_a8, 23, m, k);
+	      test_gemm_pack_b_s8 (test_gemm_pb8, test_gemm_b8, 21, k, n);
+	      for (i = 0; i < m * TEST_GEMM_MAX; i++)
+		test_gemm_c[i] = 1;
+	      /* C = 1 + A * B.  */
+	      test_gemm_s8 (test_gemm_c, TEST_GEMM_MAX, test_gemm_pa8,
+			    test_gemm_pb8, m, n, k, 1);
+	      for (i = 0; i < m; i++)
+		for (j = 0; j < TEST_GEMM_MAX; j++)
+		  {
+		    ref = 1;
+		    for (l = 0; l < k && j < n; l++)
+		      ref += test_gemm_a8[i * 23 + l]
+			  * test_gemm_b8[l * 21 + j];
+		    if (test_gemm_c[i * TEST_GEMM_MAX + j] != ref)
+		      err8++;
+		  }
+
+	      test_gemm_pack_a_s16 (test_gemm_pa, test_gemm_a, 23, m, k);
+	      test_gemm_pack_b_s16 (test_gemm_pb, test_gemm_b, 21, k, n);
+	      test_gemm_s16 (test_gemm_c, TEST_GEMM_MAX, test_gemm_pa,
+			     test_gemm_pb, m, n, k, 0);
+	      for (i = 0; i < m; i++)
+		for (j = 0; j < n; j++)
+		  {
+		    unsigned int r = 0;
+
+		    for (l = 0; l < k; l++)
+		      r += test_gemm_a[i * 23 + l] * test_gemm_b[l * 21 + j];
+		    if (test_gemm_c[i * TEST_GEMM_MAX + j] != (int) r)
+		      err16++;
+		  }
+
+	      if (err8 || err16)
+		{
+		  printf ("vec_gemm_s8/s16 m=%lu n=%lu k=%lu full=%d "
+			  "errors %d %d\n", m, n, k, full, err8, err16);
+		  rc += 1;
+		}
+	    }
+    }
+
+  return (rc);
+}
+
 int
 test_vec_i32 (void)
 {
@@ -2632,6 +3438,13 @@ test_vec_i32 (void)
   rc += test_lvguwx ();
   rc += test_stvguwx ();
   rc += test_setbw ();
+  rc += test_vec_set_u32 ();
+  rc += test_vec_bitpack_u32 ();
+  rc += test_vec_varint_u32 ();
+  rc += test_vec_scan_u32 ();
+  rc += test_vec_dsp_q15 ();
+  rc += test_vec_dsp_q31 ();
+  rc += test_vec_gemm ();
 
   return (rc);
 }
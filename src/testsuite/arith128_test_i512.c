@@ -29,6 +29,7 @@
 #include <pveclib/vec_common_ppc.h>
 #include <pveclib/vec_int128_ppc.h>
 #include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_runtime_ppc.h>
 
 #include "arith128.h"
 #include <testsuite/arith128_print.h>
@@ -2567,6 +2568,209 @@ test_mul2048x2048 (void)
 }
 #undef __DEBUG_PRINT__
 
+/* Fill a quadword array with pseudo random (LCG) values.  */
+static void
+fill_vui128_random (vui128_t *a, unsigned long n, unsigned __int128 seed)
+{
+  const unsigned __int128 mult = ((unsigned __int128) 0x2360ed051fc65da4UL << 64)
+      | 0x4385df649fccf645UL;
+  const unsigned __int128 inc = ((unsigned __int128) 0x5851f42d4c957f2dUL << 64)
+      | 0x14057b7ef767814fUL;
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    {
+      seed = seed * mult + inc;
+      a[i] = (vui128_t) seed;
+    }
+}
+
+static int
+check_vui128_array (char *prefix, vui128_t *is, vui128_t *sb, unsigned long n)
+{
+  unsigned long i;
+  int rc = 0;
+
+  for (i = 0; i < n; i++)
+    rc += check_vuint128x (prefix, is[i], sb[i]);
+
+  return (rc);
+}
+
+/* Verify the unrolled fixed size paths of vec_mul128_byMN against
+ * the straight line and generic implementations.  */
+int
+test_mul128_byMN_fixed (void)
+{
+  const vui128_t c_zero = (vui128_t) ((unsigned __int128) 0);
+  vui128_t m1[16], m2[16], m3[2];
+  vui128_t k[32], e[32];
+  int rc = 0;
+
+  printf ("\ntest_mul128_byMN_fixed vector multiply quadwords, fixed MxN\n");
+
+  fill_vui128_random (m1, 16, 0x123456789abcdefUL);
+  fill_vui128_random (m2, 16, 0xfedcba987654321UL);
+
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m1, m2, 2, 2);
+  *((__VEC_U_512 *) e) = __VEC_PWR_IMP (vec_mul256x256) (
+      *((__VEC_U_256 *) m1), *((__VEC_U_256 *) m2));
+  rc += check_vui128_array ("vec_mul128_byMN 2x2:", k, e, 4);
+
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m1, m2, 4, 4);
+  *((__VEC_U_1024 *) e) = __VEC_PWR_IMP (vec_mul512x512) (
+      *((__VEC_U_512 *) m1), *((__VEC_U_512 *) m2));
+  rc += check_vui128_array ("vec_mul128_byMN 4x4:", k, e, 8);
+
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m1, m2, 8, 8);
+  __VEC_PWR_IMP (vec_mul1024x1024) ((__VEC_U_2048 *) e,
+				    (__VEC_U_1024 *) m1,
+				    (__VEC_U_1024 *) m2);
+  rc += check_vui128_array ("vec_mul128_byMN 8x8:", k, e, 16);
+
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m1, m2, 16, 16);
+  __VEC_PWR_IMP (vec_mul2048x2048) ((__VEC_U_4096 *) e,
+				    (__VEC_U_2048 *) m1,
+				    (__VEC_U_2048 *) m2);
+  rc += check_vui128_array ("vec_mul128_byMN 16x16:", k, e, 32);
+
+  /* The Mx2 (generic loop) multiply with a zero high quadword is the
+   * reference for the Mx1 specializations.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  m3[0] = m2[0];
+  m3[1] = c_zero;
+#else
+  m3[1] = m2[0];
+  m3[0] = c_zero;
+#endif
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m1, &m2[0], 8, 1);
+  __VEC_PWR_IMP (vec_mul128_byMN) (e, m1, m3, 8, 2);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  rc += check_vui128_array ("vec_mul128_byMN 8x1:", k, e, 9);
+  rc += check_vuint128x ("vec_mul128_byMN 8x1 h:", e[9], c_zero);
+#else
+  rc += check_vui128_array ("vec_mul128_byMN 8x1:", k, &e[1], 9);
+  rc += check_vuint128x ("vec_mul128_byMN 8x1 h:", e[0], c_zero);
+#endif
+
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m1, m2, 16, 1);
+  __VEC_PWR_IMP (vec_mul128_byMN) (e, m1, m3, 16, 2);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  rc += check_vui128_array ("vec_mul128_byMN 16x1:", k, e, 17);
+  rc += check_vuint128x ("vec_mul128_byMN 16x1 h:", e[17], c_zero);
+#else
+  rc += check_vui128_array ("vec_mul128_byMN 16x1:", k, &e[1], 17);
+  rc += check_vuint128x ("vec_mul128_byMN 16x1 h:", e[0], c_zero);
+#endif
+
+  /* Reversed operand order (1x16) swaps to the same specialization.  */
+  __VEC_PWR_IMP (vec_mul128_byMN) (k, m2, m1, 1, 16);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  rc += check_vui128_array ("vec_mul128_byMN 1x16:", k, e, 17);
+#else
+  rc += check_vui128_array ("vec_mul128_byMN 1x16:", k, &e[1], 17);
+#endif
+
+  return (rc);
+}
+
+/* Verify the 8x8 and 16x16 block multiplies of vec_mul512_byMN
+ * against the generic vec_mul128_byMN loop (32x32 and 64x64
+ * quadwords are not specialized).  */
+int
+test_mul512_byMN_fixed (void)
+{
+  static vui128_t m1[64], m2[64];
+  static vui128_t k[128], e[128];
+  int rc = 0;
+
+  printf ("\ntest_mul512_byMN_fixed vector multiply 512-bit, fixed MxN\n");
+
+  fill_vui128_random (m1, 64, 0x0f1e2d3c4b5a6978UL);
+  fill_vui128_random (m2, 64, 0x8796a5b4c3d2e1f0UL);
+
+  __VEC_PWR_IMP (vec_mul512_byMN) ((__VEC_U_512 *) k, (__VEC_U_512 *) m1,
+				   (__VEC_U_512 *) m2, 8, 8);
+  __VEC_PWR_IMP (vec_mul128_byMN) (e, m1, m2, 32, 32);
+  rc += check_vui128_array ("vec_mul512_byMN 8x8:", k, e, 64);
+
+  __VEC_PWR_IMP (vec_mul512_byMN) ((__VEC_U_512 *) k, (__VEC_U_512 *) m1,
+				   (__VEC_U_512 *) m2, 16, 16);
+  __VEC_PWR_IMP (vec_mul128_byMN) (e, m1, m2, 64, 64);
+  rc += check_vui128_array ("vec_mul512_byMN 16x16:", k, e, 128);
+
+  return (rc);
+}
+
+/* Pool task that itself runs a parallel multiply, to check that a
+   nested vec_pool_run completes rather than deadlocking.  */
+typedef struct
+{
+  __VEC_U_512 *p, *m1, *m2;
+} test_mul512_nested_t;
+
+static void
+test_mul512_nested_task (void *arg, unsigned long task)
+{
+  test_mul512_nested_t *t = (test_mul512_nested_t *) arg;
+
+  __VEC_PWR_IMP (vec_mul512_byMN_parallel) (&t->p[task * 36], t->m1,
+					    t->m2, 20, 16);
+}
+
+/* Verify the multithreaded vec_mul512_byMN_parallel against the
+ * serial vec_mul512_byMN, for sizes above the parallel threshold.  */
+int
+test_mul512_byMN_parallel (void)
+{
+  static __VEC_U_512 m1[32], m2[16];
+  static __VEC_U_512 k[48], e[48];
+  unsigned int save_threads;
+  int rc = 0;
+
+  printf ("\ntest_mul512_byMN_parallel vector multiply 512-bit MxN, threaded\n");
+
+  fill_vui128_random ((vui128_t *) m1, 32 * 4, 0x0123456789abcdefUL);
+  fill_vui128_random ((vui128_t *) m2, 16 * 4, 0x76543210fedcba98UL);
+
+  save_threads = vec_pool_get_threads ();
+  vec_pool_set_threads (4);
+
+  __VEC_PWR_IMP (vec_mul512_byMN) (e, m1, m2, 20, 16);
+  __VEC_PWR_IMP (vec_mul512_byMN_parallel) (k, m1, m2, 20, 16);
+  rc += check_vui128_array ("vec_mul512_byMN_parallel 20x16:",
+			    (vui128_t *) k, (vui128_t *) e, 36 * 4);
+
+  /* Uneven slices and reversed operand order.  */
+  __VEC_PWR_IMP (vec_mul512_byMN) (e, m2, m1, 9, 32);
+  __VEC_PWR_IMP (vec_mul512_byMN_parallel) (k, m2, m1, 9, 32);
+  rc += check_vui128_array ("vec_mul512_byMN_parallel 9x32:",
+			    (vui128_t *) k, (vui128_t *) e, 41 * 4);
+
+  /* Below the threshold this is the serial path.  */
+  __VEC_PWR_IMP (vec_mul512_byMN) (e, m1, m2, 3, 5);
+  __VEC_PWR_IMP (vec_mul512_byMN_parallel) (k, m1, m2, 3, 5);
+  rc += check_vui128_array ("vec_mul512_byMN_parallel 3x5:",
+			    (vui128_t *) k, (vui128_t *) e, 8 * 4);
+
+  /* Nested runs from pool tasks execute inline.  */
+  {
+    static __VEC_U_512 kn[2 * 36];
+    test_mul512_nested_t nest = { kn, m1, m2 };
+
+    __VEC_PWR_IMP (vec_mul512_byMN) (e, m1, m2, 20, 16);
+    vec_pool_run (test_mul512_nested_task, &nest, 2);
+    rc += check_vui128_array ("vec_mul512_byMN_parallel nested 0:",
+			      (vui128_t *) &kn[0], (vui128_t *) e, 36 * 4);
+    rc += check_vui128_array ("vec_mul512_byMN_parallel nested 1:",
+			      (vui128_t *) &kn[36], (vui128_t *) e, 36 * 4);
+  }
+
+  vec_pool_set_threads (save_threads);
+
+  return (rc);
+}
+
 int
 test_vec_i512 (void)
 {
@@ -2582,8 +2786,11 @@ test_vec_i512 (void)
   rc += test_mul2048x2048 ();
   rc += test_madd512x128 ();
   rc += test_mul512x128_MN ();
+  rc += test_mul128_byMN_fixed ();
   rc += test_mul512x512_MN ();
   rc += test_mul2048x2048_MN ();
+  rc += test_mul512_byMN_fixed ();
+  rc += test_mul512_byMN_parallel ();
 
   return (rc);
 }
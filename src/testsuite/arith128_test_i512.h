@@ -72,6 +72,9 @@ extern int test_mul512x128 (void);
 extern int test_mul512x512 (void);
 extern int test_mul1024x1024 (void);
 extern int test_mul2048x2048 (void);
+extern int test_mul128_byMN_fixed (void);
+extern int test_mul512_byMN_fixed (void);
+extern int test_mul512_byMN_parallel (void);
 
 extern int test_vec_i512 (void);
 
@@ -22,6 +22,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 
 //#define __DEBUG_PRINT__
 #include <testsuite/arith128_print.h>
@@ -13397,6 +13398,986 @@ test_signextll_w(void)
     return (rc);
   }
 
+#define test_sort_u64 __VEC_PWR_IMP(vec_sort_u64)
+#define test_sort_s64 __VEC_PWR_IMP(vec_sort_s64)
+#define test_sort_u64_kv __VEC_PWR_IMP(vec_sort_u64_kv)
+#define test_sort_s64_kv __VEC_PWR_IMP(vec_sort_s64_kv)
+#define test_merge_u64 __VEC_PWR_IMP(vec_merge_u64)
+#define test_merge_s64 __VEC_PWR_IMP(vec_merge_s64)
+
+#define TEST_SORT_MAX 1031
+static unsigned long long test_sort_keys[TEST_SORT_MAX];
+static unsigned long long test_sort_pay[TEST_SORT_MAX];
+static unsigned long long test_sort_out[TEST_SORT_MAX];
+
+static unsigned long long
+test_sort_rand (unsigned long long *x)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 7;
+  *x ^= *x << 17;
+  return *x;
+}
+
+/* Fill test_sort_keys[0..n) with unsorted keys and return their sum
+ * and xor. dup selects keys with many duplicates, centered on zero
+ * when sgn so signed sorts see negative and positive keys.  */
+static void
+test_sort_fill (unsigned long n, int dup, int sgn, unsigned long long *x,
+		unsigned long long *sum, unsigned long long *xsum)
+{
+  unsigned long i;
+
+  *sum = *xsum = 0;
+  for (i = 0; i < n; i++)
+    {
+      if (dup)
+	test_sort_keys[i] = (test_sort_rand (x) % 7) - (sgn ? 3 : 0);
+      else
+	test_sort_keys[i] = test_sort_rand (x);
+      *sum += test_sort_keys[i];
+      *xsum ^= test_sort_keys[i];
+    }
+}
+
+/* Check payload[i] == ~keys[i] after a key+payload sort.  */
+static int
+check_sort_pay (char *prefix, unsigned long long *keys,
+		unsigned long long *payload, unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    {
+      if (payload[i] != ~keys[i])
+	{
+	  printf ("%s n=%lu payload mismatch at %lu\n", prefix, n, i);
+	  return 1;
+	}
+    }
+  return 0;
+}
+
+/* Check keys[0..n) is ascending (signed if sgn) and the key sum and
+ * xor match the input.  */
+static int
+check_sort_u64 (char *prefix, unsigned long long *keys, unsigned long n,
+		unsigned long long sum, unsigned long long xsum, int sgn)
+{
+  unsigned long long bias = sgn ? 0x8000000000000000ULL : 0;
+  unsigned long long s = 0, x = 0;
+  unsigned long i;
+  int rc = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      if (i > 0 && (keys[i - 1] ^ bias) > (keys[i] ^ bias))
+	{
+	  printf ("%s n=%lu not sorted at %lu: %016llx > %016llx\n",
+		  prefix, n, i, keys[i - 1], keys[i]);
+	  rc = 1;
+	  break;
+	}
+      s += keys[i];
+      x ^= keys[i];
+    }
+  if (s != sum || x != xsum)
+    {
+      printf ("%s n=%lu elements lost\n", prefix, n);
+      rc = 1;
+    }
+  return rc;
+}
+
+int
+test_sortud (void)
+{
+  vui64_t v[16];
+  unsigned long long *e = (unsigned long long *) v;
+  vi64_t vs[4];
+  unsigned long long x = 0x0123456789abcdefULL, sum, xsum;
+  int i, rc = 0;
+
+  printf ("\ntest_sortud Vector Sort Doublewords\n");
+
+  v[0] = (vui64_t) { 7, 6 };
+  v[1] = (vui64_t) { 5, 4 };
+  v[2] = (vui64_t) { 3, 2 };
+  v[3] = (vui64_t) { 1, 0 };
+  vec_sort8ud (v);
+  rc += check_vuint128x ("vec_sort8ud 0:", (vui128_t) v[0],
+			 (vui128_t) (vui64_t) { 0, 1 });
+  rc += check_vuint128x ("vec_sort8ud 1:", (vui128_t) v[1],
+			 (vui128_t) (vui64_t) { 2, 3 });
+  rc += check_vuint128x ("vec_sort8ud 2:", (vui128_t) v[2],
+			 (vui128_t) (vui64_t) { 4, 5 });
+  rc += check_vuint128x ("vec_sort8ud 3:", (vui128_t) v[3],
+			 (vui128_t) (vui64_t) { 6, 7 });
+
+  vs[0] = (vi64_t) { 3, -1 };
+  vs[1] = (vi64_t) { __INT64_MAX__, -__INT64_MAX__ };
+  vs[2] = (vi64_t) { 0, 2 };
+  vs[3] = (vi64_t) { -2, 1 };
+  vec_sort8sd (vs);
+  rc += check_vuint128x ("vec_sort8sd 0:", (vui128_t) vs[0],
+			 (vui128_t) (vi64_t) { -__INT64_MAX__, -2 });
+  rc += check_vuint128x ("vec_sort8sd 3:", (vui128_t) vs[3],
+			 (vui128_t) (vi64_t) { 3, __INT64_MAX__ });
+
+  sum = xsum = 0;
+  for (i = 0; i < 16; i++)
+    {
+      v[i] = (vui64_t) { test_sort_rand (&x), test_sort_rand (&x) };
+      sum += v[i][0] + v[i][1];
+      xsum ^= v[i][0] ^ v[i][1];
+    }
+  vec_sort32ud (v);
+  rc += check_sort_u64 ("vec_sort32ud", e, 32, sum, xsum, 0);
+
+  return (rc);
+}
+
+int
+test_vec_sort_u64 (void)
+{
+  static const unsigned long sizes[] =
+    { 0, 1, 2, 5, 31, 32, 33, 64, 95, 256, 257, 1000, TEST_SORT_MAX };
+  unsigned long long x = 0x9e3779b97f4a7c15ULL, sum, xsum;
+  unsigned long i, n, t;
+  int dup, rc = 0;
+
+  printf ("\ntest_vec_sort_u64 Sort and merge doubleword arrays\n");
+
+  for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+    for (dup = 0; dup < 2; dup++)
+      {
+	n = sizes[t];
+
+	test_sort_fill (n, dup, 0, &x, &sum, &xsum);
+	test_sort_u64 (test_sort_keys, n);
+	rc += check_sort_u64 ("vec_sort_u64", test_sort_keys, n, sum, xsum,
+			      0);
+
+	/* Fresh unsorted keys, about half of them negative.  */
+	test_sort_fill (n, dup, 1, &x, &sum, &xsum);
+	test_sort_s64 ((long long *) test_sort_keys, n);
+	rc += check_sort_u64 ("vec_sort_s64", test_sort_keys, n, sum, xsum,
+			      1);
+
+	test_sort_fill (n, dup, 0, &x, &sum, &xsum);
+	for (i = 0; i < n; i++)
+	  test_sort_pay[i] = ~test_sort_keys[i];
+	test_sort_u64_kv (test_sort_keys, test_sort_pay, n);
+	rc += check_sort_u64 ("vec_sort_u64_kv", test_sort_keys, n, sum,
+			      xsum, 0);
+	rc += check_sort_pay ("vec_sort_u64_kv", test_sort_keys,
+			      test_sort_pay, n);
+
+	test_sort_fill (n, dup, 1, &x, &sum, &xsum);
+	for (i = 0; i < n; i++)
+	  test_sort_pay[i] = ~test_sort_keys[i];
+	test_sort_s64_kv ((long long *) test_sort_keys, test_sort_pay, n);
+	rc += check_sort_u64 ("vec_sort_s64_kv", test_sort_keys, n, sum,
+			      xsum, 1);
+	rc += check_sort_pay ("vec_sort_s64_kv", test_sort_keys,
+			      test_sort_pay, n);
+
+	/* Merge two independently sorted runs of fresh keys.  */
+	if (n > 1)
+	  {
+	    test_sort_fill (n, dup, 0, &x, &sum, &xsum);
+	    test_sort_u64 (test_sort_keys, n / 3);
+	    test_sort_u64 (&test_sort_keys[n / 3], n - (n / 3));
+	    test_merge_u64 (test_sort_out, test_sort_keys, n / 3,
+			    &test_sort_keys[n / 3], n - (n / 3));
+	    rc += check_sort_u64 ("vec_merge_u64", test_sort_out, n, sum,
+				  xsum, 0);
+
+	    test_sort_fill (n, dup, 1, &x, &sum, &xsum);
+	    test_sort_s64 ((long long *) test_sort_keys, n / 3);
+	    test_sort_s64 ((long long *) &test_sort_keys[n / 3],
+			   n - (n / 3));
+	    test_merge_s64 ((long long *) test_sort_out,
+			    (long long *) test_sort_keys, n / 3,
+			    (long long *) &test_sort_keys[n / 3],
+			    n - (n / 3));
+	    rc += check_sort_u64 ("vec_merge_s64", test_sort_out, n, sum,
+				  xsum, 1);
+	  }
+      }
+
+  return (rc);
+}
+
+extern unsigned long
+__VEC_PWR_IMP (vec_difference_u64) (unsigned long long *out,
+	const unsigned long long *a, unsigned long na,
+	const unsigned long long *b, unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_intersect_u64) (unsigned long long *out,
+	const unsigned long long *a, unsigned long na,
+	const unsigned long long *b, unsigned long nb);
+extern unsigned long
+__VEC_PWR_IMP (vec_union_u64) (unsigned long long *out,
+	const unsigned long long *a, unsigned long na,
+	const unsigned long long *b, unsigned long nb);
+#define test_difference_u64 __VEC_PWR_IMP(vec_difference_u64)
+#define test_intersect_u64 __VEC_PWR_IMP(vec_intersect_u64)
+#define test_union_u64 __VEC_PWR_IMP(vec_union_u64)
+
+#define TEST_SET_MAX64 2000
+static unsigned long long test_set_u64_a[TEST_SET_MAX64];
+static unsigned long long test_set_u64_b[TEST_SET_MAX64];
+static unsigned long long test_set_u64_out[2 * TEST_SET_MAX64];
+static unsigned long long test_set_u64_ref[2 * TEST_SET_MAX64];
+
+/* Fill s with n strictly increasing elements, with gaps of 1 to
+ * gap.  */
+static void
+test_set_fill_u64 (unsigned long long *s, unsigned long n, unsigned int gap,
+		   unsigned long long *x)
+{
+  unsigned long long v = 0;
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    {
+      *x ^= *x << 13;
+      *x ^= *x >> 7;
+      *x ^= *x << 17;
+      v += 1 + (*x % gap);
+      s[i] = (v << 20) | v;
+    }
+}
+
+/* Scalar reference: op 0 difference, 1 intersect, 2 union.  */
+static unsigned long
+test_set_ref_u64 (unsigned long long *out, const unsigned long long *a,
+		  unsigned long na, const unsigned long long *b,
+		  unsigned long nb, int op)
+{
+  unsigned long i = 0, j = 0, o = 0;
+
+  while (i < na || j < nb)
+    {
+      int ina = (i < na) && (j >= nb || a[i] <= b[j]);
+      int inb = (j < nb) && (i >= na || b[j] <= a[i]);
+      unsigned long long v = ina ? a[i] : b[j];
+
+      if ((op == 0 && ina && !inb) || (op == 1 && ina && inb) || op == 2)
+	out[o++] = v;
+      i += ina;
+      j += inb;
+    }
+  return o;
+}
+
+int
+test_vec_set_u64 (void)
+{
+  /* Pairs of set sizes, including sizes skewed enough for galloping
+   * search.  */
+  static const unsigned long sizes[][2] =
+    { { 0, 0 }, { 0, 5 }, { 7, 0 }, { 1, 1 }, { 3, 5 }, { 17, 16 },
+      { 100, 97 }, { 1000, 1000 }, { 1999, 1003 }, { 10, 1900 },
+      { 1900, 10 }, { 1, TEST_SET_MAX64 } };
+  static const char *names[] =
+    { "vec_difference_u64", "vec_intersect_u64", "vec_union_u64" };
+  unsigned long long x = 0x9e3779b97f4a7c15ULL;
+  unsigned long t, n, m, na, nb;
+  unsigned int gap;
+  int op, rc = 0;
+
+  printf ("\ntest_vec_set_u64 Sorted set operations\n");
+
+  for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+    for (gap = 2; gap <= 8; gap *= 2)
+      {
+	na = sizes[t][0];
+	nb = sizes[t][1];
+	test_set_fill_u64 (test_set_u64_a, na, gap, &x);
+	test_set_fill_u64 (test_set_u64_b, nb, gap, &x);
+	for (op = 0; op < 3; op++)
+	  {
+	    if (op == 0)
+	      n = test_difference_u64 (test_set_u64_out, test_set_u64_a, na,
+				       test_set_u64_b, nb);
+	    else if (op == 1)
+	      n = test_intersect_u64 (test_set_u64_out, test_set_u64_a, na,
+				      test_set_u64_b, nb);
+	    else
+	      n = test_union_u64 (test_set_u64_out, test_set_u64_a, na,
+				  test_set_u64_b, nb);
+	    m = test_set_ref_u64 (test_set_u64_ref, test_set_u64_a, na,
+				  test_set_u64_b, nb, op);
+	    if (n != m
+		|| memcmp (test_set_u64_out, test_set_u64_ref,
+			   m * sizeof (unsigned long long)) != 0)
+	      {
+		printf ("%s na=%lu nb=%lu gap=%u returned %lu expected %lu\n",
+			names[op], na, nb, gap, n, m);
+		rc += 1;
+	      }
+	  }
+      }
+
+  return (rc);
+}
+
+#define test_htab_init_u64 __VEC_PWR_IMP(vec_htab_init_u64)
+#define test_htab_insert_u64 __VEC_PWR_IMP(vec_htab_insert_u64)
+#define test_htab_find_u64 __VEC_PWR_IMP(vec_htab_find_u64)
+#define test_htab_find_batch_u64 __VEC_PWR_IMP(vec_htab_find_batch_u64)
+#define test_htab_erase_u64 __VEC_PWR_IMP(vec_htab_erase_u64)
+#define test_htab_free __VEC_PWR_IMP(vec_htab_free)
+
+#define TEST_HTAB_MAX 3000
+static unsigned long long test_htab_keys[2 * TEST_HTAB_MAX];
+static long test_htab_slots[TEST_HTAB_MAX];
+static long test_htab_found[2 * TEST_HTAB_MAX];
+
+int
+test_vec_htab_u64 (void)
+{
+  unsigned long long x = 0x2545f4914f6cdd1dULL;
+  unsigned long long *tkeys;
+  unsigned long i, n = TEST_HTAB_MAX;
+  vec_htab_t t;
+  long slot;
+  int rc = 0;
+
+  printf ("\ntest_vec_htab_u64 Hash table of doublewords\n");
+
+  if (test_htab_init_u64 (&t, n) != 0)
+    {
+      printf ("vec_htab_init_u64 failed\n");
+      return 1;
+    }
+  tkeys = t.keys;
+
+  /* Even keys are inserted, odd keys are never present.  */
+  for (i = 0; i < 2 * n; i++)
+    test_htab_keys[i] = (test_sort_rand (&x) << 1) | (i >= n);
+
+  for (i = 0; i < n; i++)
+    {
+      test_htab_slots[i] = test_htab_insert_u64 (&t, test_htab_keys[i]);
+      if (test_htab_slots[i] < 0
+	  || tkeys[test_htab_slots[i]] != test_htab_keys[i])
+	{
+	  printf ("vec_htab_insert_u64 %lu failed\n", i);
+	  rc += 1;
+	  break;
+	}
+    }
+  if (t.count != n)
+    {
+      printf ("vec_htab_insert_u64 count %lu expected %lu\n", t.count, n);
+      rc += 1;
+    }
+  if (test_htab_insert_u64 (&t, test_htab_keys[7]) != test_htab_slots[7])
+    {
+      printf ("vec_htab_insert_u64 duplicate failed\n");
+      rc += 1;
+    }
+
+  test_htab_find_batch_u64 (&t, test_htab_found, test_htab_keys, 2 * n);
+  for (i = 0; i < 2 * n; i++)
+    {
+      slot = (i < n) ? test_htab_slots[i] : -1;
+      if (test_htab_found[i] != slot
+	  || test_htab_find_u64 (&t, test_htab_keys[i]) != slot)
+	{
+	  printf ("vec_htab_find_u64 %lu returned %ld expected %ld\n", i,
+		  test_htab_found[i], slot);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  for (i = 0; i < n; i += 3)
+    if (test_htab_erase_u64 (&t, test_htab_keys[i]) != test_htab_slots[i])
+      {
+	printf ("vec_htab_erase_u64 %lu failed\n", i);
+	rc += 1;
+	break;
+      }
+  for (i = 0; i < n; i++)
+    {
+      slot = (i % 3) ? test_htab_slots[i] : -1;
+      if (test_htab_find_u64 (&t, test_htab_keys[i]) != slot)
+	{
+	  printf ("vec_htab_find_u64 after erase %lu failed\n", i);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  test_htab_free (&t);
+  return (rc);
+}
+
+#define test_hash64 __VEC_PWR_IMP(vec_hash64)
+#define test_hash64_batch_u32 __VEC_PWR_IMP(vec_hash64_batch_u32)
+#define test_hash64_batch_u64 __VEC_PWR_IMP(vec_hash64_batch_u64)
+
+#define TEST_HASH_MAX 301
+static unsigned char test_hash_buf[TEST_HASH_MAX];
+static unsigned long long test_hash_keys[TEST_HASH_MAX];
+static unsigned int test_hash_keysw[TEST_HASH_MAX];
+static unsigned long long test_hash_out[TEST_HASH_MAX];
+
+/* Store v as n little endian bytes.  */
+static void
+test_hash_le (unsigned char *b, unsigned long long v, int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    b[i] = (unsigned char) (v >> (8 * i));
+}
+
+/* Known answers for vec_hash64 of the bytes 0, 1, 2, ... at each
+ * length, for seeds 0 and 0x0123456789abcdef. Computed with a
+ * separate scalar model of the algorithm.  */
+static const struct
+{
+  unsigned long len;
+  unsigned long long h0, h1;
+} test_hash_kat[] =
+  {
+    {   0, 0x0409638ee2bde459ULL, 0x2b4e3df129b1f482ULL },
+    {   3, 0x3a3c0d7ed67cb88fULL, 0x8de67ed7fd6c66adULL },
+    {   8, 0xe2a5e06139247f27ULL, 0x1bf01b62e28a0e81ULL },
+    {   9, 0xbbaea42b20bd69c2ULL, 0x50cc26280f301c5aULL },
+    {  16, 0x46a2d49bf1854019ULL, 0x4a7b905ed45afd42ULL },
+    {  17, 0x7ed011944b0c00adULL, 0x638610d285d40f1dULL },
+    {  33, 0x8387a9294a14a507ULL, 0x7a1fdad3c5e36391ULL },
+    {  64, 0xb64ab3839a5e0473ULL, 0x0eb3d045cc02f8abULL },
+    {  65, 0xcb31b604a243f515ULL, 0x1aca47c92b7eb2a7ULL },
+    { 129, 0xde45afd3a093a5fbULL, 0x875db9d801a89018ULL },
+    { 256, 0x45513521563d6489ULL, 0x4e89eb04cbb261c2ULL },
+  };
+
+/* Known answers for the batch forms with seed 0x0123456789abcdef.  */
+static const unsigned int test_hash_kat_k32[5] =
+  { 0, 1, 0x80000000, 0xdeadbeef, 0xffffffff };
+static const unsigned long long test_hash_kat_h32[5] =
+  {
+    0x4b81f3889efcb868ULL,
+    0x053b7693510fb01cULL,
+    0xb9e3b78fa9996d8eULL,
+    0xbf67c82425f38e23ULL,
+    0x8b32f1b15c457590ULL
+  };
+static const unsigned long long test_hash_kat_k64[5] =
+  { 0, 1, 0x8000000000000000ULL, 0x0123456789abcdefULL,
+    0xffffffffffffffffULL };
+static const unsigned long long test_hash_kat_h64[5] =
+  {
+    0xede99ee2862a9fceULL,
+    0x65ee38e487cafc8eULL,
+    0x414e39af28725257ULL,
+    0x9b199ed4b01b957aULL,
+    0xb0bbab3c53028bf9ULL
+  };
+
+int
+test_vec_hash_u64 (void)
+{
+  unsigned long long x = 0x9e3779b97f4a7c15ULL;
+  unsigned long long seed = 0x0123456789abcdefULL;
+  unsigned long long h, e;
+  unsigned char b[8];
+  unsigned long i, j;
+  int rc = 0;
+
+  printf ("\ntest_vec_hash_u64 Multiply-fold hash\n");
+
+  {
+    unsigned char kb[256];
+
+    for (i = 0; i < 256; i++)
+      kb[i] = (unsigned char) i;
+    for (i = 0; i < (sizeof (test_hash_kat) / sizeof (test_hash_kat[0]));
+	 i++)
+      {
+	h = test_hash64 (kb, test_hash_kat[i].len, 0);
+	e = test_hash64 (kb, test_hash_kat[i].len, 0x0123456789abcdefULL);
+	if (h != test_hash_kat[i].h0 || e != test_hash_kat[i].h1)
+	  {
+	    printf ("vec_hash64 len %lu %016llx %016llx expected %016llx "
+		    "%016llx\n", test_hash_kat[i].len, h, e,
+		    test_hash_kat[i].h0, test_hash_kat[i].h1);
+	    rc += 1;
+	  }
+      }
+
+    test_hash64_batch_u32 (test_hash_out, test_hash_kat_k32, 5,
+			   0x0123456789abcdefULL);
+    for (i = 0; i < 5; i++)
+      if (test_hash_out[i] != test_hash_kat_h32[i])
+	{
+	  printf ("vec_hash64_batch_u32 [%lu] %016llx expected %016llx\n",
+		  i, test_hash_out[i], test_hash_kat_h32[i]);
+	  rc += 1;
+	}
+    test_hash64_batch_u64 (test_hash_out, test_hash_kat_k64, 5,
+			   0x0123456789abcdefULL);
+    for (i = 0; i < 5; i++)
+      if (test_hash_out[i] != test_hash_kat_h64[i])
+	{
+	  printf ("vec_hash64_batch_u64 [%lu] %016llx expected %016llx\n",
+		  i, test_hash_out[i], test_hash_kat_h64[i]);
+	  rc += 1;
+	}
+  }
+
+  for (i = 0; i < TEST_HASH_MAX; i++)
+    {
+      test_hash_buf[i] = (unsigned char) test_sort_rand (&x);
+      test_hash_keys[i] = test_sort_rand (&x);
+      test_hash_keysw[i] = (unsigned int) test_sort_rand (&x);
+    }
+
+  /* Each length, including across the 16 and 64 byte boundaries,
+   * hashes differently from its neighbor, for two seeds.  */
+  for (i = 1; i < TEST_HASH_MAX; i++)
+    {
+      h = test_hash64 (test_hash_buf, i, seed);
+      if (h == test_hash64 (test_hash_buf, i - 1, seed)
+	  || h == test_hash64 (test_hash_buf, i, seed + 1)
+	  || h != test_hash64 (test_hash_buf, i, seed))
+	{
+	  printf ("vec_hash64 len %lu h=%016llx\n", i, h);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  /* A change to any byte changes the hash.  */
+  e = test_hash64 (test_hash_buf, TEST_HASH_MAX, seed);
+  for (i = 0; i < TEST_HASH_MAX; i++)
+    {
+      test_hash_buf[i] ^= 0x10;
+      h = test_hash64 (test_hash_buf, TEST_HASH_MAX, seed);
+      test_hash_buf[i] ^= 0x10;
+      if (h == e)
+	{
+	  printf ("vec_hash64 byte %lu ignored\n", i);
+	  rc += 1;
+	  break;
+	}
+    }
+
+  /* Batch results match vec_hash64 of the little endian key.  */
+  for (j = TEST_HASH_MAX - 4; j <= TEST_HASH_MAX; j++)
+    {
+      test_hash64_batch_u64 (test_hash_out, test_hash_keys, j, seed);
+      for (i = 0; i < j; i++)
+	{
+	  test_hash_le (b, test_hash_keys[i], 8);
+	  e = test_hash64 (b, 8, seed);
+	  if (test_hash_out[i] != e)
+	    {
+	      printf ("vec_hash64_batch_u64 n=%lu [%lu] %016llx expected "
+		      "%016llx\n", j, i, test_hash_out[i], e);
+	      rc += 1;
+	      break;
+	    }
+	}
+      test_hash64_batch_u32 (test_hash_out, test_hash_keysw, j, seed);
+      for (i = 0; i < j; i++)
+	{
+	  test_hash_le (b, test_hash_keysw[i], 4);
+	  e = test_hash64 (b, 4, seed);
+	  if (test_hash_out[i] != e)
+	    {
+	      printf ("vec_hash64_batch_u32 n=%lu [%lu] %016llx expected "
+		      "%016llx\n", j, i, test_hash_out[i], e);
+	      rc += 1;
+	      break;
+	    }
+	}
+    }
+
+  return (rc);
+}
+
+#define test_bitpack_u64 __VEC_PWR_IMP(vec_bitpack_u64)
+#define test_bitunpack_u64 __VEC_PWR_IMP(vec_bitunpack_u64)
+#define test_bitpack_for_u64 __VEC_PWR_IMP(vec_bitpack_for_u64)
+#define test_bitunpack_for_u64 __VEC_PWR_IMP(vec_bitunpack_for_u64)
+#define test_bitpack_delta_u64 __VEC_PWR_IMP(vec_bitpack_delta_u64)
+#define test_bitunpack_delta_u64 __VEC_PWR_IMP(vec_bitunpack_delta_u64)
+
+#define TEST_BITPACK_MAX64 (3 * 128 + 37)
+static unsigned long long test_bitpack_in64[TEST_BITPACK_MAX64];
+static unsigned long long test_bitpack_pk64[TEST_BITPACK_MAX64];
+static unsigned long long test_bitpack_out64[TEST_BITPACK_MAX64];
+
+static unsigned long long
+test_bitpack_rand64 (unsigned long long *x, unsigned int bits)
+{
+  *x ^= *x << 13;
+  *x ^= *x >> 7;
+  *x ^= *x << 17;
+  return (bits < 64) ? *x & ((1ULL << bits) - 1) : *x;
+}
+
+int
+test_vec_bitpack_u64 (void)
+{
+  static const unsigned long sizes[] = { 0, 5, 128, 129, 256,
+					 TEST_BITPACK_MAX64 };
+  unsigned long long x = 0x243f6a8885a308d3ULL;
+  const unsigned long long base = 1000000000000ULL;
+  unsigned long i, t, n, w;
+  unsigned int bits;
+  int rc = 0;
+
+  printf ("\ntest_vec_bitpack_u64 Bit packing of doublewords\n");
+
+  for (bits = 0; bits <= 64; bits++)
+    for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+      {
+	n = sizes[t];
+	for (i = 0; i < n; i++)
+	  test_bitpack_in64[i] = test_bitpack_rand64 (&x, bits);
+	w = test_bitpack_u64 (test_bitpack_pk64, test_bitpack_in64, n, bits);
+	test_bitunpack_u64 (test_bitpack_out64, test_bitpack_pk64, n, bits);
+	if (w != vec_bitpack_doublewords_u64 (n, bits)
+	    || memcmp (test_bitpack_out64, test_bitpack_in64,
+		       n * sizeof (unsigned long long)) != 0)
+	  {
+	    printf ("vec_bitpack_u64 bits=%u n=%lu failed\n", bits, n);
+	    rc += 1;
+	  }
+
+	for (i = 0; i < n; i++)
+	  test_bitpack_in64[i] = base + test_bitpack_rand64 (&x, bits);
+	test_bitpack_for_u64 (test_bitpack_pk64, test_bitpack_in64, n, base,
+			      bits);
+	test_bitunpack_for_u64 (test_bitpack_out64, test_bitpack_pk64, n,
+				base, bits);
+	if (memcmp (test_bitpack_out64, test_bitpack_in64,
+		    n * sizeof (unsigned long long)) != 0)
+	  {
+	    printf ("vec_bitpack_for_u64 bits=%u n=%lu failed\n", bits, n);
+	    rc += 1;
+	  }
+
+	/* Each lane increasing by at most bits bits.  */
+	for (i = 0; i < n; i++)
+	  test_bitpack_in64[i] = ((i < 2) ? base : test_bitpack_in64[i - 2])
+				 + test_bitpack_rand64 (&x, bits);
+	test_bitpack_delta_u64 (test_bitpack_pk64, test_bitpack_in64, n,
+				base, bits);
+	test_bitunpack_delta_u64 (test_bitpack_out64, test_bitpack_pk64, n,
+				  base, bits);
+	if (memcmp (test_bitpack_out64, test_bitpack_in64,
+		    n * sizeof (unsigned long long)) != 0)
+	  {
+	    printf ("vec_bitpack_delta_u64 bits=%u n=%lu failed\n", bits, n);
+	    rc += 1;
+	  }
+      }
+
+  return (rc);
+}
+
+#define test_leb128_encode_u64 __VEC_PWR_IMP(vec_leb128_encode_u64)
+#define test_leb128_decode_u64 __VEC_PWR_IMP(vec_leb128_decode_u64)
+
+#define TEST_VARINT_MAX64 203
+static unsigned long long test_varint_in64[TEST_VARINT_MAX64];
+static unsigned long long test_varint_out64[TEST_VARINT_MAX64];
+static unsigned char test_varint_buf64[10 * TEST_VARINT_MAX64];
+static unsigned char test_varint_ref64[10 * TEST_VARINT_MAX64 + 16];
+
+int
+test_vec_varint_u64 (void)
+{
+  static const unsigned long sizes[] = { 0, 1, 3, 15, 16, 17, 33,
+					 TEST_VARINT_MAX64 };
+  unsigned long long x = 0xa4093822299f31d0ULL;
+  unsigned long i, t, n, w, m;
+  long r;
+  int mix, rc = 0;
+
+  printf ("\ntest_vec_varint_u64 LEB128 doublewords\n");
+
+  /* mix 0 all single byte values, 1 random lengths, 2 mostly
+   * single byte.  */
+  for (mix = 0; mix < 3; mix++)
+    for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+      {
+	n = sizes[t];
+	for (i = 0; i < n; i++)
+	  {
+	    test_sort_rand (&x);
+	    if (mix == 0 || (mix == 2 && (x & 3) != 0))
+	      test_varint_in64[i] = x & 0x7f;
+	    else
+	      test_varint_in64[i] = x >> (test_sort_rand (&x) % 64);
+	  }
+
+	m = 0;
+	for (i = 0; i < n; i++)
+	  {
+	    unsigned long long v = test_varint_in64[i];
+
+	    while (v > 0x7f)
+	      {
+		test_varint_ref64[m++] = (v & 0x7f) | 0x80;
+		v >>= 7;
+	      }
+	    test_varint_ref64[m++] = v;
+	  }
+	w = test_leb128_encode_u64 (test_varint_buf64, test_varint_in64, n);
+	r = test_leb128_decode_u64 (test_varint_out64, test_varint_ref64, m,
+				    n);
+	if (w != m || memcmp (test_varint_buf64, test_varint_ref64, m) != 0
+	    || r != (long) m
+	    || memcmp (test_varint_out64, test_varint_in64,
+		       n * sizeof (unsigned long long)) != 0)
+	  {
+	    printf ("vec_leb128_u64 mix=%d n=%lu returned %lu/%ld expected "
+		    "%lu\n", mix, n, w, r, m);
+	    rc += 1;
+	  }
+	if (n > 0
+	    && test_leb128_decode_u64 (test_varint_out64, test_varint_ref64,
+				       m - 1, n) != -1)
+	  {
+	    printf ("vec_leb128_decode_u64 n=%lu truncated input\n", n);
+	    rc += 1;
+	  }
+      }
+
+  /* More than 10 bytes is malformed.  */
+  memset (test_varint_ref64, 0x80, 16);
+  if (test_leb128_decode_u64 (test_varint_out64, test_varint_ref64, 16, 1)
+      != -1)
+    {
+      printf ("vec_leb128_decode_u64 accepted an 11 byte varint\n");
+      rc += 1;
+    }
+
+  return (rc);
+}
+
+#define test_bitmap_count __VEC_PWR_IMP(vec_bitmap_count)
+#define test_bitmap_and_count __VEC_PWR_IMP(vec_bitmap_and_count)
+#define test_bitmap_andnot_count __VEC_PWR_IMP(vec_bitmap_andnot_count)
+#define test_bitmap_or_count __VEC_PWR_IMP(vec_bitmap_or_count)
+#define test_bitmap_xor_count __VEC_PWR_IMP(vec_bitmap_xor_count)
+#define test_bitmap_next_set __VEC_PWR_IMP(vec_bitmap_next_set)
+#define test_bitmap_rank __VEC_PWR_IMP(vec_bitmap_rank)
+#define test_bitmap_select __VEC_PWR_IMP(vec_bitmap_select)
+#define test_bitmap_set_array_u16 __VEC_PWR_IMP(vec_bitmap_set_array_u16)
+#define test_bitmap_to_array_u16 __VEC_PWR_IMP(vec_bitmap_to_array_u16)
+#define test_bitmap_and_array_u16 __VEC_PWR_IMP(vec_bitmap_and_array_u16)
+
+#define TEST_BITMAP_MAX 1024
+static unsigned long long test_bitmap_a[TEST_BITMAP_MAX];
+static unsigned long long test_bitmap_b[TEST_BITMAP_MAX];
+static unsigned long long test_bitmap_out[TEST_BITMAP_MAX];
+static unsigned short test_bitmap_arr[4096];
+static unsigned short test_bitmap_arr2[65536];
+
+int
+test_vec_bitmap_u64 (void)
+{
+  static const unsigned long sizes[] = { 0, 1, 2, 3, 31, 32, 33, 67,
+					 TEST_BITMAP_MAX };
+  static const char *names[] =
+    { "vec_bitmap_and_count", "vec_bitmap_andnot_count",
+      "vec_bitmap_or_count", "vec_bitmap_xor_count" };
+  unsigned long long x = 0x452821e638d01377ULL;
+  unsigned long long e[5], c;
+  unsigned long i, t, n, p, m;
+  long ns;
+  int op, rc = 0;
+
+  printf ("\ntest_vec_bitmap_u64 Bitmap count, rank, select\n");
+
+  for (t = 0; t < (sizeof (sizes) / sizeof (sizes[0])); t++)
+    {
+      n = sizes[t];
+      memset (e, 0, sizeof (e));
+      /* a sparse, b dense.  */
+      for (i = 0; i < n; i++)
+	{
+	  test_bitmap_a[i] = (test_sort_rand (&x) % 4 == 0)
+	      ? test_sort_rand (&x) & test_sort_rand (&x) : 0;
+	  test_bitmap_b[i] = test_sort_rand (&x);
+	  e[0] += __builtin_popcountll (test_bitmap_a[i]);
+	  e[1] += __builtin_popcountll (test_bitmap_a[i] & test_bitmap_b[i]);
+	  e[2] += __builtin_popcountll (test_bitmap_a[i] & ~test_bitmap_b[i]);
+	  e[3] += __builtin_popcountll (test_bitmap_a[i] | test_bitmap_b[i]);
+	  e[4] += __builtin_popcountll (test_bitmap_a[i] ^ test_bitmap_b[i]);
+	}
+      if (test_bitmap_count (test_bitmap_a, n) != e[0])
+	{
+	  printf ("vec_bitmap_count n=%lu failed\n", n);
+	  rc += 1;
+	}
+      for (op = 0; op < 4; op++)
+	{
+	  unsigned long long (*f) (unsigned long long *,
+				   const unsigned long long *,
+				   const unsigned long long *, unsigned long);
+
+	  f = (op == 0) ? test_bitmap_and_count
+	      : (op == 1) ? test_bitmap_andnot_count
+	      : (op == 2) ? test_bitmap_or_count : test_bitmap_xor_count;
+	  c = f (test_bitmap_out, test_bitmap_a, test_bitmap_b, n);
+	  if (c != e[op + 1] || f (NULL, test_bitmap_a, test_bitmap_b, n) != c
+	      || test_bitmap_count (test_bitmap_out, n) != c)
+	    {
+	      printf ("%s n=%lu returned %llu expected %llu\n", names[op], n, c,
+		      e[op + 1]);
+	      rc += 1;
+	    }
+	}
+
+      /* Walk the set bits with next_set, check rank and select.  */
+      c = 0;
+      for (p = 0, ns = test_bitmap_next_set (test_bitmap_a, n, 0); ns >= 0;
+	   p = ns + 1, ns = test_bitmap_next_set (test_bitmap_a, n, p))
+	{
+	  if (!((test_bitmap_a[ns / 64] >> (ns % 64)) & 1)
+	      || test_bitmap_rank (test_bitmap_a, ns) != c
+	      || test_bitmap_select (test_bitmap_a, n, c) != ns)
+	    {
+	      printf ("vec_bitmap_next_set/rank/select n=%lu pos %ld\n", n,
+		      ns);
+	      rc += 1;
+	      break;
+	    }
+	  c++;
+	}
+      if (c != e[0] || test_bitmap_select (test_bitmap_a, n, c) != -1)
+	{
+	  printf ("vec_bitmap_next_set n=%lu found %llu expected %llu\n", n, c,
+		  e[0]);
+	  rc += 1;
+	}
+    }
+
+  /* Roaring containers: array -> bitmap -> array, array AND bitmap.  */
+  memset (test_bitmap_out, 0, sizeof (test_bitmap_out));
+  for (i = 0, p = 0; i < 4096; i++)
+    {
+      p += 1 + test_sort_rand (&x) % 15;
+      test_bitmap_arr[i] = p;
+    }
+  test_bitmap_set_array_u16 (test_bitmap_out, test_bitmap_arr, 4096);
+  m = test_bitmap_to_array_u16 (test_bitmap_arr2, test_bitmap_out,
+				TEST_BITMAP_MAX);
+  if (m != 4096
+      || memcmp (test_bitmap_arr2, test_bitmap_arr, sizeof (test_bitmap_arr))
+	 != 0)
+    {
+      printf ("vec_bitmap_to_array_u16 returned %lu expected 4096\n", m);
+      rc += 1;
+    }
+  m = test_bitmap_and_array_u16 (test_bitmap_arr2, test_bitmap_arr, 4096,
+				 test_bitmap_b);
+  for (i = 0, p = 0; i < 4096; i++)
+    {
+      unsigned short v = test_bitmap_arr[i];
+
+      if ((test_bitmap_b[v / 64] >> (v % 64)) & 1)
+	{
+	  if (p >= m || test_bitmap_arr2[p] != v)
+	    break;
+	  p++;
+	}
+    }
+  if (i != 4096 || p != m)
+    {
+      printf ("vec_bitmap_and_array_u16 returned %lu expected %lu\n", m, p);
+      rc += 1;
+    }
+
+  return (rc);
+}
+
+#define test_prefix_sum_u64 __VEC_PWR_IMP(vec_prefix_sum_u64)
+#define test_prefix_sum_excl_u64 __VEC_PWR_IMP(vec_prefix_sum_excl_u64)
+
+#define TEST_SCAN_MAX64 203
+static unsigned long long test_scan_in64[TEST_SCAN_MAX64];
+static unsigned long long test_scan_out64[TEST_SCAN_MAX64];
+
+int
+test_vec_scan_u64 (void)
+{
+  unsigned long long x = 0x082efa98ec4e6c89ULL;
+  unsigned long long init = 0xfffffffffffffff0ULL, s, r;
+  unsigned long i, n;
+  int rc = 0;
+
+  printf ("\ntest_vec_scan_u64 Prefix sum doublewords\n");
+
+  for (i = 0; i < TEST_SCAN_MAX64; i++)
+    {
+      x ^= x << 13;
+      x ^= x >> 7;
+      x ^= x << 17;
+      test_scan_in64[i] = x;
+    }
+
+  for (n = 0; n <= TEST_SCAN_MAX64; n += (n < 20) ? 1 : 61)
+    {
+      r = test_prefix_sum_u64 (test_scan_out64, test_scan_in64, n, init);
+      for (i = 0, s = init; i < n; i++)
+	{
+	  s += test_scan_in64[i];
+	  if (test_scan_out64[i] != s)
+	    {
+	      printf ("vec_prefix_sum_u64 n=%lu [%lu] %016llx expected "
+		      "%016llx\n", n, i, test_scan_out64[i], s);
+	      rc += 1;
+	      break;
+	    }
+	}
+      if (r != s)
+	{
+	  printf ("vec_prefix_sum_u64 n=%lu sum %016llx expected "
+		  "%016llx\n", n, r, s);
+	  rc += 1;
+	}
+
+      /* In place, out == in.  */
+      memcpy (test_scan_out64, test_scan_in64,
+	      n * sizeof (unsigned long long));
+      r = test_prefix_sum_excl_u64 (test_scan_out64, test_scan_out64, n,
+				    init);
+      for (i = 0, s = init; i < n; i++)
+	{
+	  if (test_scan_out64[i] != s)
+	    {
+	      printf ("vec_prefix_sum_excl_u64 n=%lu [%lu] %016llx expected "
+		      "%016llx\n", n, i, test_scan_out64[i], s);
+	      rc += 1;
+	      break;
+	    }
+	  s += test_scan_in64[i];
+	}
+      if (r != s)
+	{
+	  printf ("vec_prefix_sum_excl_u64 n=%lu sum %016llx expected "
+		  "%016llx\n", n, r, s);
+	  rc += 1;
+	}
+    }
+
+  return (rc);
+}
+
 int
 test_vec_i64 (void)
 {
@@ -13452,6 +14433,15 @@ test_vec_i64 (void)
   rc += test_vec_divide_dw ();
   rc += test_vec_modulo_dw ();
   rc += test_vec_divide_qud ();
+  rc += test_sortud ();
+  rc += test_vec_sort_u64 ();
+  rc += test_vec_set_u64 ();
+  rc += test_vec_htab_u64 ();
+  rc += test_vec_hash_u64 ();
+  rc += test_vec_bitpack_u64 ();
+  rc += test_vec_varint_u64 ();
+  rc += test_vec_bitmap_u64 ();
+  rc += test_vec_scan_u64 ();
 
   return (rc);
 }
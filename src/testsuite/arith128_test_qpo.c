@@ -20429,3 +20429,143 @@ test_msub_qpo (void)
 
   return (rc);
 }
+
+extern __binary128 __VEC_PWR_IMP (vec_xsaddqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128 __VEC_PWR_IMP (vec_xssubqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128 __VEC_PWR_IMP (vec_xsmulqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128 __VEC_PWR_IMP (vec_xsdivqp_rm) (__binary128 vfa, __binary128 vfb, int rmode);
+extern __binary128 __VEC_PWR_IMP (vec_xsmaddqp_rm) (__binary128 vfa, __binary128 vfb, __binary128 vfc, int rmode);
+extern __binary128 __VEC_PWR_IMP (vec_xsmsubqp_rm) (__binary128 vfa, __binary128 vfb, __binary128 vfc, int rmode);
+#define test_xsaddqp_rm(_l,_k,_r)	__VEC_PWR_IMP (vec_xsaddqp_rm)(_l,_k,_r)
+#define test_xssubqp_rm(_l,_k,_r)	__VEC_PWR_IMP (vec_xssubqp_rm)(_l,_k,_r)
+#define test_xsmulqp_rm(_l,_k,_r)	__VEC_PWR_IMP (vec_xsmulqp_rm)(_l,_k,_r)
+#define test_xsdivqp_rm(_l,_k,_r)	__VEC_PWR_IMP (vec_xsdivqp_rm)(_l,_k,_r)
+#define test_xsmaddqp_rm(_l,_k,_j,_r)	__VEC_PWR_IMP (vec_xsmaddqp_rm)(_l,_k,_j,_r)
+#define test_xsmsubqp_rm(_l,_k,_j,_r)	__VEC_PWR_IMP (vec_xsmsubqp_rm)(_l,_k,_j,_r)
+
+int
+test_qp_rm (void)
+{
+  __binary128 x, y, z;
+  __binary128 t, e;
+  vui64_t xui;
+  int rc = 0;
+  printf ("\n%s\n", __FUNCTION__);
+
+  // 1.0 + 2^-113 is exactly half way between 1.0 and 1.0 + 1ulp
+  x = vec_xfer_vui64t_2_bin128 (vf128_one);
+  xui = CONST_VINT128_DW (0x3f8e000000000000, 0);
+  y = vec_xfer_vui64t_2_bin128 (xui);
+
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_NEAREST);
+  e = vec_xfer_vui64t_2_bin128 (vf128_one);
+  rc += check_f128 ("check vec_xsaddqp_rm RN", e, t, e);
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_ZERO);
+  rc += check_f128 ("check vec_xsaddqp_rm RZ", e, t, e);
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_DOWN);
+  rc += check_f128 ("check vec_xsaddqp_rm RD", e, t, e);
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_UP);
+  xui = CONST_VINT128_DW (0x3fff000000000000, 1);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsaddqp_rm RU", e, t, e);
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_ODD);
+  rc += check_f128 ("check vec_xsaddqp_rm RO", e, t, e);
+
+  // Same for -1.0 - 2^-113, RD rounds the magnitude up
+  x = vec_xfer_vui64t_2_bin128 (vf128_none);
+  xui = CONST_VINT128_DW (0xbf8e000000000000, 0);
+  y = vec_xfer_vui64t_2_bin128 (xui);
+
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_UP);
+  e = vec_xfer_vui64t_2_bin128 (vf128_none);
+  rc += check_f128 ("check vec_xsaddqp_rm RU", e, t, e);
+  t = test_xsaddqp_rm (x, y, VEC_F128_RN_DOWN);
+  xui = CONST_VINT128_DW (0xbfff000000000000, 1);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsaddqp_rm RD", e, t, e);
+
+  // x - x is -0.0 for RD and +0.0 otherwise
+  x = vec_xfer_vui64t_2_bin128 (vf128_one);
+  t = test_xssubqp_rm (x, x, VEC_F128_RN_NEAREST);
+  e = vec_xfer_vui64t_2_bin128 (vf128_zero);
+  rc += check_f128 ("check vec_xssubqp_rm RN", e, t, e);
+  t = test_xssubqp_rm (x, x, VEC_F128_RN_DOWN);
+  e = vec_xfer_vui64t_2_bin128 (vf128_nzero);
+  rc += check_f128 ("check vec_xssubqp_rm RD", e, t, e);
+
+  // (1 + 2^-112)^2 = 1 + 2^-111 + 2^-224
+  xui = CONST_VINT128_DW (0x3fff000000000000, 1);
+  x = vec_xfer_vui64t_2_bin128 (xui);
+  t = test_xsmulqp_rm (x, x, VEC_F128_RN_NEAREST);
+  xui = CONST_VINT128_DW (0x3fff000000000000, 2);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsmulqp_rm RN", e, t, e);
+  t = test_xsmulqp_rm (x, x, VEC_F128_RN_ZERO);
+  rc += check_f128 ("check vec_xsmulqp_rm RZ", e, t, e);
+  t = test_xsmulqp_rm (x, x, VEC_F128_RN_UP);
+  xui = CONST_VINT128_DW (0x3fff000000000000, 3);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsmulqp_rm RU", e, t, e);
+
+  // __FLT128_MAX__ * 2.0 overflows to Inf or stays at MAX
+  xui = CONST_VINT128_DW (0x7ffeffffffffffff, 0xffffffffffffffff);
+  x = vec_xfer_vui64t_2_bin128 (xui);
+  y = vec_xfer_vui64t_2_bin128 (vf128_two);
+  t = test_xsmulqp_rm (x, y, VEC_F128_RN_NEAREST);
+  e = vec_xfer_vui64t_2_bin128 (vf128_inf);
+  rc += check_f128 ("check vec_xsmulqp_rm RN", e, t, e);
+  t = test_xsmulqp_rm (x, y, VEC_F128_RN_UP);
+  rc += check_f128 ("check vec_xsmulqp_rm RU", e, t, e);
+  t = test_xsmulqp_rm (x, y, VEC_F128_RN_ZERO);
+  rc += check_f128 ("check vec_xsmulqp_rm RZ", x, t, x);
+  t = test_xsmulqp_rm (x, y, VEC_F128_RN_DOWN);
+  rc += check_f128 ("check vec_xsmulqp_rm RD", x, t, x);
+
+  // 1/3, the bits after the significand are 0b0101...
+  x = vec_xfer_vui64t_2_bin128 (vf128_one);
+  xui = CONST_VINT128_DW (0x4000800000000000, 0);
+  y = vec_xfer_vui64t_2_bin128 (xui);
+  t = test_xsdivqp_rm (x, y, VEC_F128_RN_NEAREST);
+  xui = CONST_VINT128_DW (0x3ffd555555555555, 0x5555555555555555);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsdivqp_rm RN", e, t, e);
+  t = test_xsdivqp_rm (x, y, VEC_F128_RN_DOWN);
+  rc += check_f128 ("check vec_xsdivqp_rm RD", e, t, e);
+  t = test_xsdivqp_rm (x, y, VEC_F128_RN_UP);
+  xui = CONST_VINT128_DW (0x3ffd555555555555, 0x5555555555555556);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsdivqp_rm RU", e, t, e);
+
+  // 1.0 * 1.0 + 2^-113 ties like the add case
+  x = vec_xfer_vui64t_2_bin128 (vf128_one);
+  xui = CONST_VINT128_DW (0x3f8e000000000000, 0);
+  z = vec_xfer_vui64t_2_bin128 (xui);
+  t = test_xsmaddqp_rm (x, x, z, VEC_F128_RN_NEAREST);
+  e = vec_xfer_vui64t_2_bin128 (vf128_one);
+  rc += check_f128 ("check vec_xsmaddqp_rm RN", e, t, e);
+  t = test_xsmaddqp_rm (x, x, z, VEC_F128_RN_UP);
+  xui = CONST_VINT128_DW (0x3fff000000000000, 1);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsmaddqp_rm RU", e, t, e);
+
+  // 1.0 * 1.0 - 2^-114 is half way between 1 - 2^-113 and 1.0
+  xui = CONST_VINT128_DW (0x3f8d000000000000, 0);
+  z = vec_xfer_vui64t_2_bin128 (xui);
+  t = test_xsmsubqp_rm (x, x, z, VEC_F128_RN_NEAREST);
+  e = vec_xfer_vui64t_2_bin128 (vf128_one);
+  rc += check_f128 ("check vec_xsmsubqp_rm RN", e, t, e);
+  t = test_xsmsubqp_rm (x, x, z, VEC_F128_RN_ZERO);
+  xui = CONST_VINT128_DW (0x3ffeffffffffffff, 0xffffffffffffffff);
+  e = vec_xfer_vui64t_2_bin128 (xui);
+  rc += check_f128 ("check vec_xsmsubqp_rm RZ", e, t, e);
+
+  // 1.0 * 1.0 - 1.0 is -0.0 for RD
+  t = test_xsmsubqp_rm (x, x, x, VEC_F128_RN_DOWN);
+  e = vec_xfer_vui64t_2_bin128 (vf128_nzero);
+  rc += check_f128 ("check vec_xsmsubqp_rm RD", e, t, e);
+  t = test_xsmsubqp_rm (x, x, x, VEC_F128_RN_ZERO);
+  e = vec_xfer_vui64t_2_bin128 (vf128_zero);
+  rc += check_f128 ("check vec_xsmsubqp_rm RZ", e, t, e);
+
+  return (rc);
+}
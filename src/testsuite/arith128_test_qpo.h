@@ -39,3 +39,5 @@
   extern int test_msub_qpo ();
   extern int test_msub_qpo_zero_c ();
   extern int test_msub_qpo_xtra ();
+
+  extern int test_qp_rm ();
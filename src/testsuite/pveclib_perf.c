@@ -43,1062 +43,182 @@
 #include <testsuite/vec_perf_f64.h>
 #include <testsuite/vec_perf_f128.h>
 
-#define TIMING_ITERATIONS 10
+#include <testsuite/vec_perf_bench.h>
+#include <testsuite/vec_perf_isa.h>
+#include <testsuite/vec_perf_lat.h>
+
+/* Elements are the operations performed per timed_* call: the
+   number of chained multiplies, loop iterations, or matrix
+   elements transposed.  */
+
+static const vec_bench_t i512_bench[] =
+  {
+    { "i512", "mul128x128", timed_mul128x128, NULL, 8 },
+    { "i512", "mul256x256", timed_mul256x256, NULL, 8 },
+    { "i512", "mul512x512", timed_mul512x512, NULL, 1 },
+    { "i512", "mul512x512by8", timed_mul512x512by8, NULL, 8 },
+    { "i512", "mul1024x1024", timed_mul1024x1024, NULL, 1 },
+    { "i512", "mul1024x1024by8", timed_mul1024x1024by8, NULL, 8 },
+    { "i512", "mul2048x2048", timed_mul2048x2048, NULL, 1 },
+    { "i512", "mul2048x2048by8", timed_mul2048x2048by8, NULL, 8 },
+    { "i512", "mul2048x2048_MN", timed_mul2048x2048_MN, NULL, 1 },
+    { "i512", "mul4096x4096_MN", timed_mul4096x4096_MN, NULL, 1 }
+  };
+
+static const vec_bench_t i128_bench[] =
+  {
+    { "i128", "gcc_divuq", timed_gcc_divuq, NULL, 1 },
+    { "i128", "gcc_divuq2", timed_gcc_divuq2, NULL, 1 },
+    { "i128", "vec_divuq", timed_vec_divuq, NULL, 1 },
+    { "i128", "vec_divuq2", timed_vec_divuq2, NULL, 1 },
+    { "i128", "vec_divuqe", timed_vec_divuqe, NULL, 1 },
+    { "i128", "vec_divdqu", timed_vec_divdqu, NULL, 1 },
+    { "i128", "lib_divmodud", timed_lib_divmodud, NULL, 8 },
+    { "i128", "divmodud", timed_divmodud, NULL, 8 },
+    { "i128", "divqud", timed_divqud, NULL, 16 },
+    { "i128", "mul10uq", timed_mul10uq, NULL, 38 },
+    { "i128", "cmul10ecuq", timed_cmul10ecuq, NULL, 64 },
+    { "i128", "mulluq", timed_mulluq, NULL, 38 },
+    { "i128", "muludq", timed_muludq, NULL, 6 },
+    { "i128", "muludqx", timed_muludqx, NULL, 6 },
+    { "i128", "longdiv_e32", timed_longdiv_e32, NULL, 1 },
+#ifndef PVECLIB_DISABLE_DFP
+    { "i128", "longbcdcf_10e32", timed_longbcdcf_10e32, NULL, 1 },
+    { "i128", "longbcdct_10e32", timed_longbcdct_10e32, NULL, 1 },
+#endif
+    { "i128", "cfmaxdouble_10e32", timed_cfmaxdouble_10e32, NULL, 1 },
+    { "i128", "ctmaxdouble_10e32", timed_ctmaxdouble_10e32, NULL, 1 }
+  };
+
+static const vec_bench_t f32_bench[] =
+  {
+    { "f32", "is_f32", timed_is_f32, NULL, 50 },
+    { "f32", "fpclassify_f32", timed_fpclassify_f32, NULL, 10 },
+    { "f32", "scalar_transpose", timed_scalar_f32_transpose,
+	timed_setup_f32_transpose, 64 * 64 },
+    { "f32", "gather_transpose", timed_gather_f32_transpose,
+	timed_setup_f32_transpose, 64 * 64 },
+    { "f32", "gatherx2_transpose", timed_gatherx2_f32_transpose,
+	timed_setup_f32_transpose, 64 * 64 },
+    { "f32", "gatherx4_transpose", timed_gatherx4_f32_transpose,
+	timed_setup_f32_transpose, 64 * 64 }
+  };
+
+static const vec_bench_t f64_bench[] =
+  {
+    { "f64", "is_f64", timed_is_f64, NULL, 50 },
+    { "f64", "fpclassify_f64", timed_fpclassify_f64, NULL, 10 },
+    { "f64", "scalar_transpose", timed_scalar_f64_transpose,
+	timed_setup_f64_transpose, 64 * 64 },
+    { "f64", "gather_transpose", timed_gather_f64_transpose,
+	timed_setup_f64_transpose, 64 * 64 },
+    { "f64", "gatherx2_transpose", timed_gatherx2_f64_transpose,
+	timed_setup_f64_transpose, 64 * 64 },
+    { "f64", "gatherx4_transpose", timed_gatherx4_f64_transpose,
+	timed_setup_f64_transpose, 64 * 64 }
+  };
+
+#ifndef PVECLIB_DISABLE_F128ARITH
+static const vec_bench_t f128_bench[] =
+  {
+#if 0 // turn off until Round-to-odd implementation is ready
+    { "f128", "expxsuba_v1", timed_expxsuba_v1_f128, NULL, 10 },
+    { "f128", "expxsuba_v2", timed_expxsuba_v2_f128, NULL, 10 },
+#endif
+    { "f128", "gcc_max8", timed_gcc_max8_f128, NULL, 10 },
+    { "f128", "lib_max8", timed_lib_max8_f128, NULL, 10 },
+    { "f128", "vec_max8", timed_vec_max8_f128, NULL, 10 },
+    { "f128", "vec_max8uz", timed_vec_max8_f128uz, NULL, 10 },
+    { "f128", "gcc_dpqp", timed_gcc_dpqp_f128, NULL, 10 },
+    { "f128", "lib_dpqp", timed_lib_dpqp_f128, NULL, 10 },
+    { "f128", "vec_dpqp", timed_vec_dpqp_f128, NULL, 10 },
+    { "f128", "gcc_uqqp", timed_gcc_uqqp_f128, NULL, 10 },
+    { "f128", "lib_uqqp", timed_lib_uqqp_f128, NULL, 10 },
+    { "f128", "vec_uqqp", timed_vec_uqqp_f128, NULL, 10 },
+    { "f128", "gcc_qpuq", timed_gcc_qpuq_f128, NULL, 10 },
+    { "f128", "lib_qpuq", timed_lib_qpuq_f128, NULL, 10 },
+    { "f128", "vec_qpuq", timed_vec_qpuq_f128, NULL, 10 },
+    { "f128", "gcc_qpdpo", timed_gcc_qpdpo_f128, NULL, 10 },
+    { "f128", "lib_qpdpo", timed_lib_qpdpo_f128, NULL, 10 },
+    { "f128", "vec_qpdpo", timed_vec_qpdpo_f128, NULL, 10 },
+    { "f128", "gcc_mulqpn", timed_gcc_mulqpn_f128, NULL, 10 },
+    { "f128", "lib_mulqpo", timed_lib_mulqpo_f128, NULL, 10 },
+    { "f128", "lib_mulqpn", timed_lib_mulqpn_f128, NULL, 10 },
+    { "f128", "gcc_divqpn", timed_gcc_divqpn_f128, NULL, 10 },
+    { "f128", "lib_divqpo", timed_lib_divqpo_f128, NULL, 10 },
+    { "f128", "gcc_addqpn", timed_gcc_addqpn_f128, NULL, 10 },
+    { "f128", "lib_addqpo", timed_lib_addqpo_f128, NULL, 10 },
+    { "f128", "gcc_subqpn", timed_gcc_subqpn_f128, NULL, 10 },
+    { "f128", "lib_subqpo", timed_lib_subqpo_f128, NULL, 10 },
+    { "f128", "gcc_maddqpn", timed_gcc_maddqpn_f128, NULL, 10 },
+    { "f128", "lib_maddqpo", timed_lib_maddqpo_f128, NULL, 10 }
+  };
+#endif
+
+static vec_bench_opts_t bench_opts;
 
 int
 test_time_i512 (void)
 {
-  long i;
-  uint64_t t_start, t_end, t_delta;
-  double delta_sec;
-  int rc = 0;
-
-  printf ("\n%s mul128x128 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul128x128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul128x128 end", __FUNCTION__);
-  printf ("\n%s mul128x128 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul256x256 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul256x256 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul256x256 end", __FUNCTION__);
-  printf ("\n%s mul256x256 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul512x512 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul512x512 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul512x512 end", __FUNCTION__);
-  printf ("\n%s mul512x512 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul512x512by8 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul512x512by8 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul512x512by8 end", __FUNCTION__);
-  printf ("\n%s mul512x512by8 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul1024x1024 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul1024x1024 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul1024x1024 end", __FUNCTION__);
-  printf ("\n%s mul1024x1024 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul1024x1024by8 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul1024x1024by8 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul1024x1024by8 end", __FUNCTION__);
-  printf ("\n%s mul1024x1024by8 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul2048x2048 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul2048x2048 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul2048x2048 end", __FUNCTION__);
-  printf ("\n%s mul2048x2048 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul2048x2048by8 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul2048x2048by8 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul2048x2048by8 end", __FUNCTION__);
-  printf ("\n%s mul2048x2048by8 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s timed_mul2048x2048_MN start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul2048x2048_MN ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s timed_mul2048x2048_MN end", __FUNCTION__);
-  printf ("\n%s timed_mul2048x2048_MN delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s timed_mul4096x4096_MN start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul4096x4096_MN ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s timed_mul4096x4096_MN end", __FUNCTION__);
-  printf ("\n%s timed_mul4096x4096_MN delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  return (rc);
+  return vec_bench_run (&bench_opts, i512_bench,
+			VEC_BENCH_COUNT (i512_bench));
 }
 
 int
 test_time_i128 (void)
 {
-  long i;
-  uint64_t t_start, t_end, t_delta;
-  double delta_sec;
-  int rc = 0;
-
-  printf ("\n%s vec_divuq_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_divuq ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divuq_gcc end", __FUNCTION__);
-  printf ("\n%s vec_divuq_gcc  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divuq2_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_divuq2 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divuq2_gcc end", __FUNCTION__);
-  printf ("\n%s vec_divuq2_qcc  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divuq_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_divuq ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divuq_lib end", __FUNCTION__);
-  printf ("\n%s vec_divuq_lib  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divuq2_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_divuq2 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divuq2_lib end", __FUNCTION__);
-  printf ("\n%s vec_divuq2_lib  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divuqe_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_divuqe ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divuqe_lib end", __FUNCTION__);
-  printf ("\n%s vec_divuqe_lib  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divdqu_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_divdqu ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divdqu_lib end", __FUNCTION__);
-  printf ("\n%s vec_divdqu_lib  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divmodud_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_divmodud ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divmodud_lib end", __FUNCTION__);
-  printf ("\n%s vec_divmodud_lib  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divmodud start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_divmodud ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divmodud end", __FUNCTION__);
-  printf ("\n%s vec_divmodud  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s vec_divqud start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_divqud ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s vec_divqud end", __FUNCTION__);
-  printf ("\n%s vec_divqud  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s mul10uq start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mul10uq ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mul10uq end", __FUNCTION__);
-  printf ("\n%s mul10uq  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s cmul10ecuq start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_cmul10ecuq ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cmul10ecuq end", __FUNCTION__);
-  printf ("\n%s cmul10ecuq  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s mulluq start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_mulluq ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mulluq end", __FUNCTION__);
-  printf ("\n%s mulluq  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s muludq start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_muludq ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s muludq end", __FUNCTION__);
-  printf ("\n%s muludq  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s muludqx start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_muludqx ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s muludqx end", __FUNCTION__);
-  printf ("\n%s muludqx  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s longdiv_e32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_longdiv_e32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s longdiv_e32 end", __FUNCTION__);
-  printf ("\n%s longdiv_e32 tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-#ifndef PVECLIB_DISABLE_DFP
-  printf ("\n%s longbcdcf_10e32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_longbcdcf_10e32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s longbcdcf_10e32 end", __FUNCTION__);
-  printf ("\n%s longbcdcf_10e32 tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s longbcdct_10e32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_longbcdct_10e32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-#endif
-
-  printf ("\n%s longbcdct_10e32 end", __FUNCTION__);
-  printf ("\n%s longbcdct_10e32 tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s cfmaxdouble_10e32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_cfmaxdouble_10e32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cfmaxdouble_10e32 end", __FUNCTION__);
-  printf ("\n%s cfmaxdouble_10e32 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s ctmaxdouble_10e32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_ctmaxdouble_10e32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s ctmaxdouble_10e32 end", __FUNCTION__);
-  printf ("\n%s ctmaxdouble_10e32 delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  return (rc);
+  return vec_bench_run (&bench_opts, i128_bench,
+			VEC_BENCH_COUNT (i128_bench));
 }
 
 int
 test_time_f32 (void)
 {
-  long i;
-  uint64_t t_start, t_end, t_delta;
-  double delta_sec;
-  int rc = 0;
-
-  printf ("\n%s is_f32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_is_f32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s is_f32 end", __FUNCTION__);
-  printf ("\n%s is_f32  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s fpclassify_f32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_fpclassify_f32 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s fpclassify_f32 end", __FUNCTION__);
-  printf ("\n%s fpclassify_f32  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  // initialize the test array to the Identity matrix
-  timed_setup_f32_transpose  ();
-
-  printf ("\n%s scalar_transpose_f32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_scalar_f32_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s scalar_transpose_f32 end", __FUNCTION__);
-  printf ("\n%s scalar_transpose_f32  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s gather_transpose_f32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gather_f32_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s gather_transpose_f32 end", __FUNCTION__);
-  printf ("\n%s gather_transpose_f32  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s gatherx2_transpose_f32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gatherx2_f32_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s gatherx2_transpose_f32 end", __FUNCTION__);
-  printf ("\n%s gatherx2_transpose_f32  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s gatherx4_transpose_f32 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gatherx4_f32_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s gatherx4_transpose_f32 end", __FUNCTION__);
-  printf ("\n%s gatherx4_transpose_f32  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  return (rc);
+  return vec_bench_run (&bench_opts, f32_bench,
+			VEC_BENCH_COUNT (f32_bench));
 }
 
 int
 test_time_f64 (void)
 {
-  long i;
-  uint64_t t_start, t_end, t_delta;
-  double delta_sec;
-  int rc = 0;
-
-  printf ("\n%s is_f64 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_is_f64 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s is_f64 end", __FUNCTION__);
-  printf ("\n%s is_f64  tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s fpclassify_f64 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_fpclassify_f64 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s fpclassify_f64 end", __FUNCTION__);
-  printf ("\n%s fpclassify_f64  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-
-  // initialize the test array to the Identity matrix
-  timed_setup_f64_transpose  ();
-
-  printf ("\n%s scalar_transpose_f64 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_scalar_f64_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s scalar_transpose_f64 end", __FUNCTION__);
-  printf ("\n%s scalar_transpose_f64  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s gather_transpose_f64 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gather_f64_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s gather_transpose_f64 end", __FUNCTION__);
-  printf ("\n%s gather_transpose_f64  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s gatherx2_transpose_f64 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gatherx2_f64_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s gatherx2_transpose_f64 end", __FUNCTION__);
-  printf ("\n%s gatherx2_transpose_f64  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s gatherx4_transpose_f64 start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gatherx4_f64_transpose ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s gatherx4_transpose_f64 end", __FUNCTION__);
-  printf ("\n%s gatherx4_transpose_f64  tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  return (rc);
+  return vec_bench_run (&bench_opts, f64_bench,
+			VEC_BENCH_COUNT (f64_bench));
 }
 
 #ifndef PVECLIB_DISABLE_F128ARITH
 int
 test_time_f128 (void)
 {
-  long i;
-  uint64_t t_start, t_end, t_delta;
-  double delta_sec;
-  int rc = 0;
-
-#if 0 // turn off until Round-to-odd implementation is ready
-  printf ("\n%s f128 CC start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_expxsuba_v1_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s f128 CC end", __FUNCTION__);
-  printf ("\n%s f128 CC tb delta = %lu, sec = %10.6g\n", __FUNCTION__, t_delta,
-	  delta_sec);
-
-  printf ("\n%s f128_LIB start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_expxsuba_v2_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s f128_LIB end", __FUNCTION__);
-  printf ("\n%s f128_LIB tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
+  return vec_bench_run (&bench_opts, f128_bench,
+			VEC_BENCH_COUNT (f128_bench));
+}
 #endif
-  printf ("\n%s cmpgtuqp_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_max8_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cmpgtuqp_gcc end", __FUNCTION__);
-  printf ("\n%s cmpgtuqp_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cmpgtuqp_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_max8_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cmpgtuqp_lib end", __FUNCTION__);
-  printf ("\n%s cmpgtuqp_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cmpgtuqp_vec start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_max8_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cmpgtuqp_vec end", __FUNCTION__);
-  printf ("\n%s cmpgtuqp_vec tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cmpgtuzqp_vec start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_max8_f128uz ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cmpgtuzqp_vec end", __FUNCTION__);
-  printf ("\n%s cmpgtuzqp_vec tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_dpqp_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_dpqp_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_dpqp_gcc end", __FUNCTION__);
-  printf ("\n%s cvt_dpqp_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_dpqp_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_dpqp_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_dpqp_lib end", __FUNCTION__);
-  printf ("\n%s cvt_dpqp_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_dpqp_vec start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_dpqp_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_dpqp_vec end", __FUNCTION__);
-  printf ("\n%s cvt_dpqp_vec tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
 
-  printf ("\n%s cvt_uqqp_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_uqqp_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_uqqp_gcc end", __FUNCTION__);
-  printf ("\n%s cvt_uqqp_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_uqqp_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_uqqp_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_uqqp_lib end", __FUNCTION__);
-  printf ("\n%s cvt_uqqp_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_uqqp_vec start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_uqqp_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_uqqp_vec end", __FUNCTION__);
-  printf ("\n%s cvt_uqqp_vec tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_qpuq_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_qpuq_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_qpuq_gcc end", __FUNCTION__);
-  printf ("\n%s cvt_qpuq_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_qpuq_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_qpuq_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_qpuq_lib end", __FUNCTION__);
-  printf ("\n%s cvt_qpuq_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_qpuq_vec start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_qpuq_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_qpuq_vec end", __FUNCTION__);
-  printf ("\n%s cvt_qpuq_vec tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_qpdpo_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_qpdpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_qpdpo_gcc end", __FUNCTION__);
-  printf ("\n%s cvt_qpdpo_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_qpdpo_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_qpdpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_qpdpo_lib end", __FUNCTION__);
-  printf ("\n%s cvt_qpdpo_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s cvt_qpdpo_vec start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_vec_qpdpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s cvt_qpdpo_vec end", __FUNCTION__);
-  printf ("\n%s cvt_qpdpo_vec tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s mulqpn_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_mulqpn_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mulqpn_gcc end", __FUNCTION__);
-  printf ("\n%s mulqpn_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s mulqpo_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_mulqpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mulqpo_lib end", __FUNCTION__);
-  printf ("\n%s mulqpo_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s mulqpn_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_mulqpn_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s mulqpn_lib end", __FUNCTION__);
-  printf ("\n%s mulqpn_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s divqpn_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_divqpn_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s divqpn_gcc end", __FUNCTION__);
-  printf ("\n%s divqpn_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s divqpo_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_divqpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s divqpo_lib end", __FUNCTION__);
-  printf ("\n%s divqpo_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s addqpn_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_addqpn_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s addqpn_gcc end", __FUNCTION__);
-  printf ("\n%s addqpn_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s addqpo_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_addqpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s addqpo_lib end", __FUNCTION__);
-  printf ("\n%s addqpo_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s subqpn_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_gcc_subqpn_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s subqpn_gcc end", __FUNCTION__);
-  printf ("\n%s subqpn_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
+int
+main (int argc, char **argv)
+{
+  int rc = EXIT_SUCCESS;
 
-  printf ("\n%s subqpo_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
-    {
-      rc += timed_lib_subqpo_f128 ();
-    }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
+  rc = vec_bench_parse_args (&bench_opts, argc, argv);
+  if (rc != 0)
+    return (rc < 0) ? 2 : EXIT_SUCCESS;
 
-  printf ("\n%s subqpo_lib end", __FUNCTION__);
-  printf ("\n%s subqpo_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
+  if (bench_opts.format == VEC_BENCH_TEXT && !bench_opts.list_only)
+    puts ("Power Vector Performance testsuite");
 
-  printf ("\n%s maddqpn_gcc start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
+  vec_bench_begin (&bench_opts);
+  if (bench_opts.isa_mode)
     {
-      rc += timed_gcc_maddqpn_f128 ();
+      rc += test_time_isa (&bench_opts);
+      vec_bench_end (&bench_opts);
+      return (rc);
     }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s maddqpn_gcc end", __FUNCTION__);
-  printf ("\n%s maddqpn_gcc tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  printf ("\n%s maddqpo_lib start, ...\n", __FUNCTION__);
-  t_start = __builtin_ppc_get_timebase ();
-  for (i = 0; i < TIMING_ITERATIONS; i++)
+  if (bench_opts.lat_mode)
     {
-      rc += timed_lib_maddqpo_f128 ();
+      rc += test_time_lat (&bench_opts);
+      vec_bench_end (&bench_opts);
+      return (rc);
     }
-  t_end = __builtin_ppc_get_timebase ();
-  t_delta = t_end - t_start;
-  delta_sec = TimeDeltaSec (t_delta);
-
-  printf ("\n%s maddqpo_lib end", __FUNCTION__);
-  printf ("\n%s maddqpo_lib tb delta = %lu, sec = %10.6g\n", __FUNCTION__,
-	  t_delta, delta_sec);
-
-  return (rc);
-}
-#endif
-
-int
-main (void)
-{
-  int rc = EXIT_SUCCESS;
-
-  puts ("Power Vector Performance testsuite");
-
 #if 1
   rc += test_time_f32 ();
 #endif
@@ -1106,7 +226,8 @@ main (void)
   rc += test_time_f64 ();
 #endif
 #ifdef PVECLIB_DISABLE_F128ARITH
-  puts ("\ntest_time_f128 disabled for PVECLIB_DISABLE_F128ARITH\n");
+  if (bench_opts.format == VEC_BENCH_TEXT)
+    puts ("\ntest_time_f128 disabled for PVECLIB_DISABLE_F128ARITH\n");
 #else
   rc += test_time_f128 ();
 #endif
@@ -1116,8 +237,9 @@ main (void)
 #if 1
   rc += test_time_i512 ();
 #endif
+  vec_bench_end (&bench_opts);
 
   if (rc > 0)
-    printf ("%d failures reported\n", rc);
+    fprintf (stderr, "%d failures reported\n", rc);
   return (rc);
 }
@@ -0,0 +1,457 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_bench.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Avoid <stdlib.h> here, see the __clang__ <floatn.h> note in
+   pveclib_perf.c. Samples are kept in a static array and sorted
+   locally.  */
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <sys/platform/ppc.h>
+
+#include <testsuite/vec_perf_bench.h>
+
+/* Upper bound on samples collected per case.  */
+#define VEC_BENCH_MAX_SAMPLES 4096
+
+static uint64_t vec_bench_samples[VEC_BENCH_MAX_SAMPLES];
+static int vec_bench_json_first = 1;
+static vec_pmu_t vec_bench_pmu;
+static int vec_bench_pmu_opened = 0;
+
+double
+vec_bench_tb_freq (void)
+{
+  static double tb_freq = 0.0;
+
+  if (tb_freq == 0.0)
+    {
+      tb_freq = (double) __ppc_get_timebase_freq ();
+      /* Fall back to the POWER8/9 constant used by TimeDeltaSec.  */
+      if (tb_freq == 0.0)
+	tb_freq = 512000000.0;
+    }
+  return tb_freq;
+}
+
+static void
+vec_bench_usage (const char *prog)
+{
+  printf ("usage: %s [options] [filter ...]\n"
+	  "  --csv            print results as CSV\n"
+	  "  --json           print results as a JSON array\n"
+	  "  --list           list the selected cases and exit\n"
+	  "  --isa            time each -mcpu= runtime variant the CPU supports\n"
+	  "  --lat            latency/throughput of inline ops per -mcpu= target\n"
+	  "  --pmu            add perf_event_open hardware counters per element\n"
+	  "  --warmup=N       untimed calls before measuring (default 2)\n"
+	  "  --samples=MIN,MAX  sample count bounds (default 10,1000)\n"
+	  "  --min-time=SEC   minimum measuring time per case (default 0.1)\n"
+	  "  filter           run cases whose group/name contains filter\n",
+	  prog);
+}
+
+int
+vec_bench_parse_args (vec_bench_opts_t *opts, int argc, char **argv)
+{
+  int i;
+
+  opts->format = VEC_BENCH_TEXT;
+  opts->filters = NULL;
+  opts->nfilters = 0;
+  opts->list_only = 0;
+  opts->isa_mode = 0;
+  opts->lat_mode = 0;
+  opts->pmu = 0;
+  opts->warmup = 2;
+  opts->min_samples = 10;
+  opts->max_samples = 1000;
+  opts->min_time = 0.1;
+  /* About 100us per sample, so timebase granularity is < 0.02%.  */
+  opts->min_sample = (uint64_t) (vec_bench_tb_freq () / 10000.0);
+
+  for (i = 1; i < argc; i++)
+    {
+      char *arg = argv[i];
+
+      if (strncmp (arg, "--", 2) != 0)
+	{
+	  /* Filters are the trailing non-option arguments.  */
+	  if (opts->filters == NULL)
+	    opts->filters = &argv[i];
+	  else if (opts->filters + opts->nfilters != &argv[i])
+	    {
+	      vec_bench_usage (argv[0]);
+	      return -1;
+	    }
+	  opts->nfilters++;
+	}
+      else if (strcmp (arg, "--csv") == 0)
+	opts->format = VEC_BENCH_CSV;
+      else if (strcmp (arg, "--json") == 0)
+	opts->format = VEC_BENCH_JSON;
+      else if (strcmp (arg, "--list") == 0)
+	opts->list_only = 1;
+      else if (strcmp (arg, "--isa") == 0)
+	opts->isa_mode = 1;
+      else if (strcmp (arg, "--lat") == 0)
+	opts->lat_mode = 1;
+      else if (strcmp (arg, "--pmu") == 0)
+	opts->pmu = 1;
+      else if (sscanf (arg, "--warmup=%u", &opts->warmup) == 1)
+	;
+      else if (sscanf (arg, "--samples=%u,%u", &opts->min_samples,
+		       &opts->max_samples) == 2)
+	;
+      else if (sscanf (arg, "--min-time=%lf", &opts->min_time) == 1)
+	;
+      else if (strcmp (arg, "--help") == 0)
+	{
+	  vec_bench_usage (argv[0]);
+	  return 1;
+	}
+      else
+	{
+	  vec_bench_usage (argv[0]);
+	  return -1;
+	}
+    }
+
+  if (opts->max_samples > VEC_BENCH_MAX_SAMPLES)
+    opts->max_samples = VEC_BENCH_MAX_SAMPLES;
+  if (opts->min_samples < 1)
+    opts->min_samples = 1;
+  if (opts->min_samples > opts->max_samples)
+    opts->min_samples = opts->max_samples;
+
+  return 0;
+}
+
+void
+vec_bench_begin (const vec_bench_opts_t *opts)
+{
+  int i;
+
+  if (opts->list_only)
+    return;
+
+  switch (opts->format)
+    {
+    case VEC_BENCH_CSV:
+      printf ("group,name,elements,batch,samples,median_tb,p99_tb,"
+	      "mean_tb,stddev_tb,tb_per_elem,ns_per_elem");
+      if (opts->pmu)
+	{
+	  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+	    printf (",%s_per_elem", vec_pmu_names[i]);
+	  printf (",ipc");
+	}
+      printf ("\n");
+      break;
+    case VEC_BENCH_JSON:
+      printf ("[");
+      vec_bench_json_first = 1;
+      break;
+    default:
+      printf ("\ntimebase %.0f Hz\n", vec_bench_tb_freq ());
+      printf ("%-32s %8s %12s %12s %8s %12s %12s\n", "case", "samples",
+	      "median tb", "p99 tb", "cv%", "tb/elem", "ns/elem");
+      if (opts->pmu)
+	{
+	  printf ("%-32s", "  per element:");
+	  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+	    printf (" %12s", vec_pmu_names[i]);
+	  printf (" %8s\n", "ipc");
+	}
+      break;
+    }
+}
+
+void
+vec_bench_end (const vec_bench_opts_t *opts)
+{
+  if (!opts->list_only && opts->format == VEC_BENCH_JSON)
+    printf ("\n]\n");
+  if (vec_bench_pmu_opened)
+    {
+      vec_pmu_close (&vec_bench_pmu);
+      vec_bench_pmu_opened = 0;
+    }
+}
+
+/* Count hardware events over min_samples batches of calls.  */
+static int
+vec_bench_count (const vec_bench_opts_t *opts, const vec_bench_t *bench,
+		 vec_bench_stats_t *stats)
+{
+  uint64_t counts[VEC_PMU_NEVENTS];
+  double calls;
+  unsigned long b;
+  unsigned int i;
+  int rc_timed = 0;
+
+  stats->pmu_valid = 0;
+  if (!vec_bench_pmu_opened)
+    {
+      vec_bench_pmu_opened = 1;
+      if (vec_pmu_open (&vec_bench_pmu) == 0)
+	fprintf (stderr, "perf_event_open failed, check "
+		 "/proc/sys/kernel/perf_event_paranoid\n");
+    }
+  if (vec_bench_pmu.valid == 0)
+    return 0;
+
+  vec_pmu_start (&vec_bench_pmu);
+  for (i = 0; i < opts->min_samples; i++)
+    for (b = 0; b < stats->batch; b++)
+      rc_timed |= bench->fn ();
+  vec_pmu_stop (&vec_bench_pmu, counts);
+
+  calls = (double) opts->min_samples * (double) stats->batch
+	  * ((bench->elements != 0) ? (double) bench->elements : 1.0);
+  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+    stats->pmu[i] = (double) counts[i] / calls;
+  stats->pmu_valid = vec_bench_pmu.valid;
+
+  return rc_timed;
+}
+
+int
+vec_bench_match (const vec_bench_opts_t *opts, const vec_bench_t *bench)
+{
+  char full[128];
+  int i;
+
+  if (opts->nfilters == 0)
+    return 1;
+
+  snprintf (full, sizeof (full), "%s/%s", bench->group, bench->name);
+  for (i = 0; i < opts->nfilters; i++)
+    {
+      if (strstr (full, opts->filters[i]) != NULL)
+	return 1;
+    }
+  return 0;
+}
+
+/* Shell sort, the sample count is small.  */
+static void
+vec_bench_sort (uint64_t *a, unsigned int n)
+{
+  unsigned int gap, i, j;
+
+  for (gap = n / 2; gap > 0; gap /= 2)
+    for (i = gap; i < n; i++)
+      {
+	uint64_t t = a[i];
+	for (j = i; j >= gap && a[j - gap] > t; j -= gap)
+	  a[j] = a[j - gap];
+	a[j] = t;
+      }
+}
+
+int
+vec_bench_measure (const vec_bench_opts_t *opts, const vec_bench_t *bench,
+		   vec_bench_stats_t *stats)
+{
+  uint64_t t_start, t_end, t_total, t_limit;
+  unsigned long batch, b;
+  unsigned int i, n;
+  double sum, sumsq, mean;
+  int rc = 0, rc_timed = 0;
+
+  if (bench->setup)
+    rc += bench->setup ();
+
+  for (i = 0; i < opts->warmup || i == 0; i++)
+    rc += bench->fn ();
+
+  /* Calibrate the batch size so one sample spans min_sample ticks.  */
+  batch = 1;
+  for (;;)
+    {
+      t_start = __builtin_ppc_get_timebase ();
+      for (b = 0; b < batch; b++)
+	rc_timed |= bench->fn ();
+      t_end = __builtin_ppc_get_timebase ();
+      if ((t_end - t_start) >= opts->min_sample || batch >= (1UL << 30))
+	break;
+      batch *= 2;
+    }
+
+  t_limit = (uint64_t) (opts->min_time * vec_bench_tb_freq ());
+  t_total = 0;
+  for (n = 0; n < opts->max_samples; n++)
+    {
+      if (n >= opts->min_samples && t_total >= t_limit)
+	break;
+      t_start = __builtin_ppc_get_timebase ();
+      for (b = 0; b < batch; b++)
+	rc_timed |= bench->fn ();
+      t_end = __builtin_ppc_get_timebase ();
+      vec_bench_samples[n] = t_end - t_start;
+      t_total += t_end - t_start;
+    }
+
+  vec_bench_sort (vec_bench_samples, n);
+  sum = 0.0;
+  sumsq = 0.0;
+  for (i = 0; i < n; i++)
+    {
+      double x = (double) vec_bench_samples[i] / (double) batch;
+      sum += x;
+      sumsq += x * x;
+    }
+  mean = sum / n;
+
+  stats->batch = batch;
+  stats->samples = n;
+  stats->mean = mean;
+  stats->stddev = 0.0;
+  if (n > 1 && (sumsq - sum * mean) > 0.0)
+    stats->stddev = sqrt ((sumsq - sum * mean) / (n - 1));
+  if (n & 1)
+    stats->median = (double) vec_bench_samples[n / 2] / (double) batch;
+  else
+    stats->median = ((double) vec_bench_samples[n / 2 - 1]
+		     + (double) vec_bench_samples[n / 2])
+		    / (2.0 * (double) batch);
+  stats->p99 = (double) vec_bench_samples[(n * 99 - 1) / 100]
+	       / (double) batch;
+
+  stats->pmu_valid = 0;
+  if (opts->pmu)
+    rc_timed |= vec_bench_count (opts, bench, stats);
+
+  if (rc_timed)
+    rc++;
+  return rc;
+}
+
+void
+vec_bench_report (const vec_bench_opts_t *opts, const vec_bench_t *bench,
+		  const vec_bench_stats_t *stats)
+{
+  double elems = (bench->elements != 0) ? (double) bench->elements : 1.0;
+  double tb_elem = stats->median / elems;
+  double ns_elem = tb_elem * 1.0e9 / vec_bench_tb_freq ();
+  double cv = (stats->mean > 0.0) ? 100.0 * stats->stddev / stats->mean : 0.0;
+  double ipc = 0.0;
+  char full[128];
+  int i;
+
+  if ((stats->pmu_valid & (1U << VEC_PMU_CYCLES))
+      && (stats->pmu_valid & (1U << VEC_PMU_INSTRUCTIONS))
+      && stats->pmu[VEC_PMU_CYCLES] > 0.0)
+    ipc = stats->pmu[VEC_PMU_INSTRUCTIONS] / stats->pmu[VEC_PMU_CYCLES];
+
+  switch (opts->format)
+    {
+    case VEC_BENCH_CSV:
+      printf ("%s,%s,%lu,%lu,%u,%.3f,%.3f,%.3f,%.3f,%.4f,%.4f",
+	      bench->group, bench->name, bench->elements, stats->batch,
+	      stats->samples, stats->median, stats->p99, stats->mean,
+	      stats->stddev, tb_elem, ns_elem);
+      if (opts->pmu)
+	{
+	  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+	    {
+	      if (stats->pmu_valid & (1U << i))
+		printf (",%.4f", stats->pmu[i]);
+	      else
+		printf (",");
+	    }
+	  printf (",%.3f", ipc);
+	}
+      printf ("\n");
+      break;
+    case VEC_BENCH_JSON:
+      printf ("%s\n  {\"group\": \"%s\", \"name\": \"%s\", \"elements\": %lu,"
+	      " \"batch\": %lu, \"samples\": %u, \"median_tb\": %.3f,"
+	      " \"p99_tb\": %.3f, \"mean_tb\": %.3f, \"stddev_tb\": %.3f,"
+	      " \"tb_per_elem\": %.4f, \"ns_per_elem\": %.4f",
+	      vec_bench_json_first ? "" : ",", bench->group, bench->name,
+	      bench->elements, stats->batch, stats->samples, stats->median,
+	      stats->p99, stats->mean, stats->stddev, tb_elem, ns_elem);
+      for (i = 0; i < VEC_PMU_NEVENTS; i++)
+	{
+	  if (stats->pmu_valid & (1U << i))
+	    printf (", \"%s_per_elem\": %.4f", vec_pmu_names[i],
+		    stats->pmu[i]);
+	}
+      if (stats->pmu_valid)
+	printf (", \"ipc\": %.3f", ipc);
+      printf ("}");
+      vec_bench_json_first = 0;
+      break;
+    default:
+      snprintf (full, sizeof (full), "%s/%s", bench->group, bench->name);
+      printf ("%-32s %8u %12.3f %12.3f %8.2f %12.4f %12.4f\n", full,
+	      stats->samples, stats->median, stats->p99, cv, tb_elem,
+	      ns_elem);
+      if (stats->pmu_valid)
+	{
+	  printf ("%-32s", "");
+	  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+	    {
+	      if (stats->pmu_valid & (1U << i))
+		printf (" %12.4f", stats->pmu[i]);
+	      else
+		printf (" %12s", "-");
+	    }
+	  printf (" %8.3f\n", ipc);
+	}
+      break;
+    }
+  fflush (stdout);
+}
+
+int
+vec_bench_run (const vec_bench_opts_t *opts, const vec_bench_t *table,
+	       unsigned long n)
+{
+  vec_bench_stats_t stats;
+  unsigned long i;
+  int rc = 0, rc_case;
+
+  for (i = 0; i < n; i++)
+    {
+      if (!vec_bench_match (opts, &table[i]))
+	continue;
+
+      if (opts->list_only)
+	{
+	  printf ("%s/%s\n", table[i].group, table[i].name);
+	  continue;
+	}
+
+      rc_case = vec_bench_measure (opts, &table[i], &stats);
+      vec_bench_report (opts, &table[i], &stats);
+      if (rc_case)
+	fprintf (stderr, "%s/%s: %d failures\n", table[i].group,
+		 table[i].name, rc_case);
+      rc += rc_case;
+    }
+
+  return rc;
+}
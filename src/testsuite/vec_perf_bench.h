@@ -0,0 +1,126 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_bench.h
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_BENCH_H_
+#define SRC_TESTSUITE_VEC_PERF_BENCH_H_
+
+#include <stdint.h>
+
+#include <testsuite/vec_perf_pmu.h>
+
+/* Benchmark registry used by pveclib_perf.
+ *
+ * Each timed_* case is described by a vec_bench_t table entry. The
+ * driver runs warmup calls, calibrates a batch size so that one
+ * sample spans at least min_sample timebase ticks, then collects
+ * samples until min_time seconds or max_samples is reached. Results
+ * are reported as median, p99, mean and standard deviation, in
+ * timebase ticks and nanoseconds per element.  */
+
+typedef enum
+{
+  VEC_BENCH_TEXT = 0,
+  VEC_BENCH_CSV,
+  VEC_BENCH_JSON
+} vec_bench_format_t;
+
+typedef struct
+{
+  /* Group name, for example "i512".  */
+  const char *group;
+  /* Case name, for example "mul512x512".  */
+  const char *name;
+  /* Timed function, returns the number of check failures.  */
+  int (*fn) (void);
+  /* Optional untimed setup called once before warmup, or NULL.  */
+  int (*setup) (void);
+  /* Operations (elements) performed per call of fn.  */
+  unsigned long elements;
+} vec_bench_t;
+
+typedef struct
+{
+  vec_bench_format_t format;
+  /* Run only cases whose "group/name" contains one of the filters.  */
+  char **filters;
+  int nfilters;
+  /* List matching cases without running them.  */
+  int list_only;
+  /* Time each compiled -mcpu= variant (see vec_perf_isa.c).  */
+  int isa_mode;
+  /* Time the inline operations per -mcpu= target (see vec_perf_lat.c).  */
+  int lat_mode;
+  /* Collect hardware counters (see vec_perf_pmu.c).  */
+  int pmu;
+  unsigned int warmup;
+  unsigned int min_samples;
+  unsigned int max_samples;
+  double min_time;
+  uint64_t min_sample;
+} vec_bench_opts_t;
+
+typedef struct
+{
+  /* Per call statistics in timebase ticks.  */
+  double median;
+  double p99;
+  double mean;
+  double stddev;
+  unsigned long batch;
+  unsigned int samples;
+  /* Hardware counter events per element, valid for the events set in
+   * pmu_valid. Collected in a separate pass after the timed samples,
+   * so counting does not perturb the timing.  */
+  unsigned int pmu_valid;
+  double pmu[VEC_PMU_NEVENTS];
+} vec_bench_stats_t;
+
+/* Parse command line options into opts. Returns 0 on success,
+ * 1 if --help was requested, and -1 for invalid options.  */
+extern int vec_bench_parse_args (vec_bench_opts_t *opts, int argc,
+				 char **argv);
+/* Print the output prologue (CSV header or JSON array open).  */
+extern void vec_bench_begin (const vec_bench_opts_t *opts);
+/* Print the output epilogue (JSON array close).  */
+extern void vec_bench_end (const vec_bench_opts_t *opts);
+/* Return nonzero if the case is selected by the opts filters.  */
+extern int vec_bench_match (const vec_bench_opts_t *opts,
+			    const vec_bench_t *bench);
+/* Measure a single case. Returns the failures from the warmup calls
+ * plus 1 if any timed call reported failures.  */
+extern int vec_bench_measure (const vec_bench_opts_t *opts,
+			      const vec_bench_t *bench,
+			      vec_bench_stats_t *stats);
+/* Print one result line in the opts format.  */
+extern void vec_bench_report (const vec_bench_opts_t *opts,
+			      const vec_bench_t *bench,
+			      const vec_bench_stats_t *stats);
+/* Run and report all selected cases of table[0..n-1].
+ * Returns the accumulated failure count.  */
+extern int vec_bench_run (const vec_bench_opts_t *opts,
+			  const vec_bench_t *table, unsigned long n);
+/* Timebase frequency in Hz.  */
+extern double vec_bench_tb_freq (void);
+
+#define VEC_BENCH_COUNT(_table) (sizeof (_table) / sizeof (_table[0]))
+
+#endif /* SRC_TESTSUITE_VEC_PERF_BENCH_H_ */
@@ -0,0 +1,401 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_cmp.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Head to head timing of pveclib against GMP and libquadmath.
+ *
+ * pveclib_perf_cmp is only built when configure finds GMP
+ * (PVECLIB_HAVE_GMP) and/or libquadmath (PVECLIB_HAVE_QUADMATH).
+ *
+ * - vec_mul512_byMN() (and the fixed size vec_mul512x512(),
+ *   vec_mul1024x1024(), vec_mul2048x2048()) against mpn_mul_n()
+ *   for equal length operands from 512 to 65536 bits.
+ * - vec_xsaddqpo(), vec_xsmulqpo(), vec_xsdivqpo() and
+ *   vec_xsmaddqpo() against the compiler __float128 operations
+ *   (libgcc soft-float on POWER8, xsaddqp etc on POWER9) and the
+ *   libquadmath fmaq().
+ *
+ * The operands are the same bits for both sides. On little endian,
+ * with 64-bit limbs, the __VEC_U_512 arrays have the same layout as
+ * the GMP limb arrays, so each pveclib product is also checked
+ * against the mpn_mul_n product before it is timed. On big endian
+ * the layouts differ and only timing is compared.
+ * Note the pveclib f128 operations round to odd, the __float128
+ * operations round to nearest.
+ *
+ * In text mode a crossover chart follows the results, showing the
+ * GMP/pveclib time ratio for each operand size.  */
+
+#ifndef PVECLIB_DISABLE_F128MATH
+#include <stdlib.h>
+#else
+#define EXIT_SUCCESS 0
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_f128_ppc.h>
+
+#ifdef PVECLIB_HAVE_GMP
+#include <gmp.h>
+#endif
+#if defined (PVECLIB_HAVE_QUADMATH) && !defined (PVECLIB_DISABLE_F128ARITH)
+#include <quadmath.h>
+#endif
+
+#include <testsuite/vec_perf_bench.h>
+
+static vec_bench_opts_t cmp_opts;
+
+/* Width of the crossover chart bars, for a ratio of 2.0.  */
+#define CMP_CHART_WIDTH 40
+
+/* Print one chart row: ratio > 1.0 means pveclib is faster. The
+ * bar is centered on '|' (equal time).  */
+static void
+cmp_chart_row (const char *label, double t_vec, double t_ref)
+{
+  double ratio;
+  int i, len;
+
+  if (t_vec <= 0.0 || t_ref <= 0.0)
+    return;
+
+  ratio = t_ref / t_vec;
+  len = (int) ((ratio - 1.0) * (CMP_CHART_WIDTH / 2));
+  if (len > CMP_CHART_WIDTH / 2)
+    len = CMP_CHART_WIDTH / 2;
+  if (len < -(CMP_CHART_WIDTH / 2))
+    len = -(CMP_CHART_WIDTH / 2);
+
+  printf ("%-16s %7.2f ", label, ratio);
+  for (i = -(CMP_CHART_WIDTH / 2); i < 0; i++)
+    putchar ((len < 0 && i >= len) ? '<' : ' ');
+  putchar ('|');
+  for (i = 1; i <= len; i++)
+    putchar ('>');
+  putchar ('\n');
+}
+
+/* Measure bench (if selected) and return nanoseconds per call,
+ * 0.0 if not selected.  */
+static double
+cmp_measure (vec_bench_t *bench, int *rc)
+{
+  vec_bench_stats_t stats;
+
+  if (!vec_bench_match (&cmp_opts, bench))
+    return 0.0;
+  if (cmp_opts.list_only)
+    {
+      printf ("%s/%s\n", bench->group, bench->name);
+      return 0.0;
+    }
+
+  *rc += vec_bench_measure (&cmp_opts, bench, &stats);
+  vec_bench_report (&cmp_opts, bench, &stats);
+  return (stats.median * 1.0e9) / vec_bench_tb_freq ();
+}
+
+#ifdef PVECLIB_HAVE_GMP
+/* Operand sizes in 512-bit units, 512 to 65536 bits.  */
+static const unsigned long cmp_sizes[] =
+  { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128 };
+#define CMP_NSIZES (sizeof (cmp_sizes) / sizeof (cmp_sizes[0]))
+#define CMP_MAX512 128
+#define CMP_LIMBS512 (512 / GMP_NUMB_BITS)
+
+static __VEC_U_512 cmp_m1[CMP_MAX512], cmp_m2[CMP_MAX512];
+static __VEC_U_512 cmp_p[CMP_MAX512 * 2];
+static mp_limb_t cmp_a[CMP_MAX512 * CMP_LIMBS512];
+static mp_limb_t cmp_b[CMP_MAX512 * CMP_LIMBS512];
+static mp_limb_t cmp_r[CMP_MAX512 * CMP_LIMBS512 * 2];
+/* Current operand size in 512-bit units.  */
+static unsigned long cmp_n;
+
+static int
+cmp_mul512_byMN (void)
+{
+  __VEC_PWR_IMP (vec_mul512_byMN) (cmp_p, cmp_m1, cmp_m2, cmp_n, cmp_n);
+  return 0;
+}
+
+static int
+cmp_mpn_mul_n (void)
+{
+  mpn_mul_n (cmp_r, cmp_a, cmp_b, cmp_n * CMP_LIMBS512);
+  return 0;
+}
+
+static int
+cmp_mul512x512 (void)
+{
+  __VEC_U_1024 *p = (__VEC_U_1024 *) cmp_p;
+
+  *p = __VEC_PWR_IMP (vec_mul512x512) (cmp_m1[0], cmp_m2[0]);
+  return 0;
+}
+
+static int
+cmp_mul1024x1024 (void)
+{
+  __VEC_PWR_IMP (vec_mul1024x1024) ((__VEC_U_2048 *) cmp_p,
+				    (__VEC_U_1024 *) cmp_m1,
+				    (__VEC_U_1024 *) cmp_m2);
+  return 0;
+}
+
+static int
+cmp_mul2048x2048 (void)
+{
+  __VEC_PWR_IMP (vec_mul2048x2048) ((__VEC_U_4096 *) cmp_p,
+				    (__VEC_U_2048 *) cmp_m1,
+				    (__VEC_U_2048 *) cmp_m2);
+  return 0;
+}
+
+/* Check the product of fn against mpn_mul_n for the current size.
+ * The two product buffers are cleared to different values first, so
+ * a kernel that does not store can not match.  */
+static int
+cmp_check_mul (const char *name, int (*fn) (void))
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ && GMP_NUMB_BITS == 64
+  size_t len = cmp_n * 2 * sizeof (__VEC_U_512);
+
+  memset (cmp_p, 0, len);
+  memset (cmp_r, 0xff, len);
+  fn ();
+  cmp_mpn_mul_n ();
+  if (memcmp (cmp_p, cmp_r, len) != 0)
+    {
+      printf ("%s: product differs from mpn_mul_n\n", name);
+      return 1;
+    }
+#else
+  (void) name;
+  (void) fn;
+#endif
+  return 0;
+}
+
+static void
+cmp_init_mul (void)
+{
+  uint64_t x = 0x9e3779b97f4a7c15UL;
+  unsigned long i;
+
+  for (i = 0; i < (CMP_MAX512 * CMP_LIMBS512); i++)
+    {
+      x = x * 6364136223846793005UL + 1442695040888963407UL;
+      cmp_a[i] = (mp_limb_t) x;
+      x = x * 6364136223846793005UL + 1442695040888963407UL;
+      cmp_b[i] = (mp_limb_t) x;
+    }
+  memcpy (cmp_m1, cmp_a, sizeof (cmp_m1));
+  memcpy (cmp_m2, cmp_b, sizeof (cmp_m2));
+}
+
+static int
+test_cmp_gmp (void)
+{
+  static double t_vec[CMP_NSIZES], t_gmp[CMP_NSIZES];
+  static double t_fixed[3], t_fixed_gmp[3];
+  static const char *fixed_names[3] =
+    { "mul512x512", "mul1024x1024", "mul2048x2048" };
+  static int (*fixed_fn[3]) (void) =
+    { cmp_mul512x512, cmp_mul1024x1024, cmp_mul2048x2048 };
+  static const unsigned long fixed_n[3] = { 1, 2, 4 };
+  char name[64], label[32];
+  vec_bench_t bench;
+  unsigned long i, j, crossover = 0;
+  int rc = 0;
+
+  cmp_init_mul ();
+  bench.group = "gmp";
+  bench.name = name;
+  bench.setup = NULL;
+  bench.elements = 1;
+
+  for (i = 0; i < CMP_NSIZES; i++)
+    {
+      cmp_n = cmp_sizes[i];
+      snprintf (name, sizeof (name), "vec_mul512_byMN_%lu",
+		cmp_n * 512);
+      bench.fn = cmp_mul512_byMN;
+      if (!cmp_opts.list_only)
+	rc += cmp_check_mul (name, bench.fn);
+      t_vec[i] = cmp_measure (&bench, &rc);
+      snprintf (name, sizeof (name), "mpn_mul_n_%lu", cmp_n * 512);
+      bench.fn = cmp_mpn_mul_n;
+      t_gmp[i] = cmp_measure (&bench, &rc);
+    }
+
+  /* The fixed sizes are all in cmp_sizes, so compare them with the
+   * mpn_mul_n times already measured for those sizes.  */
+  for (i = 0; i < 3; i++)
+    {
+      cmp_n = fixed_n[i];
+      snprintf (name, sizeof (name), "vec_%s", fixed_names[i]);
+      bench.fn = fixed_fn[i];
+      if (!cmp_opts.list_only)
+	rc += cmp_check_mul (name, bench.fn);
+      t_fixed[i] = cmp_measure (&bench, &rc);
+      t_fixed_gmp[i] = 0.0;
+      for (j = 0; j < CMP_NSIZES; j++)
+	{
+	  if (cmp_sizes[j] == cmp_n)
+	    t_fixed_gmp[i] = t_gmp[j];
+	}
+    }
+
+  if (cmp_opts.list_only || cmp_opts.format != VEC_BENCH_TEXT)
+    return rc;
+
+  printf ("\nmpn_mul_n time / pveclib time (> 1.0 pveclib faster)\n");
+  for (i = 0; i < CMP_NSIZES; i++)
+    {
+      snprintf (label, sizeof (label), "%lu bits", cmp_sizes[i] * 512);
+      cmp_chart_row (label, t_vec[i], t_gmp[i]);
+      if (crossover == 0 && t_vec[i] > 0.0 && t_gmp[i] > 0.0
+	  && t_gmp[i] < t_vec[i])
+	crossover = cmp_sizes[i] * 512;
+    }
+  for (i = 0; i < 3; i++)
+    cmp_chart_row (fixed_names[i], t_fixed[i], t_fixed_gmp[i]);
+
+  if (crossover != 0)
+    printf ("crossover: GMP faster from %lu bits\n", crossover);
+  else
+    printf ("crossover: pveclib faster at all sizes measured\n");
+
+  return rc;
+}
+#endif
+
+#if defined (PVECLIB_HAVE_QUADMATH) && !defined (PVECLIB_DISABLE_F128ARITH)
+extern __binary128 __VEC_PWR_IMP (vec_xsdivqpo) (__binary128 vfa,
+						 __binary128 vfb);
+
+/* Operations per timed call.  */
+#define CMP_F128_N 16
+
+static __binary128 cmp_qa[CMP_F128_N], cmp_qb[CMP_F128_N];
+static __binary128 cmp_qc[CMP_F128_N], cmp_qr[CMP_F128_N];
+
+#define CMP_F128_KERNEL(_NAME, _EXPR) \
+static int \
+cmp_ ## _NAME (void) \
+{ \
+  int i; \
+\
+  for (i = 0; i < CMP_F128_N; i++) \
+    cmp_qr[i] = _EXPR; \
+  return 0; \
+}
+
+CMP_F128_KERNEL (vec_addqpo,
+		 __VEC_PWR_IMP (vec_xsaddqpo) (cmp_qa[i], cmp_qb[i]))
+CMP_F128_KERNEL (vec_mulqpo,
+		 __VEC_PWR_IMP (vec_xsmulqpo) (cmp_qa[i], cmp_qb[i]))
+CMP_F128_KERNEL (vec_divqpo,
+		 __VEC_PWR_IMP (vec_xsdivqpo) (cmp_qa[i], cmp_qb[i]))
+CMP_F128_KERNEL (vec_maddqpo,
+		 __VEC_PWR_IMP (vec_xsmaddqpo) (cmp_qa[i], cmp_qb[i],
+						cmp_qc[i]))
+CMP_F128_KERNEL (gcc_addqpn, cmp_qa[i] + cmp_qb[i])
+CMP_F128_KERNEL (gcc_mulqpn, cmp_qa[i] * cmp_qb[i])
+CMP_F128_KERNEL (gcc_divqpn, cmp_qa[i] / cmp_qb[i])
+CMP_F128_KERNEL (quad_fmaq, fmaq (cmp_qa[i], cmp_qb[i], cmp_qc[i]))
+
+static int
+test_cmp_f128 (void)
+{
+  static const char *op_names[4] = { "addqp", "mulqp", "divqp", "maddqp" };
+  static int (*vec_fn[4]) (void) =
+    { cmp_vec_addqpo, cmp_vec_mulqpo, cmp_vec_divqpo, cmp_vec_maddqpo };
+  static int (*ref_fn[4]) (void) =
+    { cmp_gcc_addqpn, cmp_gcc_mulqpn, cmp_gcc_divqpn, cmp_quad_fmaq };
+  static const char *ref_names[4] =
+    { "gcc_addqpn", "gcc_mulqpn", "gcc_divqpn", "quadmath_fmaq" };
+  double t_vec[4], t_ref[4];
+  char name[64];
+  vec_bench_t bench;
+  int i, rc = 0;
+
+  for (i = 0; i < CMP_F128_N; i++)
+    {
+      cmp_qa[i] = (__binary128) (1.0 + (double) i / 3.0);
+      cmp_qb[i] = (__binary128) (3.0 - (double) i / 7.0);
+      cmp_qc[i] = (__binary128) ((double) i * 0.1);
+    }
+
+  bench.group = "quadmath";
+  bench.name = name;
+  bench.setup = NULL;
+  bench.elements = CMP_F128_N;
+
+  for (i = 0; i < 4; i++)
+    {
+      snprintf (name, sizeof (name), "vec_%so", op_names[i]);
+      bench.fn = vec_fn[i];
+      t_vec[i] = cmp_measure (&bench, &rc);
+      snprintf (name, sizeof (name), "%s", ref_names[i]);
+      bench.fn = ref_fn[i];
+      t_ref[i] = cmp_measure (&bench, &rc);
+    }
+
+  if (cmp_opts.list_only || cmp_opts.format != VEC_BENCH_TEXT)
+    return rc;
+
+  printf ("\n__float128 time / pveclib time (> 1.0 pveclib faster)\n");
+  for (i = 0; i < 4; i++)
+    cmp_chart_row (op_names[i], t_vec[i], t_ref[i]);
+
+  return rc;
+}
+#endif
+
+int
+main (int argc, char **argv)
+{
+  int rc;
+
+  rc = vec_bench_parse_args (&cmp_opts, argc, argv);
+  if (rc != 0)
+    return (rc < 0) ? 2 : EXIT_SUCCESS;
+
+  if (cmp_opts.format == VEC_BENCH_TEXT && !cmp_opts.list_only)
+    puts ("Power Vector comparison to GMP and libquadmath");
+
+  vec_bench_begin (&cmp_opts);
+#ifdef PVECLIB_HAVE_GMP
+  rc += test_cmp_gmp ();
+#endif
+#if defined (PVECLIB_HAVE_QUADMATH) && !defined (PVECLIB_DISABLE_F128ARITH)
+  rc += test_cmp_f128 ();
+#endif
+  vec_bench_end (&cmp_opts);
+
+  return (rc);
+}
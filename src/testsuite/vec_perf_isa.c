@@ -0,0 +1,542 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_isa.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Per -mcpu= variant timing for the runtime library.
+ *
+ * libpvecstatic contains each runtime function compiled for every
+ * supported target (vec_mul512x512_PWR8, vec_mul512x512_PWR9, ...).
+ * The normal perf cases only time the __VEC_PWR_IMP variant matching
+ * the perf program's own -mcpu=. Here each kernel calls the variants
+ * directly through a function pointer, for every variant the running
+ * CPU supports, then prints a speedup matrix relative to the oldest
+ * supported variant.  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_f128_ppc.h>
+
+#include <testsuite/vec_perf_bench.h>
+#include <testsuite/vec_perf_isa.h>
+
+/* Externs for the target qualified runtime functions timed here.
+ * This matches the lists in vec_runtime_DYN.c.  */
+#define VEC_ISA_LIB_LIST(_TARGET) \
+extern __VEC_U_256 vec_mul128x128 ## _TARGET (vui128_t, vui128_t); \
+extern __VEC_U_512 vec_mul256x256 ## _TARGET (__VEC_U_256, __VEC_U_256); \
+extern __VEC_U_1024 vec_mul512x512 ## _TARGET (__VEC_U_512, __VEC_U_512); \
+extern void vec_mul1024x1024 ## _TARGET (__VEC_U_2048 *, __VEC_U_1024 *, __VEC_U_1024 *); \
+extern void vec_mul2048x2048 ## _TARGET (__VEC_U_4096 *, __VEC_U_2048 *, __VEC_U_2048 *); \
+extern void vec_mul512_byMN ## _TARGET (__VEC_U_512 *p, \
+                  __VEC_U_512 *m1, __VEC_U_512 *m2, \
+		  unsigned long M, unsigned long N); \
+extern __VEC_U_128RQ vec_divdqu ## _TARGET (vui128_t, vui128_t, vui128_t); \
+extern vui128_t vec_divuq ## _TARGET (vui128_t, vui128_t); \
+extern vui64_t vec_divud ## _TARGET (vui64_t, vui64_t); \
+extern __binary128 vec_xsaddqpo ## _TARGET (__binary128, __binary128); \
+extern __binary128 vec_xsmulqpo ## _TARGET (__binary128, __binary128); \
+extern __binary128 vec_xsdivqpo ## _TARGET (__binary128, __binary128); \
+extern __binary128 vec_xsmaddqpo ## _TARGET (__binary128, __binary128, __binary128); \
+extern vf64_t vec_xscvqpdpo ## _TARGET (__binary128); \
+extern void vec_gemm_s8 ## _TARGET (int *, unsigned long, const signed char *, \
+		  const unsigned char *, unsigned long, unsigned long, \
+		  unsigned long, int); \
+extern void vec_gemm_s16 ## _TARGET (int *, unsigned long, const short *, \
+		  const short *, unsigned long, unsigned long, \
+		  unsigned long, int);
+
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_ISA_LIB_LIST (_PWR7)
+#define VEC_ISA_PWR7(_F) (vec_isa_fn_t) _F ## _PWR7
+#else
+#define VEC_ISA_PWR7(_F) NULL
+#endif
+
+VEC_ISA_LIB_LIST (_PWR8)
+#define VEC_ISA_PWR8(_F) (vec_isa_fn_t) _F ## _PWR8
+
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_ISA_LIB_LIST (_PWR9)
+#define VEC_ISA_PWR9(_F) (vec_isa_fn_t) _F ## _PWR9
+#else
+#define VEC_ISA_PWR9(_F) NULL
+#endif
+
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_ISA_LIB_LIST (_PWR10)
+#define VEC_ISA_PWR10(_F) (vec_isa_fn_t) _F ## _PWR10
+#else
+#define VEC_ISA_PWR10(_F) NULL
+#endif
+
+typedef void (*vec_isa_fn_t) (void);
+
+#define VEC_ISA_VARIANTS(_F) \
+  { VEC_ISA_PWR7(_F), VEC_ISA_PWR8(_F), VEC_ISA_PWR9(_F), VEC_ISA_PWR10(_F) }
+
+#define VEC_ISA_NVARIANTS 4
+
+static const char *vec_isa_names[VEC_ISA_NVARIANTS] =
+  { "PWR7", "PWR8", "PWR9", "PWR10" };
+
+/* The variant the kernels call, set before each measurement.  */
+static vec_isa_fn_t isa_fn;
+
+/* Results are stored here so the calls are not dead.  */
+static __VEC_U_4096 isa_sink;
+static __VEC_U_512 isa_m512[16], isa_p512[32];
+
+/* Packed 64x64 GEMM operands, see isa_gemm_s8.  */
+#define ISA_GEMM_N 64
+static signed char isa_gemm_pa8[ISA_GEMM_N * ISA_GEMM_N + 4 * ISA_GEMM_N];
+static unsigned char isa_gemm_pb8[ISA_GEMM_N * ISA_GEMM_N];
+static short isa_gemm_pa16[ISA_GEMM_N * ISA_GEMM_N];
+static short isa_gemm_pb16[ISA_GEMM_N * ISA_GEMM_N];
+static int isa_gemm_c[ISA_GEMM_N * ISA_GEMM_N];
+
+static int
+isa_mul128x128 (void)
+{
+  __VEC_U_256 (*fn) (vui128_t, vui128_t) =
+      (__VEC_U_256 (*) (vui128_t, vui128_t)) isa_fn;
+  vui128_t i = (vui128_t) ((unsigned __int128) 10);
+  __VEC_U_256 k;
+  int n;
+
+  for (n = 0; n < 8; n++)
+    {
+      k = fn (i, i);
+      i = k.vx0;
+    }
+  isa_sink.vx0 = k.vx0;
+  return 0;
+}
+
+static int
+isa_mul256x256 (void)
+{
+  __VEC_U_512 (*fn) (__VEC_U_256, __VEC_U_256) =
+      (__VEC_U_512 (*) (__VEC_U_256, __VEC_U_256)) isa_fn;
+  __VEC_U_256 i;
+  __VEC_U_512 k;
+  int n;
+
+  i.vx0 = (vui128_t) ((unsigned __int128) 10);
+  i.vx1 = (vui128_t) ((unsigned __int128) 0);
+  for (n = 0; n < 8; n++)
+    {
+      k = fn (i, i);
+      i.vx0 = k.vx0;
+      i.vx1 = k.vx1;
+    }
+  isa_sink.vx0 = k.vx0;
+  return 0;
+}
+
+static int
+isa_mul512x512 (void)
+{
+  __VEC_U_1024 (*fn) (__VEC_U_512, __VEC_U_512) =
+      (__VEC_U_1024 (*) (__VEC_U_512, __VEC_U_512)) isa_fn;
+  __VEC_U_1024x512 k;
+  __VEC_U_512 i = isa_m512[0];
+  int n;
+
+  for (n = 0; n < 8; n++)
+    {
+      k.x1024 = fn (i, i);
+      i = k.x2.v0x512;
+    }
+  isa_sink.vx0 = i.vx0;
+  return 0;
+}
+
+static int
+isa_mul1024x1024 (void)
+{
+  void (*fn) (__VEC_U_2048 *, __VEC_U_1024 *, __VEC_U_1024 *) =
+      (void (*) (__VEC_U_2048 *, __VEC_U_1024 *, __VEC_U_1024 *)) isa_fn;
+  __VEC_U_2048x512 k;
+  __VEC_U_1024x512 i;
+  int n;
+
+  i.x2.v0x512 = isa_m512[0];
+  i.x2.v1x512 = isa_m512[1];
+  for (n = 0; n < 8; n++)
+    {
+      fn (&k.x2048, &i.x1024, &i.x1024);
+      i.x1024 = k.x2.v0x1024;
+    }
+  isa_sink.vx0 = i.x2.v0x512.vx0;
+  return 0;
+}
+
+static int
+isa_mul2048x2048 (void)
+{
+  void (*fn) (__VEC_U_4096 *, __VEC_U_2048 *, __VEC_U_2048 *) =
+      (void (*) (__VEC_U_4096 *, __VEC_U_2048 *, __VEC_U_2048 *)) isa_fn;
+
+  fn (&isa_sink, (__VEC_U_2048 *) &isa_m512[0],
+      (__VEC_U_2048 *) &isa_m512[4]);
+  fn (&isa_sink, (__VEC_U_2048 *) &isa_m512[8],
+      (__VEC_U_2048 *) &isa_m512[12]);
+  return 0;
+}
+
+static int
+isa_mul512_byMN (void)
+{
+  void (*fn) (__VEC_U_512 *, __VEC_U_512 *, __VEC_U_512 *,
+	      unsigned long, unsigned long) =
+      (void (*) (__VEC_U_512 *, __VEC_U_512 *, __VEC_U_512 *,
+		  unsigned long, unsigned long)) isa_fn;
+
+  /* 10x6 is not one of the straight line sizes.  */
+  fn (isa_p512, &isa_m512[0], &isa_m512[10], 10, 6);
+  return 0;
+}
+
+static int
+isa_divdqu (void)
+{
+  __VEC_U_128RQ (*fn) (vui128_t, vui128_t, vui128_t) =
+      (__VEC_U_128RQ (*) (vui128_t, vui128_t, vui128_t)) isa_fn;
+  vui128_t x = isa_m512[1].vx0;
+  vui128_t y = isa_m512[1].vx1;
+  vui128_t z = isa_m512[0].vx0;
+  __VEC_U_128RQ rq;
+  int n;
+
+  /* Keep x < z by dividing the remainder again.  */
+  x = (vui128_t) ((unsigned __int128) x >> 1);
+  z = (vui128_t) ((unsigned __int128) z | ((unsigned __int128) 1 << 127));
+  for (n = 0; n < 8; n++)
+    {
+      rq = fn (x, y, z);
+      x = rq.R;
+      y = rq.Q;
+    }
+  isa_sink.vx0 = rq.Q;
+  return 0;
+}
+
+static int
+isa_divuq (void)
+{
+  vui128_t (*fn) (vui128_t, vui128_t) =
+      (vui128_t (*) (vui128_t, vui128_t)) isa_fn;
+  vui128_t y = isa_m512[2].vx0;
+  vui128_t z = isa_m512[2].vx1;
+  int n;
+
+  z = (vui128_t) ((unsigned __int128) z >> 48);
+  for (n = 0; n < 8; n++)
+    y = vec_adduqm (fn (y, z), y);
+  isa_sink.vx0 = y;
+  return 0;
+}
+
+static int
+isa_divud (void)
+{
+  vui64_t (*fn) (vui64_t, vui64_t) =
+      (vui64_t (*) (vui64_t, vui64_t)) isa_fn;
+  vui64_t y = (vui64_t) isa_m512[3].vx0;
+  vui64_t z = (vui64_t) isa_m512[3].vx1;
+  int n;
+
+  z = vec_srdi (z, 24);
+  for (n = 0; n < 8; n++)
+    y = vec_addudm (fn (y, z), y);
+  isa_sink.vx0 = (vui128_t) y;
+  return 0;
+}
+
+static int
+isa_xsaddqpo (void)
+{
+  __binary128 (*fn) (__binary128, __binary128) =
+      (__binary128 (*) (__binary128, __binary128)) isa_fn;
+  __binary128 x = vec_xfer_vui64t_2_bin128 (
+      (vui64_t) CONST_VINT128_DW (0x3fff000000000000UL, 1UL));
+  __binary128 y = x;
+  int n;
+
+  for (n = 0; n < 8; n++)
+    x = fn (x, y);
+  isa_sink.vx0 = vec_xfer_bin128_2_vui128t (x);
+  return 0;
+}
+
+static int
+isa_xsmulqpo (void)
+{
+  __binary128 (*fn) (__binary128, __binary128) =
+      (__binary128 (*) (__binary128, __binary128)) isa_fn;
+  __binary128 x = vec_xfer_vui64t_2_bin128 (
+      (vui64_t) CONST_VINT128_DW (0x3fff000000000000UL, 1UL));
+  __binary128 y = x;
+  int n;
+
+  for (n = 0; n < 8; n++)
+    x = fn (x, y);
+  isa_sink.vx0 = vec_xfer_bin128_2_vui128t (x);
+  return 0;
+}
+
+static int
+isa_xsdivqpo (void)
+{
+  __binary128 (*fn) (__binary128, __binary128) =
+      (__binary128 (*) (__binary128, __binary128)) isa_fn;
+  __binary128 x = vec_xfer_vui64t_2_bin128 (
+      (vui64_t) CONST_VINT128_DW (0x4000000000000000UL, 3UL));
+  __binary128 y = vec_xfer_vui64t_2_bin128 (
+      (vui64_t) CONST_VINT128_DW (0x3fff000000000000UL, 1UL));
+  int n;
+
+  for (n = 0; n < 8; n++)
+    x = fn (x, y);
+  isa_sink.vx0 = vec_xfer_bin128_2_vui128t (x);
+  return 0;
+}
+
+static int
+isa_xsmaddqpo (void)
+{
+  __binary128 (*fn) (__binary128, __binary128, __binary128) =
+      (__binary128 (*) (__binary128, __binary128, __binary128)) isa_fn;
+  __binary128 x = vec_xfer_vui64t_2_bin128 (
+      (vui64_t) CONST_VINT128_DW (0x3fff000000000000UL, 1UL));
+  __binary128 y = x;
+  int n;
+
+  for (n = 0; n < 8; n++)
+    x = fn (y, y, x);
+  isa_sink.vx0 = vec_xfer_bin128_2_vui128t (x);
+  return 0;
+}
+
+static int
+isa_xscvqpdpo (void)
+{
+  vf64_t (*fn) (__binary128) =
+      (vf64_t (*) (__binary128)) isa_fn;
+  __binary128 x = vec_xfer_vui64t_2_bin128 (
+      (vui64_t) CONST_VINT128_DW (0x3fff000000000000UL, 1UL));
+  vf64_t r = { 0.0, 0.0 };
+  int n;
+
+  for (n = 0; n < 8; n++)
+    r += fn (x);
+  isa_sink.vx0 = (vui128_t) r;
+  return 0;
+}
+
+static int
+isa_gemm_s8 (void)
+{
+  void (*fn) (int *, unsigned long, const signed char *,
+	      const unsigned char *, unsigned long, unsigned long,
+	      unsigned long, int) =
+      (void (*) (int *, unsigned long, const signed char *,
+		  const unsigned char *, unsigned long, unsigned long,
+		  unsigned long, int)) isa_fn;
+
+  /* Already packed, so this times the microkernel alone.  */
+  fn (isa_gemm_c, ISA_GEMM_N, isa_gemm_pa8, isa_gemm_pb8, ISA_GEMM_N,
+      ISA_GEMM_N, ISA_GEMM_N, 0);
+  return 0;
+}
+
+static int
+isa_gemm_s16 (void)
+{
+  void (*fn) (int *, unsigned long, const short *, const short *,
+	      unsigned long, unsigned long, unsigned long, int) =
+      (void (*) (int *, unsigned long, const short *, const short *,
+		  unsigned long, unsigned long, unsigned long, int)) isa_fn;
+
+  fn (isa_gemm_c, ISA_GEMM_N, isa_gemm_pa16, isa_gemm_pb16, ISA_GEMM_N,
+      ISA_GEMM_N, ISA_GEMM_N, 0);
+  return 0;
+}
+
+typedef struct
+{
+  const char *name;
+  int (*kernel) (void);
+  unsigned long elements;
+  vec_isa_fn_t variants[VEC_ISA_NVARIANTS];
+} vec_isa_case_t;
+
+static const vec_isa_case_t isa_cases[] =
+  {
+    { "mul128x128", isa_mul128x128, 8, VEC_ISA_VARIANTS (vec_mul128x128) },
+    { "mul256x256", isa_mul256x256, 8, VEC_ISA_VARIANTS (vec_mul256x256) },
+    { "mul512x512", isa_mul512x512, 8, VEC_ISA_VARIANTS (vec_mul512x512) },
+    { "mul1024x1024", isa_mul1024x1024, 8,
+	VEC_ISA_VARIANTS (vec_mul1024x1024) },
+    { "mul2048x2048", isa_mul2048x2048, 2,
+	VEC_ISA_VARIANTS (vec_mul2048x2048) },
+    { "mul512_byMN", isa_mul512_byMN, 1, VEC_ISA_VARIANTS (vec_mul512_byMN) },
+    { "divdqu", isa_divdqu, 8, VEC_ISA_VARIANTS (vec_divdqu) },
+    { "divuq", isa_divuq, 8, VEC_ISA_VARIANTS (vec_divuq) },
+    { "divud", isa_divud, 8, VEC_ISA_VARIANTS (vec_divud) },
+    { "xsaddqpo", isa_xsaddqpo, 8, VEC_ISA_VARIANTS (vec_xsaddqpo) },
+    { "xsmulqpo", isa_xsmulqpo, 8, VEC_ISA_VARIANTS (vec_xsmulqpo) },
+    { "xsdivqpo", isa_xsdivqpo, 8, VEC_ISA_VARIANTS (vec_xsdivqpo) },
+    { "xsmaddqpo", isa_xsmaddqpo, 8, VEC_ISA_VARIANTS (vec_xsmaddqpo) },
+    { "xscvqpdpo", isa_xscvqpdpo, 8, VEC_ISA_VARIANTS (vec_xscvqpdpo) },
+    /* Elements are multiply-adds.  */
+    { "gemm_s8_64", isa_gemm_s8, ISA_GEMM_N * ISA_GEMM_N * ISA_GEMM_N,
+	VEC_ISA_VARIANTS (vec_gemm_s8) },
+    { "gemm_s16_64", isa_gemm_s16, ISA_GEMM_N * ISA_GEMM_N * ISA_GEMM_N,
+	VEC_ISA_VARIANTS (vec_gemm_s16) }
+  };
+
+#define VEC_ISA_NCASES (sizeof (isa_cases) / sizeof (isa_cases[0]))
+
+int
+vec_isa_cpu_supports (int variant)
+{
+#ifdef __BUILTIN_CPU_SUPPORTS__
+  switch (variant)
+    {
+    case 0:
+      return __builtin_cpu_supports ("arch_2_06");
+    case 1:
+      return __builtin_cpu_supports ("arch_2_07");
+    case 2:
+      return __builtin_cpu_supports ("arch_3_00");
+    case 3:
+      return __builtin_cpu_supports ("arch_3_1");
+    default:
+      return 0;
+    }
+#else
+  /* Without HWCAP support only trust the base platform.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return (variant == 1);
+#else
+  return (variant == 0);
+#endif
+#endif
+}
+
+int
+test_time_isa (const vec_bench_opts_t *opts)
+{
+  static double tb_elem[VEC_ISA_NCASES][VEC_ISA_NVARIANTS];
+  static char names[VEC_ISA_NVARIANTS][64];
+  vec_bench_stats_t stats;
+  vec_bench_t bench;
+  unsigned long c, i;
+  int v, base;
+  int rc = 0;
+
+  for (i = 0; i < 16; i++)
+    {
+      isa_m512[i].vx0 = (vui128_t) CONST_VINT128_DW (0x0123456789abcdefUL + i,
+						    0xfedcba9876543210UL);
+      isa_m512[i].vx1 = (vui128_t) CONST_VINT128_DW (0x1111111111111111UL,
+						    0x2222222222222222UL * i);
+      isa_m512[i].vx2 = (vui128_t) CONST_VINT128_DW (0x3333333333333333UL,
+						    0x4444444444444444UL);
+      isa_m512[i].vx3 = (vui128_t) CONST_VINT128_DW (0x0555555555555555UL,
+						    0x6666666666666666UL + i);
+    }
+  for (i = 0; i < ISA_GEMM_N * ISA_GEMM_N; i++)
+    {
+      isa_gemm_pa8[i] = (signed char) (i * 7);
+      isa_gemm_pb8[i] = (unsigned char) (i * 13);
+      isa_gemm_pa16[i] = (short) (i * 509);
+      isa_gemm_pb16[i] = (short) (i * 1021);
+    }
+
+  for (c = 0; c < VEC_ISA_NCASES; c++)
+    {
+      for (v = 0; v < VEC_ISA_NVARIANTS; v++)
+	{
+	  tb_elem[c][v] = 0.0;
+	  if (isa_cases[c].variants[v] == NULL || !vec_isa_cpu_supports (v))
+	    continue;
+
+	  snprintf (names[v], sizeof (names[v]), "%s@%s", isa_cases[c].name,
+		    vec_isa_names[v]);
+	  bench.group = "isa";
+	  bench.name = names[v];
+	  bench.fn = isa_cases[c].kernel;
+	  bench.setup = NULL;
+	  bench.elements = isa_cases[c].elements;
+	  if (!vec_bench_match (opts, &bench))
+	    continue;
+	  if (opts->list_only)
+	    {
+	      printf ("%s/%s\n", bench.group, bench.name);
+	      continue;
+	    }
+
+	  isa_fn = isa_cases[c].variants[v];
+	  rc += vec_bench_measure (opts, &bench, &stats);
+	  vec_bench_report (opts, &bench, &stats);
+	  tb_elem[c][v] = stats.median / (double) bench.elements;
+	}
+    }
+
+  if (opts->list_only || opts->format != VEC_BENCH_TEXT)
+    return rc;
+
+  /* Speedup of each variant relative to the oldest variant measured
+   * for the same kernel.  */
+  printf ("\n%-16s", "speedup");
+  for (v = 0; v < VEC_ISA_NVARIANTS; v++)
+    printf (" %8s", vec_isa_names[v]);
+  printf ("\n");
+  for (c = 0; c < VEC_ISA_NCASES; c++)
+    {
+      base = -1;
+      for (v = 0; v < VEC_ISA_NVARIANTS; v++)
+	if (tb_elem[c][v] > 0.0)
+	  {
+	    base = v;
+	    break;
+	  }
+      if (base < 0)
+	continue;
+
+      printf ("%-16s", isa_cases[c].name);
+      for (v = 0; v < VEC_ISA_NVARIANTS; v++)
+	{
+	  if (tb_elem[c][v] > 0.0)
+	    printf (" %8.2f", tb_elem[c][base] / tb_elem[c][v]);
+	  else
+	    printf (" %8s", "-");
+	}
+      printf ("\n");
+    }
+
+  return rc;
+}
@@ -0,0 +1,35 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_isa.h
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_ISA_H_
+#define SRC_TESTSUITE_VEC_PERF_ISA_H_
+
+#include <testsuite/vec_perf_bench.h>
+
+/* Return nonzero if the running CPU can execute runtime variant
+ * 0 (_PWR7), 1 (_PWR8), 2 (_PWR9) or 3 (_PWR10).  */
+extern int vec_isa_cpu_supports (int variant);
+/* Time every compiled and supported variant of the runtime kernels
+ * and print the speedup matrix.  */
+extern int test_time_isa (const vec_bench_opts_t *opts);
+
+#endif /* SRC_TESTSUITE_VEC_PERF_ISA_H_ */
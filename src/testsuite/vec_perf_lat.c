@@ -0,0 +1,208 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_lat.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Latency and throughput of the header-inline operations.
+ *
+ * The runtime kernels are timed by vec_perf_isa.c. This covers the
+ * static inline operations (vec_muludq, vec_divuq_10e32, vec_clzq,
+ * ...), which are only visible to a compiler that inlines them for
+ * a specific -mcpu=. For each compiled target the CPU supports, each
+ * operation is timed as a dependent chain (latency) and as 8
+ * independent chains (throughput).
+ *
+ * Results are cycles per result when the PMU cycle counter is
+ * available (pveclib_perf --lat forces --pmu), else timebase ticks
+ * per result. The unit is tracked per measurement, and if the table
+ * mixes both the timebase tick values are marked with '*'.  */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+
+#include <testsuite/vec_perf_bench.h>
+#include <testsuite/vec_perf_isa.h>
+#include <testsuite/vec_perf_lat.h>
+
+#define VEC_LAT_NTARGETS 4
+
+typedef struct
+{
+  const char *name;
+  const vec_lat_case_t *cases;
+  const unsigned long *ncases;
+} vec_lat_target_t;
+
+static const vec_lat_target_t lat_targets[VEC_LAT_NTARGETS] =
+  {
+#ifndef PVECLIB_DISABLE_POWER7
+    { "PWR7", vec_lat_cases_PWR7, &vec_lat_ncases_PWR7 },
+#else
+    { "PWR7", NULL, NULL },
+#endif
+    { "PWR8", vec_lat_cases_PWR8, &vec_lat_ncases_PWR8 },
+#ifndef PVECLIB_DISABLE_POWER9
+    { "PWR9", vec_lat_cases_PWR9, &vec_lat_ncases_PWR9 },
+#else
+    { "PWR9", NULL, NULL },
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+    { "PWR10", vec_lat_cases_PWR10, &vec_lat_ncases_PWR10 }
+#else
+    { "PWR10", NULL, NULL }
+#endif
+  };
+
+/* Upper bound on ops per target, for the result table.  */
+#define VEC_LAT_MAXCASES 64
+
+/* Measure one kernel, return its cost per result (cycles if the
+ * cycle counter is valid, else timebase ticks), 0.0 if skipped.
+ * Set *cycles to 1 for cycles, 0 for timebase ticks.  */
+static double
+lat_measure (const vec_bench_opts_t *opts, vec_bench_t *bench,
+	     char *cycles, int *rc)
+{
+  vec_bench_stats_t stats;
+
+  *cycles = 0;
+  if (!vec_bench_match (opts, bench))
+    return 0.0;
+  if (opts->list_only)
+    {
+      printf ("%s/%s\n", bench->group, bench->name);
+      return 0.0;
+    }
+
+  *rc += vec_bench_measure (opts, bench, &stats);
+  vec_bench_report (opts, bench, &stats);
+  if (stats.pmu_valid & (1U << VEC_PMU_CYCLES))
+    {
+      *cycles = 1;
+      return stats.pmu[VEC_PMU_CYCLES];
+    }
+  return stats.median / (double) bench->elements;
+}
+
+int
+test_time_lat (const vec_bench_opts_t *opts)
+{
+  static double lat[VEC_LAT_NTARGETS][VEC_LAT_MAXCASES];
+  static double tput[VEC_LAT_NTARGETS][VEC_LAT_MAXCASES];
+  /* Unit of each lat/tput entry, 1 for cycles, 0 for ticks.  */
+  static char lat_cy[VEC_LAT_NTARGETS][VEC_LAT_MAXCASES];
+  static char tput_cy[VEC_LAT_NTARGETS][VEC_LAT_MAXCASES];
+  static char name[80];
+  vec_bench_opts_t lat_opts = *opts;
+  vec_bench_t bench;
+  const vec_lat_case_t *cases;
+  unsigned long c, n, nmax = 0;
+  int t, ncycles = 0, nticks = 0, mixed;
+  int rc = 0;
+
+  /* Cycles per result needs the cycle counter.  */
+  lat_opts.pmu = 1;
+
+  for (t = 0; t < VEC_LAT_NTARGETS; t++)
+    {
+      memset (lat[t], 0, sizeof (lat[t]));
+      memset (tput[t], 0, sizeof (tput[t]));
+      if (lat_targets[t].cases == NULL || !vec_isa_cpu_supports (t))
+	continue;
+
+      cases = lat_targets[t].cases;
+      n = *lat_targets[t].ncases;
+      if (n > VEC_LAT_MAXCASES)
+	n = VEC_LAT_MAXCASES;
+      if (n > nmax)
+	nmax = n;
+
+      for (c = 0; c < n; c++)
+	{
+	  bench.group = "lat";
+	  bench.name = name;
+	  bench.setup = NULL;
+	  bench.elements = VEC_LAT_OPS_PER_CALL;
+
+	  snprintf (name, sizeof (name), "%s@%s", cases[c].name,
+		    lat_targets[t].name);
+	  bench.fn = cases[c].latency;
+	  lat[t][c] = lat_measure (&lat_opts, &bench, &lat_cy[t][c], &rc);
+
+	  bench.group = "tput";
+	  bench.fn = cases[c].throughput;
+	  tput[t][c] = lat_measure (&lat_opts, &bench, &tput_cy[t][c],
+				    &rc);
+
+	  if (lat[t][c] > 0.0)
+	    {
+	      ncycles += lat_cy[t][c];
+	      nticks += !lat_cy[t][c];
+	    }
+	  if (tput[t][c] > 0.0)
+	    {
+	      ncycles += tput_cy[t][c];
+	      nticks += !tput_cy[t][c];
+	    }
+	}
+    }
+
+  if (opts->list_only || opts->format != VEC_BENCH_TEXT)
+    return rc;
+
+  /* Every target compiles the same VEC_LAT_OPS list, so the names
+   * from the PWR8 table label all columns.  */
+  mixed = (ncycles != 0 && nticks != 0);
+  if (mixed)
+    printf ("\ncycles per result (* timebase ticks, no cycle count), "
+	    "latency / throughput\n");
+  else
+    printf ("\n%s per result, latency / throughput\n",
+	    ncycles ? "cycles" : "timebase ticks");
+  printf ("%-16s", "op");
+  for (t = 0; t < VEC_LAT_NTARGETS; t++)
+    printf (" %17s", lat_targets[t].name);
+  printf ("\n");
+  for (c = 0; c < nmax; c++)
+    {
+      printf ("%-16s", vec_lat_cases_PWR8[c].name);
+      for (t = 0; t < VEC_LAT_NTARGETS; t++)
+	{
+	  if (lat[t][c] > 0.0 || tput[t][c] > 0.0)
+	    {
+	      char l[24], r[24];
+
+	      snprintf (l, sizeof (l), "%.2f%s", lat[t][c],
+			(mixed && !lat_cy[t][c]) ? "*" : "");
+	      snprintf (r, sizeof (r), "%.2f%s", tput[t][c],
+			(mixed && !tput_cy[t][c]) ? "*" : "");
+	      printf (" %8s/%-8s", l, r);
+	    }
+	  else
+	    printf (" %17s", "-");
+	}
+      printf ("\n");
+    }
+
+  return rc;
+}
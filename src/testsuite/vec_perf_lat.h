@@ -0,0 +1,62 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_lat.h
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_LAT_H_
+#define SRC_TESTSUITE_VEC_PERF_LAT_H_
+
+#include <testsuite/vec_perf_bench.h>
+
+/* Operations per latency or throughput kernel call.  */
+#define VEC_LAT_OPS_PER_CALL 64
+
+/* One header-inline operation, compiled for one -mcpu= target.
+ * latency runs a single dependent chain, throughput runs 8
+ * independent chains, both VEC_LAT_OPS_PER_CALL operations.  */
+typedef struct
+{
+  const char *name;
+  int (*latency) (void);
+  int (*throughput) (void);
+} vec_lat_case_t;
+
+/* Per target case tables from vec_perf_lat_ops.c, compiled once per
+ * -mcpu= target (vec_perf_lat_PWR7.c ... vec_perf_lat_PWR10.c).  */
+#define VEC_LAT_LIST(_TARGET) \
+extern const vec_lat_case_t vec_lat_cases ## _TARGET[]; \
+extern const unsigned long vec_lat_ncases ## _TARGET;
+
+#ifndef PVECLIB_DISABLE_POWER7
+VEC_LAT_LIST (_PWR7)
+#endif
+VEC_LAT_LIST (_PWR8)
+#ifndef PVECLIB_DISABLE_POWER9
+VEC_LAT_LIST (_PWR9)
+#endif
+#ifndef PVECLIB_DISABLE_POWER10
+VEC_LAT_LIST (_PWR10)
+#endif
+
+/* Measure latency and throughput of every op for every compiled
+ * target the CPU supports and print the cost table.  */
+extern int test_time_lat (const vec_bench_opts_t *opts);
+
+#endif /* SRC_TESTSUITE_VEC_PERF_LAT_H_ */
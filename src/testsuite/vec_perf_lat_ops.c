@@ -0,0 +1,182 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_lat_ops.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Latency and throughput kernels for header-inline operations.
+ *
+ * This file is included by vec_perf_lat_PWR7.c ... vec_perf_lat_PWR10.c
+ * which are compiled with the matching -mcpu= option, so the table
+ * names carry the __VEC_PWR_IMP() suffix.
+ *
+ * Each operation is listed once in VEC_LAT_OPS as an expression of the
+ * vui128_t chain variable x (and h for a high half result). The
+ * latency kernel feeds each result into the next operation. The
+ * throughput kernel runs 8 independent chains.
+ *
+ * Operations whose result would quickly degenerate to a constant
+ * (divides, modulo) are chained through a vec_xor with a constant.
+ * The "xor" entry measures that glue so it can be subtracted.  */
+
+#include <stdint.h>
+
+#include <pveclib/vec_int128_ppc.h>
+
+#include <testsuite/vec_perf_lat.h>
+
+static const vui128_t lat_c1 = (vui128_t) CONST_VINT128_DW (
+    0x9e3779b97f4a7c15UL, 0xf39cc0605cedc835UL);
+static const vui128_t lat_c2 = (vui128_t) CONST_VINT128_DW (
+    0x0000000000000001UL, 0x3b9aca0000000007UL);
+static const vui128_t lat_c3 = (vui128_t) CONST_VINT128_DW (
+    0x8000000000000000UL, 0x0123456789abcdefUL);
+static const vui128_t lat_c4 = (vui128_t) CONST_VINT128_DW (
+    0x0000000000000000UL, 0x0000000000012345UL);
+
+/* Chain seed, not const so the chains are not folded.  */
+vui128_t __VEC_PWR_IMP (vec_lat_seed) = (vui128_t) CONST_VINT128_DW (
+    0x0123456789abcdefUL, 0xfedcba9876543210UL);
+vui128_t __VEC_PWR_IMP (vec_lat_sink);
+
+static inline __attribute__ ((always_inline)) __VEC_U_128RQ
+lat_divdqu (vui128_t x)
+{
+  return vec_divdqu_inline (lat_c4, x, lat_c1);
+}
+
+#define VEC_LAT_OPS \
+  VEC_LAT_OP (xor, (vui128_t) vec_xor ((vui32_t) x, (vui32_t) lat_c3)) \
+  VEC_LAT_OP (adduqm, vec_adduqm (x, lat_c1)) \
+  VEC_LAT_OP (addcuq, vec_addcuq (x, lat_c1)) \
+  VEC_LAT_OP (subuqm, vec_subuqm (x, lat_c1)) \
+  VEC_LAT_OP (clzq, vec_clzq (x)) \
+  VEC_LAT_OP (ctzq, vec_ctzq (x)) \
+  VEC_LAT_OP (popcntq, vec_popcntq (x)) \
+  VEC_LAT_OP (sldqi, vec_sldqi (x, lat_c1, 8)) \
+  VEC_LAT_OP (srqi, vec_srqi (x, 7)) \
+  VEC_LAT_OP (rlqi, vec_rlqi (x, 17)) \
+  VEC_LAT_OP (cmpgtuq_seluq, \
+	      vec_seluq (x, lat_c1, vec_cmpgtuq (x, lat_c2))) \
+  VEC_LAT_OP (clzd, (vui128_t) vec_clzd ((vui64_t) x)) \
+  VEC_LAT_OP (popcntd, (vui128_t) vec_popcntd ((vui64_t) x)) \
+  VEC_LAT_OP (muludm, \
+	      (vui128_t) vec_muludm ((vui64_t) x, (vui64_t) lat_c1)) \
+  VEC_LAT_OP (vmuleud, vec_vmuleud ((vui64_t) x, (vui64_t) lat_c1)) \
+  VEC_LAT_OP (msumudm, \
+	      vec_msumudm ((vui64_t) x, (vui64_t) lat_c1, lat_c2)) \
+  VEC_LAT_OP (mulluq, vec_mulluq (x, lat_c1)) \
+  VEC_LAT_OP (muludq, vec_muludq (h, x, lat_c1)) \
+  VEC_LAT_OP (mulhuq, vec_mulhuq (x, lat_c1)) \
+  VEC_LAT_OP (mul10uq, vec_mul10uq (x)) \
+  VEC_LAT_OP (divuq_10e31, \
+	      (vui128_t) vec_xor ((vui32_t) vec_divuq_10e31 (x), \
+				  (vui32_t) lat_c3)) \
+  VEC_LAT_OP (divuq_10e32, \
+	      (vui128_t) vec_xor ((vui32_t) vec_divuq_10e32 (x), \
+				  (vui32_t) lat_c3)) \
+  VEC_LAT_OP (divudq_10e32, \
+	      (vui128_t) vec_xor ((vui32_t) vec_divudq_10e32 (h, lat_c4, x), \
+				  (vui32_t) lat_c3)) \
+  VEC_LAT_OP (divdqu_inline, \
+	      (vui128_t) vec_xor ((vui32_t) lat_divdqu (x).Q, \
+				  (vui32_t) lat_c3)) \
+  VEC_LAT_OP (vdivuq_inline, \
+	      (vui128_t) vec_xor ((vui32_t) vec_vdivuq_inline (x, lat_c2), \
+				  (vui32_t) lat_c3)) \
+  VEC_LAT_OP (vmoduq_inline, \
+	      (vui128_t) vec_xor ((vui32_t) vec_vmoduq_inline (x, lat_c2), \
+				  (vui32_t) lat_c3)) \
+  VEC_LAT_OP (vdivud_inline, \
+	      (vui128_t) vec_xor ((vui32_t) vec_vdivud_inline ( \
+				      (vui64_t) x, (vui64_t) lat_c2), \
+				  (vui32_t) lat_c3))
+
+/* Generate the inline step function and the two kernels.  */
+#define VEC_LAT_OP(_NAME, _EXPR) \
+static inline __attribute__ ((always_inline)) vui128_t \
+lat_step_ ## _NAME (vui128_t x, vui128_t *h) \
+{ \
+  (void) h; \
+  return _EXPR; \
+} \
+\
+static int \
+lat_ ## _NAME (void) \
+{ \
+  vui128_t x = __VEC_PWR_IMP (vec_lat_seed); \
+  vui128_t h; \
+  int i; \
+\
+  for (i = 0; i < VEC_LAT_OPS_PER_CALL; i++) \
+    x = lat_step_ ## _NAME (x, &h); \
+  __VEC_PWR_IMP (vec_lat_sink) = x; \
+  return 0; \
+} \
+\
+static int \
+tput_ ## _NAME (void) \
+{ \
+  vui128_t x0, x1, x2, x3, x4, x5, x6, x7; \
+  vui128_t h; \
+  int i; \
+\
+  x0 = __VEC_PWR_IMP (vec_lat_seed); \
+  x1 = vec_adduqm (x0, lat_c3); \
+  x2 = vec_adduqm (x1, lat_c3); \
+  x3 = vec_adduqm (x2, lat_c3); \
+  x4 = vec_adduqm (x3, lat_c3); \
+  x5 = vec_adduqm (x4, lat_c3); \
+  x6 = vec_adduqm (x5, lat_c3); \
+  x7 = vec_adduqm (x6, lat_c3); \
+  for (i = 0; i < (VEC_LAT_OPS_PER_CALL / 8); i++) \
+    { \
+      x0 = lat_step_ ## _NAME (x0, &h); \
+      x1 = lat_step_ ## _NAME (x1, &h); \
+      x2 = lat_step_ ## _NAME (x2, &h); \
+      x3 = lat_step_ ## _NAME (x3, &h); \
+      x4 = lat_step_ ## _NAME (x4, &h); \
+      x5 = lat_step_ ## _NAME (x5, &h); \
+      x6 = lat_step_ ## _NAME (x6, &h); \
+      x7 = lat_step_ ## _NAME (x7, &h); \
+    } \
+  x0 = (vui128_t) vec_xor ((vui32_t) x0, (vui32_t) x1); \
+  x2 = (vui128_t) vec_xor ((vui32_t) x2, (vui32_t) x3); \
+  x4 = (vui128_t) vec_xor ((vui32_t) x4, (vui32_t) x5); \
+  x6 = (vui128_t) vec_xor ((vui32_t) x6, (vui32_t) x7); \
+  x0 = (vui128_t) vec_xor ((vui32_t) x0, (vui32_t) x2); \
+  x4 = (vui128_t) vec_xor ((vui32_t) x4, (vui32_t) x6); \
+  x0 = (vui128_t) vec_xor ((vui32_t) x0, (vui32_t) x4); \
+  __VEC_PWR_IMP (vec_lat_sink) = x0; \
+  return 0; \
+}
+
+VEC_LAT_OPS
+
+#undef VEC_LAT_OP
+#define VEC_LAT_OP(_NAME, _EXPR) { #_NAME, lat_ ## _NAME, tput_ ## _NAME },
+
+const vec_lat_case_t __VEC_PWR_IMP (vec_lat_cases)[] =
+  {
+    VEC_LAT_OPS
+  };
+
+const unsigned long __VEC_PWR_IMP (vec_lat_ncases) =
+    sizeof (__VEC_PWR_IMP (vec_lat_cases))
+    / sizeof (__VEC_PWR_IMP (vec_lat_cases)[0]);
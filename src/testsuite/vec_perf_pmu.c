@@ -0,0 +1,127 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_pmu.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#include <testsuite/vec_perf_pmu.h>
+
+const char *vec_pmu_names[VEC_PMU_NEVENTS] =
+  { "cycles", "instructions", "l1d_miss", "ll_miss", "branch_miss" };
+
+static const struct
+{
+  uint32_t type;
+  uint64_t config;
+} vec_pmu_events[VEC_PMU_NEVENTS] =
+  {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D
+	| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+	| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL
+	| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+	| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+  };
+
+unsigned int
+vec_pmu_open (vec_pmu_t *pmu)
+{
+  struct perf_event_attr attr;
+  int i;
+
+  pmu->valid = 0;
+  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+    {
+      memset (&attr, 0, sizeof (attr));
+      attr.size = sizeof (attr);
+      attr.type = vec_pmu_events[i].type;
+      attr.config = vec_pmu_events[i].config;
+      attr.disabled = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+      pmu->fd[i] = (int) syscall (__NR_perf_event_open, &attr, 0, -1, -1, 0);
+      if (pmu->fd[i] >= 0)
+	pmu->valid |= (1U << i);
+    }
+
+  return pmu->valid;
+}
+
+void
+vec_pmu_start (vec_pmu_t *pmu)
+{
+  int i;
+
+  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+    {
+      if (pmu->valid & (1U << i))
+	{
+	  ioctl (pmu->fd[i], PERF_EVENT_IOC_RESET, 0);
+	  ioctl (pmu->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+	}
+    }
+}
+
+void
+vec_pmu_stop (vec_pmu_t *pmu, uint64_t counts[VEC_PMU_NEVENTS])
+{
+  int i;
+
+  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+    {
+      if (pmu->valid & (1U << i))
+	ioctl (pmu->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+    {
+      counts[i] = 0;
+      if (pmu->valid & (1U << i))
+	{
+	  if (read (pmu->fd[i], &counts[i], sizeof (counts[i]))
+	      != sizeof (counts[i]))
+	    counts[i] = 0;
+	}
+    }
+}
+
+void
+vec_pmu_close (vec_pmu_t *pmu)
+{
+  int i;
+
+  for (i = 0; i < VEC_PMU_NEVENTS; i++)
+    {
+      if (pmu->valid & (1U << i))
+	close (pmu->fd[i]);
+      pmu->fd[i] = -1;
+    }
+  pmu->valid = 0;
+}
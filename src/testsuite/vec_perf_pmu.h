@@ -0,0 +1,66 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_perf_pmu.h
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+#ifndef SRC_TESTSUITE_VEC_PERF_PMU_H_
+#define SRC_TESTSUITE_VEC_PERF_PMU_H_
+
+#include <stdint.h>
+
+/* Hardware performance counters (via perf_event_open) for the
+ * benchmark driver. Each event is opened separately, user mode only,
+ * so events the kernel or hypervisor does not provide are just
+ * reported as missing.  */
+
+typedef enum
+{
+  VEC_PMU_CYCLES = 0,
+  VEC_PMU_INSTRUCTIONS,
+  VEC_PMU_L1D_MISS,
+  /* Generic last level cache read misses. POWER has no generic L2
+   * event, so this covers misses beyond the cache hierarchy visible
+   * to the kernel's generic events.  */
+  VEC_PMU_LL_MISS,
+  VEC_PMU_BRANCH_MISS,
+  VEC_PMU_NEVENTS
+} vec_pmu_event_t;
+
+typedef struct
+{
+  int fd[VEC_PMU_NEVENTS];
+  /* Bit i set if event i opened.  */
+  unsigned int valid;
+} vec_pmu_t;
+
+/* Short event names, for output column headers.  */
+extern const char *vec_pmu_names[VEC_PMU_NEVENTS];
+
+/* Open the counters (disabled). Returns the valid event mask, 0 if
+ * perf_event_open is not available (for example
+ * kernel.perf_event_paranoid restricts it).  */
+extern unsigned int vec_pmu_open (vec_pmu_t *pmu);
+/* Reset and enable all valid counters.  */
+extern void vec_pmu_start (vec_pmu_t *pmu);
+/* Disable the counters and read them into counts[].  */
+extern void vec_pmu_stop (vec_pmu_t *pmu, uint64_t counts[VEC_PMU_NEVENTS]);
+extern void vec_pmu_close (vec_pmu_t *pmu);
+
+#endif /* SRC_TESTSUITE_VEC_PERF_PMU_H_ */
@@ -0,0 +1,129 @@
+/*
+ Copyright (c) [2026] Steven Munroe
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_runtime_test.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Check the PVECLIB_CPU override of the libpvec IFUNC resolvers.
+ * This must link the dynamic library. If PVECLIB_CPU is not set the
+ * test sets it to the base target for this endian and re-executes
+ * itself, so the libpvec constructor sees the override.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_runtime_ppc.h>
+
+/* The base target is always accepted by the override.  */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define VEC_RT_TEST_CPU "power7"
+#else
+#define VEC_RT_TEST_CPU "power8"
+#endif
+
+static int
+check_target (const char *name, const char *r, const char *e)
+{
+  if (r == NULL || strcmp (r, e) != 0)
+    {
+      printf ("%s: expected %s, got %s\n", name, e,
+	      r == NULL ? "(null)" : r);
+      return 1;
+    }
+  return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+  __VEC_U_512 m1, m2;
+  __VEC_U_1024 p;
+  const char *cpu = getenv ("PVECLIB_CPU");
+  int bound_early, found;
+  unsigned int i;
+  int rc = 0;
+
+  (void) argc;
+  if (cpu == NULL)
+    {
+      setenv ("PVECLIB_CPU", VEC_RT_TEST_CPU, 1);
+      execv ("/proc/self/exe", argv);
+      perror ("execv");
+      return 1;
+    }
+
+  printf ("\nvec_runtime_test PVECLIB_CPU=%s\n", cpu);
+  if (strcmp (cpu, VEC_RT_TEST_CPU) != 0)
+    {
+      printf ("PVECLIB_CPU set externally, skipping\n");
+      return 0;
+    }
+
+  rc += check_target ("vec_runtime_target (NULL)",
+		      vec_runtime_target (NULL), VEC_RT_TEST_CPU);
+
+  /* With BIND_NOW the entry point was resolved before the override
+     was read, and keeps the hardware target.  */
+  bound_early = (vec_runtime_target ("vec_mul512x512") != NULL);
+
+  memset (&m1, 0, sizeof (m1));
+  memset (&m2, 0, sizeof (m2));
+  m1.vx0 = (vui128_t) ((unsigned __int128) 3);
+  m2.vx0 = (vui128_t) ((unsigned __int128) 5);
+  p = vec_mul512x512 (m1, m2);
+  if (!vec_cmpuq_all_eq (p.vx0, (vui128_t) ((unsigned __int128) 15)))
+    {
+      printf ("vec_mul512x512: wrong product\n");
+      rc += 1;
+    }
+
+  /* An entry point bound early to another target must be reported
+     by vec_runtime_override_missed.  */
+  if (bound_early)
+    {
+      if (strcmp (vec_runtime_target ("vec_mul512x512"), VEC_RT_TEST_CPU)
+	  != 0 && vec_runtime_override_missed () == 0)
+	{
+	  printf ("vec_runtime_override_missed: vec_mul512x512 bound to %s "
+		  "not reported\n", vec_runtime_target ("vec_mul512x512"));
+	  rc += 1;
+	}
+    }
+  else
+    rc += check_target ("vec_runtime_target (\"vec_mul512x512\")",
+			vec_runtime_target ("vec_mul512x512"),
+			VEC_RT_TEST_CPU);
+
+  found = 0;
+  for (i = 0; i < vec_runtime_resolved_count (); i++)
+    {
+      if (strcmp (vec_runtime_resolved_name (i), "vec_mul512x512") == 0)
+	found = 1;
+    }
+  if (!found)
+    {
+      printf ("vec_runtime_resolved_name: vec_mul512x512 not listed\n");
+      rc += 1;
+    }
+
+  return rc;
+}
@@ -0,0 +1,90 @@
+/*
+ Copyright (c) [2026] Steven Munroe
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_uint_test.cpp
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Minimal C++ compile and link test for vec_uint_ppc.hpp.
+ * A C header is included first on purpose, so this also checks the
+ * C headers carry their own extern "C" linkage.  */
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_uint_ppc.hpp>
+
+#include <cstdio>
+
+template<unsigned Bits>
+static int
+check_uint (const char *name, const pvec::uint<Bits> &r,
+	    const pvec::uint<Bits> &e)
+{
+  if (r != e)
+    {
+      std::printf ("%s: mismatch\n", name);
+      return 1;
+    }
+  return 0;
+}
+
+int
+main (void)
+{
+  const vui128_t ones = (vui128_t) ((unsigned __int128) -1);
+  int rc = 0;
+
+  std::printf ("\nvec_uint_test\n");
+  {
+    // (2**128 - 1) + 1 carries into the second quadword.
+    pvec::uint<256> a (ones);
+    pvec::uint<256> e ((uint64_t) 0);
+    e.limb (1) = (vui128_t) ((unsigned __int128) 1);
+    rc += check_uint ("uint<256> add", a + pvec::uint<256> ((uint64_t) 1), e);
+    rc += check_uint ("uint<256> sub", e - pvec::uint<256> ((uint64_t) 1), a);
+  }
+  {
+    // (2**512 - 1)**2 mod 2**512 == 1
+    pvec::uint<512> a = ~pvec::uint<512>::zero ();
+    rc += check_uint ("uint<512> mul", a * a, pvec::uint<512> ((uint64_t) 1));
+  }
+  {
+    // The 1024-bit product calls the C linkage vec_mul1024x1024.
+    pvec::uint<1024> a = ~pvec::uint<1024>::zero ();
+    rc += check_uint ("uint<1024> mul", a * a,
+		      pvec::uint<1024> ((uint64_t) 1));
+  }
+  {
+    // 2**256 / 3 == 0x5555...5555 remainder 1
+    pvec::uint<512> a ((uint64_t) 0);
+    pvec::uint<512> e ((uint64_t) 0);
+    vui128_t r;
+    a.limb (2) = (vui128_t) ((unsigned __int128) 1);
+    e.limb (0) = (vui128_t) ((unsigned __int128) -1 / 3);
+    e.limb (1) = e.limb (0);
+    rc += check_uint ("uint<512> div",
+		      pvec::divmod (a, (vui128_t) ((unsigned __int128) 3), &r),
+		      e);
+    if (!vec_cmpuq_all_eq (r, (vui128_t) ((unsigned __int128) 1)))
+      {
+	std::printf ("uint<512> rem: mismatch\n");
+	rc += 1;
+      }
+  }
+
+  return rc;
+}
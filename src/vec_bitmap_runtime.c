@@ -0,0 +1,369 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_bitmap_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Bitmap operations over arrays of doublewords. Included by
+ * vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * Bit i of a bitmap is bit (i % 64) of doubleword (i / 64).
+ *
+ * The boolean op and count functions combine 2 doublewords per
+ * vector, optionally store the result, and count the result bits.
+ * Runs of 16 vectors are reduced with a Harley-Seal carry save adder
+ * tree, so only 1 vec_popcntd is needed per 16 vectors (plus 4 at the
+ * end). vec_popcntd is vpopcntd on POWER8 and later and a byte
+ * population count and sum on POWER7.
+ *
+ * Find next set bit skips zero quadwords and uses vec_ctzq on the
+ * first non zero quadword. Select in a doubleword uses pdepd on
+ * POWER10. The Roaring style container functions convert between
+ * bitmap containers and sorted arrays of 16-bit values, and
+ * intersect an array container with a bitmap container.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int64_ppc.h>
+#include <pveclib/vec_int128_ppc.h>
+
+/* Boolean ops for __vec_bitmap_opcount.  */
+#define __VEC_BITMAP_NOP 0
+#define __VEC_BITMAP_AND 1
+#define __VEC_BITMAP_OR 2
+#define __VEC_BITMAP_ANDNOT 3
+#define __VEC_BITMAP_XOR 4
+
+static inline vui64_t
+__vec_bitmap_ld (const unsigned long long *p)
+{
+  vui64_t v;
+
+  memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static inline unsigned long long
+__vec_bitmap_op1 (unsigned long long a, unsigned long long b, const int op)
+{
+  switch (op)
+    {
+    case __VEC_BITMAP_AND:
+      return a & b;
+    case __VEC_BITMAP_OR:
+      return a | b;
+    case __VEC_BITMAP_ANDNOT:
+      return a & ~b;
+    case __VEC_BITMAP_XOR:
+      return a ^ b;
+    default:
+      return a;
+    }
+}
+
+/* Return op of the 2 doublewords at a + i and b + i and store it to
+ * out + i if out is not NULL.  */
+static inline vui64_t __attribute__((always_inline))
+__vec_bitmap_op2 (unsigned long long *out, const unsigned long long *a,
+		  const unsigned long long *b, unsigned long i, const int op)
+{
+  vui64_t va = __vec_bitmap_ld (a + i);
+  vui64_t r;
+
+  switch (op)
+    {
+    case __VEC_BITMAP_AND:
+      r = vec_and (va, __vec_bitmap_ld (b + i));
+      break;
+    case __VEC_BITMAP_OR:
+      r = vec_or (va, __vec_bitmap_ld (b + i));
+      break;
+    case __VEC_BITMAP_ANDNOT:
+      r = vec_andc (va, __vec_bitmap_ld (b + i));
+      break;
+    case __VEC_BITMAP_XOR:
+      r = vec_xor (va, __vec_bitmap_ld (b + i));
+      break;
+    default:
+      return va;
+    }
+  if (out != NULL)
+    memcpy (out + i, &r, sizeof (r));
+  return r;
+}
+
+/* Carry save adder: *h:*l = a + b + c for each bit.  */
+static inline void
+__vec_bitmap_csa (vui64_t *h, vui64_t *l, vui64_t a, vui64_t b, vui64_t c)
+{
+  vui64_t u = vec_xor (a, b);
+
+  *h = vec_or (vec_and (a, b), vec_and (u, c));
+  *l = vec_xor (u, c);
+}
+
+static inline unsigned long long __attribute__((always_inline))
+__vec_bitmap_opcount (unsigned long long *out, const unsigned long long *a,
+		      const unsigned long long *b, unsigned long n,
+		      const int op)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  vui64_t total = zero;
+  unsigned long long cnt;
+  unsigned long i = 0;
+
+  if (n >= 32)
+    {
+      vui64_t ones = zero, twos = zero, fours = zero, eights = zero;
+      vui64_t twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+      vui64_t sixteens;
+
+      for (; i + 32 <= n; i += 32)
+	{
+#define __VEC_BITMAP_D(k) __vec_bitmap_op2 (out, a, b, i + 2 * (k), op)
+	  __vec_bitmap_csa (&twos_a, &ones, ones, __VEC_BITMAP_D (0),
+			    __VEC_BITMAP_D (1));
+	  __vec_bitmap_csa (&twos_b, &ones, ones, __VEC_BITMAP_D (2),
+			    __VEC_BITMAP_D (3));
+	  __vec_bitmap_csa (&fours_a, &twos, twos, twos_a, twos_b);
+	  __vec_bitmap_csa (&twos_a, &ones, ones, __VEC_BITMAP_D (4),
+			    __VEC_BITMAP_D (5));
+	  __vec_bitmap_csa (&twos_b, &ones, ones, __VEC_BITMAP_D (6),
+			    __VEC_BITMAP_D (7));
+	  __vec_bitmap_csa (&fours_b, &twos, twos, twos_a, twos_b);
+	  __vec_bitmap_csa (&eights_a, &fours, fours, fours_a, fours_b);
+	  __vec_bitmap_csa (&twos_a, &ones, ones, __VEC_BITMAP_D (8),
+			    __VEC_BITMAP_D (9));
+	  __vec_bitmap_csa (&twos_b, &ones, ones, __VEC_BITMAP_D (10),
+			    __VEC_BITMAP_D (11));
+	  __vec_bitmap_csa (&fours_a, &twos, twos, twos_a, twos_b);
+	  __vec_bitmap_csa (&twos_a, &ones, ones, __VEC_BITMAP_D (12),
+			    __VEC_BITMAP_D (13));
+	  __vec_bitmap_csa (&twos_b, &ones, ones, __VEC_BITMAP_D (14),
+			    __VEC_BITMAP_D (15));
+#undef __VEC_BITMAP_D
+	  __vec_bitmap_csa (&fours_b, &twos, twos, twos_a, twos_b);
+	  __vec_bitmap_csa (&eights_b, &fours, fours, fours_a, fours_b);
+	  __vec_bitmap_csa (&sixteens, &eights, eights, eights_a, eights_b);
+	  total = vec_addudm (total, vec_popcntd (sixteens));
+	}
+      total = vec_sldi (total, 4);
+      total = vec_addudm (total, vec_sldi (vec_popcntd (eights), 3));
+      total = vec_addudm (total, vec_sldi (vec_popcntd (fours), 2));
+      total = vec_addudm (total, vec_sldi (vec_popcntd (twos), 1));
+      total = vec_addudm (total, vec_popcntd (ones));
+    }
+  for (; i + 2 <= n; i += 2)
+    total = vec_addudm (total,
+			vec_popcntd (__vec_bitmap_op2 (out, a, b, i, op)));
+  cnt = total[0] + total[1];
+  if (i < n)
+    {
+      unsigned long long r = __vec_bitmap_op1 (a[i], (op) ? b[i] : 0, op);
+
+      if (out != NULL && op != __VEC_BITMAP_NOP)
+	out[i] = r;
+      cnt += __builtin_popcountll (r);
+    }
+  return cnt;
+}
+
+/* Bit position of the set bit with rank k (k < popcount (w)).  */
+static inline unsigned int
+__vec_bitmap_select1 (unsigned long long w, unsigned int k)
+{
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 11)
+  return __builtin_ctzll (__builtin_pdepd (1ULL << k, w));
+#else
+  while (k-- > 0)
+    w &= w - 1;
+  return __builtin_ctzll (w);
+#endif
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_bitmap_count) (const unsigned long long *a,
+				  unsigned long n)
+{
+  return __vec_bitmap_opcount (NULL, a, NULL, n, __VEC_BITMAP_NOP);
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_bitmap_and_count) (unsigned long long *out,
+				      const unsigned long long *a,
+				      const unsigned long long *b,
+				      unsigned long n)
+{
+  return __vec_bitmap_opcount (out, a, b, n, __VEC_BITMAP_AND);
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_bitmap_andnot_count) (unsigned long long *out,
+					 const unsigned long long *a,
+					 const unsigned long long *b,
+					 unsigned long n)
+{
+  return __vec_bitmap_opcount (out, a, b, n, __VEC_BITMAP_ANDNOT);
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_bitmap_or_count) (unsigned long long *out,
+				     const unsigned long long *a,
+				     const unsigned long long *b,
+				     unsigned long n)
+{
+  return __vec_bitmap_opcount (out, a, b, n, __VEC_BITMAP_OR);
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_bitmap_xor_count) (unsigned long long *out,
+				      const unsigned long long *a,
+				      const unsigned long long *b,
+				      unsigned long n)
+{
+  return __vec_bitmap_opcount (out, a, b, n, __VEC_BITMAP_XOR);
+}
+
+long
+__VEC_PWR_IMP (vec_bitmap_next_set) (const unsigned long long *a,
+				     unsigned long n, unsigned long pos)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  unsigned long i = pos / 64;
+  unsigned long long w;
+
+  if (i >= n)
+    return -1;
+  w = a[i] & (~0ULL << (pos % 64));
+  if (w != 0)
+    return i * 64 + __builtin_ctzll (w);
+
+  for (i++; i + 2 <= n; i += 2)
+    {
+      vui64_t v = __vec_bitmap_ld (a + i);
+
+      if (!vec_cmpud_all_eq (v, zero))
+	{
+	  __VEC_U_128 t;
+
+	  /* Make doubleword a[i] the low order half of the quadword.  */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	  v = vec_swapd (v);
+#endif
+	  t.vx1 = vec_ctzq ((vui128_t) v);
+	  return i * 64 + t.ulong.lower;
+	}
+    }
+  if (i < n && a[i] != 0)
+    return i * 64 + __builtin_ctzll (a[i]);
+  return -1;
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_bitmap_rank) (const unsigned long long *a,
+				 unsigned long pos)
+{
+  unsigned long long cnt;
+
+  cnt = __vec_bitmap_opcount (NULL, a, NULL, pos / 64, __VEC_BITMAP_NOP);
+  if (pos % 64)
+    cnt += __builtin_popcountll (a[pos / 64] & ((1ULL << (pos % 64)) - 1));
+  return cnt;
+}
+
+long
+__VEC_PWR_IMP (vec_bitmap_select) (const unsigned long long *a,
+				   unsigned long n, unsigned long long k)
+{
+  unsigned long i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      vui64_t c = vec_popcntd (__vec_bitmap_ld (a + i));
+      unsigned long long c0 = c[0];
+
+      /* c[0] is the count for a[i] in either endian.  */
+      if (k < c0 + c[1])
+	{
+	  if (k >= c0)
+	    return (i + 1) * 64 + __vec_bitmap_select1 (a[i + 1], k - c0);
+	  return i * 64 + __vec_bitmap_select1 (a[i], k);
+	}
+      k -= c0 + c[1];
+    }
+  if (i < n && k < (unsigned long long) __builtin_popcountll (a[i]))
+    return i * 64 + __vec_bitmap_select1 (a[i], k);
+  return -1;
+}
+
+void
+__VEC_PWR_IMP (vec_bitmap_set_array_u16) (unsigned long long *bm,
+					  const unsigned short *in,
+					  unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    bm[in[i] / 64] |= 1ULL << (in[i] % 64);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitmap_to_array_u16) (unsigned short *out,
+					 const unsigned long long *bm,
+					 unsigned long n)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  unsigned long i, j, o = 0;
+
+  for (i = 0; i < n; i += 2)
+    {
+      if (i + 2 <= n && vec_cmpud_all_eq (__vec_bitmap_ld (bm + i), zero))
+	continue;
+      for (j = i; j < i + 2 && j < n; j++)
+	{
+	  unsigned long long w = bm[j];
+
+	  while (w != 0)
+	    {
+	      out[o++] = j * 64 + __builtin_ctzll (w);
+	      w &= w - 1;
+	    }
+	}
+    }
+  return o;
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitmap_and_array_u16) (unsigned short *out,
+					  const unsigned short *in,
+					  unsigned long n,
+					  const unsigned long long *bm)
+{
+  unsigned long i, o = 0;
+
+  /* Branch free, store each value and advance if its bit is set.  */
+  for (i = 0; i < n; i++)
+    {
+      unsigned short v = in[i];
+
+      out[o] = v;
+      o += (bm[v / 64] >> (v % 64)) & 1;
+    }
+  return o;
+}
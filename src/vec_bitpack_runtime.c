@@ -0,0 +1,578 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_bitpack_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Bit packing with frame of reference and delta coding, in the
+ * style of SIMD-BP128. Included by vec_runtime_PWR7.c ...
+ * vec_runtime_PWR10.c.
+ *
+ * Values are packed in blocks of 128. Each element of the vector
+ * is a lane: lane j of a word block holds in[4k+j] (k = 0-31) and
+ * lane j of a doubleword block holds in[2k+j] (k = 0-63). Each lane
+ * is packed independently, low order bits first, so a block of
+ * width b occupies exactly b vectors and packing is only vector
+ * shift, and, or. The (n % 128) values after the last
+ * full block are packed as a scalar bit stream, low order bits
+ * first, into words (doublewords).
+ *
+ * Frame of reference subtracts a base from every value. Plain
+ * packing is frame of reference with a base of 0. Delta coding
+ * stores the difference from the previous value in the same lane
+ * (in[i] - in[i-4] for words, in[i] - in[i-2] for doublewords),
+ * so decode is a running vector add (prefix sum per lane) fused
+ * into the unpack. Both are a vector add/subtract with an
+ * accumulator that is either fixed (the base) or replaced by each
+ * value (delta), selected by a mask.
+ *
+ * The word unpack (the decoder hot path) is specialized for each
+ * bit width so the loop is fully unrolled and every shift is an
+ * immediate. Packing and the doubleword unpack use the generic
+ * loop, where the shift counts are only known at run time, so they
+ * splat the count into a vector and use the vector shift forms
+ * (vec_sl/vec_sr, vec_vsld/vec_vsrd).  */
+
+#include <string.h>
+
+#include <pveclib/vec_int32_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+
+#define __VEC_BITPACK_BLOCK 128
+
+static inline unsigned int
+__vec_bitpack_mask32 (unsigned int bits)
+{
+  return (bits < 32) ? (1U << bits) - 1 : ~0U;
+}
+
+static inline unsigned long long
+__vec_bitpack_mask64 (unsigned int bits)
+{
+  return (bits < 64) ? (1ULL << bits) - 1 : ~0ULL;
+}
+
+static inline vui32_t
+__vec_bitpack_ld32 (const unsigned int *p)
+{
+  vui32_t v;
+
+  memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static inline void
+__vec_bitpack_st32 (unsigned int *p, vui32_t v)
+{
+  memcpy (p, &v, sizeof (v));
+}
+
+static inline vui64_t
+__vec_bitpack_ld64 (const unsigned long long *p)
+{
+  vui64_t v;
+
+  memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static inline void
+__vec_bitpack_st64 (unsigned long long *p, vui64_t v)
+{
+  memcpy (p, &v, sizeof (v));
+}
+
+/* Pack one block of 128 words into bits (1-32) vectors. *acc is the
+ * base (dmask zero) or previous values (dmask ones) and is updated
+ * for the next block.  */
+static inline void __attribute__((always_inline))
+__vec_bitpack_blk32 (unsigned int *out, const unsigned int *in,
+		     const unsigned int bits, vui32_t *acc, vui32_t dmask)
+{
+  const vui32_t mask = vec_splats (__vec_bitpack_mask32 (bits));
+  const vui32_t zero = vec_splat_u32 (0);
+  vui32_t w = zero, a = *acc;
+  vui32_t x, v;
+  unsigned int k, sh = 0;
+
+  for (k = 0; k < 32; k++)
+    {
+      x = __vec_bitpack_ld32 (in + 4 * k);
+      v = vec_and (vec_sub (x, a), mask);
+      a = vec_sel (a, x, (vb32_t) dmask);
+      w = vec_or (w, vec_sl (v, vec_splats (sh)));
+      sh += bits;
+      if (sh >= 32)
+	{
+	  __vec_bitpack_st32 (out, w);
+	  out += 4;
+	  sh -= 32;
+	  w = (sh > 0) ? vec_sr (v, vec_splats (bits - sh)) : zero;
+	}
+    }
+  *acc = a;
+}
+
+/* Unpack one block of 128 words from bits (1-32) vectors, adding
+ * *acc as for __vec_bitpack_blk32.  */
+static inline void __attribute__((always_inline))
+__vec_bitunpack_blk32 (unsigned int *out, const unsigned int *in,
+		       const unsigned int bits, vui32_t *acc, vui32_t dmask)
+{
+  const vui32_t mask = vec_splats (__vec_bitpack_mask32 (bits));
+  vui32_t cur, v, a = *acc;
+  unsigned int k, sh = 0;
+
+  cur = __vec_bitpack_ld32 (in);
+  in += 4;
+#pragma GCC unroll 32
+  for (k = 0; k < 32; k++)
+    {
+      v = vec_srwi (cur, sh);
+      sh += bits;
+      if (sh >= 32)
+	{
+	  sh -= 32;
+	  if (sh > 0 || k < 31)
+	    {
+	      cur = __vec_bitpack_ld32 (in);
+	      in += 4;
+	      if (sh > 0)
+		v = vec_or (v, vec_slwi (cur, bits - sh));
+	    }
+	}
+      v = vec_add (vec_and (v, mask), a);
+      a = vec_sel (a, v, (vb32_t) dmask);
+      __vec_bitpack_st32 (out + 4 * k, v);
+    }
+  *acc = a;
+}
+
+/* Generate the fixed width word block decoders.  */
+#define __VEC_BITUNPACK32_FIXED(_B) \
+static void __attribute__((noinline)) \
+__vec_bitunpack32_b ## _B (unsigned int *out, const unsigned int *in, \
+			   vui32_t *acc, vui32_t dmask) \
+{ \
+  __vec_bitunpack_blk32 (out, in, _B, acc, dmask); \
+}
+
+__VEC_BITUNPACK32_FIXED (1)
+__VEC_BITUNPACK32_FIXED (2)
+__VEC_BITUNPACK32_FIXED (3)
+__VEC_BITUNPACK32_FIXED (4)
+__VEC_BITUNPACK32_FIXED (5)
+__VEC_BITUNPACK32_FIXED (6)
+__VEC_BITUNPACK32_FIXED (7)
+__VEC_BITUNPACK32_FIXED (8)
+__VEC_BITUNPACK32_FIXED (9)
+__VEC_BITUNPACK32_FIXED (10)
+__VEC_BITUNPACK32_FIXED (11)
+__VEC_BITUNPACK32_FIXED (12)
+__VEC_BITUNPACK32_FIXED (13)
+__VEC_BITUNPACK32_FIXED (14)
+__VEC_BITUNPACK32_FIXED (15)
+__VEC_BITUNPACK32_FIXED (16)
+__VEC_BITUNPACK32_FIXED (17)
+__VEC_BITUNPACK32_FIXED (18)
+__VEC_BITUNPACK32_FIXED (19)
+__VEC_BITUNPACK32_FIXED (20)
+__VEC_BITUNPACK32_FIXED (21)
+__VEC_BITUNPACK32_FIXED (22)
+__VEC_BITUNPACK32_FIXED (23)
+__VEC_BITUNPACK32_FIXED (24)
+__VEC_BITUNPACK32_FIXED (25)
+__VEC_BITUNPACK32_FIXED (26)
+__VEC_BITUNPACK32_FIXED (27)
+__VEC_BITUNPACK32_FIXED (28)
+__VEC_BITUNPACK32_FIXED (29)
+__VEC_BITUNPACK32_FIXED (30)
+__VEC_BITUNPACK32_FIXED (31)
+__VEC_BITUNPACK32_FIXED (32)
+
+static void (* const __vec_bitunpack32_tab[33]) (unsigned int *,
+						 const unsigned int *,
+						 vui32_t *, vui32_t) =
+{
+  NULL,
+  __vec_bitunpack32_b1, __vec_bitunpack32_b2, __vec_bitunpack32_b3,
+  __vec_bitunpack32_b4, __vec_bitunpack32_b5, __vec_bitunpack32_b6,
+  __vec_bitunpack32_b7, __vec_bitunpack32_b8, __vec_bitunpack32_b9,
+  __vec_bitunpack32_b10, __vec_bitunpack32_b11, __vec_bitunpack32_b12,
+  __vec_bitunpack32_b13, __vec_bitunpack32_b14, __vec_bitunpack32_b15,
+  __vec_bitunpack32_b16, __vec_bitunpack32_b17, __vec_bitunpack32_b18,
+  __vec_bitunpack32_b19, __vec_bitunpack32_b20, __vec_bitunpack32_b21,
+  __vec_bitunpack32_b22, __vec_bitunpack32_b23, __vec_bitunpack32_b24,
+  __vec_bitunpack32_b25, __vec_bitunpack32_b26, __vec_bitunpack32_b27,
+  __vec_bitunpack32_b28, __vec_bitunpack32_b29, __vec_bitunpack32_b30,
+  __vec_bitunpack32_b31, __vec_bitunpack32_b32
+};
+
+/* Pack one block of 128 doublewords into bits (1-64) vectors.  */
+static inline void
+__vec_bitpack_blk64 (unsigned long long *out, const unsigned long long *in,
+		     const unsigned int bits, vui64_t *acc, vui64_t dmask)
+{
+  const vui64_t mask = vec_splats (__vec_bitpack_mask64 (bits));
+  const vui64_t zero = vec_splat_u64 (0);
+  vui64_t w = zero, a = *acc;
+  vui64_t x, v;
+  unsigned int k, sh = 0;
+
+  for (k = 0; k < 64; k++)
+    {
+      x = __vec_bitpack_ld64 (in + 2 * k);
+      v = vec_and (vec_subudm (x, a), mask);
+      a = vec_sel (a, x, (vb64_t) dmask);
+      w = vec_or (w, vec_vsld (v, vec_splats ((unsigned long long) sh)));
+      sh += bits;
+      if (sh >= 64)
+	{
+	  __vec_bitpack_st64 (out, w);
+	  out += 2;
+	  sh -= 64;
+	  w = (sh > 0)
+	      ? vec_vsrd (v, vec_splats ((unsigned long long) (bits - sh)))
+	      : zero;
+	}
+    }
+  *acc = a;
+}
+
+/* Unpack one block of 128 doublewords from bits (1-64) vectors.  */
+static inline void
+__vec_bitunpack_blk64 (unsigned long long *out, const unsigned long long *in,
+		       const unsigned int bits, vui64_t *acc, vui64_t dmask)
+{
+  const vui64_t mask = vec_splats (__vec_bitpack_mask64 (bits));
+  vui64_t cur, v, a = *acc;
+  unsigned int k, sh = 0;
+
+  cur = __vec_bitpack_ld64 (in);
+  in += 2;
+  for (k = 0; k < 64; k++)
+    {
+      v = vec_vsrd (cur, vec_splats ((unsigned long long) sh));
+      sh += bits;
+      if (sh >= 64)
+	{
+	  sh -= 64;
+	  if (sh > 0 || k < 63)
+	    {
+	      cur = __vec_bitpack_ld64 (in);
+	      in += 2;
+	      if (sh > 0)
+		v = vec_or (v, vec_vsld (cur,
+			    vec_splats ((unsigned long long) (bits - sh))));
+	    }
+	}
+      v = vec_addudm (vec_and (v, mask), a);
+      a = vec_sel (a, v, (vb64_t) dmask);
+      __vec_bitpack_st64 (out + 2 * k, v);
+    }
+  *acc = a;
+}
+
+/* Pack the tail values, from index i of in, as a scalar bit stream.
+ * prev is the value for delta coding before in[i] in the same lane,
+ * or the base for frame of reference.  */
+static unsigned long
+__vec_bitpack_tail32 (unsigned int *out, const unsigned int *in,
+		      unsigned long i, unsigned long n, unsigned int ref,
+		      int delta, unsigned int bits)
+{
+  const unsigned int mask = __vec_bitpack_mask32 (bits);
+  unsigned long words = ((n - i) * bits + 31) / 32;
+  unsigned long pos = 0, j;
+
+  memset (out, 0, words * sizeof (unsigned int));
+  for (j = i; j < n; j++, pos += bits)
+    {
+      unsigned int r = ref;
+      unsigned int v;
+
+      if (delta && j >= 4)
+	r = in[j - 4];
+      v = (in[j] - r) & mask;
+      out[pos / 32] |= v << (pos % 32);
+      if ((pos % 32) + bits > 32)
+	out[pos / 32 + 1] |= v >> (32 - (pos % 32));
+    }
+  return words;
+}
+
+static void
+__vec_bitunpack_tail32 (unsigned int *out, const unsigned int *in,
+			unsigned long i, unsigned long n, unsigned int ref,
+			int delta, unsigned int bits)
+{
+  const unsigned int mask = __vec_bitpack_mask32 (bits);
+  unsigned long pos = 0, j;
+
+  for (j = i; j < n; j++, pos += bits)
+    {
+      unsigned int r = ref;
+      unsigned int v = 0;
+
+      if (delta && j >= 4)
+	r = out[j - 4];
+      if (bits > 0)
+	{
+	  v = in[pos / 32] >> (pos % 32);
+	  if ((pos % 32) + bits > 32)
+	    v |= in[pos / 32 + 1] << (32 - (pos % 32));
+	}
+      out[j] = (v & mask) + r;
+    }
+}
+
+static unsigned long
+__vec_bitpack_tail64 (unsigned long long *out, const unsigned long long *in,
+		      unsigned long i, unsigned long n, unsigned long long ref,
+		      int delta, unsigned int bits)
+{
+  const unsigned long long mask = __vec_bitpack_mask64 (bits);
+  unsigned long words = ((n - i) * bits + 63) / 64;
+  unsigned long pos = 0, j;
+
+  memset (out, 0, words * sizeof (unsigned long long));
+  for (j = i; j < n; j++, pos += bits)
+    {
+      unsigned long long r = ref;
+      unsigned long long v;
+
+      if (delta && j >= 2)
+	r = in[j - 2];
+      v = (in[j] - r) & mask;
+      out[pos / 64] |= v << (pos % 64);
+      if ((pos % 64) + bits > 64)
+	out[pos / 64 + 1] |= v >> (64 - (pos % 64));
+    }
+  return words;
+}
+
+static void
+__vec_bitunpack_tail64 (unsigned long long *out, const unsigned long long *in,
+			unsigned long i, unsigned long n, unsigned long long ref,
+			int delta, unsigned int bits)
+{
+  const unsigned long long mask = __vec_bitpack_mask64 (bits);
+  unsigned long pos = 0, j;
+
+  for (j = i; j < n; j++, pos += bits)
+    {
+      unsigned long long r = ref;
+      unsigned long long v = 0;
+
+      if (delta && j >= 2)
+	r = out[j - 2];
+      if (bits > 0)
+	{
+	  v = in[pos / 64] >> (pos % 64);
+	  if ((pos % 64) + bits > 64)
+	    v |= in[pos / 64 + 1] << (64 - (pos % 64));
+	}
+      out[j] = (v & mask) + r;
+    }
+}
+
+static unsigned long
+__vec_bitpack_u32 (unsigned int *out, const unsigned int *in,
+		   unsigned long n, unsigned int ref, int delta,
+		   unsigned int bits)
+{
+  const vui32_t dmask = vec_splats (delta ? ~0U : 0U);
+  vui32_t acc = vec_splats (ref);
+  unsigned long i, o = 0;
+
+  if (bits > 32)
+    bits = 32;
+  if (bits == 0)
+    return 0;
+  for (i = 0; i + __VEC_BITPACK_BLOCK <= n; i += __VEC_BITPACK_BLOCK)
+    {
+      __vec_bitpack_blk32 (out + o, in + i, bits, &acc, dmask);
+      o += 4 * bits;
+    }
+  return o + __vec_bitpack_tail32 (out + o, in, i, n, ref, delta, bits);
+}
+
+static void
+__vec_bitunpack_u32 (unsigned int *out, const unsigned int *in,
+		     unsigned long n, unsigned int ref, int delta,
+		     unsigned int bits)
+{
+  const vui32_t dmask = vec_splats (delta ? ~0U : 0U);
+  vui32_t acc = vec_splats (ref);
+  unsigned long i = 0, o = 0;
+
+  if (bits > 32)
+    bits = 32;
+  if (bits > 0)
+    for (; i + __VEC_BITPACK_BLOCK <= n; i += __VEC_BITPACK_BLOCK)
+      {
+	__vec_bitunpack32_tab[bits] (out + i, in + o, &acc, dmask);
+	o += 4 * bits;
+      }
+  __vec_bitunpack_tail32 (out, in + o, i, n, ref, delta, bits);
+}
+
+static unsigned long
+__vec_bitpack_u64 (unsigned long long *out, const unsigned long long *in,
+		   unsigned long n, unsigned long long ref, int delta,
+		   unsigned int bits)
+{
+  const vui64_t dmask = vec_splats (delta ? ~0ULL : 0ULL);
+  vui64_t acc = vec_splats (ref);
+  unsigned long i, o = 0;
+
+  if (bits > 64)
+    bits = 64;
+  if (bits == 0)
+    return 0;
+  for (i = 0; i + __VEC_BITPACK_BLOCK <= n; i += __VEC_BITPACK_BLOCK)
+    {
+      __vec_bitpack_blk64 (out + o, in + i, bits, &acc, dmask);
+      o += 2 * bits;
+    }
+  return o + __vec_bitpack_tail64 (out + o, in, i, n, ref, delta, bits);
+}
+
+static void
+__vec_bitunpack_u64 (unsigned long long *out, const unsigned long long *in,
+		     unsigned long n, unsigned long long ref, int delta,
+		     unsigned int bits)
+{
+  const vui64_t dmask = vec_splats (delta ? ~0ULL : 0ULL);
+  vui64_t acc = vec_splats (ref);
+  unsigned long i = 0, o = 0;
+
+  if (bits > 64)
+    bits = 64;
+  if (bits > 0)
+    for (; i + __VEC_BITPACK_BLOCK <= n; i += __VEC_BITPACK_BLOCK)
+      {
+	__vec_bitunpack_blk64 (out + i, in + o, bits, &acc, dmask);
+	o += 2 * bits;
+      }
+  __vec_bitunpack_tail64 (out, in + o, i, n, ref, delta, bits);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitpack_u32) (unsigned int *out, const unsigned int *in,
+				 unsigned long n, unsigned int bits)
+{
+  return __vec_bitpack_u32 (out, in, n, 0, 0, bits);
+}
+
+void
+__VEC_PWR_IMP (vec_bitunpack_u32) (unsigned int *out, const unsigned int *in,
+				   unsigned long n, unsigned int bits)
+{
+  __vec_bitunpack_u32 (out, in, n, 0, 0, bits);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitpack_for_u32) (unsigned int *out,
+				     const unsigned int *in,
+				     unsigned long n, unsigned int base,
+				     unsigned int bits)
+{
+  return __vec_bitpack_u32 (out, in, n, base, 0, bits);
+}
+
+void
+__VEC_PWR_IMP (vec_bitunpack_for_u32) (unsigned int *out,
+				       const unsigned int *in,
+				       unsigned long n, unsigned int base,
+				       unsigned int bits)
+{
+  __vec_bitunpack_u32 (out, in, n, base, 0, bits);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitpack_delta_u32) (unsigned int *out,
+				       const unsigned int *in,
+				       unsigned long n, unsigned int init,
+				       unsigned int bits)
+{
+  return __vec_bitpack_u32 (out, in, n, init, 1, bits);
+}
+
+void
+__VEC_PWR_IMP (vec_bitunpack_delta_u32) (unsigned int *out,
+					 const unsigned int *in,
+					 unsigned long n, unsigned int init,
+					 unsigned int bits)
+{
+  __vec_bitunpack_u32 (out, in, n, init, 1, bits);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitpack_u64) (unsigned long long *out,
+				 const unsigned long long *in,
+				 unsigned long n, unsigned int bits)
+{
+  return __vec_bitpack_u64 (out, in, n, 0, 0, bits);
+}
+
+void
+__VEC_PWR_IMP (vec_bitunpack_u64) (unsigned long long *out,
+				   const unsigned long long *in,
+				   unsigned long n, unsigned int bits)
+{
+  __vec_bitunpack_u64 (out, in, n, 0, 0, bits);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitpack_for_u64) (unsigned long long *out,
+				     const unsigned long long *in,
+				     unsigned long n, unsigned long long base,
+				     unsigned int bits)
+{
+  return __vec_bitpack_u64 (out, in, n, base, 0, bits);
+}
+
+void
+__VEC_PWR_IMP (vec_bitunpack_for_u64) (unsigned long long *out,
+				       const unsigned long long *in,
+				       unsigned long n, unsigned long long base,
+				       unsigned int bits)
+{
+  __vec_bitunpack_u64 (out, in, n, base, 0, bits);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_bitpack_delta_u64) (unsigned long long *out,
+				       const unsigned long long *in,
+				       unsigned long n, unsigned long long init,
+				       unsigned int bits)
+{
+  return __vec_bitpack_u64 (out, in, n, init, 1, bits);
+}
+
+void
+__VEC_PWR_IMP (vec_bitunpack_delta_u64) (unsigned long long *out,
+					 const unsigned long long *in,
+					 unsigned long n,
+					 unsigned long long init,
+					 unsigned int bits)
+{
+  __vec_bitunpack_u64 (out, in, n, init, 1, bits);
+}
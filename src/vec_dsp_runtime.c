@@ -0,0 +1,537 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_dsp_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Fixed-point Q15 and Q31 signal processing kernels.
+ * Included by vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * Q15 products are formed with vec_mule/vec_mulo (vmulesh/vmulosh)
+ * as full 32-bit Q30 values, the even product words holding the
+ * even numbered outputs and the odd product words the odd outputs.
+ * FIR taps are splatted and, like the Q15 dot product, each product
+ * is widened to a doubleword with vec_vupkhsw/vec_vupklsw so the sum
+ * is exact. The sums are then rounded, saturated, merged back into
+ * element order and packed to halfwords with vec_packs.
+ *
+ * Q31 products are formed with vec_mulesw/vec_mulosw as 64-bit Q62
+ * values and, as is usual for Q31 accumulation, truncated to Q48
+ * before summing in doublewords. That leaves 15 bits of headroom
+ * and an error of at most n * 2<SUP>-48</SUP>.
+ *
+ * Rounding never adds to the accumulator itself. The shifted
+ * quotient is incremented by the carry out of (remainder + bias),
+ * so a full scale accumulator can not overflow before the
+ * saturation.
+ *
+ * The biquad recursion is serial per sample, so only the
+ * feed-forward (FIR) part of each section is vectorized, over a
+ * block of samples, and the feedback terms are applied in scalar
+ * 64-bit arithmetic.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int64_ppc.h>
+
+/* Merge doubleword element 0 (h) or 1 (l) of a and b, in element
+ * order.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define __VEC_DSP_MRGHD(a, b) \
+  ((vi64_t) vec_mrgald ((vui128_t) (b), (vui128_t) (a)))
+#define __VEC_DSP_MRGLD(a, b) \
+  ((vi64_t) vec_mrgahd ((vui128_t) (b), (vui128_t) (a)))
+#else
+#define __VEC_DSP_MRGHD(a, b) \
+  ((vi64_t) vec_mrgahd ((vui128_t) (a), (vui128_t) (b)))
+#define __VEC_DSP_MRGLD(a, b) \
+  ((vi64_t) vec_mrgald ((vui128_t) (a), (vui128_t) (b)))
+#endif
+
+/* Samples per biquad feed-forward block.  */
+#define __VEC_DSP_BLK 64
+
+/* Shift x right by s (1-31) bits with rounding mode rnd.  */
+static inline long long
+__vec_dsp_rnd (long long x, int s, int rnd)
+{
+  long long q = x >> s;
+  long long r = x & ((1LL << s) - 1);
+
+  if (rnd == VEC_Q_RND_NEAREST)
+    q += (r + (1LL << (s - 1))) >> s;
+  else if (rnd == VEC_Q_RND_EVEN)
+    q += (r + (1LL << (s - 1)) - 1 + (q & 1)) >> s;
+  return q;
+}
+
+static inline short
+__vec_dsp_sat16 (long long x)
+{
+  if (x > 32767)
+    return 32767;
+  if (x < -32768)
+    return -32768;
+  return x;
+}
+
+static inline int
+__vec_dsp_sat32 (long long x)
+{
+  if (x > 2147483647LL)
+    return 2147483647;
+  if (x < -2147483648LL)
+    return -2147483648;
+  return x;
+}
+
+/* Shift the Q30 words of x right by 15 bits with rounding mode
+ * rnd.  */
+static inline vi32_t
+__vec_dsp_rnd_w (vi32_t x, int rnd)
+{
+  const vui32_t s15 = vec_splat_u32 (15);
+  vi32_t q = vec_sra (x, s15);
+  vi32_t r, bias;
+
+  if (rnd == VEC_Q_RND_TRUNC)
+    return q;
+  r = vec_and (x, vec_splats ((int) 0x7fff));
+  if (rnd == VEC_Q_RND_EVEN)
+    bias = vec_add (vec_splats ((int) 0x3fff),
+		    vec_and (q, vec_splats ((int) 1)));
+  else
+    bias = vec_splats ((int) 0x4000);
+  return vec_add (q, vec_sra (vec_add (r, bias), s15));
+}
+
+/* Shift the doublewords of x right by s bits with rounding mode rnd,
+ * then saturate to the signed word range.  */
+static inline vi64_t
+__vec_dsp_rnd_sat_d (vi64_t x, const unsigned int s, int rnd)
+{
+  const vi64_t vmax = vec_splats ((long long) 2147483647LL);
+  const vi64_t vmin = vec_splats ((long long) -2147483648LL);
+  vi64_t q = vec_sradi (x, s);
+
+  if (rnd != VEC_Q_RND_TRUNC)
+    {
+      vi64_t r, bias;
+
+      r = vec_and (x, vec_splats ((long long) ((1LL << s) - 1)));
+      if (rnd == VEC_Q_RND_EVEN)
+	bias = (vi64_t) vec_addudm (
+	    (vui64_t) vec_splats ((long long) ((1LL << (s - 1)) - 1)),
+	    (vui64_t) vec_and (q, vec_splats ((long long) 1)));
+      else
+	bias = vec_splats ((long long) (1LL << (s - 1)));
+      r = (vi64_t) vec_srdi ((vui64_t) vec_addudm ((vui64_t) r,
+						  (vui64_t) bias), s);
+      q = (vi64_t) vec_addudm ((vui64_t) q, (vui64_t) r);
+    }
+  return vec_maxsd (vec_minsd (q, vmax), vmin);
+}
+
+/* Round, saturate and pack the doubleword accumulators of the even
+ * (e) and odd (o) Q31 outputs into 4 words in element order.  */
+static inline vi32_t
+__vec_dsp_pack_q31 (vi64_t e, vi64_t o, const unsigned int s, int rnd)
+{
+  e = __vec_dsp_rnd_sat_d (e, s, rnd);
+  o = __vec_dsp_rnd_sat_d (o, s, rnd);
+  return (vi32_t) vec_vpkudum ((vui64_t) __VEC_DSP_MRGHD (e, o),
+			       (vui64_t) __VEC_DSP_MRGLD (e, o));
+}
+
+/* Add the Q30 products x * h of 8 outputs to the doubleword
+ * accumulators acc. acc[0] holds outputs 0 and 2, acc[1] 4 and 6,
+ * acc[2] 1 and 3, acc[3] 5 and 7.  */
+static inline void
+__vec_dsp_mac8_q15 (vi64_t *acc, vi16_t x, vi16_t h)
+{
+  vi32_t pe = vec_mule (x, h);
+  vi32_t po = vec_mulo (x, h);
+
+  acc[0] = (vi64_t) vec_addudm ((vui64_t) acc[0], (vui64_t) vec_vupkhsw (pe));
+  acc[1] = (vi64_t) vec_addudm ((vui64_t) acc[1], (vui64_t) vec_vupklsw (pe));
+  acc[2] = (vi64_t) vec_addudm ((vui64_t) acc[2], (vui64_t) vec_vupkhsw (po));
+  acc[3] = (vi64_t) vec_addudm ((vui64_t) acc[3], (vui64_t) vec_vupklsw (po));
+}
+
+/* Q15 FIR accumulators for the 8 outputs at x, in the acc layout of
+ * __vec_dsp_mac8_q15.  */
+static inline void
+__vec_dsp_fir8_q15 (vi64_t *acc, const short *x, const short *coef,
+		    unsigned long ntaps)
+{
+  unsigned long k;
+
+  acc[0] = acc[1] = acc[2] = acc[3] = vec_splats ((long long) 0);
+  for (k = 0; k < ntaps; k++)
+    {
+      vi16_t h = vec_splats (coef[ntaps - 1 - k]);
+      vi16_t xk;
+
+      memcpy (&xk, &x[k], sizeof (xk));
+      __vec_dsp_mac8_q15 (acc, xk, h);
+    }
+}
+
+/* Round and saturate the 8 doubleword Q30 accumulators acc back to
+ * Q15 halfwords in element order.  */
+static inline vi16_t
+__vec_dsp_pack8_q15 (const vi64_t *acc, int rnd)
+{
+  vi32_t y0 = __vec_dsp_pack_q31 (acc[0], acc[2], 15, rnd);
+  vi32_t y1 = __vec_dsp_pack_q31 (acc[1], acc[3], 15, rnd);
+
+  return vec_packs (y0, y1);
+}
+
+/* Round and saturate the even/odd Q30 accumulators back to 8 Q15
+ * halfwords in element order.  */
+static inline vi16_t
+__vec_dsp_pack_q15 (vi32_t e, vi32_t o, int rnd)
+{
+  e = __vec_dsp_rnd_w (e, rnd);
+  o = __vec_dsp_rnd_w (o, rnd);
+  return vec_packs (vec_mergeh (e, o), vec_mergel (e, o));
+}
+
+/* Scalar Q15 FIR output at x.  */
+static inline long long
+__vec_dsp_fir1_q15 (const short *x, const short *coef,
+		    unsigned long ntaps)
+{
+  long long acc = 0;
+  unsigned long k;
+
+  for (k = 0; k < ntaps; k++)
+    acc += coef[ntaps - 1 - k] * x[k];
+  return acc;
+}
+
+void
+__VEC_PWR_IMP (vec_q15_fir) (short *out, const short *in, unsigned long n,
+			     const short *coef, unsigned long ntaps, int rnd)
+{
+  unsigned long i, k;
+
+  /* 16 outputs per iteration, two independent sets of accumulators
+   * sharing each splatted tap.  */
+  for (i = 0; i + 16 <= n; i += 16)
+    {
+      vi64_t a0[4], a1[4];
+      vi16_t y0, y1;
+
+      a0[0] = a0[1] = a0[2] = a0[3] = vec_splats ((long long) 0);
+      a1[0] = a1[1] = a1[2] = a1[3] = a0[0];
+      for (k = 0; k < ntaps; k++)
+	{
+	  vi16_t h = vec_splats (coef[ntaps - 1 - k]);
+	  vi16_t x0, x1;
+
+	  memcpy (&x0, &in[i + k], sizeof (x0));
+	  memcpy (&x1, &in[i + k + 8], sizeof (x1));
+	  __vec_dsp_mac8_q15 (a0, x0, h);
+	  __vec_dsp_mac8_q15 (a1, x1, h);
+	}
+      y0 = __vec_dsp_pack8_q15 (a0, rnd);
+      y1 = __vec_dsp_pack8_q15 (a1, rnd);
+      memcpy (&out[i], &y0, sizeof (y0));
+      memcpy (&out[i + 8], &y1, sizeof (y1));
+    }
+  if (i + 8 <= n)
+    {
+      vi64_t acc[4];
+      vi16_t y;
+
+      __vec_dsp_fir8_q15 (acc, &in[i], coef, ntaps);
+      y = __vec_dsp_pack8_q15 (acc, rnd);
+      memcpy (&out[i], &y, sizeof (y));
+      i += 8;
+    }
+  for (; i < n; i++)
+    out[i] = __vec_dsp_sat16 (
+	__vec_dsp_rnd (__vec_dsp_fir1_q15 (&in[i], coef, ntaps), 15, rnd));
+}
+
+short
+__VEC_PWR_IMP (vec_q15_dot) (const short *a, const short *b,
+			     unsigned long n, int rnd)
+{
+  vi64_t s0 = vec_splats ((long long) 0);
+  vi64_t s1 = s0, s2 = s0, s3 = s0;
+  long long acc;
+  unsigned long i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      vi16_t x, y;
+      vi32_t pe, po;
+
+      memcpy (&x, &a[i], sizeof (x));
+      memcpy (&y, &b[i], sizeof (y));
+      pe = vec_mule (x, y);
+      po = vec_mulo (x, y);
+      s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) vec_vupkhsw (pe));
+      s1 = (vi64_t) vec_addudm ((vui64_t) s1, (vui64_t) vec_vupklsw (pe));
+      s2 = (vi64_t) vec_addudm ((vui64_t) s2, (vui64_t) vec_vupkhsw (po));
+      s3 = (vi64_t) vec_addudm ((vui64_t) s3, (vui64_t) vec_vupklsw (po));
+    }
+  s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) s1);
+  s2 = (vi64_t) vec_addudm ((vui64_t) s2, (vui64_t) s3);
+  s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) s2);
+  acc = s0[0] + s0[1];
+  for (; i < n; i++)
+    acc += a[i] * b[i];
+  return __vec_dsp_sat16 (__vec_dsp_rnd (acc, 15, rnd));
+}
+
+void
+__VEC_PWR_IMP (vec_q15_cmul) (short *out, const short *a, const short *b,
+			      unsigned long n, int rnd)
+{
+  const vui32_t s16 = vec_splats ((unsigned int) 16);
+  unsigned long i;
+
+  /* 4 complex elements per vector. Even halfwords are the real
+   * parts, so vec_mule gives ar*br and vec_mulo ai*bi. Rotating each
+   * word of b by 16 bits swaps its real and imaginary parts for the
+   * cross products. The real part difference always fits a word and
+   * the imaginary part sum only overflows for all inputs -1.0, which
+   * vec_adds saturates to the same Q15 result.  */
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      vi16_t x, y, ys, z;
+      vi32_t re, im;
+
+      memcpy (&x, &a[2 * i], sizeof (x));
+      memcpy (&y, &b[2 * i], sizeof (y));
+      ys = (vi16_t) vec_rl ((vui32_t) y, s16);
+      re = vec_sub (vec_mule (x, y), vec_mulo (x, y));
+      im = vec_adds (vec_mule (x, ys), vec_mulo (x, ys));
+      z = __vec_dsp_pack_q15 (re, im, rnd);
+      memcpy (&out[2 * i], &z, sizeof (z));
+    }
+  for (; i < n; i++)
+    {
+      long long ar = a[2 * i], ai = a[2 * i + 1];
+      long long br = b[2 * i], bi = b[2 * i + 1];
+
+      out[2 * i] = __vec_dsp_sat16 (
+	  __vec_dsp_rnd (ar * br - ai * bi, 15, rnd));
+      out[2 * i + 1] = __vec_dsp_sat16 (
+	  __vec_dsp_rnd (ar * bi + ai * br, 15, rnd));
+    }
+}
+
+/* Feed-forward sums of one biquad section for n (at most
+ * __VEC_DSP_BLK) samples. x holds the 2 previous inputs followed by
+ * the n new inputs.  */
+static inline void
+__vec_dsp_biquad_ff (long long *ff, const short *x, unsigned long n,
+		     const short *b)
+{
+  unsigned long i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      vi64_t acc[4], y;
+
+      __vec_dsp_fir8_q15 (acc, &x[i], b, 3);
+      y = __VEC_DSP_MRGHD (acc[0], acc[2]);
+      memcpy (&ff[i], &y, sizeof (y));
+      y = __VEC_DSP_MRGLD (acc[0], acc[2]);
+      memcpy (&ff[i + 2], &y, sizeof (y));
+      y = __VEC_DSP_MRGHD (acc[1], acc[3]);
+      memcpy (&ff[i + 4], &y, sizeof (y));
+      y = __VEC_DSP_MRGLD (acc[1], acc[3]);
+      memcpy (&ff[i + 6], &y, sizeof (y));
+    }
+  for (; i < n; i++)
+    ff[i] = __vec_dsp_fir1_q15 (&x[i], b, 3);
+}
+
+void
+__VEC_PWR_IMP (vec_q15_biquad) (short *out, const short *in,
+				unsigned long n, const short *coef,
+				short *state, unsigned long stages,
+				int shift, int rnd)
+{
+  short x[__VEC_DSP_BLK + 2];
+  long long ff[__VEC_DSP_BLK];
+  const int s = 15 - shift;
+  unsigned long st, i, j, m;
+
+  for (st = 0; st < stages; st++)
+    {
+      const short *b = &coef[5 * st];
+      const long long a1 = b[3], a2 = b[4];
+      short *z = &state[4 * st];
+      const short *src = (st == 0) ? in : out;
+      long long y1 = z[2], y2 = z[3];
+
+      x[0] = z[1];
+      x[1] = z[0];
+      for (i = 0; i < n; i += m)
+	{
+	  m = n - i;
+	  if (m > __VEC_DSP_BLK)
+	    m = __VEC_DSP_BLK;
+	  memcpy (&x[2], &src[i], m * sizeof (short));
+	  __vec_dsp_biquad_ff (ff, x, m, b);
+	  for (j = 0; j < m; j++)
+	    {
+	      long long acc = ff[j] + a1 * y1 + a2 * y2;
+
+	      acc = __vec_dsp_rnd (acc, s, rnd);
+	      y2 = y1;
+	      y1 = __vec_dsp_sat16 (acc);
+	      out[i + j] = y1;
+	    }
+	  x[0] = x[m];
+	  x[1] = x[m + 1];
+	}
+      z[0] = x[1];
+      z[1] = x[0];
+      z[2] = y1;
+      z[3] = y2;
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_q31_fir) (int *out, const int *in, unsigned long n,
+			     const int *coef, unsigned long ntaps, int rnd)
+{
+  unsigned long i, k;
+
+  /* 8 outputs per iteration. The doubleword accumulators of each
+   * input vector hold outputs 0 and 2 (even) and 1 and 3 (odd).  */
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      vi64_t ae0 = vec_splats ((long long) 0), ao0 = ae0;
+      vi64_t ae1 = ae0, ao1 = ae0;
+      vi32_t y0, y1;
+
+      for (k = 0; k < ntaps; k++)
+	{
+	  vi32_t h = vec_splats (coef[ntaps - 1 - k]);
+	  vi32_t x0, x1;
+
+	  memcpy (&x0, &in[i + k], sizeof (x0));
+	  memcpy (&x1, &in[i + k + 4], sizeof (x1));
+	  ae0 = (vi64_t) vec_addudm ((vui64_t) ae0,
+			(vui64_t) vec_sradi (vec_mulesw (x0, h), 14));
+	  ao0 = (vi64_t) vec_addudm ((vui64_t) ao0,
+			(vui64_t) vec_sradi (vec_mulosw (x0, h), 14));
+	  ae1 = (vi64_t) vec_addudm ((vui64_t) ae1,
+			(vui64_t) vec_sradi (vec_mulesw (x1, h), 14));
+	  ao1 = (vi64_t) vec_addudm ((vui64_t) ao1,
+			(vui64_t) vec_sradi (vec_mulosw (x1, h), 14));
+	}
+      y0 = __vec_dsp_pack_q31 (ae0, ao0, 17, rnd);
+      y1 = __vec_dsp_pack_q31 (ae1, ao1, 17, rnd);
+      memcpy (&out[i], &y0, sizeof (y0));
+      memcpy (&out[i + 4], &y1, sizeof (y1));
+    }
+  for (; i < n; i++)
+    {
+      long long acc = 0;
+
+      for (k = 0; k < ntaps; k++)
+	acc += ((long long) coef[ntaps - 1 - k] * in[i + k]) >> 14;
+      out[i] = __vec_dsp_sat32 (__vec_dsp_rnd (acc, 17, rnd));
+    }
+}
+
+int
+__VEC_PWR_IMP (vec_q31_dot) (const int *a, const int *b, unsigned long n,
+			     int rnd)
+{
+  vi64_t s0 = vec_splats ((long long) 0);
+  vi64_t s1 = s0;
+  long long acc;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      vi32_t x, y;
+
+      memcpy (&x, &a[i], sizeof (x));
+      memcpy (&y, &b[i], sizeof (y));
+      s0 = (vi64_t) vec_addudm ((vui64_t) s0,
+				(vui64_t) vec_sradi (vec_mulesw (x, y), 14));
+      s1 = (vi64_t) vec_addudm ((vui64_t) s1,
+				(vui64_t) vec_sradi (vec_mulosw (x, y), 14));
+    }
+  s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) s1);
+  acc = s0[0] + s0[1];
+  for (; i < n; i++)
+    acc += ((long long) a[i] * b[i]) >> 14;
+  return __vec_dsp_sat32 (__vec_dsp_rnd (acc, 17, rnd));
+}
+
+void
+__VEC_PWR_IMP (vec_q31_cmul) (int *out, const int *a, const int *b,
+			      unsigned long n, int rnd)
+{
+  const vui64_t smin = vec_splats ((unsigned long long) 1 << 63);
+  unsigned long i;
+
+  /* 2 complex elements per vector. Even words are the real parts, so
+   * vec_mulesw gives ar*br and vec_mulosw ai*bi. Rotating each
+   * doubleword of b by 32 bits swaps its real and imaginary parts.
+   * The Q62 real part difference always fits a doubleword. The
+   * imaginary part sum only overflows for all inputs -1.0, where it
+   * wraps to -2<SUP>63</SUP>, a sum that is otherwise impossible.
+   * Adding the compare mask (-1) turns that back into the largest
+   * positive sum, which saturates to the same Q31 result.  */
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      vi32_t x, y, ys, z;
+      vi64_t re;
+      vui64_t im;
+
+      memcpy (&x, &a[2 * i], sizeof (x));
+      memcpy (&y, &b[2 * i], sizeof (y));
+      ys = (vi32_t) vec_rldi ((vui64_t) y, 32);
+      re = (vi64_t) vec_subudm ((vui64_t) vec_mulesw (x, y),
+				(vui64_t) vec_mulosw (x, y));
+      im = vec_addudm ((vui64_t) vec_mulesw (x, ys),
+		       (vui64_t) vec_mulosw (x, ys));
+      im = vec_addudm (im, (vui64_t) vec_cmpequd (im, smin));
+      z = __vec_dsp_pack_q31 (re, (vi64_t) im, 31, rnd);
+      memcpy (&out[2 * i], &z, sizeof (z));
+    }
+  for (; i < n; i++)
+    {
+      long long ar = a[2 * i], ai = a[2 * i + 1];
+      long long br = b[2 * i], bi = b[2 * i + 1];
+      unsigned long long im = (unsigned long long) (ar * bi)
+	  + (unsigned long long) (ai * br);
+
+      if (im == (1ULL << 63))
+	im--;
+      out[2 * i] = __vec_dsp_sat32 (
+	  __vec_dsp_rnd (ar * br - ai * bi, 31, rnd));
+      out[2 * i + 1] = __vec_dsp_sat32 (__vec_dsp_rnd ((long long) im,
+						       31, rnd));
+    }
+}
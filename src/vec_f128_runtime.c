@@ -58,6 +58,44 @@ __VEC_PWR_IMP (vec_xsmsubqpo) (__binary128 vfa, __binary128 vfb, __binary128 vfc
   return vec_xsmsubqpo_inline (vfa, vfb, vfc);
 }
 
+__binary128
+__VEC_PWR_IMP (vec_xsaddqp_rm) (__binary128 vfa, __binary128 vfb, int rmode)
+{
+  return vec_xsaddqp_rm_inline (vfa, vfb, rmode);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xssubqp_rm) (__binary128 vfa, __binary128 vfb, int rmode)
+{
+  return vec_xssubqp_rm_inline (vfa, vfb, rmode);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xsdivqp_rm) (__binary128 vfa, __binary128 vfb, int rmode)
+{
+  return vec_xsdivqp_rm_inline (vfa, vfb, rmode);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xsmulqp_rm) (__binary128 vfa, __binary128 vfb, int rmode)
+{
+  return vec_xsmulqp_rm_inline (vfa, vfb, rmode);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xsmaddqp_rm) (__binary128 vfa, __binary128 vfb, __binary128 vfc,
+				  int rmode)
+{
+  return vec_xsmaddqp_rm_inline (vfa, vfb, vfc, rmode);
+}
+
+__binary128
+__VEC_PWR_IMP (vec_xsmsubqp_rm) (__binary128 vfa, __binary128 vfb, __binary128 vfc,
+				  int rmode)
+{
+  return vec_xsmsubqp_rm_inline (vfa, vfb, vfc, rmode);
+}
+
 __binary128
 __VEC_PWR_IMP (vec_xscvdpqp) (vf64_t vfa)
 {
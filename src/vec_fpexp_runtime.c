@@ -0,0 +1,545 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_fpexp_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Exponent manipulation (frexp, ldexp, scalbn, ilogb, logb and
+ * nextafter) over arrays of double and float. Included by
+ * vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * These are built on vec_xvxexpdp, vec_xvxsigdp and vec_xviexpdp
+ * (and the single precision vec_xvxexpsp, vec_xvxsigsp and
+ * vec_xviexpsp), which are single instructions for POWER9 and short
+ * integer sequences for POWER7/8. No lane needs a branch.
+ *
+ * frexp prescales subnormal lanes by 2^54 (2^25 for float) so the
+ * exponent field is valid, then inserts the biased exponent of 0.5.
+ * ilogb and logb of subnormals count the leading zeros of the
+ * significand instead. ldexp and scalbn follow the usual scalbn
+ * steps: multiply by 2^1023 (or 2^-969) at most twice while the
+ * scale is out of the normal range, clamp, then multiply by the
+ * remaining power of 2. Every step but the last is exact, so each
+ * result is rounded once, including subnormal results.
+ *
+ * Results for zero, infinity and NaN match C99 Annex F and the glibc
+ * scalar functions: frexp returns x with an exponent of 0, ilogb
+ * returns FP_ILOGB0, INT_MAX or FP_ILOGBNAN, and logb returns -Inf,
+ * +Inf or NaN.  */
+
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+#include <pveclib/vec_int32_ppc.h>
+#include <pveclib/vec_f64_ppc.h>
+#include <pveclib/vec_f32_ppc.h>
+
+/* Mantissa of x in [0.5, 1.0) and the exponent in *e, as frexp.  */
+static inline vf64_t
+__vec_fpexp_frexp_f64 (vf64_t x, vi64_t *e)
+{
+  const vui64_t zero = vec_splats ((unsigned long long) 0);
+  const vui64_t emax = vec_splats ((unsigned long long) 2047);
+  vf64_t xs;
+  vb64_t sub, spec;
+  vui64_t ex;
+  vi64_t bias;
+
+  sub = vec_issubnormalf64 (x);
+  xs = vec_sel (x, vec_mul (x, vec_splats (0x1p54)), sub);
+  bias = vec_selsd (vec_splats ((long long) 1022),
+		    vec_splats ((long long) (1022 + 54)), sub);
+  ex = vec_xvxexpdp (xs);
+  spec = (vb64_t) vec_or ((vui64_t) vec_cmpequd (ex, zero),
+			  (vui64_t) vec_cmpequd (ex, emax));
+  *e = vec_selsd ((vi64_t) vec_subudm (ex, (vui64_t) bias),
+		  (vi64_t) zero, spec);
+  return vec_sel (vec_xviexpdp ((vui64_t) xs,
+				vec_splats ((unsigned long long) 1022)),
+		  x, spec);
+}
+
+/* Unbiased exponent of finite nonzero x, including subnormals.  */
+static inline vi64_t
+__vec_fpexp_ilogb_f64 (vf64_t x)
+{
+  vi64_t r, rs;
+
+  r = (vi64_t) vec_subudm (vec_xvxexpdp (x),
+			   vec_splats ((unsigned long long) 1023));
+  /* A subnormal is sig 2^-1074 and its leading bit is bit 63 - clz.  */
+  rs = (vi64_t) vec_subudm (vec_splats ((unsigned long long) -1011),
+			    vec_clzd (vec_xvxsigdp (x)));
+  return vec_selsd (r, rs, vec_issubnormalf64 (x));
+}
+
+/* x 2^k with a single rounding. k is any int.  */
+static inline vf64_t
+__vec_fpexp_scale_f64 (vf64_t x, vi64_t k)
+{
+  const vi64_t emax = vec_splats ((long long) 1023);
+  const vi64_t emin = vec_splats ((long long) -1022);
+  const vi64_t zero = vec_splats ((long long) 0);
+  vb64_t hi, lo;
+  vf64_t f;
+  vi64_t d;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    {
+      hi = vec_cmpgtsd (k, emax);
+      lo = vec_cmpltsd (k, emin);
+      f = vec_sel (vec_sel (vec_splats (1.0), vec_splats (0x1p1023), hi),
+		   vec_splats (0x1p-969), lo);
+      d = vec_selsd (vec_selsd (zero, emax, hi),
+		     vec_splats ((long long) -969), lo);
+      x = vec_mul (x, f);
+      k = (vi64_t) vec_subudm ((vui64_t) k, (vui64_t) d);
+    }
+  k = vec_minsd (vec_maxsd (k, emin), emax);
+  f = vec_xviexpdp (vec_splats ((unsigned long long) 0),
+		    vec_addudm ((vui64_t) k,
+				vec_splats ((unsigned long long) 1023)));
+  return vec_mul (x, f);
+}
+
+static inline vf64_t
+__vec_fpexp_nextafter_f64 (vf64_t x, vf64_t y)
+{
+  const vf64_t zero = vec_splats (0.0);
+  const vui64_t one = vec_splats ((unsigned long long) 1);
+  const vui64_t sign = vec_splats ((unsigned long long) 1 << 63);
+  vb64_t up;
+  vui64_t r, tiny;
+
+  /* The magnitude grows if y > x for positive x, or y < x for
+   * negative x. The integer image of x steps by 1 either way.  */
+  up = (vb64_t) vec_xor ((vui64_t) vec_cmpgt (y, x),
+			 (vui64_t) vec_sradi ((vi64_t) x, 63));
+  r = vec_sel (vec_subudm ((vui64_t) x, one), vec_addudm ((vui64_t) x, one),
+	       up);
+  tiny = vec_or (vec_and ((vui64_t) y, sign), one);
+  r = vec_sel (r, tiny, (vb64_t) vec_cmpeq (x, zero));
+  r = vec_sel (r, (vui64_t) y, (vb64_t) vec_cmpeq (x, y));
+  return vec_sel ((vf64_t) r, vec_add (x, y),
+		  (vb64_t) vec_or ((vui64_t) vec_isnanf64 (x),
+				   (vui64_t) vec_isnanf64 (y)));
+}
+
+static inline vf32_t
+__vec_fpexp_frexp_f32 (vf32_t x, vi32_t *e)
+{
+  const vui32_t zero = vec_splats ((unsigned int) 0);
+  const vui32_t emax = vec_splats ((unsigned int) 255);
+  vf32_t xs;
+  vb32_t sub, spec;
+  vui32_t ex;
+  vi32_t bias;
+
+  sub = vec_issubnormalf32 (x);
+  xs = vec_sel (x, vec_mul (x, vec_splats (0x1p25f)), sub);
+  bias = vec_sel (vec_splats ((int) 126), vec_splats ((int) (126 + 25)),
+		  sub);
+  ex = vec_xvxexpsp (xs);
+  spec = vec_or (vec_cmpeq (ex, zero), vec_cmpeq (ex, emax));
+  *e = vec_sel (vec_sub ((vi32_t) ex, bias), (vi32_t) zero, spec);
+  return vec_sel (vec_xviexpsp ((vui32_t) xs,
+				vec_splats ((unsigned int) 126)),
+		  x, spec);
+}
+
+static inline vi32_t
+__vec_fpexp_ilogb_f32 (vf32_t x)
+{
+  vi32_t r, rs;
+
+  r = vec_sub ((vi32_t) vec_xvxexpsp (x), vec_splats ((int) 127));
+  /* A subnormal is sig 2^-149 and its leading bit is bit 31 - clz.  */
+  rs = vec_sub (vec_splats ((int) -118),
+		(vi32_t) vec_clzw (vec_xvxsigsp (x)));
+  return vec_sel (r, rs, vec_issubnormalf32 (x));
+}
+
+static inline vf32_t
+__vec_fpexp_scale_f32 (vf32_t x, vi32_t k)
+{
+  const vi32_t emax = vec_splats ((int) 127);
+  const vi32_t emin = vec_splats ((int) -126);
+  const vi32_t zero = vec_splats ((int) 0);
+  vb32_t hi, lo;
+  vf32_t f;
+  vi32_t d;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    {
+      hi = vec_cmpgt (k, emax);
+      lo = vec_cmplt (k, emin);
+      f = vec_sel (vec_sel (vec_splats (1.0f), vec_splats (0x1p127f), hi),
+		   vec_splats (0x1p-102f), lo);
+      d = vec_sel (vec_sel (zero, emax, hi), vec_splats ((int) -102), lo);
+      x = vec_mul (x, f);
+      k = vec_sub (k, d);
+    }
+  k = vec_min (vec_max (k, emin), emax);
+  f = vec_xviexpsp (vec_splats ((unsigned int) 0),
+		    (vui32_t) vec_add (k, vec_splats ((int) 127)));
+  return vec_mul (x, f);
+}
+
+static inline vf32_t
+__vec_fpexp_nextafter_f32 (vf32_t x, vf32_t y)
+{
+  const vf32_t zero = vec_splats (0.0f);
+  const vui32_t one = vec_splats ((unsigned int) 1);
+  const vui32_t sign = vec_splats ((unsigned int) 1 << 31);
+  vb32_t up;
+  vui32_t r, tiny;
+
+  up = (vb32_t) vec_xor ((vui32_t) vec_cmpgt (y, x),
+			 (vui32_t) vec_sra ((vi32_t) x,
+					    vec_splats ((unsigned int) 31)));
+  r = vec_sel (vec_sub ((vui32_t) x, one), vec_add ((vui32_t) x, one), up);
+  tiny = vec_or (vec_and ((vui32_t) y, sign), one);
+  r = vec_sel (r, tiny, vec_cmpeq (x, zero));
+  r = vec_sel (r, (vui32_t) y, vec_cmpeq (x, y));
+  return vec_sel ((vf32_t) r, vec_add (x, y),
+		  vec_or (vec_isnanf32 (x), vec_isnanf32 (y)));
+}
+
+/* Load the 2 elements at p, or p[0] twice when only 1 is left.  */
+static inline vf64_t
+__vec_fpexp_ld_f64 (const double *p, unsigned long r)
+{
+  vf64_t x;
+
+  if (r < 2)
+    return vec_splats (p[0]);
+  memcpy (&x, p, sizeof (x));
+  return x;
+}
+
+static inline void
+__vec_fpexp_st_f64 (double *p, vf64_t x, unsigned long r)
+{
+  if (r < 2)
+    p[0] = x[0];
+  else
+    memcpy (p, &x, sizeof (x));
+}
+
+static inline vi64_t
+__vec_fpexp_ld_i64 (const int *p, unsigned long r)
+{
+  long long t[2];
+  vi64_t k;
+
+  t[0] = p[0];
+  t[1] = (r < 2) ? p[0] : p[1];
+  memcpy (&k, t, sizeof (k));
+  return k;
+}
+
+static inline void
+__vec_fpexp_st_i64 (int *p, vi64_t k, unsigned long r)
+{
+  p[0] = k[0];
+  if (r >= 2)
+    p[1] = k[1];
+}
+
+/* Copy the r < 4 elements at p into a zero padded vector.  */
+static inline vf32_t
+__vec_fpexp_ld_f32 (const float *p, unsigned long r)
+{
+  float t[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+  vf32_t x;
+
+  memcpy (t, p, (r < 4 ? r : 4) * sizeof (float));
+  memcpy (&x, t, sizeof (x));
+  return x;
+}
+
+static inline void
+__vec_fpexp_st_f32 (float *p, vf32_t x, unsigned long r)
+{
+  float t[4];
+
+  memcpy (t, &x, sizeof (x));
+  memcpy (p, t, (r < 4 ? r : 4) * sizeof (float));
+}
+
+static inline vi32_t
+__vec_fpexp_ld_i32 (const int *p, unsigned long r)
+{
+  int t[4] = { 0, 0, 0, 0 };
+  vi32_t k;
+
+  memcpy (t, p, (r < 4 ? r : 4) * sizeof (int));
+  memcpy (&k, t, sizeof (k));
+  return k;
+}
+
+static inline void
+__vec_fpexp_st_i32 (int *p, vi32_t k, unsigned long r)
+{
+  int t[4];
+
+  memcpy (t, &k, sizeof (k));
+  memcpy (p, t, (r < 4 ? r : 4) * sizeof (int));
+}
+
+void
+__VEC_PWR_IMP (vec_frexp_f64) (double *mant, int *exp, const double *in,
+			       unsigned long n)
+{
+  vf64_t x;
+  vi64_t e;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 2)
+    {
+      x = __vec_fpexp_frexp_f64 (__vec_fpexp_ld_f64 (&in[i], n - i), &e);
+      __vec_fpexp_st_f64 (&mant[i], x, n - i);
+      __vec_fpexp_st_i64 (&exp[i], e, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_ldexp_f64) (double *out, const double *in,
+			       const int *exp, unsigned long n)
+{
+  vf64_t x;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 2)
+    {
+      x = __vec_fpexp_scale_f64 (__vec_fpexp_ld_f64 (&in[i], n - i),
+				 __vec_fpexp_ld_i64 (&exp[i], n - i));
+      __vec_fpexp_st_f64 (&out[i], x, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_scalbn_f64) (double *out, const double *in, int exp,
+				unsigned long n)
+{
+  const vi64_t k = vec_splats ((long long) exp);
+  vf64_t x0, x1;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      memcpy (&x0, &in[i], sizeof (x0));
+      memcpy (&x1, &in[i + 2], sizeof (x1));
+      x0 = __vec_fpexp_scale_f64 (x0, k);
+      x1 = __vec_fpexp_scale_f64 (x1, k);
+      memcpy (&out[i], &x0, sizeof (x0));
+      memcpy (&out[i + 2], &x1, sizeof (x1));
+    }
+  for (; i < n; i += 2)
+    {
+      x0 = __vec_fpexp_scale_f64 (__vec_fpexp_ld_f64 (&in[i], n - i), k);
+      __vec_fpexp_st_f64 (&out[i], x0, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_ilogb_f64) (int *out, const double *in, unsigned long n)
+{
+  vf64_t x;
+  vi64_t r;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 2)
+    {
+      x = __vec_fpexp_ld_f64 (&in[i], n - i);
+      r = __vec_fpexp_ilogb_f64 (x);
+      r = vec_selsd (r, vec_splats ((long long) FP_ILOGB0),
+		     vec_iszerof64 (x));
+      r = vec_selsd (r, vec_splats ((long long) INT_MAX), vec_isinff64 (x));
+      r = vec_selsd (r, vec_splats ((long long) FP_ILOGBNAN),
+		     vec_isnanf64 (x));
+      __vec_fpexp_st_i64 (&out[i], r, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_logb_f64) (double *out, const double *in,
+			      unsigned long n)
+{
+  /* 1.5 2^52, whose low fraction bits hold a small signed integer.  */
+  const vf64_t magic = vec_splats (0x1.8p52);
+  vf64_t x, d;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 2)
+    {
+      x = __vec_fpexp_ld_f64 (&in[i], n - i);
+      d = (vf64_t) vec_addudm ((vui64_t) magic,
+			       (vui64_t) __vec_fpexp_ilogb_f64 (x));
+      d = vec_sub (d, magic);
+      d = vec_sel (d, vec_abs (x),
+		   (vb64_t) vec_or ((vui64_t) vec_isinff64 (x),
+				    (vui64_t) vec_isnanf64 (x)));
+      d = vec_sel (d, vec_splats (-__builtin_inf ()), vec_iszerof64 (x));
+      __vec_fpexp_st_f64 (&out[i], d, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_nextafter_f64) (double *out, const double *x,
+				   const double *y, unsigned long n)
+{
+  vf64_t r;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 2)
+    {
+      r = __vec_fpexp_nextafter_f64 (__vec_fpexp_ld_f64 (&x[i], n - i),
+				     __vec_fpexp_ld_f64 (&y[i], n - i));
+      __vec_fpexp_st_f64 (&out[i], r, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_frexp_f32) (float *mant, int *exp, const float *in,
+			       unsigned long n)
+{
+  vf32_t x;
+  vi32_t e;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      memcpy (&x, &in[i], sizeof (x));
+      x = __vec_fpexp_frexp_f32 (x, &e);
+      memcpy (&mant[i], &x, sizeof (x));
+      memcpy (&exp[i], &e, sizeof (e));
+    }
+  if (i < n)
+    {
+      x = __vec_fpexp_frexp_f32 (__vec_fpexp_ld_f32 (&in[i], n - i), &e);
+      __vec_fpexp_st_f32 (&mant[i], x, n - i);
+      __vec_fpexp_st_i32 (&exp[i], e, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_ldexp_f32) (float *out, const float *in,
+			       const int *exp, unsigned long n)
+{
+  vf32_t x;
+  vi32_t k;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      memcpy (&x, &in[i], sizeof (x));
+      memcpy (&k, &exp[i], sizeof (k));
+      x = __vec_fpexp_scale_f32 (x, k);
+      memcpy (&out[i], &x, sizeof (x));
+    }
+  if (i < n)
+    {
+      x = __vec_fpexp_scale_f32 (__vec_fpexp_ld_f32 (&in[i], n - i),
+				 __vec_fpexp_ld_i32 (&exp[i], n - i));
+      __vec_fpexp_st_f32 (&out[i], x, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_scalbn_f32) (float *out, const float *in, int exp,
+				unsigned long n)
+{
+  const vi32_t k = vec_splats (exp);
+  vf32_t x0, x1;
+  unsigned long i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      memcpy (&x0, &in[i], sizeof (x0));
+      memcpy (&x1, &in[i + 4], sizeof (x1));
+      x0 = __vec_fpexp_scale_f32 (x0, k);
+      x1 = __vec_fpexp_scale_f32 (x1, k);
+      memcpy (&out[i], &x0, sizeof (x0));
+      memcpy (&out[i + 4], &x1, sizeof (x1));
+    }
+  for (; i < n; i += 4)
+    {
+      x0 = __vec_fpexp_scale_f32 (__vec_fpexp_ld_f32 (&in[i], n - i), k);
+      __vec_fpexp_st_f32 (&out[i], x0, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_ilogb_f32) (int *out, const float *in, unsigned long n)
+{
+  vf32_t x;
+  vi32_t r;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 4)
+    {
+      x = __vec_fpexp_ld_f32 (&in[i], n - i);
+      r = __vec_fpexp_ilogb_f32 (x);
+      r = vec_sel (r, vec_splats ((int) FP_ILOGB0), vec_iszerof32 (x));
+      r = vec_sel (r, vec_splats ((int) INT_MAX), vec_isinff32 (x));
+      r = vec_sel (r, vec_splats ((int) FP_ILOGBNAN), vec_isnanf32 (x));
+      __vec_fpexp_st_i32 (&out[i], r, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_logb_f32) (float *out, const float *in,
+			      unsigned long n)
+{
+  const vf32_t magic = vec_splats (0x1.8p23f);
+  vf32_t x, d;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 4)
+    {
+      x = __vec_fpexp_ld_f32 (&in[i], n - i);
+      d = (vf32_t) vec_add ((vi32_t) magic, __vec_fpexp_ilogb_f32 (x));
+      d = vec_sub (d, magic);
+      d = vec_sel (d, vec_abs (x),
+		   vec_or (vec_isinff32 (x), vec_isnanf32 (x)));
+      d = vec_sel (d, vec_splats (-__builtin_inff ()), vec_iszerof32 (x));
+      __vec_fpexp_st_f32 (&out[i], d, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_nextafter_f32) (float *out, const float *x,
+				   const float *y, unsigned long n)
+{
+  vf32_t r;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 4)
+    {
+      r = __vec_fpexp_nextafter_f32 (__vec_fpexp_ld_f32 (&x[i], n - i),
+				     __vec_fpexp_ld_f32 (&y[i], n - i));
+      __vec_fpexp_st_f32 (&out[i], r, n - i);
+    }
+}
@@ -0,0 +1,483 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_gemm_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Int8 and int16 dot products and GEMM microkernels.
+ * Included by vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * The multiply-sum instructions reduce 4 bytes (vmsummbm) or 2
+ * halfwords (vmsumshm) into each word of the accumulator, so the
+ * packed panels hold 4 (int8) or 2 (int16) consecutive k values per
+ * word. For each k group an A panel holds one word for each of its
+ * VEC_GEMM_MR rows (2 vectors) and a B panel one word for each of its
+ * VEC_GEMM_NR columns. The same layout feeds the POWER10 MMA rank-4
+ * (xvi8ger4pp) and rank-2 (xvi16ger2pp) updates, where each pair of
+ * A and B vectors updates one 4x4 accumulator.
+ *
+ * vmsummbm and xvi8ger4pp multiply signed bytes (A) by unsigned
+ * bytes (B). For int8 x int8 the B panel is packed biased by +128
+ * (xor 0x80) and the A panel carries 128 times the sum of each row,
+ * which the microkernel subtracts once per tile.
+ *
+ * Without MMA the 8x8 tile is 16 word accumulators. Each word of the
+ * A vectors (one row) is splatted and multiply-summed with both B
+ * vectors, 16 vmsum per 8 splats and 4 loads.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int64_ppc.h>
+
+#if defined (_ARCH_PWR10) && defined (__MMA__)
+#define __VEC_GEMM_MMA 1
+#endif
+
+static inline unsigned long
+__vec_gemm_kp (unsigned long k, unsigned long kg)
+{
+  return (k + kg - 1) / kg * kg;
+}
+
+/* Store the valid mr x nr part of the 8x8 tile t to c.  */
+static inline void
+__vec_gemm_store (int *c, unsigned long ldc, vi32_t t[8][2],
+		  unsigned long mr, unsigned long nr, int accum)
+{
+  unsigned long i, j;
+
+  for (i = 0; i < mr; i++)
+    {
+      int *ci = &c[i * ldc];
+
+      if (nr == VEC_GEMM_NR)
+	{
+	  vi32_t c0 = t[i][0], c1 = t[i][1];
+
+	  if (accum)
+	    {
+	      vi32_t x0, x1;
+
+	      memcpy (&x0, &ci[0], sizeof (x0));
+	      memcpy (&x1, &ci[4], sizeof (x1));
+	      c0 = vec_add (c0, x0);
+	      c1 = vec_add (c1, x1);
+	    }
+	  memcpy (&ci[0], &c0, sizeof (c0));
+	  memcpy (&ci[4], &c1, sizeof (c1));
+	}
+      else
+	{
+	  int r[VEC_GEMM_NR];
+
+	  memcpy (r, t[i], sizeof (r));
+	  for (j = 0; j < nr; j++)
+	    ci[j] = accum ? (int) ((unsigned int) ci[j] + r[j]) : r[j];
+	}
+    }
+}
+
+#ifdef __VEC_GEMM_MMA
+/* Move the 4 accumulators of an 8x8 tile into t. Each accumulator
+ * row is 4 columns of one row of C.  */
+static inline void
+__vec_gemm_mma_tile (vi32_t t[8][2], __vector_quad *acc)
+{
+  vi32_t r[4];
+  int h, q, i;
+
+  for (q = 0; q < 4; q++)
+    {
+      __builtin_mma_disassemble_acc (r, &acc[q]);
+      h = q >> 1;
+      for (i = 0; i < 4; i++)
+	t[4 * h + i][q & 1] = r[i];
+    }
+}
+#endif
+
+/* Multiply-sum row _R of the tile t, word _W of _A splatted as type
+ * _T, with the B vectors b0 and b1.  */
+#define __VEC_GEMM_ROW(_T, _R, _A, _W) \
+  { \
+    _T s = (_T) vec_splat (_A, _W); \
+    t[_R][0] = vec_msum (s, b0, t[_R][0]); \
+    t[_R][1] = vec_msum (s, b1, t[_R][1]); \
+  }
+
+/* 8x8 int8 microkernel over kp (a multiple of 4) values of k.  */
+static inline void
+__vec_gemm_s8_8x8 (vi32_t t[8][2], const signed char *pa,
+		   const unsigned char *pb, unsigned long kp)
+{
+  unsigned long g;
+  int i;
+#ifdef __VEC_GEMM_MMA
+  __vector_quad acc[4];
+
+  __builtin_mma_xxsetaccz (&acc[0]);
+  __builtin_mma_xxsetaccz (&acc[1]);
+  __builtin_mma_xxsetaccz (&acc[2]);
+  __builtin_mma_xxsetaccz (&acc[3]);
+  for (g = 0; g < kp; g += 4)
+    {
+      vui8_t a0, a1, b0, b1;
+
+      memcpy (&a0, &pa[8 * g], sizeof (a0));
+      memcpy (&a1, &pa[8 * g + 16], sizeof (a1));
+      memcpy (&b0, &pb[8 * g], sizeof (b0));
+      memcpy (&b1, &pb[8 * g + 16], sizeof (b1));
+      __builtin_mma_xvi8ger4pp (&acc[0], a0, b0);
+      __builtin_mma_xvi8ger4pp (&acc[1], a0, b1);
+      __builtin_mma_xvi8ger4pp (&acc[2], a1, b0);
+      __builtin_mma_xvi8ger4pp (&acc[3], a1, b1);
+    }
+  __vec_gemm_mma_tile (t, acc);
+#else
+  for (i = 0; i < 8; i++)
+    t[i][0] = t[i][1] = vec_splats ((int) 0);
+  for (g = 0; g < kp; g += 4)
+    {
+      vi32_t a0, a1;
+      vui8_t b0, b1;
+
+      memcpy (&a0, &pa[8 * g], sizeof (a0));
+      memcpy (&a1, &pa[8 * g + 16], sizeof (a1));
+      memcpy (&b0, &pb[8 * g], sizeof (b0));
+      memcpy (&b1, &pb[8 * g + 16], sizeof (b1));
+      __VEC_GEMM_ROW (vi8_t, 0, a0, 0);
+      __VEC_GEMM_ROW (vi8_t, 1, a0, 1);
+      __VEC_GEMM_ROW (vi8_t, 2, a0, 2);
+      __VEC_GEMM_ROW (vi8_t, 3, a0, 3);
+      __VEC_GEMM_ROW (vi8_t, 4, a1, 0);
+      __VEC_GEMM_ROW (vi8_t, 5, a1, 1);
+      __VEC_GEMM_ROW (vi8_t, 6, a1, 2);
+      __VEC_GEMM_ROW (vi8_t, 7, a1, 3);
+    }
+#endif
+  /* Remove the +128 bias of B.  */
+  for (i = 0; i < 8; i++)
+    {
+      int corr;
+      vi32_t vc;
+
+      memcpy (&corr, &pa[8 * kp + 4 * i], sizeof (corr));
+      vc = vec_splats (corr);
+      t[i][0] = vec_sub (t[i][0], vc);
+      t[i][1] = vec_sub (t[i][1], vc);
+    }
+}
+
+/* 8x8 int16 microkernel over kp (a multiple of 2) values of k.  */
+static inline void
+__vec_gemm_s16_8x8 (vi32_t t[8][2], const short *pa, const short *pb,
+		    unsigned long kp)
+{
+  unsigned long g;
+#ifdef __VEC_GEMM_MMA
+  __vector_quad acc[4];
+
+  __builtin_mma_xxsetaccz (&acc[0]);
+  __builtin_mma_xxsetaccz (&acc[1]);
+  __builtin_mma_xxsetaccz (&acc[2]);
+  __builtin_mma_xxsetaccz (&acc[3]);
+  for (g = 0; g < kp; g += 2)
+    {
+      vui8_t a0, a1, b0, b1;
+
+      memcpy (&a0, &pa[8 * g], sizeof (a0));
+      memcpy (&a1, &pa[8 * g + 8], sizeof (a1));
+      memcpy (&b0, &pb[8 * g], sizeof (b0));
+      memcpy (&b1, &pb[8 * g + 8], sizeof (b1));
+      __builtin_mma_xvi16ger2pp (&acc[0], a0, b0);
+      __builtin_mma_xvi16ger2pp (&acc[1], a0, b1);
+      __builtin_mma_xvi16ger2pp (&acc[2], a1, b0);
+      __builtin_mma_xvi16ger2pp (&acc[3], a1, b1);
+    }
+  __vec_gemm_mma_tile (t, acc);
+#else
+  int i;
+
+  for (i = 0; i < 8; i++)
+    t[i][0] = t[i][1] = vec_splats ((int) 0);
+  for (g = 0; g < kp; g += 2)
+    {
+      vi32_t a0, a1;
+      vi16_t b0, b1;
+
+      memcpy (&a0, &pa[8 * g], sizeof (a0));
+      memcpy (&a1, &pa[8 * g + 8], sizeof (a1));
+      memcpy (&b0, &pb[8 * g], sizeof (b0));
+      memcpy (&b1, &pb[8 * g + 8], sizeof (b1));
+      __VEC_GEMM_ROW (vi16_t, 0, a0, 0);
+      __VEC_GEMM_ROW (vi16_t, 1, a0, 1);
+      __VEC_GEMM_ROW (vi16_t, 2, a0, 2);
+      __VEC_GEMM_ROW (vi16_t, 3, a0, 3);
+      __VEC_GEMM_ROW (vi16_t, 4, a1, 0);
+      __VEC_GEMM_ROW (vi16_t, 5, a1, 1);
+      __VEC_GEMM_ROW (vi16_t, 6, a1, 2);
+      __VEC_GEMM_ROW (vi16_t, 7, a1, 3);
+    }
+#endif
+}
+
+void
+__VEC_PWR_IMP (vec_gemm_pack_a_s8) (signed char *pa, const signed char *a,
+				    unsigned long lda, unsigned long m,
+				    unsigned long k)
+{
+  const unsigned long kp = __vec_gemm_kp (k, 4);
+  unsigned long i, r, g, j;
+
+  for (i = 0; i < m; i += VEC_GEMM_MR)
+    {
+      for (r = 0; r < VEC_GEMM_MR; r++)
+	{
+	  int sum = 0;
+
+	  for (g = 0; g < kp; g += 4)
+	    for (j = 0; j < 4; j++)
+	      {
+		signed char x = 0;
+
+		if (i + r < m && g + j < k)
+		  x = a[(i + r) * lda + g + j];
+		pa[8 * g + 4 * r + j] = x;
+		sum += x;
+	      }
+	  sum *= 128;
+	  memcpy (&pa[8 * kp + 4 * r], &sum, sizeof (sum));
+	}
+      pa += 8 * kp + 4 * VEC_GEMM_MR;
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_gemm_pack_b_s8) (unsigned char *pb, const signed char *b,
+				    unsigned long ldb, unsigned long k,
+				    unsigned long n)
+{
+  const unsigned long kp = __vec_gemm_kp (k, 4);
+  unsigned long i, c, g, j;
+
+  for (i = 0; i < n; i += VEC_GEMM_NR)
+    {
+      for (g = 0; g < kp; g += 4)
+	for (c = 0; c < VEC_GEMM_NR; c++)
+	  for (j = 0; j < 4; j++)
+	    {
+	      signed char x = 0;
+
+	      if (i + c < n && g + j < k)
+		x = b[(g + j) * ldb + i + c];
+	      pb[8 * g + 4 * c + j] = (unsigned char) x ^ 0x80;
+	    }
+      pb += 8 * kp;
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_gemm_s8) (int *c, unsigned long ldc,
+			     const signed char *pa, const unsigned char *pb,
+			     unsigned long m, unsigned long n, unsigned long k,
+			     int accum)
+{
+  const unsigned long kp = __vec_gemm_kp (k, 4);
+  const unsigned long sa = 8 * kp + 4 * VEC_GEMM_MR;
+  vi32_t t[8][2];
+  unsigned long i, j, mr, nr;
+
+  for (j = 0; j < n; j += VEC_GEMM_NR)
+    {
+      const unsigned char *pbj = &pb[(j / VEC_GEMM_NR) * 8 * kp];
+
+      nr = (n - j < VEC_GEMM_NR) ? n - j : VEC_GEMM_NR;
+      for (i = 0; i < m; i += VEC_GEMM_MR)
+	{
+	  mr = (m - i < VEC_GEMM_MR) ? m - i : VEC_GEMM_MR;
+	  __vec_gemm_s8_8x8 (t, &pa[(i / VEC_GEMM_MR) * sa], pbj, kp);
+	  __vec_gemm_store (&c[i * ldc + j], ldc, t, mr, nr, accum);
+	}
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_gemm_pack_a_s16) (short *pa, const short *a,
+				     unsigned long lda, unsigned long m,
+				     unsigned long k)
+{
+  const unsigned long kp = __vec_gemm_kp (k, 2);
+  unsigned long i, r, g, j;
+
+  for (i = 0; i < m; i += VEC_GEMM_MR)
+    {
+      for (g = 0; g < kp; g += 2)
+	for (r = 0; r < VEC_GEMM_MR; r++)
+	  for (j = 0; j < 2; j++)
+	    {
+	      short x = 0;
+
+	      if (i + r < m && g + j < k)
+		x = a[(i + r) * lda + g + j];
+	      pa[8 * g + 2 * r + j] = x;
+	    }
+      pa += 8 * kp;
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_gemm_pack_b_s16) (short *pb, const short *b,
+				     unsigned long ldb, unsigned long k,
+				     unsigned long n)
+{
+  const unsigned long kp = __vec_gemm_kp (k, 2);
+  unsigned long i, c, g, j;
+
+  for (i = 0; i < n; i += VEC_GEMM_NR)
+    {
+      for (g = 0; g < kp; g += 2)
+	for (c = 0; c < VEC_GEMM_NR; c++)
+	  for (j = 0; j < 2; j++)
+	    {
+	      short x = 0;
+
+	      if (i + c < n && g + j < k)
+		x = b[(g + j) * ldb + i + c];
+	      pb[8 * g + 2 * c + j] = x;
+	    }
+      pb += 8 * kp;
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_gemm_s16) (int *c, unsigned long ldc, const short *pa,
+			      const short *pb, unsigned long m,
+			      unsigned long n, unsigned long k, int accum)
+{
+  const unsigned long kp = __vec_gemm_kp (k, 2);
+  vi32_t t[8][2];
+  unsigned long i, j, mr, nr;
+
+  for (j = 0; j < n; j += VEC_GEMM_NR)
+    {
+      const short *pbj = &pb[(j / VEC_GEMM_NR) * 8 * kp];
+
+      nr = (n - j < VEC_GEMM_NR) ? n - j : VEC_GEMM_NR;
+      for (i = 0; i < m; i += VEC_GEMM_MR)
+	{
+	  mr = (m - i < VEC_GEMM_MR) ? m - i : VEC_GEMM_MR;
+	  __vec_gemm_s16_8x8 (t, &pa[(i / VEC_GEMM_MR) * 8 * kp], pbj, kp);
+	  __vec_gemm_store (&c[i * ldc + j], ldc, t, mr, nr, accum);
+	}
+    }
+}
+
+int
+__VEC_PWR_IMP (vec_dot_s8) (const signed char *a, const signed char *b,
+			    unsigned long n)
+{
+  const vui8_t bias = vec_splats ((unsigned char) 0x80);
+  const vui8_t ones = vec_splats ((unsigned char) 1);
+  vi32_t s0 = vec_splats ((int) 0), s1 = s0, r0 = s0, r1 = s0;
+  unsigned int sum;
+  unsigned long i;
+
+  /* a * b = a * (b + 128) - 128 * a, with the row sum of a
+   * accumulated by a second vmsummbm with ones.  */
+  for (i = 0; i + 32 <= n; i += 32)
+    {
+      vi8_t x0, x1;
+      vui8_t y0, y1;
+
+      memcpy (&x0, &a[i], sizeof (x0));
+      memcpy (&x1, &a[i + 16], sizeof (x1));
+      memcpy (&y0, &b[i], sizeof (y0));
+      memcpy (&y1, &b[i + 16], sizeof (y1));
+      s0 = vec_msum (x0, vec_xor (y0, bias), s0);
+      s1 = vec_msum (x1, vec_xor (y1, bias), s1);
+      r0 = vec_msum (x0, ones, r0);
+      r1 = vec_msum (x1, ones, r1);
+    }
+  s0 = vec_sub (vec_add (s0, s1), vec_sl (vec_add (r0, r1),
+					  vec_splat_u32 (7)));
+  sum = (unsigned int) s0[0] + s0[1] + s0[2] + s0[3];
+  for (; i < n; i++)
+    sum += a[i] * b[i];
+  return (int) sum;
+}
+
+int
+__VEC_PWR_IMP (vec_dot_s16) (const short *a, const short *b,
+			     unsigned long n)
+{
+  vi32_t s0 = vec_splats ((int) 0), s1 = s0;
+  unsigned int sum;
+  unsigned long i;
+
+  for (i = 0; i + 16 <= n; i += 16)
+    {
+      vi16_t x0, x1, y0, y1;
+
+      memcpy (&x0, &a[i], sizeof (x0));
+      memcpy (&x1, &a[i + 8], sizeof (x1));
+      memcpy (&y0, &b[i], sizeof (y0));
+      memcpy (&y1, &b[i + 8], sizeof (y1));
+      s0 = vec_msum (x0, y0, s0);
+      s1 = vec_msum (x1, y1, s1);
+    }
+  s0 = vec_add (s0, s1);
+  sum = (unsigned int) s0[0] + s0[1] + s0[2] + s0[3];
+  for (; i < n; i++)
+    sum += a[i] * b[i];
+  return (int) sum;
+}
+
+long long
+__VEC_PWR_IMP (vec_dot_s16_s64) (const short *a, const short *b,
+				 unsigned long n)
+{
+  vi64_t s0 = vec_splats ((long long) 0);
+  vi64_t s1 = s0, s2 = s0, s3 = s0;
+  long long sum;
+  unsigned long i;
+
+  /* vmsumshm can overflow a word for a pair of -32768 * -32768, so
+   * widen the even and odd products instead.  */
+  for (i = 0; i + 8 <= n; i += 8)
+    {
+      vi16_t x, y;
+      vi32_t pe, po;
+
+      memcpy (&x, &a[i], sizeof (x));
+      memcpy (&y, &b[i], sizeof (y));
+      pe = vec_mule (x, y);
+      po = vec_mulo (x, y);
+      s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) vec_vupkhsw (pe));
+      s1 = (vi64_t) vec_addudm ((vui64_t) s1, (vui64_t) vec_vupklsw (pe));
+      s2 = (vi64_t) vec_addudm ((vui64_t) s2, (vui64_t) vec_vupkhsw (po));
+      s3 = (vi64_t) vec_addudm ((vui64_t) s3, (vui64_t) vec_vupklsw (po));
+    }
+  s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) s1);
+  s2 = (vi64_t) vec_addudm ((vui64_t) s2, (vui64_t) s3);
+  s0 = (vi64_t) vec_addudm ((vui64_t) s0, (vui64_t) s2);
+  sum = s0[0] + s0[1];
+  for (; i < n; i++)
+    sum += a[i] * b[i];
+  return sum;
+}
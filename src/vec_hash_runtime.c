@@ -0,0 +1,325 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_hash_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Multiply-fold (wyhash style) 64 and 128-bit hash. Included by
+ * vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * The mixing step is mum(a, b): the 128-bit product a * b with the
+ * high and low doublewords XORed together. Buffers longer than 64
+ * bytes run 4 independent mum chains, 2 per vector, over 16 bytes
+ * each per 64 byte stripe. Each vector step is one vec_vmuleud and
+ * one vec_vmuloud, so POWER8 gets the vmulouw based implementation,
+ * POWER9 vmsumudm, and POWER10 the native vmuleud/vmuloud.
+ * The remaining bytes (and inputs of 16 bytes or less) go through
+ * the scalar mum chain.
+ *
+ * Data is read as little endian doublewords, so the hash of a buffer
+ * is the same on big and little endian systems. The batch functions
+ * hash 2 (doubleword and quadword keys) or 4 (word keys) keys per
+ * vector, producing the same value as vec_hash64() of the key in
+ * little endian byte order.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+
+#define __VEC_HASH_P0 0xa0761d6478bd642fULL
+#define __VEC_HASH_P1 0xe7037ed1a0b428dbULL
+#define __VEC_HASH_P2 0x8ebc6af09c88c6e3ULL
+#define __VEC_HASH_P3 0x589965cc75374cc3ULL
+
+static inline unsigned long long
+__vec_hash_r8 (const unsigned char *p)
+{
+  unsigned long long v;
+
+  memcpy (&v, p, sizeof (v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64 (v);
+#endif
+  return v;
+}
+
+/* Read len (0-7) bytes, zero extended.  */
+static inline unsigned long long
+__vec_hash_rn (const unsigned char *p, unsigned long len)
+{
+  unsigned char b[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+
+  memcpy (b, p, len);
+  return __vec_hash_r8 (b);
+}
+
+/* Replace a and b with the low and high doublewords of a * b.  */
+static inline void
+__vec_hash_mul (unsigned long long *a, unsigned long long *b)
+{
+  unsigned __int128 r = (unsigned __int128) *a * *b;
+
+  *a = (unsigned long long) r;
+  *b = (unsigned long long) (r >> 64);
+}
+
+static inline unsigned long long
+__vec_hash_mum (unsigned long long a, unsigned long long b)
+{
+  __vec_hash_mul (&a, &b);
+  return a ^ b;
+}
+
+/* Load 16 bytes as 2 little endian doublewords.  */
+static inline vui64_t
+__vec_hash_ld (const unsigned char *p)
+{
+  vui64_t v;
+
+  memcpy (&v, p, sizeof (v));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = vec_revbd (v);
+#endif
+  return v;
+}
+
+/* Vector mul: return the low doublewords and set *hi to the high
+ * doublewords of the products of each doubleword element.  */
+static inline vui64_t
+__vec_hash_mul2 (vui64_t a, vui64_t b, vui64_t *hi)
+{
+  vui128_t pe, po;
+
+  pe = vec_vmuleud (a, b);
+  po = vec_vmuloud (a, b);
+  *hi = vec_mrgahd (pe, po);
+  return vec_mrgald (pe, po);
+}
+
+/* Vector mum of each doubleword element.  */
+static inline vui64_t
+__vec_hash_mum2 (vui64_t a, vui64_t b)
+{
+  vui64_t lo, hi;
+
+  lo = __vec_hash_mul2 (a, b, &hi);
+  return vec_xor (lo, hi);
+}
+
+static inline unsigned long long
+__vec_hash_seed (unsigned long long seed)
+{
+  return seed ^ __vec_hash_mum (seed ^ __VEC_HASH_P0, __VEC_HASH_P1);
+}
+
+/* Hash len bytes at p with the mixed seed s. If hi is not NULL, also
+ * run a second chain from seed t for the high doubleword of the
+ * 128-bit hash.  */
+static inline unsigned long long
+__vec_hash_core (const unsigned char *p, unsigned long len,
+		 unsigned long long s, unsigned long long *hi)
+{
+  unsigned long long t = __vec_hash_mum (s ^ __VEC_HASH_P2, __VEC_HASH_P3);
+  unsigned long long a, b, c, d;
+  unsigned long i = len;
+
+  if (len <= 16)
+    {
+      if (len > 8)
+	{
+	  a = __vec_hash_r8 (p);
+	  b = __vec_hash_r8 (p + len - 8);
+	}
+      else
+	{
+	  a = (len == 8) ? __vec_hash_r8 (p) : __vec_hash_rn (p, len);
+	  b = 0;
+	}
+    }
+  else
+    {
+      if (i > 64)
+	{
+	  const vui64_t k0 = (vui64_t) { __VEC_HASH_P1, __VEC_HASH_P2 };
+	  const vui64_t k1 = (vui64_t) { __VEC_HASH_P3, __VEC_HASH_P0 };
+	  vui64_t x = (vui64_t) { s, t };
+	  vui64_t y = (vui64_t) { s ^ __VEC_HASH_P2, t ^ __VEC_HASH_P3 };
+
+	  do
+	    {
+	      vui64_t d0 = __vec_hash_ld (p);
+	      vui64_t d1 = __vec_hash_ld (p + 16);
+	      vui64_t d2 = __vec_hash_ld (p + 32);
+	      vui64_t d3 = __vec_hash_ld (p + 48);
+
+	      x = __vec_hash_mum2 (vec_xor (d0, k0), vec_xor (d1, x));
+	      y = __vec_hash_mum2 (vec_xor (d2, k1), vec_xor (d3, y));
+	      p += 64;
+	      i -= 64;
+	    }
+	  while (i > 64);
+	  s = x[0] ^ x[1] ^ y[0] ^ y[1];
+	  t = __vec_hash_mum (x[0] ^ y[0], x[1] ^ y[1]);
+	}
+      while (i > 16)
+	{
+	  a = __vec_hash_r8 (p);
+	  b = __vec_hash_r8 (p + 8);
+	  s = __vec_hash_mum (a ^ __VEC_HASH_P1, b ^ s);
+	  if (hi != NULL)
+	    t = __vec_hash_mum (a ^ __VEC_HASH_P3, b ^ t);
+	  p += 16;
+	  i -= 16;
+	}
+      /* The last 16 bytes of the buffer, may overlap the chain.  */
+      a = __vec_hash_r8 (p + i - 16);
+      b = __vec_hash_r8 (p + i - 8);
+    }
+
+  if (hi != NULL)
+    {
+      c = a ^ __VEC_HASH_P2;
+      d = b ^ t;
+      __vec_hash_mul (&c, &d);
+      *hi = __vec_hash_mum (c ^ __VEC_HASH_P3 ^ len, d ^ __VEC_HASH_P2);
+    }
+  a ^= __VEC_HASH_P1;
+  b ^= s;
+  __vec_hash_mul (&a, &b);
+  return __vec_hash_mum (a ^ __VEC_HASH_P0 ^ len, b ^ __VEC_HASH_P1);
+}
+
+/* The short input path of __vec_hash_core() for 2 keys at once.
+ * a and b are the first and last doublewords of each key, s the
+ * mixed seed, len the key length.  */
+static inline vui64_t
+__vec_hash_short2 (vui64_t a, vui64_t b, unsigned long long s,
+		   unsigned long long len)
+{
+  const vui64_t p0 = vec_splats (__VEC_HASH_P0 ^ len);
+  const vui64_t p1 = vec_splats (__VEC_HASH_P1);
+  vui64_t lo, hi;
+
+  lo = __vec_hash_mul2 (vec_xor (a, p1), vec_xor (b, vec_splats (s)), &hi);
+  return __vec_hash_mum2 (vec_xor (lo, p0), vec_xor (hi, p1));
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_hash64) (const void *buf, unsigned long len,
+			    unsigned long long seed)
+{
+  return __vec_hash_core (buf, len, __vec_hash_seed (seed), NULL);
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_hash128) (const void *buf, unsigned long len,
+			     unsigned long long seed)
+{
+  unsigned long long hi;
+  __VEC_U_128 r;
+
+  r.ulong.lower = __vec_hash_core (buf, len, __vec_hash_seed (seed), &hi);
+  r.ulong.upper = hi;
+  return r.vx1;
+}
+
+void
+__VEC_PWR_IMP (vec_hash64_batch_u32) (unsigned long long *out,
+				      const unsigned int *keys,
+				      unsigned long n, unsigned long long seed)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  unsigned long long s = __vec_hash_seed (seed);
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      vui32_t k;
+      vui64_t h0, h1;
+
+      memcpy (&k, &keys[i], sizeof (k));
+      h0 = __vec_hash_short2 (vec_vupkhuw (k), zero, s, 4);
+      h1 = __vec_hash_short2 (vec_vupkluw (k), zero, s, 4);
+      memcpy (&out[i], &h0, sizeof (h0));
+      memcpy (&out[i + 2], &h1, sizeof (h1));
+    }
+  for (; i < n; i++)
+    {
+      unsigned char b[4];
+      unsigned int k = keys[i];
+
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+      k = __builtin_bswap32 (k);
+#endif
+      memcpy (b, &k, sizeof (b));
+      out[i] = __vec_hash_core (b, 4, s, NULL);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_hash64_batch_u64) (unsigned long long *out,
+				      const unsigned long long *keys,
+				      unsigned long n, unsigned long long seed)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  unsigned long long s = __vec_hash_seed (seed);
+  unsigned long i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      vui64_t k, h;
+
+      memcpy (&k, &keys[i], sizeof (k));
+      h = __vec_hash_short2 (k, zero, s, 8);
+      memcpy (&out[i], &h, sizeof (h));
+    }
+  if (i < n)
+    {
+      vui64_t h;
+
+      h = __vec_hash_short2 (vec_splats (keys[i]), zero, s, 8);
+      out[i] = h[0];
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_hash64_batch_u128) (unsigned long long *out,
+				       const vui128_t *keys,
+				       unsigned long n,
+				       unsigned long long seed)
+{
+  unsigned long long s = __vec_hash_seed (seed);
+  unsigned long i;
+
+  /* vec_mrgald/vec_mrgahd keep the keys in algebraic order, so key i
+   * hashes into the high doubleword of the result.  */
+  for (i = 0; i < n; i += 2)
+    {
+      vui128_t k0 = keys[i];
+      vui128_t k1 = (i + 1 < n) ? keys[i + 1] : k0;
+      __VEC_U_128 h;
+
+      h.vx1 = (vui128_t) __vec_hash_short2 (vec_mrgald (k0, k1),
+					    vec_mrgahd (k0, k1), s, 16);
+      out[i] = h.ulong.upper;
+      if (i + 1 < n)
+	out[i + 1] = h.ulong.lower;
+    }
+}
@@ -0,0 +1,428 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_htab_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Open addressing hash table core for doubleword and quadword keys.
+ * Included by vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * The slots are divided into groups of 16. Each slot has a control
+ * byte: a 7-bit tag from the key hash if the slot is full, or
+ * __VEC_HTAB_EMPTY / __VEC_HTAB_DELETED. One probe loads the 16
+ * control bytes of a group into a vector, compares all of them with
+ * the splatted tag (vec_cmpeq) and walks the matches in element order
+ * with vec_cntlz_lsbb_bi(). Only slots with a matching tag have the
+ * key compared (vec_cmpequd / vec_cmpuq_all_eq). A group that
+ * contains an empty slot ends the probe sequence.
+ *
+ * Groups are probed in triangular order (g, g+1, g+3, g+6 ...), which
+ * visits every group of a power of 2 group count.  */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+
+#define __VEC_HTAB_GROUP 16
+#define __VEC_HTAB_EMPTY 0x80
+#define __VEC_HTAB_DELETED 0xfe
+/* Keys hashed and prefetched ahead of the current batch probe.  */
+#define __VEC_HTAB_AHEAD 8
+/* Cache line size for table allocation and prefetch.  */
+#define __VEC_HTAB_LINE 128
+
+/* splitmix64 finalizer. All bits of the result depend on all bits of
+ * the key, so the tag (low 7 bits) and group index (next bits) are
+ * independent.  */
+static inline unsigned long long
+__vec_htab_mix (unsigned long long h)
+{
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+static inline unsigned long long
+__vec_htab_hash_u64 (unsigned long long key)
+{
+  return __vec_htab_mix (key);
+}
+
+static inline unsigned long long
+__vec_htab_hash_u128 (vui128_t key)
+{
+  __VEC_U_128 k;
+
+  k.vx1 = key;
+  return __vec_htab_mix (k.ulong.lower ^ __vec_htab_mix (k.ulong.upper));
+}
+
+static inline vui8_t
+__vec_htab_ctrl (const vec_htab_t *t, unsigned long g)
+{
+  return vec_ld (0, &t->ctrl[g * __VEC_HTAB_GROUP]);
+}
+
+/* Mask of the control bytes of grp equal to tag.  */
+static inline vui8_t
+__vec_htab_match (vui8_t grp, unsigned int tag)
+{
+  return (vui8_t) vec_cmpeq (grp, vec_splats ((unsigned char) tag));
+}
+
+/* Clear the mask bytes at and before element index idx.  */
+static inline vui8_t
+__vec_htab_next (vui8_t mask, int idx)
+{
+  const vui8_t iota =
+    { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+  vui8_t after;
+
+  after = (vui8_t) vec_cmpgt (iota, vec_splats ((unsigned char) idx));
+  return vec_and (mask, after);
+}
+
+/* Nonzero if grp contains an empty slot.  */
+static inline int
+__vec_htab_has_empty (vui8_t grp)
+{
+  const vui8_t empty = vec_splats ((unsigned char) __VEC_HTAB_EMPTY);
+
+  return vec_first_match_byte_index (grp, empty) < 16;
+}
+
+/* Index of the first empty or deleted (sign bit set) slot of grp,
+ * or 16.  */
+static inline int
+__vec_htab_first_free (vui8_t grp)
+{
+  const vui8_t full_max = vec_splats ((unsigned char) 0x7f);
+
+  return vec_cntlz_lsbb_bi ((vui8_t) vec_cmpgt (grp, full_max));
+}
+
+static inline int
+__vec_htab_key_eq_u64 (const vec_htab_t *t, unsigned long slot,
+		       unsigned long long key)
+{
+  const unsigned long long *keys = t->keys;
+  vui64_t pair, eq;
+
+  /* Keys are 16-byte aligned in pairs, so compare the pair holding
+   * the slot and test its doubleword.  */
+  memcpy (&pair, &keys[slot & ~1UL], sizeof (pair));
+  eq = (vui64_t) vec_cmpequd (pair, vec_splats (key));
+  return eq[slot & 1] != 0;
+}
+
+static inline int
+__vec_htab_key_eq_u128 (const vec_htab_t *t, unsigned long slot,
+			vui128_t key)
+{
+  const vui128_t *keys = t->keys;
+
+  return vec_cmpuq_all_eq (keys[slot], key);
+}
+
+static int
+__vec_htab_init (vec_htab_t *t, unsigned long capacity, size_t keysize)
+{
+  unsigned long groups = 1, slots;
+  void *ctrl, *keys;
+
+  /* Keep the load factor at or below 7/8.  */
+  while ((groups * __VEC_HTAB_GROUP / 8) * 7 < capacity)
+    groups <<= 1;
+  slots = groups * __VEC_HTAB_GROUP;
+
+  if (posix_memalign (&ctrl, __VEC_HTAB_LINE, slots) != 0)
+    return -1;
+  if (posix_memalign (&keys, __VEC_HTAB_LINE, slots * keysize) != 0)
+    {
+      free (ctrl);
+      return -1;
+    }
+  memset (ctrl, __VEC_HTAB_EMPTY, slots);
+
+  t->ctrl = ctrl;
+  t->keys = keys;
+  t->gmask = groups - 1;
+  t->count = 0;
+  t->limit = (slots / 8) * 7;
+  return 0;
+}
+
+/* Return the slot of key (with hash h), or -1. If free_slot is not
+ * NULL, also set *free_slot to the first empty or deleted slot on the
+ * probe sequence (or leave it -1 if there are none).  */
+static long
+__vec_htab_find_u64 (const vec_htab_t *t, unsigned long long key,
+		     unsigned long long h, long *free_slot)
+{
+  unsigned long g = (h >> 7) & t->gmask;
+  unsigned int tag = h & 0x7f;
+  unsigned long step;
+
+  for (step = 1; step <= t->gmask + 1; step++)
+    {
+      vui8_t grp = __vec_htab_ctrl (t, g);
+      vui8_t mask = __vec_htab_match (grp, tag);
+      int idx = vec_cntlz_lsbb_bi (mask);
+
+      while (idx < 16)
+	{
+	  unsigned long slot = g * __VEC_HTAB_GROUP + idx;
+	  if (__vec_htab_key_eq_u64 (t, slot, key))
+	    return slot;
+	  mask = __vec_htab_next (mask, idx);
+	  idx = vec_cntlz_lsbb_bi (mask);
+	}
+      if (free_slot != NULL && *free_slot < 0)
+	{
+	  idx = __vec_htab_first_free (grp);
+	  if (idx < 16)
+	    *free_slot = g * __VEC_HTAB_GROUP + idx;
+	}
+      if (__vec_htab_has_empty (grp))
+	break;
+      g = (g + step) & t->gmask;
+    }
+  return -1;
+}
+
+static long
+__vec_htab_find_u128 (const vec_htab_t *t, vui128_t key,
+		      unsigned long long h, long *free_slot)
+{
+  unsigned long g = (h >> 7) & t->gmask;
+  unsigned int tag = h & 0x7f;
+  unsigned long step;
+
+  for (step = 1; step <= t->gmask + 1; step++)
+    {
+      vui8_t grp = __vec_htab_ctrl (t, g);
+      vui8_t mask = __vec_htab_match (grp, tag);
+      int idx = vec_cntlz_lsbb_bi (mask);
+
+      while (idx < 16)
+	{
+	  unsigned long slot = g * __VEC_HTAB_GROUP + idx;
+	  if (__vec_htab_key_eq_u128 (t, slot, key))
+	    return slot;
+	  mask = __vec_htab_next (mask, idx);
+	  idx = vec_cntlz_lsbb_bi (mask);
+	}
+      if (free_slot != NULL && *free_slot < 0)
+	{
+	  idx = __vec_htab_first_free (grp);
+	  if (idx < 16)
+	    *free_slot = g * __VEC_HTAB_GROUP + idx;
+	}
+      if (__vec_htab_has_empty (grp))
+	break;
+      g = (g + step) & t->gmask;
+    }
+  return -1;
+}
+
+int
+__VEC_PWR_IMP (vec_htab_init_u64) (vec_htab_t *t, unsigned long capacity)
+{
+  return __vec_htab_init (t, capacity, sizeof (unsigned long long));
+}
+
+int
+__VEC_PWR_IMP (vec_htab_init_u128) (vec_htab_t *t, unsigned long capacity)
+{
+  return __vec_htab_init (t, capacity, sizeof (vui128_t));
+}
+
+void
+__VEC_PWR_IMP (vec_htab_free) (vec_htab_t *t)
+{
+  free (t->ctrl);
+  free (t->keys);
+  t->ctrl = NULL;
+  t->keys = NULL;
+  t->count = 0;
+  t->limit = 0;
+}
+
+long
+__VEC_PWR_IMP (vec_htab_find_u64) (const vec_htab_t *t,
+				   unsigned long long key)
+{
+  return __vec_htab_find_u64 (t, key, __vec_htab_hash_u64 (key), NULL);
+}
+
+long
+__VEC_PWR_IMP (vec_htab_find_u128) (const vec_htab_t *t, vui128_t key)
+{
+  return __vec_htab_find_u128 (t, key, __vec_htab_hash_u128 (key), NULL);
+}
+
+long
+__VEC_PWR_IMP (vec_htab_insert_u64) (vec_htab_t *t, unsigned long long key)
+{
+  unsigned long long h = __vec_htab_hash_u64 (key);
+  unsigned long long *keys = t->keys;
+  long slot, free_slot = -1;
+
+  slot = __vec_htab_find_u64 (t, key, h, &free_slot);
+  if (slot >= 0)
+    return slot;
+  if (free_slot < 0 || t->count >= t->limit)
+    return -1;
+
+  keys[free_slot] = key;
+  t->ctrl[free_slot] = h & 0x7f;
+  t->count++;
+  return free_slot;
+}
+
+long
+__VEC_PWR_IMP (vec_htab_insert_u128) (vec_htab_t *t, vui128_t key)
+{
+  unsigned long long h = __vec_htab_hash_u128 (key);
+  vui128_t *keys = t->keys;
+  long slot, free_slot = -1;
+
+  slot = __vec_htab_find_u128 (t, key, h, &free_slot);
+  if (slot >= 0)
+    return slot;
+  if (free_slot < 0 || t->count >= t->limit)
+    return -1;
+
+  keys[free_slot] = key;
+  t->ctrl[free_slot] = h & 0x7f;
+  t->count++;
+  return free_slot;
+}
+
+long
+__VEC_PWR_IMP (vec_htab_erase_u64) (vec_htab_t *t, unsigned long long key)
+{
+  long slot;
+
+  slot = __vec_htab_find_u64 (t, key, __vec_htab_hash_u64 (key), NULL);
+  if (slot >= 0)
+    {
+      t->ctrl[slot] = __VEC_HTAB_DELETED;
+      t->count--;
+    }
+  return slot;
+}
+
+long
+__VEC_PWR_IMP (vec_htab_erase_u128) (vec_htab_t *t, vui128_t key)
+{
+  long slot;
+
+  slot = __vec_htab_find_u128 (t, key, __vec_htab_hash_u128 (key), NULL);
+  if (slot >= 0)
+    {
+      t->ctrl[slot] = __VEC_HTAB_DELETED;
+      t->count--;
+    }
+  return slot;
+}
+
+/* Touch the control group and the key lines of the first probe
+ * group for hash h.  */
+static inline void
+__vec_htab_prefetch (const vec_htab_t *t, unsigned long long h,
+		     size_t keysize)
+{
+  unsigned long g = (h >> 7) & t->gmask;
+  const char *k = (const char *) t->keys
+      + g * __VEC_HTAB_GROUP * keysize;
+  size_t off;
+
+  __builtin_prefetch (&t->ctrl[g * __VEC_HTAB_GROUP], 0, 3);
+  for (off = 0; off < __VEC_HTAB_GROUP * keysize; off += __VEC_HTAB_LINE)
+    __builtin_prefetch (k + off, 0, 3);
+}
+
+/* Batch lookup. The hash of key i+__VEC_HTAB_AHEAD is computed, and
+ * its first probe group prefetched, before key i is probed. So the
+ * cache misses of up to __VEC_HTAB_AHEAD probes are in flight.  */
+void
+__VEC_PWR_IMP (vec_htab_find_batch_u64) (const vec_htab_t *t, long *slots,
+					 const unsigned long long *keys,
+					 unsigned long n)
+{
+  unsigned long long hq[__VEC_HTAB_AHEAD];
+  unsigned long i;
+
+  for (i = 0; i < n && i < __VEC_HTAB_AHEAD; i++)
+    {
+      hq[i] = __vec_htab_hash_u64 (keys[i]);
+      __vec_htab_prefetch (t, hq[i], sizeof (unsigned long long));
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      unsigned long long h = hq[i % __VEC_HTAB_AHEAD];
+
+      if (i + __VEC_HTAB_AHEAD < n)
+	{
+	  unsigned long long hn;
+
+	  hn = __vec_htab_hash_u64 (keys[i + __VEC_HTAB_AHEAD]);
+	  __vec_htab_prefetch (t, hn, sizeof (unsigned long long));
+	  hq[i % __VEC_HTAB_AHEAD] = hn;
+	}
+      slots[i] = __vec_htab_find_u64 (t, keys[i], h, NULL);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_htab_find_batch_u128) (const vec_htab_t *t, long *slots,
+					  const vui128_t *keys,
+					  unsigned long n)
+{
+  unsigned long long hq[__VEC_HTAB_AHEAD];
+  unsigned long i;
+
+  for (i = 0; i < n && i < __VEC_HTAB_AHEAD; i++)
+    {
+      hq[i] = __vec_htab_hash_u128 (keys[i]);
+      __vec_htab_prefetch (t, hq[i], sizeof (vui128_t));
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      unsigned long long h = hq[i % __VEC_HTAB_AHEAD];
+
+      if (i + __VEC_HTAB_AHEAD < n)
+	{
+	  unsigned long long hn;
+
+	  hn = __vec_htab_hash_u128 (keys[i + __VEC_HTAB_AHEAD]);
+	  __vec_htab_prefetch (t, hn, sizeof (vui128_t));
+	  hq[i % __VEC_HTAB_AHEAD] = hn;
+	}
+      slots[i] = __vec_htab_find_u128 (t, keys[i], h, NULL);
+    }
+}
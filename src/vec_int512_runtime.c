@@ -20,7 +20,10 @@
       Created on: Aug 20, 2019
  */
 
+#include <stdlib.h>
+
 #include <pveclib/vec_int512_ppc.h>
+#include <pveclib/vec_runtime_ppc.h>
 
 #ifdef __VEC_EXPLICITE_FENCE_NOPS__
 #undef COMPILE_FENCE
@@ -727,6 +730,68 @@ __VEC_PWR_IMP (vec_mul2048x2048) (__VEC_U_4096* r4096,
 #define __PDX(__index) ((px - 1) - (__index))
 #endif
 
+/* Fully unrolled core for fixed (compile time constant) M x N
+ * quadword multiplies.
+ * The partial product row is held in the local pt[] array which
+ * the compiler scalarizes into vector registers once both loops are
+ * completely unrolled. This avoids the p[] store/reload of the
+ * generic loop. Each low order quadword is stored to p[] once, as
+ * soon as it is final.
+ * Requires mx >= nx and mx + nx <= 32.  */
+static inline void __attribute__((always_inline))
+__VEC_PWR_IMP (vec_mul128_byMN_unrolled) (vui128_t *p,
+		  vui128_t *mp, vui128_t *np,
+		  const unsigned long mx, const unsigned long nx)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  const unsigned long px = mx + nx;
+#endif
+  vui128_t pt[32];
+  vui128_t mq;
+  unsigned long i, j;
+
+  pt[0] = vec_muludq (&mq, mp[__MDX(0)], np[__NDX(0)]);
+#pragma GCC unroll 16
+  for (i = 1; i < mx; i++)
+    pt[i] = vec_madduq (&mq, mp[__MDX(i)], np[__NDX(0)], mq);
+  pt[mx] = mq;
+  p[__PDX(0)] = pt[0];
+
+#pragma GCC unroll 16
+  for (j = 1; j < nx; j++)
+    {
+      pt[j] = vec_madduq (&mq, mp[__MDX(0)], np[__NDX(j)], pt[j]);
+#pragma GCC unroll 16
+      for (i = 1; i < mx; i++)
+	pt[i + j] = vec_madd2uq (&mq, mp[__MDX(i)], np[__NDX(j)], mq,
+				 pt[i + j]);
+      pt[mx + j] = mq;
+      p[__PDX(j)] = pt[j];
+    }
+
+#pragma GCC unroll 32
+  for (i = nx; i < (mx + nx); i++)
+    p[__PDX(i)] = pt[i];
+}
+
+/* Generate the fixed size specializations selected by
+ * vec_mul128_byMN for the common square (2x2, 4x4, 8x8, 16x16) and
+ * rectangular (8x1, 16x1) quadword sizes.  */
+#define __VEC_MUL128_BYMN_FIXED(_M, _N) \
+static void __attribute__((flatten, noinline)) \
+__VEC_PWR_IMP (vec_mul128_by ## _M ## x ## _N) (vui128_t *p, \
+		  vui128_t *m1, vui128_t *m2) \
+{ \
+  __VEC_PWR_IMP (vec_mul128_byMN_unrolled) (p, m1, m2, _M, _N); \
+}
+
+__VEC_MUL128_BYMN_FIXED (2, 2)
+__VEC_MUL128_BYMN_FIXED (4, 4)
+__VEC_MUL128_BYMN_FIXED (8, 8)
+__VEC_MUL128_BYMN_FIXED (16, 16)
+__VEC_MUL128_BYMN_FIXED (8, 1)
+__VEC_MUL128_BYMN_FIXED (16, 1)
+
 void __attribute__((flatten ))
 __VEC_PWR_IMP (vec_mul128_byMN) (vui128_t *p,
 		  vui128_t *m1, vui128_t *m2,
@@ -757,6 +822,41 @@ __VEC_PWR_IMP (vec_mul128_byMN) (vui128_t *p,
       np = xp;
     }
 
+  /* Use the unrolled specializations for common fixed sizes.  */
+  if (mx == nx)
+    {
+      switch (mx)
+	{
+	case 2:
+	  __VEC_PWR_IMP (vec_mul128_by2x2) (p, mp, np);
+	  return;
+	case 4:
+	  __VEC_PWR_IMP (vec_mul128_by4x4) (p, mp, np);
+	  return;
+	case 8:
+	  __VEC_PWR_IMP (vec_mul128_by8x8) (p, mp, np);
+	  return;
+	case 16:
+	  __VEC_PWR_IMP (vec_mul128_by16x16) (p, mp, np);
+	  return;
+	default:
+	  break;
+	}
+    }
+  else if (nx == 1)
+    {
+      if (mx == 8)
+	{
+	  __VEC_PWR_IMP (vec_mul128_by8x1) (p, mp, np);
+	  return;
+	}
+      else if (mx == 16)
+	{
+	  __VEC_PWR_IMP (vec_mul128_by16x1) (p, mp, np);
+	  return;
+	}
+    }
+
   if (nx > 0)
     {
       mpx0 = vec_muludq (&mqx0, mp[__MDX(0)], np[__NDX(0)]);
@@ -832,6 +932,26 @@ __VEC_PWR_IMP (vec_mul512_byMN) (__VEC_U_512 *p,
       np = xp;
     }
 
+  /* The 2x2 and 4x4 (1024x1024 and 2048x2048-bit) cases have
+   * hand scheduled straight line implementations.  */
+  if (mx == nx)
+    {
+      if (mx == 2)
+	{
+	  __VEC_PWR_IMP (vec_mul1024x1024) ((__VEC_U_2048 *) p,
+					    (__VEC_U_1024 *) mp,
+					    (__VEC_U_1024 *) np);
+	  return;
+	}
+      else if (mx == 4)
+	{
+	  __VEC_PWR_IMP (vec_mul2048x2048) ((__VEC_U_4096 *) p,
+					    (__VEC_U_2048 *) mp,
+					    (__VEC_U_2048 *) np);
+	  return;
+	}
+    }
+
   if (nx > 0)
     {
       mpx0.x1024 = __VEC_PWR_IMP(vec_mul512x512_static) (mp[__MDX(0)], np[__NDX(0)]);
@@ -883,3 +1003,131 @@ __VEC_PWR_IMP (vec_mul512_byMN) (__VEC_U_512 *p,
     }
 }
 
+/* Minimum M*N (512-bit block products) before vec_mul512_byMN_parallel
+ * splits the multiply across the worker pool. Below this the thread
+ * hand-off costs more than it saves.  */
+#define __VEC_MUL512_PARALLEL_MIN 256
+
+typedef struct
+{
+  __VEC_U_512 *mp;
+  __VEC_U_512 *np;
+  __VEC_U_512 *scratch;
+  unsigned long mx;
+  unsigned long nx;
+  unsigned long slice;
+} __vec_mul512_par_t;
+
+/* Task t multiplies the t-th slice of the (larger) m1 operand by all
+ * of m2, producing a (slice + nx) block partial product in its own
+ * scratch area.  */
+static void
+__VEC_PWR_IMP (vec_mul512_byMN_task) (void *arg, unsigned long t)
+{
+  __vec_mul512_par_t *par = arg;
+  unsigned long i0 = t * par->slice;
+  unsigned long mi = par->mx - i0;
+  __VEC_U_512 *sp, *mp;
+
+  if (mi > par->slice)
+    mi = par->slice;
+
+  sp = par->scratch + t * (par->slice + par->nx);
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  mp = &par->mp[i0];
+#else
+  mp = &par->mp[par->mx - i0 - mi];
+#endif
+  __VEC_PWR_IMP (vec_mul512_byMN) (sp, mp, par->np, mi, par->nx);
+}
+
+void
+__VEC_PWR_IMP (vec_mul512_byMN_parallel) (__VEC_U_512 *p,
+                  __VEC_U_512 *m1, __VEC_U_512 *m2,
+		  unsigned long M, unsigned long N)
+{
+  __vec_mul512_par_t par;
+  __VEC_U_512 *mp = m1;
+  __VEC_U_512 *np = m2;
+  unsigned long mx = M;
+  unsigned long nx = N;
+  unsigned long px = M + N;
+  unsigned long nthreads, ntasks, t, i, k;
+  __VEC_U_512 p_zero;
+  __VEC_U_512x1 sum;
+  vui128_t mcx0;
+
+  if (mx < nx)
+    {
+      mx = N;
+      nx = M;
+      mp = m2;
+      np = m1;
+    }
+
+  nthreads = vec_pool_get_threads ();
+  if ((nthreads < 2) || (nx == 0) || (mx < 2)
+      || ((mx * nx) < __VEC_MUL512_PARALLEL_MIN))
+    {
+      __VEC_PWR_IMP (vec_mul512_byMN) (p, m1, m2, M, N);
+      return;
+    }
+
+  ntasks = (nthreads < mx) ? nthreads : mx;
+  par.mp = mp;
+  par.np = np;
+  par.mx = mx;
+  par.nx = nx;
+  par.slice = (mx + ntasks - 1) / ntasks;
+  ntasks = (mx + par.slice - 1) / par.slice;
+  par.scratch = malloc (ntasks * (par.slice + nx) * sizeof (__VEC_U_512));
+  if (par.scratch == NULL)
+    {
+      __VEC_PWR_IMP (vec_mul512_byMN) (p, m1, m2, M, N);
+      return;
+    }
+
+  vec_pool_run (__VEC_PWR_IMP (vec_mul512_byMN_task), &par, ntasks);
+
+  /* Sum the partial products into p. Each partial product is added
+   * at its block offset and the carry is propagated to the top of p,
+   * without data dependent early exit.  */
+  p_zero.vx0 = (vui128_t) ((unsigned __int128) 0);
+  p_zero.vx1 = (vui128_t) ((unsigned __int128) 0);
+  p_zero.vx2 = (vui128_t) ((unsigned __int128) 0);
+  p_zero.vx3 = (vui128_t) ((unsigned __int128) 0);
+  for (i = 0; i < px; i++)
+    p[__PDX(i)] = p_zero;
+
+  for (t = 0; t < ntasks; t++)
+    {
+      unsigned long i0 = t * par.slice;
+      unsigned long mi = mx - i0;
+      unsigned long sx;
+      __VEC_U_512 *sp = par.scratch + t * (par.slice + nx);
+
+      if (mi > par.slice)
+	mi = par.slice;
+      sx = mi + nx;
+
+      mcx0 = (vui128_t) ((unsigned __int128) 0);
+      for (k = 0; k < sx; k++)
+	{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	  sum.x640 = vec_add512ecu (p[__PDX(i0 + k)], sp[k], mcx0);
+#else
+	  sum.x640 = vec_add512ecu (p[__PDX(i0 + k)], sp[(sx - 1) - k], mcx0);
+#endif
+	  p[__PDX(i0 + k)] = sum.x2.v0x512;
+	  mcx0 = sum.x2.v1x128;
+	}
+      for (k = i0 + sx; k < px; k++)
+	{
+	  sum.x640 = vec_add512ecu (p[__PDX(k)], p_zero, mcx0);
+	  p[__PDX(k)] = sum.x2.v0x512;
+	  mcx0 = sum.x2.v1x128;
+	}
+    }
+
+  free (par.scratch);
+}
@@ -0,0 +1,219 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_ldbl_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* IBM long double (double-double) arithmetic over arrays. Included
+ * by vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * An IBM long double is stored as its high double followed by its
+ * low double. Two values are loaded as two vectors, each {high, low},
+ * and transposed with vec_mergeh / vec_mergel into a vector of high
+ * parts and a vector of low parts. The vec_adddd, vec_muldd ...
+ * operations from vec_f64_ppc.h then work on both lanes at once, and
+ * the results are transposed back for the store. Each loop iteration
+ * handles 4 values as 2 independent vector pairs.
+ *
+ * This is only built when long double is IBM double-double. With
+ * -mabi=ieeelongdouble these entry points are not defined.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+#include <pveclib/vec_f64_ppc.h>
+
+#if defined (__LONG_DOUBLE_128__) && !defined (__LONG_DOUBLE_IEEE128__)
+/* Load the 2 long doubles at p as high and low vectors, or p[0] in
+ * both lanes when only 1 is left.  */
+static inline vf64_t
+__vec_ldbl_ld (vf64_t *l, const long double *p, unsigned long r)
+{
+  vf64_t v0, v1;
+
+  memcpy (&v0, &p[0], sizeof (v0));
+  if (r < 2)
+    v1 = v0;
+  else
+    memcpy (&v1, &p[1], sizeof (v1));
+  *l = vec_mergel (v0, v1);
+  return vec_mergeh (v0, v1);
+}
+
+static inline void
+__vec_ldbl_st (long double *p, vf64_t h, vf64_t l, unsigned long r)
+{
+  vf64_t v0, v1;
+
+  v0 = vec_mergeh (h, l);
+  v1 = vec_mergel (h, l);
+  memcpy (&p[0], &v0, sizeof (v0));
+  if (r >= 2)
+    memcpy (&p[1], &v1, sizeof (v1));
+}
+
+typedef vf64_t (*__vec_ldbl_op2) (vf64_t *, vf64_t, vf64_t, vf64_t,
+				  vf64_t);
+
+/* out = a op b. Always inlined so op is a direct call.  */
+static inline void __attribute__((always_inline))
+__vec_ldbl_map2 (long double *out, const long double *a,
+		 const long double *b, unsigned long n, __vec_ldbl_op2 op)
+{
+  vf64_t ah0, al0, bh0, bl0, ah1, al1, bh1, bl1;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      ah0 = __vec_ldbl_ld (&al0, &a[i], 2);
+      bh0 = __vec_ldbl_ld (&bl0, &b[i], 2);
+      ah1 = __vec_ldbl_ld (&al1, &a[i + 2], 2);
+      bh1 = __vec_ldbl_ld (&bl1, &b[i + 2], 2);
+      ah0 = op (&al0, ah0, al0, bh0, bl0);
+      ah1 = op (&al1, ah1, al1, bh1, bl1);
+      __vec_ldbl_st (&out[i], ah0, al0, 2);
+      __vec_ldbl_st (&out[i + 2], ah1, al1, 2);
+    }
+  for (; i < n; i += 2)
+    {
+      ah0 = __vec_ldbl_ld (&al0, &a[i], n - i);
+      bh0 = __vec_ldbl_ld (&bl0, &b[i], n - i);
+      ah0 = op (&al0, ah0, al0, bh0, bl0);
+      __vec_ldbl_st (&out[i], ah0, al0, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_add_ldbl) (long double *out, const long double *a,
+			      const long double *b, unsigned long n)
+{
+  __vec_ldbl_map2 (out, a, b, n, vec_adddd);
+}
+
+void
+__VEC_PWR_IMP (vec_sub_ldbl) (long double *out, const long double *a,
+			      const long double *b, unsigned long n)
+{
+  __vec_ldbl_map2 (out, a, b, n, vec_subdd);
+}
+
+void
+__VEC_PWR_IMP (vec_mul_ldbl) (long double *out, const long double *a,
+			      const long double *b, unsigned long n)
+{
+  __vec_ldbl_map2 (out, a, b, n, vec_muldd);
+}
+
+void
+__VEC_PWR_IMP (vec_div_ldbl) (long double *out, const long double *a,
+			      const long double *b, unsigned long n)
+{
+  __vec_ldbl_map2 (out, a, b, n, vec_divdd);
+}
+
+void
+__VEC_PWR_IMP (vec_sqrt_ldbl) (long double *out, const long double *in,
+			       unsigned long n)
+{
+  vf64_t h0, l0, h1, l1;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      h0 = __vec_ldbl_ld (&l0, &in[i], 2);
+      h1 = __vec_ldbl_ld (&l1, &in[i + 2], 2);
+      h0 = vec_sqrtdd (&l0, h0, l0);
+      h1 = vec_sqrtdd (&l1, h1, l1);
+      __vec_ldbl_st (&out[i], h0, l0, 2);
+      __vec_ldbl_st (&out[i + 2], h1, l1, 2);
+    }
+  for (; i < n; i += 2)
+    {
+      h0 = __vec_ldbl_ld (&l0, &in[i], n - i);
+      h0 = vec_sqrtdd (&l0, h0, l0);
+      __vec_ldbl_st (&out[i], h0, l0, n - i);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_madd_ldbl) (long double *out, const long double *a,
+			       const long double *b, const long double *c,
+			       unsigned long n)
+{
+  vf64_t ah, al, bh, bl, ch, cl;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 2)
+    {
+      ah = __vec_ldbl_ld (&al, &a[i], n - i);
+      bh = __vec_ldbl_ld (&bl, &b[i], n - i);
+      ch = __vec_ldbl_ld (&cl, &c[i], n - i);
+      ah = vec_madddd (&al, ah, al, bh, bl, ch, cl);
+      __vec_ldbl_st (&out[i], ah, al, n - i);
+    }
+}
+
+long double
+__VEC_PWR_IMP (vec_dot_ldbl) (const long double *a, const long double *b,
+			      unsigned long n)
+{
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t sh0 = zero, sl0 = zero, sh1 = zero, sl1 = zero;
+  vf64_t ah, al, bh, bl;
+  double t[2];
+  long double r;
+  unsigned long i;
+
+  /* Two independent accumulator pairs, 4 lanes in all.  */
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      ah = __vec_ldbl_ld (&al, &a[i], 2);
+      bh = __vec_ldbl_ld (&bl, &b[i], 2);
+      sh0 = vec_madddd (&sl0, ah, al, bh, bl, sh0, sl0);
+      ah = __vec_ldbl_ld (&al, &a[i + 2], 2);
+      bh = __vec_ldbl_ld (&bl, &b[i + 2], 2);
+      sh1 = vec_madddd (&sl1, ah, al, bh, bl, sh1, sl1);
+    }
+  if (i + 2 <= n)
+    {
+      ah = __vec_ldbl_ld (&al, &a[i], 2);
+      bh = __vec_ldbl_ld (&bl, &b[i], 2);
+      sh0 = vec_madddd (&sl0, ah, al, bh, bl, sh0, sl0);
+      i += 2;
+    }
+  sh0 = vec_adddd (&sl0, sh0, sl0, sh1, sl1);
+  if (i < n)
+    {
+      /* The last product goes to lane 0 only.  */
+      ah = __vec_ldbl_ld (&al, &a[i], 1);
+      bh = __vec_ldbl_ld (&bl, &b[i], 1);
+      sh1 = vec_madddd (&sl1, ah, al, bh, bl, zero, zero);
+      sh0 = vec_adddd (&sl0, sh0, sl0, vec_mergeh (sh1, zero),
+		       vec_mergeh (sl1, zero));
+    }
+  /* Add lane 1 to lane 0.  */
+  sh0 = vec_adddd (&sl0, sh0, sl0, vec_mergel (sh0, sh0),
+		   vec_mergel (sl0, sl0));
+  t[0] = sh0[0];
+  t[1] = sl0[0];
+  memcpy (&r, t, sizeof (r));
+  return r;
+}
+#endif
@@ -0,0 +1,1298 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_math_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Elementary functions (exp, log, pow, sin, cos, tanh and sigmoid)
+ * over arrays of double and float. Included by vec_runtime_PWR7.c
+ * ... vec_runtime_PWR10.c.
+ *
+ * Each function has two accuracy tiers. The _u10 functions have a
+ * maximum error below 1.0 ULP and the _u35 functions below 3.5 ULP,
+ * over the whole input range including subnormal inputs and results.
+ * Special values (NaN, infinities and signed zeros) follow C99
+ * Annex F.
+ *
+ * exp reduces x to k ln2 + r with a 2 part ln2, so the first FMA is
+ * exact, and scales by 2^k in two steps so subnormal results are
+ * rounded once. log splits x into 2^e m, sqrt(2)/2 <= m < sqrt(2),
+ * and evaluates log(m) = 2 atanh(s), s = (m - 1) / (m + 1). sin and
+ * cos reduce x to n pi/2 + r with a 3 part (33-bit) pi/2 for
+ * |x| <= 2^20, and a scalar Payne-Hanek reduction (1280 bits of 2/pi)
+ * for the rare lanes above that. The polynomials are near minimax
+ * fits (Chebyshev interpolation) on the reduced ranges.
+ *
+ * The double _u10 kernels carry the reduced argument and the result
+ * as double-double (the unevaluated sum of 2 doubles), so the only
+ * error of note is the final rounding. The _u35 kernels use the same
+ * reductions in plain double with shorter polynomials. pow needs
+ * log(x) to about 2^-64 relative when y log(x) is near the overflow
+ * threshold, so both pow tiers use the double-double log and exp.
+ *
+ * The float _u10 functions evaluate the double _u35 kernels and round
+ * once to float. The float _u35 exp, log, sin, cos and sigmoid are
+ * native 4 x float kernels. tanh and pow use the double path for both
+ * float tiers.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+#include <pveclib/vec_int32_ppc.h>
+#include <pveclib/vec_f64_ppc.h>
+#include <pveclib/vec_f32_ppc.h>
+
+/* 2/pi to 1280 bits, most significant first.  */
+static const unsigned long long __vec_math_2opi[20] =
+{
+  0xa2f9836e4e441529ULL, 0xfc2757d1f534ddc0ULL,
+  0xdb6295993c439041ULL, 0xfe5163abdebbc561ULL,
+  0xb7246e3a424dd2e0ULL, 0x06492eea09d1921cULL,
+  0xfe1deb1cb129a73eULL, 0xe88235f52ebb4484ULL,
+  0xe99c7026b45f7e41ULL, 0x3991d639835339f4ULL,
+  0x9c845f8bbdf9283bULL, 0x1ff897ffde05980fULL,
+  0xef2f118b5a0a6d1fULL, 0x6d367ecf27cb09b7ULL,
+  0x4f463f669e5fea2dULL, 0x7527bac7ebe5f17bULL,
+  0x3d0739f78a5292eaULL, 0x6bfb5fb11f8d5d08ULL,
+  0x56033046fc7b6babULL, 0xf0cfbc209af4361dULL
+};
+
+/* (e^r - 1 - r) / r^2 for |r| <= ln2/2.  */
+static const double __vec_math_exp_u10_c[11] =
+{
+  0x1.0000000000000p-1, 0x1.5555555555557p-3, 0x1.5555555555556p-5,
+  0x1.11111111100dcp-7, 0x1.6c16c16c162d5p-10, 0x1.a01a01abe78f9p-13,
+  0x1.a01a01a6d84aap-16, 0x1.71de0232f4775p-19, 0x1.27e4db653346ep-22,
+  0x1.af4de6a36d4fcp-26, 0x1.1f7301a8efa5cp-29
+};
+
+static const double __vec_math_exp_u35_c[10] =
+{
+  0x1.0000000000001p-1, 0x1.5555555555556p-3, 0x1.5555555553d64p-5,
+  0x1.11111111109b4p-7, 0x1.6c16c1788b646p-10, 0x1.a01a01a7c3d59p-13,
+  0x1.a019b90eefe8ep-16, 0x1.71de0daf7a6ccp-19, 0x1.2891834686c7ep-22,
+  0x1.af38a71a18cb9p-26
+};
+
+/* (log((1 + s) / (1 - s)) - 2s - 2s^3/3) / s^5 for s^2 <= 0.0295.  */
+static const double __vec_math_logk_c[8] =
+{
+  0x1.999999999999ap-2, 0x1.2492492492522p-2, 0x1.c71c71c6ea871p-3,
+  0x1.745d177aad02ap-3, 0x1.3b1395c881220p-3, 0x1.1118c9ee5b8a4p-3,
+  0x1.df7c5bc7c7563p-4, 0x1.e032e4d8436a1p-4
+};
+
+/* (log((1 + s) / (1 - s)) - 2s) / s^3 for s^2 <= 0.0295.  */
+static const double __vec_math_log_u35_c[7] =
+{
+  0x1.5555555555558p-1, 0x1.99999999952b2p-2, 0x1.2492492df6947p-2,
+  0x1.c71c62debf86bp-3, 0x1.7462b69705382p-3, 0x1.39fe208c33457p-3,
+  0x1.2b5b5fb2eac92p-3
+};
+
+/* (sin(r) / r - 1) / r^2 and (cos(r) - 1 + r^2/2) / r^4 for
+ * |r| <= pi/4.  */
+static const double __vec_math_sin_u10_c[7] =
+{
+  -0x1.5555555555555p-3, 0x1.1111111111110p-7, -0x1.a01a01a019937p-13,
+  0x1.71de3a54607fap-19, -0x1.ae6454129f078p-26, 0x1.61217eed1c04ap-33,
+  -0x1.ab17c21adf462p-41
+};
+
+static const double __vec_math_cos_u10_c[7] =
+{
+  0x1.5555555555555p-5, -0x1.6c16c16c16c16p-10, 0x1.a01a01a019d0ap-16,
+  -0x1.27e4fb7712cc8p-22, 0x1.1eed8deb869afp-29, -0x1.9394b9f1ce104p-37,
+  0x1.ab784b1122af7p-45
+};
+
+static const double __vec_math_sin_u35_c[6] =
+{
+  -0x1.5555555555555p-3, 0x1.1111111110bb2p-7, -0x1.a01a019e83896p-13,
+  0x1.71de37965ea29p-19, -0x1.ae600ad575592p-26, 0x1.5e0b09aba9d7fp-33
+};
+
+static const double __vec_math_cos_u35_c[6] =
+{
+  0x1.5555555555555p-5, -0x1.6c16c16c16967p-10, 0x1.a01a019f4e9f4p-16,
+  -0x1.27e4fa17c44e0p-22, 0x1.1eeb68d2958ddp-29, -0x1.907d9316a965fp-37
+};
+
+/* The float versions of the above.  */
+static const float __vec_math_expf_c[5] =
+{
+  0x1.000000p-1f, 0x1.5554dcp-3f, 0x1.55551ap-5f, 0x1.120b6cp-7f,
+  0x1.6d1106p-10f
+};
+
+static const float __vec_math_logf_c[4] =
+{
+  0x1.555556p-1f, 0x1.9999ecp-2f, 0x1.245c38p-2f, 0x1.ddd172p-3f
+};
+
+static const float __vec_math_sinf_c[4] =
+{
+  -0x1.555556p-3f, 0x1.11110ep-7f, -0x1.a013a8p-13f, 0x1.6dbdf2p-19f
+};
+
+static const float __vec_math_cosf_c[4] =
+{
+  0x1.555556p-5f, -0x1.6c16c0p-10f, 0x1.a015c4p-16f, -0x1.252440p-22f
+};
+
+/* ln2 = ln2_hi + ln2_lo, with ln2_hi the double nearest ln2. For
+ * |k| <= 1100, x - k ln2_hi is exact when |x - k ln2| <= ln2/2.  */
+#define __VEC_MATH_LN2_HI 0x1.62e42fefa39efp-1
+#define __VEC_MATH_LN2_LO 0x1.abc9e3b39803fp-56
+/* ln2 = ln2_hi + ln2_lo, with 21 trailing zero bits in ln2_hi, so
+ * e ln2_hi is exact for any exponent e.  */
+#define __VEC_MATH_LN2E_HI 0x1.62e42fee00000p-1
+#define __VEC_MATH_LN2E_LO 0x1.a39ef35793c76p-33
+#define __VEC_MATH_LOG2E 0x1.71547652b82fep0
+/* pi/2 in 33-bit parts, so n p1, n p2 and n p3 are exact for
+ * n <= 2^20, and the remainder p3t.  */
+#define __VEC_MATH_PIO2_1 0x1.921fb544p0
+#define __VEC_MATH_PIO2_2 0x1.0b4611a6p-34
+#define __VEC_MATH_PIO2_3 0x1.3198a2ep-69
+#define __VEC_MATH_PIO2_3T 0x1.b839a252049c1p-104
+#define __VEC_MATH_PIO2_HI 0x1.921fb54442d18p0
+#define __VEC_MATH_PIO2_LO 0x1.1a62633145c07p-54
+#define __VEC_MATH_2OPI 0x1.45f306dc9c883p-1
+
+static inline vf64_t
+__vec_math_poly (vf64_t x, const double *c, int n)
+{
+  vf64_t p = vec_splats (c[n - 1]);
+  int i;
+
+  for (i = n - 2; i >= 0; i--)
+    p = vec_madd (p, x, vec_splats (c[i]));
+  return p;
+}
+
+static inline vf32_t
+__vec_math_polyf (vf32_t x, const float *c, int n)
+{
+  vf32_t p = vec_splats (c[n - 1]);
+  int i;
+
+  for (i = n - 2; i >= 0; i--)
+    p = vec_madd (p, x, vec_splats (c[i]));
+  return p;
+}
+
+/* Double-double primitives. a + b = s + *e exactly.  */
+static inline vf64_t
+__vec_math_two_sum (vf64_t a, vf64_t b, vf64_t *e)
+{
+  vf64_t s = vec_add (a, b);
+  vf64_t bb = vec_sub (s, a);
+
+  *e = vec_add (vec_sub (a, vec_sub (s, bb)), vec_sub (b, bb));
+  return s;
+}
+
+/* As __vec_math_two_sum for |a| >= |b|.  */
+static inline vf64_t
+__vec_math_fast_two_sum (vf64_t a, vf64_t b, vf64_t *e)
+{
+  vf64_t s = vec_add (a, b);
+
+  *e = vec_sub (b, vec_sub (s, a));
+  return s;
+}
+
+/* (ah + al) * (bh + bl).  */
+static inline vf64_t
+__vec_math_dd_mul (vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl, vf64_t *l)
+{
+  vf64_t p = vec_mul (ah, bh);
+  vf64_t e = vec_msub (ah, bh, p);
+
+  e = vec_madd (ah, bl, vec_madd (al, bh, e));
+  return __vec_math_fast_two_sum (p, e, l);
+}
+
+/* (ah + al) / (bh + bl).  */
+static inline vf64_t
+__vec_math_dd_div (vf64_t ah, vf64_t al, vf64_t bh, vf64_t bl, vf64_t *l)
+{
+  vf64_t q = vec_div (ah, bh);
+  vf64_t r = vec_nmsub (q, bh, ah);
+
+  r = vec_nmsub (q, bl, vec_add (r, al));
+  return __vec_math_fast_two_sum (q, vec_div (r, bh), l);
+}
+
+/* Round x to the nearest integer for |x| < 2^51, and return it as a
+ * doubleword integer in *k.  */
+static inline vf64_t
+__vec_math_rint (vf64_t x, vi64_t *k)
+{
+  const vf64_t magic = vec_splats (0x1.8p52);
+  vf64_t t = vec_add (x, magic);
+
+  *k = (vi64_t) vec_subudm ((vui64_t) t, (vui64_t) magic);
+  return vec_sub (t, magic);
+}
+
+/* 2^k for -1022 <= k <= 1023.  */
+static inline vf64_t
+__vec_math_pow2i (vi64_t k)
+{
+  const vui64_t bias = vec_splats ((unsigned long long) 1023);
+
+  return (vf64_t) vec_sldi (vec_addudm ((vui64_t) k, bias), 52);
+}
+
+/* x 2^k for |k| <= 2044. The first step is exact for normal x, so a
+ * subnormal result is rounded once.  */
+static inline vf64_t
+__vec_math_ldexp (vf64_t x, vi64_t k)
+{
+  vi64_t k1 = vec_sradi (k, 1);
+  vi64_t k2 = (vi64_t) vec_subudm ((vui64_t) k, (vui64_t) k1);
+
+  x = vec_mul (x, __vec_math_pow2i (k1));
+  return vec_mul (x, __vec_math_pow2i (k2));
+}
+
+/* e^(xh + xl) = 2^k (eh + *el) for |xh| <= 746, accurate to about
+ * 2^-57 relative.  */
+static inline vf64_t
+__vec_math_expk (vf64_t xh, vf64_t xl, vf64_t *el, vi64_t *k)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t kf, r1, c, rh, rl, t, sh, se;
+
+  kf = __vec_math_rint (vec_mul (xh, vec_splats (__VEC_MATH_LOG2E)), k);
+  r1 = vec_nmsub (kf, vec_splats (__VEC_MATH_LN2_HI), xh);
+  c = vec_nmsub (kf, vec_splats (__VEC_MATH_LN2_LO), xl);
+  rh = __vec_math_two_sum (r1, c, &rl);
+  /* e^r = 1 + r + r^2 P(r), with the rl terms to first order.  */
+  t = __vec_math_poly (rh, __vec_math_exp_u10_c, 11);
+  t = vec_madd (vec_mul (rh, rh), t, vec_madd (rl, rh, rl));
+  sh = __vec_math_fast_two_sum (one, rh, &se);
+  return __vec_math_fast_two_sum (sh, vec_add (se, t), el);
+}
+
+/* (eh + el) 2^k for eh + el near 1. A subnormal result is rounded
+ * once, on the 2^-1074 grid, by adding (eh + el) 2^(k + 1022) to
+ * 1.0.  */
+static inline vf64_t
+__vec_math_scale (vf64_t eh, vf64_t el, vi64_t k)
+{
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t tiny = vec_splats (0x1p-1022);
+  vf64_t r, s, y, yl, hi, lo;
+  vi64_t kt;
+
+  r = __vec_math_ldexp (vec_add (eh, el), k);
+  if (vec_any_lt (r, tiny))
+    {
+      kt = (vi64_t) vec_addudm ((vui64_t) k,
+				vec_splats ((unsigned long long) 1022));
+      s = __vec_math_pow2i (kt);
+      y = vec_mul (eh, s);
+      yl = vec_mul (el, s);
+      hi = vec_add (one, y);
+      lo = vec_add (vec_add (vec_sub (one, hi), y), yl);
+      y = vec_mul (vec_sub (vec_add (hi, lo), one), tiny);
+      r = vec_sel (r, y, vec_cmplt (r, tiny));
+    }
+  return r;
+}
+
+/* Overflow and underflow of e^x, given r = e^x for
+ * -746 <= x <= ln(DBL_MAX).  */
+static inline vf64_t
+__vec_math_exp_range (vf64_t x, vf64_t r)
+{
+  const vf64_t inf = vec_splats (__builtin_inf ());
+
+  r = vec_sel (r, inf, vec_cmpgt (x, vec_splats (0x1.62e42fefa39efp9)));
+  return vec_sel (r, vec_splats (0.0), vec_cmplt (x, vec_splats (-746.0)));
+}
+
+static inline vf64_t
+__vec_math_exp_u10 (vf64_t x)
+{
+  vf64_t eh, el;
+  vi64_t k;
+
+  eh = __vec_math_expk (x, vec_splats (0.0), &el, &k);
+  return __vec_math_exp_range (x, __vec_math_scale (eh, el, k));
+}
+
+static inline vf64_t
+__vec_math_exp_u35 (vf64_t x)
+{
+  vf64_t kf, r, p;
+  vi64_t k;
+
+  kf = __vec_math_rint (vec_mul (x, vec_splats (__VEC_MATH_LOG2E)), &k);
+  r = vec_nmsub (kf, vec_splats (__VEC_MATH_LN2_HI), x);
+  r = vec_nmsub (kf, vec_splats (__VEC_MATH_LN2_LO), r);
+  p = __vec_math_poly (r, __vec_math_exp_u35_c, 10);
+  p = vec_add (vec_splats (1.0), vec_madd (vec_mul (r, r), p, r));
+  return __vec_math_exp_range (x, __vec_math_ldexp (p, k));
+}
+
+/* Split positive finite x into 2^e m, sqrt(2)/2 <= m < sqrt(2).
+ * Return m, and e as a double in *ef.  */
+static inline vf64_t
+__vec_math_frexp (vf64_t x, vf64_t *ef)
+{
+  const vui64_t mant = vec_splats ((unsigned long long)
+				   0x000fffffffffffffULL);
+  const vui64_t one = vec_splats ((unsigned long long)
+				  0x3ff0000000000000ULL);
+  const vui64_t magic = vec_splats ((unsigned long long)
+				    0x4330000000000000ULL);
+  vb64_t tiny, big;
+  vf64_t m, e;
+
+  tiny = vec_cmplt (x, vec_splats (0x1p-1022));
+  x = vec_sel (x, vec_mul (x, vec_splats (0x1p54)), tiny);
+  e = (vf64_t) vec_or (vec_srdi ((vui64_t) x, 52), magic);
+  e = vec_sub (e, vec_splats (0x1p52 + 1023.0));
+  m = (vf64_t) vec_or (vec_and ((vui64_t) x, mant), one);
+  big = vec_cmpgt (m, vec_splats (0x1.6a09e667f3bcdp0));
+  m = vec_sel (m, vec_mul (m, vec_splats (0.5)), big);
+  e = vec_sel (e, vec_add (e, vec_splats (1.0)), big);
+  *ef = vec_sel (e, vec_sub (e, vec_splats (54.0)), tiny);
+  return m;
+}
+
+/* log(x) = lh + *ll for positive finite x, accurate to about 2^-67
+ * relative.  */
+static inline vf64_t
+__vec_math_logk (vf64_t x, vf64_t *ll)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t m, ef, f, dh, dl, sh, sl, zh, zl, g, ph, pl, qh, ql, wh, wl;
+  vf64_t lh, l, eh, el, t;
+
+  m = __vec_math_frexp (x, &ef);
+  /* s = (m - 1) / (m + 1), with m - 1 and the low part of m + 1
+   * exact.  */
+  f = vec_sub (m, one);
+  dh = vec_add (m, one);
+  dl = vec_sub (m, vec_sub (dh, one));
+  sh = vec_div (f, dh);
+  t = vec_nmsub (sh, dh, f);
+  sl = vec_div (vec_nmsub (sh, dl, t), dh);
+  /* log(m) = 2s + s^3 (2/3 + s^2 P(s^2)).  */
+  zh = vec_mul (sh, sh);
+  zl = vec_madd (vec_add (sh, sh), sl, vec_msub (sh, sh, zh));
+  g = __vec_math_poly (zh, __vec_math_logk_c, 8);
+  ph = vec_mul (zh, g);
+  pl = vec_madd (zl, g, vec_msub (zh, g, ph));
+  qh = __vec_math_fast_two_sum (vec_splats (0x1.5555555555555p-1), ph, &ql);
+  ql = vec_add (ql, vec_add (vec_splats (0x1.5555555555555p-55), pl));
+  wh = __vec_math_dd_mul (zh, zl, qh, ql, &wl);
+  wh = __vec_math_dd_mul (sh, sl, wh, wl, &wl);
+  lh = __vec_math_fast_two_sum (vec_add (sh, sh), wh, &l);
+  l = vec_add (l, vec_add (vec_add (sl, sl), wl));
+  /* + e ln2.  */
+  eh = vec_mul (ef, vec_splats (__VEC_MATH_LN2E_HI));
+  el = vec_mul (ef, vec_splats (__VEC_MATH_LN2E_LO));
+  lh = __vec_math_two_sum (eh, lh, &t);
+  return __vec_math_fast_two_sum (lh, vec_add (t, vec_add (l, el)), ll);
+}
+
+/* log of the lanes of x that are not positive finite.  */
+static inline vf64_t
+__vec_math_log_special (vf64_t x, vf64_t r)
+{
+  const vf64_t zero = vec_splats (0.0);
+  vb64_t pos;
+  vf64_t s;
+
+  pos = vec_and (vec_cmpgt (x, zero),
+		 vec_cmplt (x, vec_splats (__builtin_inf ())));
+  s = vec_sel (vec_add (x, x), vec_splats (__builtin_nan ("")),
+	       vec_cmplt (x, zero));
+  s = vec_sel (s, vec_splats (-__builtin_inf ()), vec_cmpeq (x, zero));
+  return vec_sel (s, r, pos);
+}
+
+static inline vf64_t
+__vec_math_log_u10 (vf64_t x)
+{
+  vf64_t ll;
+
+  return __vec_math_log_special (x, __vec_math_logk (x, &ll));
+}
+
+static inline vf64_t
+__vec_math_log_u35 (vf64_t x)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t m, ef, f, s, z, p;
+
+  m = __vec_math_frexp (x, &ef);
+  f = vec_sub (m, one);
+  s = vec_div (f, vec_add (m, one));
+  z = vec_mul (s, s);
+  p = __vec_math_poly (z, __vec_math_log_u35_c, 7);
+  p = vec_madd (vec_mul (s, z), p, vec_add (s, s));
+  p = vec_madd (ef, vec_splats (__VEC_MATH_LN2E_LO), p);
+  p = vec_madd (ef, vec_splats (__VEC_MATH_LN2E_HI), p);
+  return __vec_math_log_special (x, p);
+}
+
+static inline vf64_t
+__vec_math_pow (vf64_t x, vf64_t y)
+{
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t inf = vec_splats (__builtin_inf ());
+  const vf64_t two52 = vec_splats (0x1p52);
+  vf64_t ax, ay, h, lh, ll, th, tl, eh, el, r;
+  vb64_t yint, yodd, m;
+  vi64_t k;
+
+  /* |x|^y = e^(y log|x|).  */
+  ax = vec_abs (x);
+  lh = __vec_math_logk (ax, &ll);
+  th = vec_mul (y, lh);
+  tl = vec_madd (y, ll, vec_msub (y, lh, th));
+  eh = __vec_math_expk (th, tl, &el, &k);
+  r = __vec_math_scale (eh, el, k);
+  r = vec_sel (r, inf, vec_cmpgt (th, vec_splats (710.0)));
+  r = vec_sel (r, zero, vec_cmplt (th, vec_splats (-746.0)));
+
+  /* x of 0 or infinity, and y of infinity.  */
+  m = vec_cmplt (y, zero);
+  r = vec_sel (r, vec_sel (zero, inf, m), vec_cmpeq (ax, zero));
+  r = vec_sel (r, vec_sel (inf, zero, m), vec_cmpeq (ax, inf));
+  ay = vec_abs (y);
+  m = vec_xor (vec_cmplt (ax, one), m);
+  r = vec_sel (r, vec_sel (inf, zero, m), vec_cmpeq (ay, inf));
+  r = vec_sel (r, one, vec_and (vec_cmpeq (ay, inf), vec_cmpeq (ax, one)));
+
+  /* Every |y| >= 2^52 is an integer, and odd only below 2^53.  */
+  yint = vec_or (vec_cmpge (ay, two52),
+		 vec_cmpeq (vec_sub (vec_add (ay, two52), two52), ay));
+  h = vec_mul (ay, vec_splats (0.5));
+  yodd = vec_andc (vec_and (yint, vec_cmplt (ay, vec_splats (0x1p53))),
+		   vec_cmpeq (vec_sub (vec_add (h, two52), two52), h));
+  r = vec_sel (r, vec_copysignf64 (x, r), yodd);
+  m = vec_andc (vec_and (vec_cmplt (x, zero), vec_cmplt (ax, inf)), yint);
+  r = vec_sel (r, vec_splats (__builtin_nan ("")), m);
+
+  r = vec_sel (r, vec_add (x, y), vec_or (vec_isnanf64 (x),
+					  vec_isnanf64 (y)));
+  r = vec_sel (r, one, vec_cmpeq (y, zero));
+  return vec_sel (r, one, vec_cmpeq (x, one));
+}
+
+/* Payne-Hanek reduction of finite |x| > 2^20 to n pi/2 + (*rh + *rl),
+ * |*rh| <= pi/4. Returns n mod 4.  */
+static int
+__vec_math_rem_pio2_large (double x, double *rh, double *rl)
+{
+  unsigned long long ix, m, c[3], p[5], fh, fl;
+  unsigned __int128 t;
+  int e, pos, sh, w, b, i, q, neg, lz;
+  double a, ah, al, h, l, s, sc;
+
+  memcpy (&ix, &x, sizeof (ix));
+  neg = ix >> 63;
+  e = (int) ((ix >> 52) & 0x7ff) - 1075;
+  m = (ix & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+  /* x (2/pi) = m 2^e sum b[i] 2^-i. The bits with i <= e - 2 add
+   * multiples of 4, so start the 192-bit window of 2/pi at bit e - 1,
+   * or at the first bit. sh is the weight of the window LSB.  */
+  pos = e - 2 > 0 ? e - 2 : 0;
+  sh = pos + 192 - e;
+  for (i = 0; i < 3; i++)
+    {
+      w = (pos >> 6) + i;
+      b = pos & 63;
+      c[i] = __vec_math_2opi[w] << b;
+      if (b)
+	c[i] |= __vec_math_2opi[w + 1] >> (64 - b);
+    }
+  /* p = m c, 245 bits.  */
+  t = (unsigned __int128) m * c[2];
+  p[0] = (unsigned long long) t;
+  t = (unsigned __int128) m * c[1] + (t >> 64);
+  p[1] = (unsigned long long) t;
+  t = (unsigned __int128) m * c[0] + (t >> 64);
+  p[2] = (unsigned long long) t;
+  p[3] = (unsigned long long) (t >> 64);
+  p[4] = 0;
+  /* The fraction is the 128 bits below bit sh, and n the 2 bits
+   * above. sh - 128 is 62 to 96.  */
+  w = (sh - 128) >> 6;
+  b = (sh - 128) & 63;
+  fl = (p[w] >> b) | (b ? p[w + 1] << (64 - b) : 0);
+  fh = (p[w + 1] >> b) | (b ? p[w + 2] << (64 - b) : 0);
+  q = (int) (((p[w + 2] >> b) | (b ? p[w + 3] << (64 - b) : 0)) & 3);
+  s = 1.0;
+  if (fh >> 63)
+    {
+      /* Round n to nearest, the fraction is 1 - f.  */
+      q++;
+      s = -1.0;
+      fl = -fl;
+      fh = ~fh + (fl == 0);
+    }
+  /* f = (fh 2^64 + fl) 2^-128 as double-double. Normalize so fh has
+   * 64 significant bits, then convert 32 bits at a time.  */
+  sc = 1.0;
+  if (fh == 0)
+    {
+      fh = fl;
+      fl = 0;
+      sc = 0x1p-64;
+    }
+  lz = __builtin_clzll (fh);
+  if (lz)
+    {
+      fh = (fh << lz) | (fl >> (64 - lz));
+      fl <<= lz;
+    }
+  ix = (unsigned long long) (1023 - 64 - lz) << 52;
+  memcpy (&a, &ix, sizeof (a));
+  sc *= a;
+  a = (double) (fh >> 32) * 0x1p32;
+  ah = a + (double) (fh & 0xffffffffULL);
+  al = (a - ah) + (double) (fh & 0xffffffffULL);
+  al += (double) fl * 0x1p-64;
+  ah *= sc;
+  al *= sc;
+  /* r = f pi/2.  */
+  h = ah * __VEC_MATH_PIO2_HI;
+  l = __builtin_fma (ah, __VEC_MATH_PIO2_HI, -h);
+  l = __builtin_fma (ah, __VEC_MATH_PIO2_LO, l);
+  l = __builtin_fma (al, __VEC_MATH_PIO2_HI, l);
+  s = neg ? -s : s;
+  *rh = s * (h + l);
+  *rl = s * (l - ((h + l) - h));
+  return (neg ? -q : q) & 3;
+}
+
+/* Replace the lanes of x with |x| > 2^20 or not finite.  */
+static inline vf64_t
+__vec_math_rem_pio2_fix (vf64_t x, vf64_t rh, vf64_t *rl, vi64_t *q)
+{
+  double h, l;
+  int i;
+
+  for (i = 0; i < 2; i++)
+    if (!(__builtin_fabs (x[i]) <= 0x1p20))
+      {
+	if (x[i] - x[i] == 0.0)
+	  {
+	    (*q)[i] = __vec_math_rem_pio2_large (x[i], &h, &l);
+	    rh[i] = h;
+	    (*rl)[i] = l;
+	  }
+	else
+	  {
+	    (*q)[i] = 0;
+	    rh[i] = x[i] - x[i];
+	    (*rl)[i] = 0.0;
+	  }
+      }
+  return rh;
+}
+
+/* x = q pi/2 + (rh + *rl), |rh| <= pi/4.  */
+static inline vf64_t
+__vec_math_rem_pio2_u10 (vf64_t x, vf64_t *rl, vi64_t *q)
+{
+  vf64_t n, a, rh, t, l;
+
+  n = __vec_math_rint (vec_mul (x, vec_splats (__VEC_MATH_2OPI)), q);
+  a = vec_nmsub (n, vec_splats (__VEC_MATH_PIO2_1), x);
+  a = __vec_math_two_sum (a, vec_mul (n, vec_splats (-__VEC_MATH_PIO2_2)),
+			  &l);
+  rh = __vec_math_two_sum (a, vec_mul (n, vec_splats (-__VEC_MATH_PIO2_3)),
+			   &t);
+  t = vec_add (t, vec_nmsub (n, vec_splats (__VEC_MATH_PIO2_3T), l));
+  rh = __vec_math_fast_two_sum (rh, t, rl);
+  if (!vec_all_le (vec_abs (x), vec_splats (0x1p20)))
+    rh = __vec_math_rem_pio2_fix (x, rh, rl, q);
+  return rh;
+}
+
+static inline vf64_t
+__vec_math_rem_pio2_u35 (vf64_t x, vi64_t *q)
+{
+  vf64_t n, r, rl = vec_splats (0.0);
+
+  n = __vec_math_rint (vec_mul (x, vec_splats (__VEC_MATH_2OPI)), q);
+  r = vec_nmsub (n, vec_splats (__VEC_MATH_PIO2_1), x);
+  r = vec_nmsub (n, vec_splats (__VEC_MATH_PIO2_2), r);
+  r = vec_nmsub (n, vec_splats (__VEC_MATH_PIO2_3), r);
+  if (!vec_all_le (vec_abs (x), vec_splats (0x1p20)))
+    r = __vec_math_rem_pio2_fix (x, r, &rl, q);
+  return r;
+}
+
+/* sin(rh + rl) and cos(rh + rl) for |rh| <= pi/4, z = rh^2.  */
+static inline vf64_t
+__vec_math_sin_k (vf64_t rh, vf64_t rl, vf64_t z, const double *c, int n)
+{
+  vf64_t t;
+
+  t = vec_nmsub (vec_mul (z, vec_splats (0.5)), rl, rl);
+  t = vec_madd (vec_mul (z, rh), __vec_math_poly (z, c, n), t);
+  return vec_add (rh, t);
+}
+
+static inline vf64_t
+__vec_math_cos_k (vf64_t rh, vf64_t rl, vf64_t z, const double *c, int n)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t hz, w, t;
+
+  /* 1 - z/2 rounded, plus its rounding error exactly.  */
+  hz = vec_mul (z, vec_splats (0.5));
+  w = vec_sub (one, hz);
+  t = vec_nmsub (rh, rl, vec_mul (vec_mul (z, z),
+				  __vec_math_poly (z, c, n)));
+  return vec_add (w, vec_add (vec_sub (vec_sub (one, w), hz), t));
+}
+
+/* Select sin(x) from s = sin(r) and c = cos(r) for quadrant q.
+ * cos(x) is the select for quadrant q + 1.  */
+static inline vf64_t
+__vec_math_quadrant (vf64_t s, vf64_t c, vi64_t q)
+{
+  const vui64_t one = vec_splats ((unsigned long long) 1);
+  const vui64_t two = vec_splats ((unsigned long long) 2);
+  vb64_t odd;
+  vui64_t sgn;
+
+  odd = vec_cmpequd (vec_and ((vui64_t) q, one), one);
+  sgn = vec_sldi (vec_and ((vui64_t) q, two), 62);
+  return (vf64_t) vec_xor ((vui64_t) vec_sel (s, c, odd), sgn);
+}
+
+/* sin(x) rounds to x for |x| < 2^-26, which also keeps the sign of
+ * -0.0 that the reduction loses.  */
+static inline vf64_t
+__vec_math_sin_tiny (vf64_t x, vf64_t s)
+{
+  return vec_sel (s, x, vec_cmplt (vec_abs (x), vec_splats (0x1p-26)));
+}
+
+static inline vi64_t
+__vec_math_q1 (vi64_t q)
+{
+  return (vi64_t) vec_addudm ((vui64_t) q,
+			      vec_splats ((unsigned long long) 1));
+}
+
+static inline vf64_t
+__vec_math_sin_u10 (vf64_t x)
+{
+  vf64_t rh, rl, z, s, c;
+  vi64_t q;
+
+  rh = __vec_math_rem_pio2_u10 (x, &rl, &q);
+  z = vec_mul (rh, rh);
+  s = __vec_math_sin_k (rh, rl, z, __vec_math_sin_u10_c, 7);
+  c = __vec_math_cos_k (rh, rl, z, __vec_math_cos_u10_c, 7);
+  return __vec_math_sin_tiny (x, __vec_math_quadrant (s, c, q));
+}
+
+static inline vf64_t
+__vec_math_cos_u10 (vf64_t x)
+{
+  vf64_t rh, rl, z, s, c;
+  vi64_t q;
+
+  rh = __vec_math_rem_pio2_u10 (x, &rl, &q);
+  z = vec_mul (rh, rh);
+  s = __vec_math_sin_k (rh, rl, z, __vec_math_sin_u10_c, 7);
+  c = __vec_math_cos_k (rh, rl, z, __vec_math_cos_u10_c, 7);
+  return __vec_math_quadrant (s, c, __vec_math_q1 (q));
+}
+
+static inline vf64_t
+__vec_math_sin_u35 (vf64_t x)
+{
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t r, z, s, c;
+  vi64_t q;
+
+  r = __vec_math_rem_pio2_u35 (x, &q);
+  z = vec_mul (r, r);
+  s = __vec_math_sin_k (r, zero, z, __vec_math_sin_u35_c, 6);
+  c = __vec_math_cos_k (r, zero, z, __vec_math_cos_u35_c, 6);
+  return __vec_math_sin_tiny (x, __vec_math_quadrant (s, c, q));
+}
+
+static inline vf64_t
+__vec_math_cos_u35 (vf64_t x)
+{
+  const vf64_t zero = vec_splats (0.0);
+  vf64_t r, z, s, c;
+  vi64_t q;
+
+  r = __vec_math_rem_pio2_u35 (x, &q);
+  z = vec_mul (r, r);
+  s = __vec_math_sin_k (r, zero, z, __vec_math_sin_u35_c, 6);
+  c = __vec_math_cos_k (r, zero, z, __vec_math_cos_u35_c, 6);
+  return __vec_math_quadrant (s, c, __vec_math_q1 (q));
+}
+
+/* e^(2|x|) = eh + *el for |x| <= 22.  */
+static inline vf64_t
+__vec_math_exp2x (vf64_t ax, vf64_t *el)
+{
+  vf64_t eh, p;
+  vi64_t k;
+
+  eh = __vec_math_expk (vec_add (ax, ax), vec_splats (0.0), el, &k);
+  p = __vec_math_pow2i (k);
+  *el = vec_mul (*el, p);
+  return vec_mul (eh, p);
+}
+
+/* tanh(x) = (e^2x - 1) / (e^2x + 1) for |x| of 2^-28 to 22, else x
+ * or +-1.  */
+static inline vf64_t
+__vec_math_tanh_range (vf64_t x, vf64_t ax, vf64_t r)
+{
+  r = vec_sel (r, vec_splats (1.0), vec_cmpgt (ax, vec_splats (22.0)));
+  r = vec_sel (r, ax, vec_cmplt (ax, vec_splats (0x1p-28)));
+  return vec_copysignf64 (x, r);
+}
+
+static inline vf64_t
+__vec_math_tanh_u10 (vf64_t x)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t ax, eh, el, nh, nl, dh, dl, t;
+
+  ax = vec_abs (x);
+  eh = __vec_math_exp2x (ax, &el);
+  nh = __vec_math_two_sum (eh, vec_splats (-1.0), &t);
+  nh = __vec_math_fast_two_sum (nh, vec_add (t, el), &nl);
+  dh = __vec_math_fast_two_sum (eh, one, &t);
+  dh = __vec_math_fast_two_sum (dh, vec_add (t, el), &dl);
+  nh = __vec_math_dd_div (nh, nl, dh, dl, &t);
+  return __vec_math_tanh_range (x, ax, nh);
+}
+
+static inline vf64_t
+__vec_math_tanh_u35 (vf64_t x)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t ax, eh, el, r;
+
+  ax = vec_abs (x);
+  eh = __vec_math_exp2x (ax, &el);
+  r = vec_div (vec_add (vec_sub (eh, one), el),
+	       vec_add (vec_add (eh, one), el));
+  return __vec_math_tanh_range (x, ax, r);
+}
+
+/* sigmoid(x) = 1 / (1 + e^-x), evaluated as e^-|x| / (1 + e^-|x|)
+ * for x < 0 so there is no overflow or cancellation.  */
+static inline vf64_t
+__vec_math_sigmoid_u10 (vf64_t x)
+{
+  const vf64_t zero = vec_splats (0.0);
+  const vf64_t one = vec_splats (1.0);
+  vf64_t ax, eh, el, p, dh, dl, t, r;
+  vb64_t pos;
+  vi64_t k;
+
+  ax = vec_abs (x);
+  eh = __vec_math_expk (vec_sub (zero, ax), zero, &el, &k);
+  p = __vec_math_pow2i (k);
+  eh = vec_mul (eh, p);
+  el = vec_mul (el, p);
+  dh = __vec_math_fast_two_sum (one, eh, &t);
+  dh = __vec_math_fast_two_sum (dh, vec_add (t, el), &dl);
+  pos = vec_cmpge (x, zero);
+  r = __vec_math_dd_div (vec_sel (eh, one, pos), vec_sel (el, zero, pos),
+			 dh, dl, &t);
+  /* Beyond +-40 sigmoid(x) rounds to 1 or e^x.  */
+  r = vec_sel (r, one, vec_cmpgt (x, vec_splats (40.0)));
+  if (vec_any_lt (x, vec_splats (-40.0)))
+    r = vec_sel (r, __vec_math_exp_u10 (x),
+		 vec_cmplt (x, vec_splats (-40.0)));
+  return r;
+}
+
+static inline vf64_t
+__vec_math_sigmoid_u35 (vf64_t x)
+{
+  const vf64_t one = vec_splats (1.0);
+  vf64_t e;
+
+  e = __vec_math_exp_u35 (vec_sub (vec_splats (0.0), vec_abs (x)));
+  return vec_div (vec_sel (e, one, vec_cmpge (x, vec_splats (0.0))),
+		  vec_add (one, e));
+}
+
+/* Native float kernels.  */
+static inline vf32_t
+__vec_math_rintf (vf32_t x, vi32_t *k)
+{
+  const vf32_t magic = vec_splats (0x1.8p23f);
+  vf32_t t = vec_add (x, magic);
+
+  *k = (vi32_t) vec_sub ((vui32_t) t, (vui32_t) magic);
+  return vec_sub (t, magic);
+}
+
+static inline vf32_t
+__vec_math_pow2if (vi32_t k)
+{
+  return (vf32_t) vec_sl (vec_add ((vui32_t) k, vec_splats ((unsigned) 127)),
+			  vec_splats ((unsigned) 23));
+}
+
+static inline vf32_t
+__vec_math_expf_u35 (vf32_t x)
+{
+  const vf32_t inf = vec_splats (__builtin_inff ());
+  vf32_t kf, r, p;
+  vi32_t k, k1;
+
+  kf = __vec_math_rintf (vec_mul (x, vec_splats (0x1.715476p0f)), &k);
+  r = vec_nmsub (kf, vec_splats (0x1.62e430p-1f), x);
+  r = vec_nmsub (kf, vec_splats (-0x1.05c610p-29f), r);
+  p = __vec_math_polyf (r, __vec_math_expf_c, 5);
+  p = vec_add (vec_splats (1.0f), vec_madd (vec_mul (r, r), p, r));
+  /* 2^k in two steps, for |k| <= 150.  */
+  k1 = vec_sra (k, vec_splats ((unsigned) 1));
+  p = vec_mul (p, __vec_math_pow2if (k1));
+  p = vec_mul (p, __vec_math_pow2if (vec_sub (k, k1)));
+  p = vec_sel (p, inf, vec_cmpgt (x, vec_splats (0x1.62e42ep6f)));
+  return vec_sel (p, vec_splats (0.0f), vec_cmplt (x, vec_splats (-104.0f)));
+}
+
+static inline vf32_t
+__vec_math_logf_u35 (vf32_t x)
+{
+  const vf32_t zero = vec_splats (0.0f);
+  const vf32_t one = vec_splats (1.0f);
+  const vf32_t inf = vec_splats (__builtin_inff ());
+  vb32_t tiny, big, pos;
+  vf32_t m, e, f, s, z, p;
+
+  tiny = vec_cmplt (x, vec_splats (0x1p-126f));
+  p = vec_sel (x, vec_mul (x, vec_splats (0x1p23f)), tiny);
+  e = (vf32_t) vec_or (vec_sr ((vui32_t) p, vec_splats ((unsigned) 23)),
+		       vec_splats ((unsigned) 0x4b000000));
+  e = vec_sub (e, vec_splats (0x1p23f + 127.0f));
+  m = (vf32_t) vec_or (vec_and ((vui32_t) p,
+				vec_splats ((unsigned) 0x007fffff)),
+		       vec_splats ((unsigned) 0x3f800000));
+  big = vec_cmpgt (m, vec_splats (0x1.6a09e6p0f));
+  m = vec_sel (m, vec_mul (m, vec_splats (0.5f)), big);
+  e = vec_sel (e, vec_add (e, one), big);
+  e = vec_sel (e, vec_sub (e, vec_splats (23.0f)), tiny);
+  f = vec_sub (m, one);
+  s = vec_div (f, vec_add (m, one));
+  z = vec_mul (s, s);
+  p = __vec_math_polyf (z, __vec_math_logf_c, 4);
+  p = vec_madd (vec_mul (s, z), p, vec_add (s, s));
+  p = vec_madd (e, vec_splats (-0x1.05c610p-29f), p);
+  p = vec_madd (e, vec_splats (0x1.62e430p-1f), p);
+  /* Not positive finite.  */
+  pos = vec_and (vec_cmpgt (x, zero), vec_cmplt (x, inf));
+  s = vec_sel (vec_add (x, x), vec_splats (__builtin_nanf ("")),
+	       vec_cmplt (x, zero));
+  s = vec_sel (s, vec_splats (-__builtin_inff ()), vec_cmpeq (x, zero));
+  return vec_sel (s, p, pos);
+}
+
+/* Evaluate the double kernel fn for the 4 floats of x.  */
+static inline vf32_t __attribute__((always_inline))
+__vec_math_f32_f64 (vf32_t x, vf64_t (*fn) (vf64_t))
+{
+  float t[4];
+
+  memcpy (t, &x, sizeof (t));
+  vec_vsstfsso (fn (vec_vglfsso (t, 0, 4)), t, 0, 4);
+  vec_vsstfsso (fn (vec_vglfsso (t, 8, 12)), t, 8, 12);
+  memcpy (&x, t, sizeof (x));
+  return x;
+}
+
+/* sin (cos = 0) or cos (cos = 1) of x. The 3 FMA reduction with a
+ * 24-bit pi/2 is within 1 ULP for |x| <= 2^13, larger or non-finite
+ * x use the double kernel.  */
+static inline vf32_t __attribute__((always_inline))
+__vec_math_sincosf_u35 (vf32_t x, int cos)
+{
+  const vf32_t one = vec_splats (1.0f);
+  const vui32_t u1 = vec_splats ((unsigned) 1);
+  vf32_t n, r, z, s, c;
+  vui32_t q, sgn;
+  vi32_t k;
+
+  if (!vec_all_le (vec_abs (x), vec_splats (0x1p13f)))
+    return __vec_math_f32_f64 (x, cos ? __vec_math_cos_u35
+			       : __vec_math_sin_u35);
+  n = __vec_math_rintf (vec_mul (x, vec_splats (0x1.45f306p-1f)), &k);
+  r = vec_nmsub (n, vec_splats (0x1.921fb6p0f), x);
+  r = vec_nmsub (n, vec_splats (-0x1.777a5cp-25f), r);
+  r = vec_nmsub (n, vec_splats (-0x1.ee59dap-50f), r);
+  z = vec_mul (r, r);
+  s = vec_madd (vec_mul (r, z), __vec_math_polyf (z, __vec_math_sinf_c, 4),
+		r);
+  c = vec_madd (vec_mul (z, z), __vec_math_polyf (z, __vec_math_cosf_c, 4),
+		vec_nmsub (vec_splats (0.5f), z, one));
+  q = vec_add ((vui32_t) k, vec_splats ((unsigned) cos));
+  sgn = vec_sl (vec_and (q, vec_splats ((unsigned) 2)),
+		vec_splats ((unsigned) 30));
+  s = vec_sel (s, c, vec_cmpeq (vec_and (q, u1), u1));
+  s = (vf32_t) vec_xor ((vui32_t) s, sgn);
+  /* As for double, sin(x) = x for tiny x, including -0.0.  */
+  if (!cos)
+    s = vec_sel (s, x, vec_cmplt (vec_abs (x), vec_splats (0x1p-12f)));
+  return s;
+}
+
+static inline vf32_t
+__vec_math_sinf_u35 (vf32_t x)
+{
+  return __vec_math_sincosf_u35 (x, 0);
+}
+
+static inline vf32_t
+__vec_math_cosf_u35 (vf32_t x)
+{
+  return __vec_math_sincosf_u35 (x, 1);
+}
+
+static inline vf32_t
+__vec_math_sigmoidf_u35 (vf32_t x)
+{
+  const vf32_t one = vec_splats (1.0f);
+  vf32_t e;
+
+  e = __vec_math_expf_u35 (vec_sub (vec_splats (0.0f), vec_abs (x)));
+  return vec_div (vec_sel (e, one, vec_cmpge (x, vec_splats (0.0f))),
+		  vec_add (one, e));
+}
+
+/* Array loops. The tails are computed in a zero padded vector.  */
+static inline void __attribute__((always_inline))
+__vec_math_map_f64 (double *out, const double *in, unsigned long n,
+		    vf64_t (*fn) (vf64_t))
+{
+  vf64_t x0, x1;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      memcpy (&x0, &in[i], sizeof (x0));
+      memcpy (&x1, &in[i + 2], sizeof (x1));
+      x0 = fn (x0);
+      x1 = fn (x1);
+      memcpy (&out[i], &x0, sizeof (x0));
+      memcpy (&out[i + 2], &x1, sizeof (x1));
+    }
+  for (; i < n; i += 2)
+    {
+      double t[2] = { 0.0, 0.0 };
+      unsigned long r = (n - i) < 2 ? (n - i) : 2;
+
+      memcpy (t, &in[i], r * sizeof (double));
+      memcpy (&x0, t, sizeof (x0));
+      x0 = fn (x0);
+      memcpy (t, &x0, sizeof (x0));
+      memcpy (&out[i], t, r * sizeof (double));
+    }
+}
+
+static inline void __attribute__((always_inline))
+__vec_math_map_f32 (float *out, const float *in, unsigned long n,
+		    vf32_t (*fn) (vf32_t))
+{
+  vf32_t x0;
+  unsigned long i;
+
+  for (i = 0; i < n; i += 4)
+    {
+      float t[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+      unsigned long r = (n - i) < 4 ? (n - i) : 4;
+
+      memcpy (t, &in[i], r * sizeof (float));
+      memcpy (&x0, t, sizeof (x0));
+      x0 = fn (x0);
+      memcpy (t, &x0, sizeof (x0));
+      memcpy (&out[i], t, r * sizeof (float));
+    }
+}
+
+/* float in and out, double kernel.  */
+static inline void __attribute__((always_inline))
+__vec_math_map_f32_f64 (float *out, const float *in, unsigned long n,
+			vf64_t (*fn) (vf64_t))
+{
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      vf64_t x0 = vec_vglfsso ((float *) &in[i], 0, 4);
+      vf64_t x1 = vec_vglfsso ((float *) &in[i], 8, 12);
+
+      vec_vsstfsso (fn (x0), &out[i], 0, 4);
+      vec_vsstfsso (fn (x1), &out[i], 8, 12);
+    }
+  for (; i < n; i++)
+    {
+      vf64_t x0 = vec_vglfsso ((float *) &in[i], 0, 0);
+
+      vec_vsstfsso (fn (x0), &out[i], 0, 0);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_exp_f64_u10) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_exp_u10);
+}
+
+void
+__VEC_PWR_IMP (vec_exp_f64_u35) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_exp_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_log_f64_u10) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_log_u10);
+}
+
+void
+__VEC_PWR_IMP (vec_log_f64_u35) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_log_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_sin_f64_u10) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_sin_u10);
+}
+
+void
+__VEC_PWR_IMP (vec_sin_f64_u35) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_sin_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_cos_f64_u10) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_cos_u10);
+}
+
+void
+__VEC_PWR_IMP (vec_cos_f64_u35) (double *out, const double *in,
+				 unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_cos_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_tanh_f64_u10) (double *out, const double *in,
+				  unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_tanh_u10);
+}
+
+void
+__VEC_PWR_IMP (vec_tanh_f64_u35) (double *out, const double *in,
+				  unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_tanh_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_sigmoid_f64_u10) (double *out, const double *in,
+				     unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_sigmoid_u10);
+}
+
+void
+__VEC_PWR_IMP (vec_sigmoid_f64_u35) (double *out, const double *in,
+				     unsigned long n)
+{
+  __vec_math_map_f64 (out, in, n, __vec_math_sigmoid_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_pow_f64_u10) (double *out, const double *x,
+				 const double *y, unsigned long n)
+{
+  vf64_t x0, y0;
+  unsigned long i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      memcpy (&x0, &x[i], sizeof (x0));
+      memcpy (&y0, &y[i], sizeof (y0));
+      x0 = __vec_math_pow (x0, y0);
+      memcpy (&out[i], &x0, sizeof (x0));
+    }
+  if (i < n)
+    {
+      x0 = vec_splats (x[i]);
+      y0 = vec_splats (y[i]);
+      out[i] = __vec_math_pow (x0, y0)[0];
+    }
+}
+
+/* There is no cheaper pow within 3.5 ULP, see above.  */
+void
+__VEC_PWR_IMP (vec_pow_f64_u35) (double *out, const double *x,
+				 const double *y, unsigned long n)
+{
+  __VEC_PWR_IMP (vec_pow_f64_u10) (out, x, y, n);
+}
+
+void
+__VEC_PWR_IMP (vec_exp_f32_u10) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_exp_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_exp_f32_u35) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32 (out, in, n, __vec_math_expf_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_log_f32_u10) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_log_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_log_f32_u35) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32 (out, in, n, __vec_math_logf_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_sin_f32_u10) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_sin_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_sin_f32_u35) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32 (out, in, n, __vec_math_sinf_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_cos_f32_u10) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_cos_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_cos_f32_u35) (float *out, const float *in,
+				 unsigned long n)
+{
+  __vec_math_map_f32 (out, in, n, __vec_math_cosf_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_tanh_f32_u10) (float *out, const float *in,
+				  unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_tanh_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_tanh_f32_u35) (float *out, const float *in,
+				  unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_tanh_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_sigmoid_f32_u10) (float *out, const float *in,
+				     unsigned long n)
+{
+  __vec_math_map_f32_f64 (out, in, n, __vec_math_sigmoid_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_sigmoid_f32_u35) (float *out, const float *in,
+				     unsigned long n)
+{
+  __vec_math_map_f32 (out, in, n, __vec_math_sigmoidf_u35);
+}
+
+void
+__VEC_PWR_IMP (vec_pow_f32_u10) (float *out, const float *x,
+				 const float *y, unsigned long n)
+{
+  unsigned long i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      vf64_t x0 = vec_vglfsso ((float *) &x[i], 0, 4);
+      vf64_t y0 = vec_vglfsso ((float *) &y[i], 0, 4);
+
+      vec_vsstfsso (__vec_math_pow (x0, y0), &out[i], 0, 4);
+    }
+  if (i < n)
+    {
+      vf64_t x0 = vec_vglfsso ((float *) &x[i], 0, 0);
+      vf64_t y0 = vec_vglfsso ((float *) &y[i], 0, 0);
+
+      vec_vsstfsso (__vec_math_pow (x0, y0), &out[i], 0, 0);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_pow_f32_u35) (float *out, const float *x,
+				 const float *y, unsigned long n)
+{
+  __VEC_PWR_IMP (vec_pow_f32_u10) (out, x, y, n);
+}
@@ -0,0 +1,306 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_pool_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/*!
+ * \file  vec_pool_runtime.c
+ * \brief Small persistent pthread worker pool shared by the
+ * multithreaded runtime operations (for example
+ * vec_mul512_byMN_parallel()).
+ *
+ * This code is not -mcpu= target specific, so it is built once into
+ * libpvecstatic and once (via vec_runtime_common.c) into libpvec.
+ * The target qualified runtime implementations pass a task function
+ * and task count to vec_pool_run(). The calling thread also executes
+ * tasks, so a pool of N threads creates N-1 workers.
+ *
+ * The pool is created lazily on the first vec_pool_run() after
+ * vec_pool_set_threads() selects more than one thread. Calls to
+ * vec_pool_run() from multiple application threads are serialized.
+ * A vec_pool_run() issued from inside a task would wait forever on
+ * the run it is part of, so nested runs execute their tasks inline.
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <pveclib/vec_runtime_ppc.h>
+
+/* Upper bound on worker threads (and affinity list entries).  */
+#define __VEC_POOL_MAX_THREADS 256
+
+typedef struct
+{
+  pthread_mutex_t lock;
+  pthread_cond_t work_cv;
+  pthread_cond_t done_cv;
+  /* Serializes vec_pool_run and reconfiguration.  */
+  pthread_mutex_t run_lock;
+  pthread_t workers[__VEC_POOL_MAX_THREADS];
+  unsigned int nworkers;
+  unsigned int nthreads;
+  int cpus[__VEC_POOL_MAX_THREADS];
+  unsigned int ncpus;
+  /* Current job.  */
+  void (*fn) (void *, unsigned long);
+  void *arg;
+  unsigned long ntasks;
+  unsigned long next_task;
+  unsigned long tasks_done;
+  unsigned long generation;
+  int shutdown;
+} __vec_pool_t;
+
+static __vec_pool_t __vec_pool =
+  {
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .work_cv = PTHREAD_COND_INITIALIZER,
+    .done_cv = PTHREAD_COND_INITIALIZER,
+    .run_lock = PTHREAD_MUTEX_INITIALIZER,
+    .nworkers = 0,
+    .nthreads = 1,
+    .ncpus = 0
+  };
+
+/* Nonzero while this thread is executing a pool task.  */
+static __thread int __vec_pool_in_task;
+
+static void
+__vec_pool_bind (pthread_t thread, unsigned int index)
+{
+  cpu_set_t set;
+
+  if (__vec_pool.ncpus == 0)
+    return;
+
+  CPU_ZERO (&set);
+  CPU_SET (__vec_pool.cpus[index % __vec_pool.ncpus], &set);
+  (void) pthread_setaffinity_np (thread, sizeof (set), &set);
+}
+
+/* Claim and run tasks of the current job until none remain.
+ * Called with the pool lock held, returns with it held.  */
+static void
+__vec_pool_drain (void)
+{
+  while (__vec_pool.next_task < __vec_pool.ntasks)
+    {
+      unsigned long task = __vec_pool.next_task++;
+      void (*fn) (void *, unsigned long) = __vec_pool.fn;
+      void *arg = __vec_pool.arg;
+
+      pthread_mutex_unlock (&__vec_pool.lock);
+      __vec_pool_in_task = 1;
+      fn (arg, task);
+      __vec_pool_in_task = 0;
+      pthread_mutex_lock (&__vec_pool.lock);
+
+      if (++__vec_pool.tasks_done == __vec_pool.ntasks)
+	pthread_cond_signal (&__vec_pool.done_cv);
+    }
+}
+
+static void *
+__vec_pool_worker (void *unused)
+{
+  unsigned long seen = 0;
+
+  (void) unused;
+  pthread_mutex_lock (&__vec_pool.lock);
+  for (;;)
+    {
+      while (!__vec_pool.shutdown && __vec_pool.generation == seen)
+	pthread_cond_wait (&__vec_pool.work_cv, &__vec_pool.lock);
+      if (__vec_pool.shutdown)
+	break;
+      seen = __vec_pool.generation;
+      __vec_pool_drain ();
+    }
+  pthread_mutex_unlock (&__vec_pool.lock);
+  return NULL;
+}
+
+/* Stop and join all workers. Called with run_lock held.  */
+static void
+__vec_pool_stop (void)
+{
+  unsigned int i;
+
+  pthread_mutex_lock (&__vec_pool.lock);
+  __vec_pool.shutdown = 1;
+  pthread_cond_broadcast (&__vec_pool.work_cv);
+  pthread_mutex_unlock (&__vec_pool.lock);
+
+  for (i = 0; i < __vec_pool.nworkers; i++)
+    pthread_join (__vec_pool.workers[i], NULL);
+
+  __vec_pool.nworkers = 0;
+  __vec_pool.shutdown = 0;
+}
+
+/* Start nthreads-1 workers. Called with run_lock held.
+ * Returns the number of threads (including the caller) available.  */
+static unsigned int
+__vec_pool_start (void)
+{
+  unsigned int i;
+
+  for (i = 0; (i + 1) < __vec_pool.nthreads; i++)
+    {
+      if (pthread_create (&__vec_pool.workers[i], NULL,
+			  __vec_pool_worker, NULL) != 0)
+	break;
+      /* Worker i runs on affinity entry i+1. Entry 0 is applied to
+         the calling thread by vec_pool_run.  */
+      __vec_pool_bind (__vec_pool.workers[i], i + 1);
+    }
+  __vec_pool.nworkers = i;
+
+  return (i + 1);
+}
+
+int
+vec_pool_set_threads (unsigned int nthreads)
+{
+  if (nthreads == 0)
+    nthreads = 1;
+  if (nthreads > __VEC_POOL_MAX_THREADS)
+    nthreads = __VEC_POOL_MAX_THREADS;
+
+  pthread_mutex_lock (&__vec_pool.run_lock);
+  if (__vec_pool.nworkers > 0)
+    __vec_pool_stop ();
+  pthread_mutex_lock (&__vec_pool.lock);
+  __vec_pool.nthreads = nthreads;
+  pthread_mutex_unlock (&__vec_pool.lock);
+  pthread_mutex_unlock (&__vec_pool.run_lock);
+
+  return (int) nthreads;
+}
+
+unsigned int
+vec_pool_get_threads (void)
+{
+  unsigned int nthreads;
+
+  /* Use the job lock, not run_lock, so this is safe to call from
+     a task.  */
+  pthread_mutex_lock (&__vec_pool.lock);
+  nthreads = __vec_pool.nthreads;
+  pthread_mutex_unlock (&__vec_pool.lock);
+
+  return nthreads;
+}
+
+int
+vec_pool_set_affinity (const int *cpus, unsigned int ncpus)
+{
+  unsigned int i;
+
+  if (ncpus > __VEC_POOL_MAX_THREADS)
+    ncpus = __VEC_POOL_MAX_THREADS;
+  if (cpus == NULL)
+    ncpus = 0;
+
+  for (i = 0; i < ncpus; i++)
+    {
+      if (cpus[i] < 0 || cpus[i] >= CPU_SETSIZE)
+	return -1;
+    }
+
+  pthread_mutex_lock (&__vec_pool.run_lock);
+  /* Restart any running workers so they pick up the new binding.  */
+  if (__vec_pool.nworkers > 0)
+    __vec_pool_stop ();
+  for (i = 0; i < ncpus; i++)
+    __vec_pool.cpus[i] = cpus[i];
+  __vec_pool.ncpus = ncpus;
+  pthread_mutex_unlock (&__vec_pool.run_lock);
+
+  return (int) ncpus;
+}
+
+void
+vec_pool_run (void (*fn) (void *, unsigned long), void *arg,
+	      unsigned long ntasks)
+{
+  cpu_set_t saved;
+  int rebound = 0;
+  unsigned long i;
+
+  if (ntasks == 0)
+    return;
+
+  /* Nested run from a task. The pool is busy with the outer run,
+     so just run these tasks here.  */
+  if (__vec_pool_in_task)
+    {
+      for (i = 0; i < ntasks; i++)
+	fn (arg, i);
+      return;
+    }
+
+  pthread_mutex_lock (&__vec_pool.run_lock);
+  if (__vec_pool.nthreads > 1 && __vec_pool.nworkers == 0)
+    (void) __vec_pool_start ();
+
+  if (__vec_pool.nworkers == 0 || ntasks == 1)
+    {
+      pthread_mutex_unlock (&__vec_pool.run_lock);
+      for (i = 0; i < ntasks; i++)
+	fn (arg, i);
+      return;
+    }
+
+  /* Bind the calling thread to affinity entry 0 for this run.  */
+  if (__vec_pool.ncpus > 0
+      && pthread_getaffinity_np (pthread_self (), sizeof (saved),
+				 &saved) == 0)
+    {
+      __vec_pool_bind (pthread_self (), 0);
+      rebound = 1;
+    }
+
+  pthread_mutex_lock (&__vec_pool.lock);
+  __vec_pool.fn = fn;
+  __vec_pool.arg = arg;
+  __vec_pool.ntasks = ntasks;
+  __vec_pool.next_task = 0;
+  __vec_pool.tasks_done = 0;
+  __vec_pool.generation++;
+  pthread_cond_broadcast (&__vec_pool.work_cv);
+
+  /* The calling thread works too, then waits for stragglers.  */
+  __vec_pool_drain ();
+  while (__vec_pool.tasks_done < __vec_pool.ntasks)
+    pthread_cond_wait (&__vec_pool.done_cv, &__vec_pool.lock);
+  pthread_mutex_unlock (&__vec_pool.lock);
+
+  if (rebound)
+    (void) pthread_setaffinity_np (pthread_self (), sizeof (saved),
+				   &saved);
+  pthread_mutex_unlock (&__vec_pool.run_lock);
+}
@@ -0,0 +1,443 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_rng_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Bulk random number generation. Included by vec_runtime_PWR7.c ...
+ * vec_runtime_PWR10.c.
+ *
+ * PCG64 is the 128-bit LCG (vec_mulluq and vec_adduqm) with the
+ * XSL-RR 64-bit output function. VEC_PCG64_STREAMS independent
+ * streams are stepped together, so the latency of the 128-bit
+ * multiply of one stream is covered by the others, and the output
+ * functions of 2 streams are computed per vector.
+ *
+ * Philox4x32-10 is computed for 4 counters at a time, with word j of
+ * the 4 blocks in vector j. Each round is 2 x vec_muleuw/vec_mulouw
+ * pairs for the 4 high and low products. The result is transposed
+ * back to 4 consecutive words per counter.
+ *
+ * The uniform and normal conversions use the exponent insert method
+ * for [1.0, 2.0) and Box-Muller with local polynomial log and sincos
+ * kernels, so no libm calls are needed.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+#include <pveclib/vec_int32_ppc.h>
+#include <pveclib/vec_f64_ppc.h>
+
+/* The PCG 128-bit LCG multiplier.  */
+#define __VEC_PCG_MUL_H 0x2360ed051fc65da4ULL
+#define __VEC_PCG_MUL_L 0x4385df649fccf645ULL
+
+/* Element order merge high/low doublewords ({a[0], b[0]} and
+ * {a[1], b[1]}) from the algebraic merges.  */
+static inline vui64_t
+__vec_rng_mrghd (vui64_t a, vui64_t b)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return vec_mrgald ((vui128_t) b, (vui128_t) a);
+#else
+  return vec_mrgahd ((vui128_t) a, (vui128_t) b);
+#endif
+}
+
+static inline vui64_t
+__vec_rng_mrgld (vui64_t a, vui64_t b)
+{
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  return vec_mrgahd ((vui128_t) b, (vui128_t) a);
+#else
+  return vec_mrgald ((vui128_t) a, (vui128_t) b);
+#endif
+}
+
+static inline vui128_t
+__vec_pcg_step (vui128_t s, vui128_t inc)
+{
+  const vui128_t mul = (vui128_t) CONST_VINT128_DW (__VEC_PCG_MUL_H,
+						    __VEC_PCG_MUL_L);
+
+  return vec_adduqm (vec_mulluq (s, mul), inc);
+}
+
+/* XSL-RR output of the states s0 and s1, as elements 0 and 1.  */
+static inline vui64_t
+__vec_pcg_out2 (vui128_t s0, vui128_t s1)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  vui64_t h, x;
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  h = vec_mrgahd (s1, s0);
+  x = vec_xor (h, vec_mrgald (s1, s0));
+#else
+  h = vec_mrgahd (s0, s1);
+  x = vec_xor (h, vec_mrgald (s0, s1));
+#endif
+  /* Rotate right by the high 6 bits of the state.  */
+  return vec_vrld (x, vec_subudm (zero, vec_srdi (h, 58)));
+}
+
+void
+__VEC_PWR_IMP (vec_pcg64_init) (vec_pcg64_t *g, vui128_t seed,
+				vui128_t seq)
+{
+  vui128_t inc;
+  int j;
+
+  /* As pcg_setseq_128_srandom_r with initseq (seq << 2) + j.  */
+  for (j = 0; j < VEC_PCG64_STREAMS; j++)
+    {
+      inc = vec_adduqm (vec_slqi (seq, 2),
+			(vui128_t) CONST_VINT128_DW (0, j));
+      inc = (vui128_t) vec_or ((vui64_t) vec_slqi (inc, 1),
+			       CONST_VINT128_DW (0, 1));
+      g->inc[j] = inc;
+      g->state[j] = __vec_pcg_step (vec_adduqm (inc, seed), inc);
+    }
+}
+
+void
+__VEC_PWR_IMP (vec_pcg64_fill_u64) (vec_pcg64_t *g, unsigned long long *out,
+				    unsigned long n)
+{
+  vui128_t s0 = g->state[0], s1 = g->state[1];
+  vui128_t s2 = g->state[2], s3 = g->state[3];
+  const vui128_t i0 = g->inc[0], i1 = g->inc[1];
+  const vui128_t i2 = g->inc[2], i3 = g->inc[3];
+  vui64_t o0, o1;
+  unsigned long i;
+
+  for (i = 0; i < n; i += VEC_PCG64_STREAMS)
+    {
+      s0 = __vec_pcg_step (s0, i0);
+      s1 = __vec_pcg_step (s1, i1);
+      s2 = __vec_pcg_step (s2, i2);
+      s3 = __vec_pcg_step (s3, i3);
+      o0 = __vec_pcg_out2 (s0, s1);
+      o1 = __vec_pcg_out2 (s2, s3);
+      if (i + VEC_PCG64_STREAMS <= n)
+	{
+	  memcpy (&out[i], &o0, sizeof (o0));
+	  memcpy (&out[i + 2], &o1, sizeof (o1));
+	}
+      else
+	{
+	  unsigned long long t[VEC_PCG64_STREAMS];
+
+	  memcpy (&t[0], &o0, sizeof (o0));
+	  memcpy (&t[2], &o1, sizeof (o1));
+	  memcpy (&out[i], t, (n - i) * sizeof (t[0]));
+	}
+    }
+  g->state[0] = s0;
+  g->state[1] = s1;
+  g->state[2] = s2;
+  g->state[3] = s3;
+}
+
+/* Philox4x32 multipliers and Weyl key increments.  */
+#define __VEC_PHILOX_M0 0xd2511f53U
+#define __VEC_PHILOX_M1 0xcd9e8d57U
+#define __VEC_PHILOX_W0 0x9e3779b9U
+#define __VEC_PHILOX_W1 0xbb67ae85U
+
+/* Return the low words and set *hi to the high words of the products
+ * of the word elements of a and b.  */
+static inline vui32_t
+__vec_philox_mul (vui32_t a, vui32_t b, vui32_t *hi)
+{
+  vui64_t pe = vec_muleuw (a, b);
+  vui64_t po = vec_mulouw (a, b);
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  *hi = vec_mrgahw (po, pe);
+  return vec_mrgalw (po, pe);
+#else
+  *hi = vec_mrgahw (pe, po);
+  return vec_mrgalw (pe, po);
+#endif
+}
+
+/* 10 rounds of Philox4x32 on 4 blocks, word j of each block in c[j].  */
+static inline void
+__vec_philox_10 (vui32_t c[4], unsigned int k0, unsigned int k1)
+{
+  const vui32_t m0 = vec_splats ((unsigned int) __VEC_PHILOX_M0);
+  const vui32_t m1 = vec_splats ((unsigned int) __VEC_PHILOX_M1);
+  vui32_t h0, h1, l0, l1;
+  int r;
+
+  for (r = 0; r < 10; r++)
+    {
+      l0 = __vec_philox_mul (c[0], m0, &h0);
+      l1 = __vec_philox_mul (c[2], m1, &h1);
+      c[0] = vec_xor (vec_xor (h1, c[1]), vec_splats (k0));
+      c[1] = l1;
+      c[2] = vec_xor (vec_xor (h0, c[3]), vec_splats (k1));
+      c[3] = l0;
+      k0 += __VEC_PHILOX_W0;
+      k1 += __VEC_PHILOX_W1;
+    }
+}
+
+/* Add the lane values d to the 128-bit counters held as word j of
+ * each counter in c[j], propagating the carry.  */
+static inline void
+__vec_philox_add (vui32_t c[4], vui32_t d)
+{
+  vui32_t cy, x;
+  int j;
+
+  x = vec_add (c[0], d);
+  cy = (vui32_t) vec_cmplt (x, c[0]);
+  c[0] = x;
+  for (j = 1; j < 4; j++)
+    {
+      /* cy is 0 or -1, so subtract to add the carry.  */
+      c[j] = vec_sub (c[j], cy);
+      cy = vec_and (cy, (vui32_t) vec_cmpeq (c[j], vec_splat_u32 (0)));
+    }
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_philox4x32_fill_u32) (unsigned int *out, unsigned long n,
+					 vui128_t ctr, unsigned long long key)
+{
+  const vui32_t lanes = (vui32_t) { 0, 1, 2, 3 };
+  const unsigned int k0 = (unsigned int) key;
+  const unsigned int k1 = (unsigned int) (key >> 32);
+  vui32_t b[4], c[4], r[4], t0, t1, t2, t3;
+  __VEC_U_128 x;
+  unsigned long i;
+
+  /* Lane l of c[j] is word j of the counter ctr + l.  */
+  x.vx1 = ctr;
+  c[0] = vec_splats ((unsigned int) x.ulong.lower);
+  c[1] = vec_splats ((unsigned int) (x.ulong.lower >> 32));
+  c[2] = vec_splats ((unsigned int) x.ulong.upper);
+  c[3] = vec_splats ((unsigned int) (x.ulong.upper >> 32));
+  __vec_philox_add (c, lanes);
+
+  for (i = 0; i < n; i += 16)
+    {
+      memcpy (r, c, sizeof (r));
+      __vec_philox_10 (r, k0, k1);
+
+      /* Transpose to the 4 words of each counter.  */
+      t0 = vec_mergeh (r[0], r[1]);
+      t1 = vec_mergeh (r[2], r[3]);
+      t2 = vec_mergel (r[0], r[1]);
+      t3 = vec_mergel (r[2], r[3]);
+      b[0] = (vui32_t) __vec_rng_mrghd ((vui64_t) t0, (vui64_t) t1);
+      b[1] = (vui32_t) __vec_rng_mrgld ((vui64_t) t0, (vui64_t) t1);
+      b[2] = (vui32_t) __vec_rng_mrghd ((vui64_t) t2, (vui64_t) t3);
+      b[3] = (vui32_t) __vec_rng_mrgld ((vui64_t) t2, (vui64_t) t3);
+      if (i + 16 <= n)
+	memcpy (&out[i], b, sizeof (b));
+      else
+	memcpy (&out[i], b, (n - i) * sizeof (unsigned int));
+      __vec_philox_add (c, vec_splats ((unsigned int) 4));
+    }
+  /* The counter after the last (possibly partial) block.  */
+  x.ulong.upper = 0;
+  x.ulong.lower = (n + 3) / 4;
+  return vec_adduqm (ctr, x.vx1);
+}
+
+/* Convert the high 52 bits of x to a double in [1.0, 2.0).  */
+static inline vf64_t
+__vec_rng_f12 (vui64_t x)
+{
+  const vui64_t one = vec_splats (0x3ff0000000000000ULL);
+
+  return (vf64_t) vec_or (vec_srdi (x, 12), one);
+}
+
+void
+__VEC_PWR_IMP (vec_rng_uniform_f64) (double *out,
+				     const unsigned long long *in,
+				     unsigned long n)
+{
+  const vf64_t one = vec_splats (1.0);
+  vui64_t x0, x1;
+  vf64_t d0, d1;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      memcpy (&x0, &in[i], sizeof (x0));
+      memcpy (&x1, &in[i + 2], sizeof (x1));
+      d0 = vec_sub (__vec_rng_f12 (x0), one);
+      d1 = vec_sub (__vec_rng_f12 (x1), one);
+      memcpy (&out[i], &d0, sizeof (d0));
+      memcpy (&out[i + 2], &d1, sizeof (d1));
+    }
+  for (; i < n; i++)
+    {
+      d0 = vec_sub (__vec_rng_f12 (vec_splats (in[i])), one);
+      out[i] = d0[0];
+    }
+}
+
+/* Natural log of u in (0.0, 1.0]. u = 2^e * m with m in
+ * [sqrt(0.5), sqrt(2)), log(m) = 2 * atanh ((m - 1) / (m + 1)) by
+ * the odd series to s^21, for |s| <= 0.1716.  */
+static inline vf64_t
+__vec_rng_log (vf64_t u)
+{
+  const vui64_t mant = vec_splats (0x000fffffffffffffULL);
+  const vui64_t bias = vec_splats (1023ULL);
+  const vui64_t expo = vec_splats (0x3ff0000000000000ULL);
+  const vui64_t magic = vec_splats (0x4338000000000000ULL);
+  const vf64_t fmagic = vec_splats (0x1.8p52);
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t half = vec_splats (0.5);
+  const vf64_t sqrt2 = vec_splats (0x1.6a09e667f3bcdp0);
+  const vf64_t ln2 = vec_splats (0x1.62e42fefa39efp-1);
+  vui64_t e;
+  vb64_t big;
+  vf64_t m, ef, s, z, p;
+
+  e = vec_subudm (vec_srdi ((vui64_t) u, 52), bias);
+  m = (vf64_t) vec_or (vec_and ((vui64_t) u, mant), expo);
+  big = vec_cmpgt (m, sqrt2);
+  m = vec_sel (m, vec_mul (m, half), big);
+  e = vec_subudm (e, (vui64_t) big);
+  /* Convert the small signed integer e to double.  */
+  ef = vec_sub ((vf64_t) vec_addudm (e, magic), fmagic);
+
+  s = vec_div (vec_sub (m, one), vec_add (m, one));
+  z = vec_mul (s, s);
+  p = vec_splats (2.0 / 21.0);
+  p = vec_madd (p, z, vec_splats (2.0 / 19.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 17.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 15.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 13.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 11.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 9.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 7.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 5.0));
+  p = vec_madd (p, z, vec_splats (2.0 / 3.0));
+  p = vec_madd (vec_mul (p, z), s, vec_add (s, s));
+  return vec_madd (ef, ln2, p);
+}
+
+/* Sine and cosine of 2 * pi * u for u in [0.0, 1.0). Reduce to
+ * quadrant q and x in [-pi/4, pi/4], then Taylor series to x^17 for
+ * sine and x^18 for cosine.  */
+static inline vf64_t
+__vec_rng_sincos2pi (vf64_t u, vf64_t *cosine)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  const vui64_t q1 = vec_splats (1ULL);
+  const vui64_t q2 = vec_splats (2ULL);
+  const vf64_t fmagic = vec_splats (0x1.8p52);
+  const vf64_t pio2 = vec_splats (0x1.921fb54442d18p0);
+  vui64_t q, swap, ss, cs;
+  vf64_t t, k, x, z, sp, cp, sn, cn;
+
+  t = vec_mul (u, vec_splats (4.0));
+  k = vec_add (t, fmagic);
+  q = (vui64_t) k;
+  x = vec_mul (vec_sub (t, vec_sub (k, fmagic)), pio2);
+  z = vec_mul (x, x);
+
+  sp = vec_splats (1.0 / 355687428096000.0);
+  sp = vec_madd (sp, z, vec_splats (-1.0 / 1307674368000.0));
+  sp = vec_madd (sp, z, vec_splats (1.0 / 6227020800.0));
+  sp = vec_madd (sp, z, vec_splats (-1.0 / 39916800.0));
+  sp = vec_madd (sp, z, vec_splats (1.0 / 362880.0));
+  sp = vec_madd (sp, z, vec_splats (-1.0 / 5040.0));
+  sp = vec_madd (sp, z, vec_splats (1.0 / 120.0));
+  sp = vec_madd (sp, z, vec_splats (-1.0 / 6.0));
+  sp = vec_madd (vec_mul (sp, z), x, x);
+
+  cp = vec_splats (-1.0 / 6402373705728000.0);
+  cp = vec_madd (cp, z, vec_splats (1.0 / 20922789888000.0));
+  cp = vec_madd (cp, z, vec_splats (-1.0 / 87178291200.0));
+  cp = vec_madd (cp, z, vec_splats (1.0 / 479001600.0));
+  cp = vec_madd (cp, z, vec_splats (-1.0 / 3628800.0));
+  cp = vec_madd (cp, z, vec_splats (1.0 / 40320.0));
+  cp = vec_madd (cp, z, vec_splats (-1.0 / 720.0));
+  cp = vec_madd (cp, z, vec_splats (1.0 / 24.0));
+  cp = vec_madd (cp, z, vec_splats (-0.5));
+  cp = vec_madd (cp, z, vec_splats (1.0));
+
+  /* Odd quadrants swap sine and cosine. Sine is negative in
+   * quadrants 2 and 3, cosine in quadrants 1 and 2.  */
+  swap = vec_subudm (zero, vec_and (q, q1));
+  sn = vec_sel (sp, cp, (vb64_t) swap);
+  cn = vec_sel (cp, sp, (vb64_t) swap);
+  ss = vec_sldi (vec_and (q, q2), 62);
+  cs = vec_sldi (vec_and (vec_addudm (q, q1), q2), 62);
+  *cosine = (vf64_t) vec_xor ((vui64_t) cn, cs);
+  return (vf64_t) vec_xor ((vui64_t) sn, ss);
+}
+
+/* Box-Muller of 2 pairs: u1 from x (high 52 bits, as (0.0, 1.0]) and
+ * u2 from y. Return r * cos and set *sine to r * sin.  */
+static inline vf64_t
+__vec_rng_boxmuller (vui64_t x, vui64_t y, vf64_t *sine)
+{
+  const vf64_t one = vec_splats (1.0);
+  const vf64_t two = vec_splats (2.0);
+  vf64_t r, s, c;
+
+  r = __vec_rng_log (vec_sub (two, __vec_rng_f12 (x)));
+  r = vec_sqrt (vec_mul (r, vec_splats (-2.0)));
+  s = __vec_rng_sincos2pi (vec_sub (__vec_rng_f12 (y), one), &c);
+  *sine = vec_mul (r, s);
+  return vec_mul (r, c);
+}
+
+void
+__VEC_PWR_IMP (vec_rng_normal_f64) (double *out,
+				    const unsigned long long *in,
+				    unsigned long n)
+{
+  vui64_t x0, x1;
+  vf64_t c, s, d0, d1;
+  unsigned long i;
+
+  /* Pair p is in[2p], in[2p + 1] and produces out[2p], out[2p + 1].  */
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      memcpy (&x0, &in[i], sizeof (x0));
+      memcpy (&x1, &in[i + 2], sizeof (x1));
+      c = __vec_rng_boxmuller (__vec_rng_mrghd (x0, x1),
+			       __vec_rng_mrgld (x0, x1), &s);
+      d0 = (vf64_t) __vec_rng_mrghd ((vui64_t) c, (vui64_t) s);
+      d1 = (vf64_t) __vec_rng_mrgld ((vui64_t) c, (vui64_t) s);
+      memcpy (&out[i], &d0, sizeof (d0));
+      memcpy (&out[i + 2], &d1, sizeof (d1));
+    }
+  for (; i < n; i += 2)
+    {
+      c = __vec_rng_boxmuller (vec_splats (in[i]), vec_splats (in[i + 1]),
+			       &s);
+      out[i] = c[0];
+      if (i + 1 < n)
+	out[i + 1] = s[0];
+    }
+}
@@ -48,61 +48,352 @@
  *
  * If __BUILTIN_CPU_SUPPORTS__ is not defined we default to the
  * appropriate (for the platform endian) base platform.
+ *
+ * The environment variable PVECLIB_CPU (power7, power8, power9 or
+ * power10) overrides the selection, within the targets this build
+ * provides and the ISA level the hardware supports. It is read once,
+ * by a constructor, when libpvec is loaded. So the override applies
+ * to entry points bound lazily (at their first call) but not to
+ * entry points bound during relocation (BIND_NOW). The constructor
+ * counts the entry points it was too late for and reports them on
+ * stderr and through vec_runtime_override_missed().
+ * Each resolver records the target it selected, and
+ * vec_runtime_target() reports it.
  */
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <stdio.h>
+#include <stdlib.h>
+
 #include <pveclib/vec_int512_ppc.h>
 #include <pveclib/vec_int128_ppc.h>
 #include <pveclib/vec_int64_ppc.h>
 #include <pveclib/vec_f128_ppc.h>
-#if 1
-/*! \brief Macro to expand the parameterize resolver.
- * \sa \ref main_libary_issues_0_0_2
- * \sa \ref main_libary_issues_0_0 */
+#include <pveclib/vec_f64_ppc.h>
+#include <pveclib/vec_f32_ppc.h>
+#include <pveclib/vec_runtime_ppc.h>
+
+/*! \brief Target indexes for the -mcpu= qualified implementations. */
+#define VEC_DYN_PWR7  0
+#define VEC_DYN_PWR8  1
+#define VEC_DYN_PWR9  2
+#define VEC_DYN_PWR10 3
+
+static const char *__vec_dyn_names[] =
+  { "power7", "power8", "power9", "power10" };
+
+/*! \brief Return the highest target this build provides and the
+ * hardware runs, using the same __builtin_cpu_is() tests the
+ * resolvers always used. */
+static int
+__vec_dyn_hw_target (void)
+{
 #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
 #ifdef __BUILTIN_CPU_SUPPORTS__
-#ifdef PVECLIB_DISABLE_POWER9
-#define VEC_DYN_RESOLVER(FNAME) \
-  if (__builtin_cpu_is ("power8")) \
-    return FNAME ## _PWR8; \
-  else \
-    return FNAME ## _PWR7;
-#else
-#define VEC_DYN_RESOLVER(FNAME) \
-  if (__builtin_cpu_is ("power9")) \
-    return FNAME ## _PWR9; \
-  else if (__builtin_cpu_is ("power8")) \
-    return FNAME ## _PWR8; \
-  else \
-    return FNAME ## _PWR7;
+#ifndef PVECLIB_DISABLE_POWER9
+  if (__builtin_cpu_is ("power9"))
+    return VEC_DYN_PWR9;
 #endif
-#else
-#define VEC_DYN_RESOLVER(__FNAME) \
-   return __FNAME ## _PWR7;
+  if (__builtin_cpu_is ("power8"))
+    return VEC_DYN_PWR8;
 #endif
+  return VEC_DYN_PWR7;
 #else // __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
-#ifdef  __BUILTIN_CPU_SUPPORTS__
+#ifdef __BUILTIN_CPU_SUPPORTS__
+#ifndef PVECLIB_DISABLE_POWER10
+  if (__builtin_cpu_is ("power10"))
+    return VEC_DYN_PWR10;
+#endif
+  if (__builtin_cpu_is ("power9"))
+    return VEC_DYN_PWR9;
+#endif
+  return VEC_DYN_PWR8;
+#endif
+}
+
+/*! \brief Return nonzero if this build provides target and the
+ * hardware implements its ISA level.  This is the limit for the
+ * PVECLIB_CPU override, so a forced target can not SIGILL.  */
+static int
+__vec_dyn_target_ok (int target)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  if (target == VEC_DYN_PWR10)
+    return 0;
+#ifdef PVECLIB_DISABLE_POWER9
+  if (target == VEC_DYN_PWR9)
+    return 0;
+#endif
+#else
+  if (target == VEC_DYN_PWR7)
+    return 0;
 #ifdef PVECLIB_DISABLE_POWER10
-#define VEC_DYN_RESOLVER(FNAME) \
-  if (__builtin_cpu_is ("power9")) \
-    return FNAME ## _PWR9; \
-  else \
-    return FNAME ## _PWR8;
+  if (target == VEC_DYN_PWR10)
+    return 0;
+#endif
+#endif
+#ifdef __BUILTIN_CPU_SUPPORTS__
+  switch (target)
+    {
+    case VEC_DYN_PWR10:
+      return __builtin_cpu_supports ("arch_3_1");
+    case VEC_DYN_PWR9:
+      return __builtin_cpu_supports ("arch_3_00");
+    case VEC_DYN_PWR8:
+      return __builtin_cpu_supports ("arch_2_07");
+    default:
+      return 1;
+    }
 #else
-#define VEC_DYN_RESOLVER(FNAME) \
-  if (__builtin_cpu_is ("power10")) \
-    return FNAME ## _PWR10; \
-  else if (__builtin_cpu_is ("power9")) \
-    return FNAME ## _PWR9; \
-  else \
-    return FNAME ## _PWR8;
+  return (target <= __vec_dyn_hw_target ());
 #endif
+}
+
+/*! \brief Parse a PVECLIB_CPU value ("power8", "pwr8", "POWER8", ...).
+ * Returns the target index or -1.  */
+static int
+__vec_dyn_parse_cpu (const char *cpu)
+{
+  const char *p = cpu;
+  int n = 0;
+
+  if ((p[0] | 0x20) == 'p' && (p[1] | 0x20) == 'o' && (p[2] | 0x20) == 'w'
+      && (p[3] | 0x20) == 'e' && (p[4] | 0x20) == 'r')
+    p += 5;
+  else if ((p[0] | 0x20) == 'p' && (p[1] | 0x20) == 'w'
+	   && (p[2] | 0x20) == 'r')
+    p += 3;
+  else
+    return -1;
+
+  if (*p < '0' || *p > '9')
+    return -1;
+  while (*p >= '0' && *p <= '9')
+    n = n * 10 + (*p++ - '0');
+  if (*p != '\0' || n < 7 || n > 10)
+    return -1;
+
+  return n - 7;
+}
+
+/*! \brief Upper bound on recorded resolutions, larger than the
+ * number of IFUNC entry points.  */
+#define VEC_DYN_MAX_RECORDS 256
+
+/*! \brief Resolution records. A resolver reserves a slot with an
+ * atomic increment of __vec_dyn_nrecords, fills in the target and
+ * then publishes fname with release order. Readers load fname with
+ * acquire order and skip slots not yet published.  */
+static struct
+{
+  const char *fname;
+  int target;
+} __vec_dyn_records[VEC_DYN_MAX_RECORDS];
+static unsigned int __vec_dyn_nrecords;
+
+/*! \brief Target forced by PVECLIB_CPU, or -1 if none.  */
+static int __vec_dyn_forced = -1;
+
+/*! \brief Number of entry points bound, before __vec_dyn_init ran,
+ * to a target other than the forced one.  */
+static unsigned int __vec_dyn_missed;
+
+/*! \brief Return the number of reserved record slots.  */
+static unsigned int
+__vec_dyn_nslots (void)
+{
+  unsigned int n = __atomic_load_n (&__vec_dyn_nrecords, __ATOMIC_ACQUIRE);
+
+  return (n < VEC_DYN_MAX_RECORDS) ? n : VEC_DYN_MAX_RECORDS;
+}
+
+/*! \brief Read the PVECLIB_CPU environment variable.
+ *
+ * Accept a target this build provides and the hardware can execute.
+ * So PVECLIB_CPU can always force an older target (for A/B testing)
+ * but can not force a newer one than the ISA level of the machine
+ * (or compatibility mode) supports.
+ *
+ * This runs as a constructor rather than from the resolvers. With
+ * BIND_NOW (-z now or LD_BIND_NOW) the resolvers run during
+ * relocation, before libc has initialized the environment, so they
+ * must not depend on getenv.  */
+static void __attribute__ ((constructor))
+__vec_dyn_init (void)
+{
+  const char *cpu = secure_getenv ("PVECLIB_CPU");
+  unsigned int i, n;
+
+  if (cpu != NULL)
+    {
+      int forced = __vec_dyn_parse_cpu (cpu);
+      if (forced >= 0 && __vec_dyn_target_ok (forced))
+	{
+	  /* Entry points already bound (BIND_NOW) keep their target.
+	   * Count those that differ, so the override is not silently
+	   * ignored.  */
+	  n = __vec_dyn_nslots ();
+	  for (i = 0; i < n; i++)
+	    {
+	      if (__atomic_load_n (&__vec_dyn_records[i].fname,
+				   __ATOMIC_ACQUIRE) != NULL
+		  && __vec_dyn_records[i].target != forced)
+		__vec_dyn_missed++;
+	    }
+	  __atomic_store_n (&__vec_dyn_forced, forced, __ATOMIC_RELEASE);
+	  if (__vec_dyn_missed != 0)
+	    fprintf (stderr, "libpvec: PVECLIB_CPU=%s not applied to %u "
+		     "entry points bound at load time (BIND_NOW)\n", cpu,
+		     __vec_dyn_missed);
+	}
+    }
+}
+
+/*! \brief Select the target for the resolvers.
+ *
+ * Use the PVECLIB_CPU target if __vec_dyn_init accepted one, else
+ * the hardware target.
+ *
+ * \note IFUNC resolvers run when the dynamic loader binds the symbol.
+ * With the default lazy binding that is at the first call, after the
+ * libpvec constructor has run. Entry points bound before that (all
+ * of them with BIND_NOW, or any called from an earlier constructor)
+ * use the hardware target. vec_runtime_target(fname) reports the
+ * actual binding.  */
+static int
+__vec_dyn_target (void)
+{
+  int forced = __atomic_load_n (&__vec_dyn_forced, __ATOMIC_ACQUIRE);
+
+  if (forced >= 0)
+    return forced;
+  return __vec_dyn_hw_target ();
+}
+
+static int
+__vec_dyn_streq (const char *a, const char *b)
+{
+  while (*a != '\0' && *a == *b)
+    {
+      a++;
+      b++;
+    }
+  return (*a == *b);
+}
+
+/*! \brief Return the record slot published for fname, or -1.  */
+static int
+__vec_dyn_find (const char *fname)
+{
+  unsigned int i, n = __vec_dyn_nslots ();
+
+  for (i = 0; i < n; i++)
+    {
+      const char *r = __atomic_load_n (&__vec_dyn_records[i].fname,
+				       __ATOMIC_ACQUIRE);
+      if (r != NULL && __vec_dyn_streq (r, fname))
+	return i;
+    }
+  return -1;
+}
+
+/*! \brief Select and record the target for entry point fname.
+ *
+ * With lazy binding the resolvers run from the first call of each
+ * entry point, with no loader lock held, so threads may record
+ * concurrently. Two threads making the first call of the same entry
+ * point may each record it, with the same target.  */
+static int
+__vec_dyn_resolve (const char *fname)
+{
+  int target = __vec_dyn_target ();
+  unsigned int i;
+
+  if (__vec_dyn_find (fname) >= 0)
+    return target;
+  i = __atomic_fetch_add (&__vec_dyn_nrecords, 1, __ATOMIC_ACQ_REL);
+  if (i < VEC_DYN_MAX_RECORDS)
+    {
+      __vec_dyn_records[i].target = target;
+      __atomic_store_n (&__vec_dyn_records[i].fname, fname,
+			__ATOMIC_RELEASE);
+    }
+  return target;
+}
+
+const char *
+vec_runtime_target (const char *fname)
+{
+  int i;
+
+  if (fname == NULL)
+    return __vec_dyn_names[__vec_dyn_target ()];
+
+  i = __vec_dyn_find (fname);
+  if (i < 0)
+    return NULL;
+  return __vec_dyn_names[__vec_dyn_records[i].target];
+}
+
+unsigned int
+vec_runtime_resolved_count (void)
+{
+  return __vec_dyn_nslots ();
+}
+
+const char *
+vec_runtime_resolved_name (unsigned int index)
+{
+  if (index >= __vec_dyn_nslots ())
+    return NULL;
+  return __atomic_load_n (&__vec_dyn_records[index].fname,
+			  __ATOMIC_ACQUIRE);
+}
+
+unsigned int
+vec_runtime_override_missed (void)
+{
+  return __vec_dyn_missed;
+}
+
+/*! \brief Case labels for the targets this build provides. */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define VEC_DYN_CASE_PWR10(FNAME)
+#define VEC_DYN_CASE_PWR8(FNAME) \
+    case VEC_DYN_PWR8: return FNAME ## _PWR8;
+#define VEC_DYN_DEFAULT(FNAME) \
+    default: return FNAME ## _PWR7;
 #else
-#define VEC_DYN_RESOLVER(FNAME) \
-   return FNAME ## _PWR8;
+#ifndef PVECLIB_DISABLE_POWER10
+#define VEC_DYN_CASE_PWR10(FNAME) \
+    case VEC_DYN_PWR10: return FNAME ## _PWR10;
+#else
+#define VEC_DYN_CASE_PWR10(FNAME)
 #endif
+#define VEC_DYN_CASE_PWR8(FNAME)
+#define VEC_DYN_DEFAULT(FNAME) \
+    default: return FNAME ## _PWR8;
 #endif
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__ && defined (PVECLIB_DISABLE_POWER9)
+#define VEC_DYN_CASE_PWR9(FNAME)
+#else
+#define VEC_DYN_CASE_PWR9(FNAME) \
+    case VEC_DYN_PWR9: return FNAME ## _PWR9;
 #endif
 
+/*! \brief Macro to expand the parameterize resolver.
+ * \sa \ref main_libary_issues_0_0_2
+ * \sa \ref main_libary_issues_0_0 */
+#define VEC_DYN_RESOLVER(FNAME) \
+  switch (__vec_dyn_resolve (#FNAME)) \
+    { \
+    VEC_DYN_CASE_PWR10 (FNAME) \
+    VEC_DYN_CASE_PWR9 (FNAME) \
+    VEC_DYN_CASE_PWR8 (FNAME) \
+    VEC_DYN_DEFAULT (FNAME) \
+    }
 
 /*! \brief Macros paste resolver_ prefix on function names. */
 #define RESPASTE(_XF) resolve_ ## _XF
@@ -141,6 +432,51 @@ static _VT \
 _VT _FUNC (_VA, _VB, _VC) \
 __attribute__ ((ifunc ("resolve_" #_FUNC )));
 
+#define VEC_RESOLVER_4(_VT,_FUNC,_VA,_VB,_VC,_VD) \
+static _VT \
+(* RESPASTE(_FUNC) (void))(_VA, _VB, _VC, _VD) \
+{ \
+  VEC_DYN_RESOLVER(_FUNC); \
+} \
+_VT _FUNC (_VA, _VB, _VC, _VD) \
+__attribute__ ((ifunc ("resolve_" #_FUNC )));
+
+#define VEC_RESOLVER_5(_VT,_FUNC,_VA,_VB,_VC,_VD,_VE) \
+static _VT \
+(* RESPASTE(_FUNC) (void))(_VA, _VB, _VC, _VD, _VE) \
+{ \
+  VEC_DYN_RESOLVER(_FUNC); \
+} \
+_VT _FUNC (_VA, _VB, _VC, _VD, _VE) \
+__attribute__ ((ifunc ("resolve_" #_FUNC )));
+
+#define VEC_RESOLVER_6(_VT,_FUNC,_VA,_VB,_VC,_VD,_VE,_VF) \
+static _VT \
+(* RESPASTE(_FUNC) (void))(_VA, _VB, _VC, _VD, _VE, _VF) \
+{ \
+  VEC_DYN_RESOLVER(_FUNC); \
+} \
+_VT _FUNC (_VA, _VB, _VC, _VD, _VE, _VF) \
+__attribute__ ((ifunc ("resolve_" #_FUNC )));
+
+#define VEC_RESOLVER_7(_VT,_FUNC,_VA,_VB,_VC,_VD,_VE,_VF,_VG) \
+static _VT \
+(* RESPASTE(_FUNC) (void))(_VA, _VB, _VC, _VD, _VE, _VF, _VG) \
+{ \
+  VEC_DYN_RESOLVER(_FUNC); \
+} \
+_VT _FUNC (_VA, _VB, _VC, _VD, _VE, _VF, _VG) \
+__attribute__ ((ifunc ("resolve_" #_FUNC )));
+
+#define VEC_RESOLVER_8(_VT,_FUNC,_VA,_VB,_VC,_VD,_VE,_VF,_VG,_VH) \
+static _VT \
+(* RESPASTE(_FUNC) (void))(_VA, _VB, _VC, _VD, _VE, _VF, _VG, _VH) \
+{ \
+  VEC_DYN_RESOLVER(_FUNC); \
+} \
+_VT _FUNC (_VA, _VB, _VC, _VD, _VE, _VF, _VG, _VH) \
+__attribute__ ((ifunc ("resolve_" #_FUNC )));
+
 /*! \brief Macros listing externs for CPU specific runtime library
  * functions.
  * These will be expanded multiple time, once for each supported
@@ -151,7 +487,157 @@ extern vui64_t vec_moddud ## _TARGET (vui64_t, vui64_t, vui64_t); \
 extern vui64_t vec_divqud ## _TARGET (vui128_t, vui64_t); \
 extern vui64_t vec_diveud ## _TARGET (vui64_t, vui64_t); \
 extern vui64_t vec_divud ## _TARGET (vui64_t, vui64_t); \
-extern vui64_t vec_modud ## _TARGET (vui64_t, vui64_t);
+extern vui64_t vec_modud ## _TARGET (vui64_t, vui64_t); \
+extern void vec_merge_s64 ## _TARGET (long long *, const long long *, \
+	unsigned long, const long long *, unsigned long); \
+extern void vec_merge_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, \
+	const unsigned long long *, unsigned long); \
+extern void vec_sort_s64 ## _TARGET (long long *, unsigned long); \
+extern void vec_sort_s64_kv ## _TARGET (long long *, unsigned long long *, \
+	unsigned long); \
+extern void vec_sort_u64 ## _TARGET (unsigned long long *, unsigned long); \
+extern void vec_sort_u64_kv ## _TARGET (unsigned long long *, \
+	unsigned long long *, unsigned long); \
+extern unsigned long vec_difference_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, const unsigned int *, \
+	unsigned long); \
+extern unsigned long vec_difference_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, \
+	const unsigned long long *, unsigned long); \
+extern unsigned long vec_intersect_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, const unsigned int *, \
+	unsigned long); \
+extern unsigned long vec_intersect_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, \
+	const unsigned long long *, unsigned long); \
+extern unsigned long vec_union_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, const unsigned int *, \
+	unsigned long); \
+extern unsigned long vec_union_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, \
+	const unsigned long long *, unsigned long); \
+extern void vec_htab_free ## _TARGET (vec_htab_t *); \
+extern long vec_htab_erase_u64 ## _TARGET (vec_htab_t *, unsigned long long); \
+extern long vec_htab_find_u64 ## _TARGET (const vec_htab_t *, \
+	unsigned long long); \
+extern void vec_htab_find_batch_u64 ## _TARGET (const vec_htab_t *, long *, \
+	const unsigned long long *, unsigned long); \
+extern int vec_htab_init_u64 ## _TARGET (vec_htab_t *, unsigned long); \
+extern long vec_htab_insert_u64 ## _TARGET (vec_htab_t *, unsigned long long); \
+extern unsigned long long vec_hash64 ## _TARGET (const void *, unsigned long, \
+	unsigned long long); \
+extern void vec_hash64_batch_u32 ## _TARGET (unsigned long long *, \
+	const unsigned int *, unsigned long, unsigned long long); \
+extern void vec_hash64_batch_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long); \
+extern unsigned long vec_bitpack_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int); \
+extern void vec_bitunpack_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int); \
+extern unsigned long vec_bitpack_for_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int, unsigned int); \
+extern void vec_bitunpack_for_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int, unsigned int); \
+extern unsigned long vec_bitpack_delta_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int, unsigned int); \
+extern void vec_bitunpack_delta_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int, unsigned int); \
+extern unsigned long vec_bitpack_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned int); \
+extern void vec_bitunpack_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned int); \
+extern unsigned long vec_bitpack_for_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long, \
+	unsigned int); \
+extern void vec_bitunpack_for_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long, \
+	unsigned int); \
+extern unsigned long vec_bitpack_delta_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long, \
+	unsigned int); \
+extern void vec_bitunpack_delta_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long, \
+	unsigned int); \
+extern unsigned long vec_svb_encode_u32 ## _TARGET (unsigned char *, \
+	const unsigned int *, unsigned long); \
+extern unsigned long vec_svb_decode_u32 ## _TARGET (unsigned int *, \
+	const unsigned char *, unsigned long); \
+extern unsigned long vec_leb128_encode_u32 ## _TARGET (unsigned char *, \
+	const unsigned int *, unsigned long); \
+extern long vec_leb128_decode_u32 ## _TARGET (unsigned int *, \
+	const unsigned char *, unsigned long, unsigned long); \
+extern unsigned long vec_leb128_encode_u64 ## _TARGET (unsigned char *, \
+	const unsigned long long *, unsigned long); \
+extern long vec_leb128_decode_u64 ## _TARGET (unsigned long long *, \
+	const unsigned char *, unsigned long, unsigned long); \
+extern unsigned long long vec_bitmap_and_count ## _TARGET (unsigned long long *, \
+	const unsigned long long *, const unsigned long long *, \
+	unsigned long); \
+extern unsigned long vec_bitmap_and_array_u16 ## _TARGET (unsigned short *, \
+	const unsigned short *, unsigned long, const unsigned long long *); \
+extern unsigned long long vec_bitmap_andnot_count ## _TARGET (unsigned long long *, \
+	const unsigned long long *, const unsigned long long *, \
+	unsigned long); \
+extern unsigned long long vec_bitmap_count ## _TARGET (const unsigned long long *, \
+	unsigned long); \
+extern long vec_bitmap_next_set ## _TARGET (const unsigned long long *, \
+	unsigned long, unsigned long); \
+extern unsigned long long vec_bitmap_or_count ## _TARGET (unsigned long long *, \
+	const unsigned long long *, const unsigned long long *, \
+	unsigned long); \
+extern unsigned long long vec_bitmap_rank ## _TARGET (const unsigned long long *, \
+	unsigned long); \
+extern long vec_bitmap_select ## _TARGET (const unsigned long long *, \
+	unsigned long, unsigned long long); \
+extern void vec_bitmap_set_array_u16 ## _TARGET (unsigned long long *, \
+	const unsigned short *, unsigned long); \
+extern unsigned long vec_bitmap_to_array_u16 ## _TARGET (unsigned short *, \
+	const unsigned long long *, unsigned long); \
+extern unsigned long long vec_bitmap_xor_count ## _TARGET (unsigned long long *, \
+	const unsigned long long *, const unsigned long long *, \
+	unsigned long); \
+extern unsigned int vec_prefix_sum_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int); \
+extern unsigned int vec_prefix_sum_excl_u32 ## _TARGET (unsigned int *, \
+	const unsigned int *, unsigned long, unsigned int); \
+extern unsigned long long vec_prefix_sum_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long); \
+extern unsigned long long vec_prefix_sum_excl_u64 ## _TARGET (unsigned long long *, \
+	const unsigned long long *, unsigned long, unsigned long long); \
+extern void vec_q15_biquad ## _TARGET (short *, const short *, unsigned long, \
+	const short *, short *, unsigned long, int, int); \
+extern void vec_q15_cmul ## _TARGET (short *, const short *, const short *, \
+	unsigned long, int); \
+extern short vec_q15_dot ## _TARGET (const short *, const short *, \
+	unsigned long, int); \
+extern void vec_q15_fir ## _TARGET (short *, const short *, unsigned long, \
+	const short *, unsigned long, int); \
+extern void vec_q31_cmul ## _TARGET (int *, const int *, const int *, \
+	unsigned long, int); \
+extern int vec_q31_dot ## _TARGET (const int *, const int *, unsigned long, \
+	int); \
+extern void vec_q31_fir ## _TARGET (int *, const int *, unsigned long, \
+	const int *, unsigned long, int); \
+extern int vec_dot_s16 ## _TARGET (const short *, const short *, \
+	unsigned long); \
+extern long long vec_dot_s16_s64 ## _TARGET (const short *, const short *, \
+	unsigned long); \
+extern int vec_dot_s8 ## _TARGET (const signed char *, const signed char *, \
+	unsigned long); \
+extern void vec_gemm_pack_a_s16 ## _TARGET (short *, const short *, \
+	unsigned long, unsigned long, unsigned long); \
+extern void vec_gemm_pack_a_s8 ## _TARGET (signed char *, \
+	const signed char *, unsigned long, unsigned long, unsigned long); \
+extern void vec_gemm_pack_b_s16 ## _TARGET (short *, const short *, \
+	unsigned long, unsigned long, unsigned long); \
+extern void vec_gemm_pack_b_s8 ## _TARGET (unsigned char *, \
+	const signed char *, unsigned long, unsigned long, unsigned long); \
+extern void vec_gemm_s16 ## _TARGET (int *, unsigned long, const short *, \
+	const short *, unsigned long, unsigned long, unsigned long, int); \
+extern void vec_gemm_s8 ## _TARGET (int *, unsigned long, \
+	const signed char *, const unsigned char *, unsigned long, \
+	unsigned long, unsigned long, int);
 
 #define VEC_INT128_LIB_LIST(_TARGET) \
 extern __VEC_U_128RQ vec_divdqu ## _TARGET (vui128_t, vui128_t, vui128_t); \
@@ -159,7 +645,38 @@ extern vui128_t vec_divduq ## _TARGET (vui128_t, vui128_t, vui128_t); \
 extern vui128_t vec_modduq ## _TARGET (vui128_t, vui128_t, vui128_t); \
 extern vui128_t vec_diveuq ## _TARGET (vui128_t, vui128_t); \
 extern vui128_t vec_divuq ## _TARGET (vui128_t, vui128_t); \
-extern vui128_t vec_moduq ## _TARGET (vui128_t, vui128_t);
+extern vui128_t vec_moduq ## _TARGET (vui128_t, vui128_t); \
+extern void vec_sort_s128 ## _TARGET (vi128_t *, unsigned long); \
+extern void vec_sort_u128 ## _TARGET (vui128_t *, unsigned long); \
+extern unsigned long vec_lower_bound_s128 ## _TARGET (const vi128_t *, \
+	unsigned long, vi128_t); \
+extern unsigned long vec_lower_bound_u128 ## _TARGET (const vui128_t *, \
+	unsigned long, vui128_t); \
+extern unsigned long vec_upper_bound_s128 ## _TARGET (const vi128_t *, \
+	unsigned long, vi128_t); \
+extern unsigned long vec_upper_bound_u128 ## _TARGET (const vui128_t *, \
+	unsigned long, vui128_t); \
+extern long vec_htab_erase_u128 ## _TARGET (vec_htab_t *, vui128_t); \
+extern long vec_htab_find_u128 ## _TARGET (const vec_htab_t *, vui128_t); \
+extern void vec_htab_find_batch_u128 ## _TARGET (const vec_htab_t *, long *, \
+	const vui128_t *, unsigned long); \
+extern int vec_htab_init_u128 ## _TARGET (vec_htab_t *, unsigned long); \
+extern long vec_htab_insert_u128 ## _TARGET (vec_htab_t *, vui128_t); \
+extern vui128_t vec_hash128 ## _TARGET (const void *, unsigned long, \
+	unsigned long long); \
+extern void vec_hash64_batch_u128 ## _TARGET (unsigned long long *, \
+	const vui128_t *, unsigned long, unsigned long long); \
+extern vui128_t vec_prefix_sum_u128 ## _TARGET (vui128_t *, const vui128_t *, \
+	unsigned long, vui128_t); \
+extern vui128_t vec_prefix_sum_u64_u128 ## _TARGET (vui128_t *, \
+	const unsigned long long *, unsigned long, vui128_t); \
+extern vui128_t vec_sum_u128 ## _TARGET (vui128_t *, const vui128_t *, \
+	unsigned long); \
+extern void vec_pcg64_init ## _TARGET (vec_pcg64_t *, vui128_t, vui128_t); \
+extern void vec_pcg64_fill_u64 ## _TARGET (vec_pcg64_t *, \
+	unsigned long long *, unsigned long); \
+extern vui128_t vec_philox4x32_fill_u32 ## _TARGET (unsigned int *, \
+	unsigned long, vui128_t, unsigned long long);
 
 #define VEC_F128_LIB_LIST(_TARGET) \
 extern __binary128 vec_xsaddqpo ## _TARGET (__binary128, __binary128); \
@@ -168,6 +685,14 @@ extern __binary128 vec_xsdivqpo ## _TARGET (__binary128, __binary128); \
 extern __binary128 vec_xsmulqpo ## _TARGET (__binary128, __binary128); \
 extern __binary128 vec_xsmaddqpo ## _TARGET (__binary128, __binary128, __binary128); \
 extern __binary128 vec_xsmsubqpo ## _TARGET (__binary128, __binary128, __binary128); \
+extern __binary128 vec_xsaddqp_rm ## _TARGET (__binary128, __binary128, int); \
+extern __binary128 vec_xssubqp_rm ## _TARGET (__binary128, __binary128, int); \
+extern __binary128 vec_xsdivqp_rm ## _TARGET (__binary128, __binary128, int); \
+extern __binary128 vec_xsmulqp_rm ## _TARGET (__binary128, __binary128, int); \
+extern __binary128 vec_xsmaddqp_rm ## _TARGET (__binary128, __binary128, \
+	__binary128, int); \
+extern __binary128 vec_xsmsubqp_rm ## _TARGET (__binary128, __binary128, \
+	__binary128, int); \
 extern __binary128 vec_xscvdpqp ## _TARGET (vf64_t); \
 extern vf64_t vec_xscvqpdpo ## _TARGET (__binary128); \
 extern vui64_t vec_xscvqpudz ## _TARGET (__binary128); \
@@ -177,6 +702,111 @@ extern __binary128 vec_xscvsqqp ## _TARGET (vi128_t); \
 extern __binary128 vec_xscvudqp ## _TARGET (vui64_t); \
 extern __binary128 vec_xscvuqqp ## _TARGET (vui128_t);
 
+#define VEC_F64_LIB_LIST(_TARGET) \
+extern void vec_rng_uniform_f64 ## _TARGET (double *, \
+	const unsigned long long *, unsigned long); \
+extern void vec_rng_normal_f64 ## _TARGET (double *, \
+	const unsigned long long *, unsigned long); \
+extern void vec_exp_f64_u10 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_exp_f64_u35 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_log_f64_u10 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_log_f64_u35 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_pow_f64_u10 ## _TARGET (double *, const double *, \
+	const double *, unsigned long); \
+extern void vec_pow_f64_u35 ## _TARGET (double *, const double *, \
+	const double *, unsigned long); \
+extern void vec_sin_f64_u10 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_sin_f64_u35 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_cos_f64_u10 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_cos_f64_u35 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_tanh_f64_u10 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_tanh_f64_u35 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_sigmoid_f64_u10 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_sigmoid_f64_u35 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_frexp_f64 ## _TARGET (double *, int *, const double *, \
+	unsigned long); \
+extern void vec_ldexp_f64 ## _TARGET (double *, const double *, const int *, \
+	unsigned long); \
+extern void vec_scalbn_f64 ## _TARGET (double *, const double *, int, \
+	unsigned long); \
+extern void vec_ilogb_f64 ## _TARGET (int *, const double *, unsigned long); \
+extern void vec_logb_f64 ## _TARGET (double *, const double *, \
+	unsigned long); \
+extern void vec_nextafter_f64 ## _TARGET (double *, const double *, \
+	const double *, unsigned long);
+
+#define VEC_F32_LIB_LIST(_TARGET) \
+extern void vec_exp_f32_u10 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_exp_f32_u35 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_log_f32_u10 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_log_f32_u35 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_pow_f32_u10 ## _TARGET (float *, const float *, \
+	const float *, unsigned long); \
+extern void vec_pow_f32_u35 ## _TARGET (float *, const float *, \
+	const float *, unsigned long); \
+extern void vec_sin_f32_u10 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_sin_f32_u35 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_cos_f32_u10 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_cos_f32_u35 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_tanh_f32_u10 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_tanh_f32_u35 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_sigmoid_f32_u10 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_sigmoid_f32_u35 ## _TARGET (float *, const float *, \
+	unsigned long); \
+extern void vec_frexp_f32 ## _TARGET (float *, int *, const float *, \
+	unsigned long); \
+extern void vec_ldexp_f32 ## _TARGET (float *, const float *, const int *, \
+	unsigned long); \
+extern void vec_scalbn_f32 ## _TARGET (float *, const float *, int, \
+	unsigned long); \
+extern void vec_ilogb_f32 ## _TARGET (int *, const float *, unsigned long); \
+extern void vec_logb_f32 ## _TARGET (float *, const float *, unsigned long); \
+extern void vec_nextafter_f32 ## _TARGET (float *, const float *, \
+	const float *, unsigned long);
+
+#if defined (__LONG_DOUBLE_128__) && !defined (__LONG_DOUBLE_IEEE128__)
+#define VEC_LDBL_LIB_LIST(_TARGET) \
+extern void vec_add_ldbl ## _TARGET (long double *, const long double *, \
+	const long double *, unsigned long); \
+extern void vec_sub_ldbl ## _TARGET (long double *, const long double *, \
+	const long double *, unsigned long); \
+extern void vec_mul_ldbl ## _TARGET (long double *, const long double *, \
+	const long double *, unsigned long); \
+extern void vec_div_ldbl ## _TARGET (long double *, const long double *, \
+	const long double *, unsigned long); \
+extern void vec_sqrt_ldbl ## _TARGET (long double *, const long double *, \
+	unsigned long); \
+extern void vec_madd_ldbl ## _TARGET (long double *, const long double *, \
+	const long double *, const long double *, unsigned long); \
+extern long double vec_dot_ldbl ## _TARGET (const long double *, \
+	const long double *, unsigned long);
+#else
+#define VEC_LDBL_LIB_LIST(_TARGET)
+#endif
+
 #define VEC_INT512_LIB_LIST(_TARGET) \
 extern __VEC_U_256 vec_mul128x128 ## _TARGET (vui128_t, vui128_t); \
 extern __VEC_U_512 vec_mul256x256 ## _TARGET (__VEC_U_256, __VEC_U_256); \
@@ -189,6 +819,9 @@ extern void vec_mul128_byMN ## _TARGET (vui128_t *p, \
 		  vui128_t *m1, vui128_t *m2, \
 		  unsigned long M, unsigned long N); \
 extern void vec_mul512_byMN ## _TARGET (__VEC_U_512 *p, \
+                  __VEC_U_512 *m1, __VEC_U_512 *m2, \
+		  unsigned long M, unsigned long N); \
+extern void vec_mul512_byMN_parallel ## _TARGET (__VEC_U_512 *p, \
                   __VEC_U_512 *m1, __VEC_U_512 *m2, \
 		  unsigned long M, unsigned long N);
 
@@ -201,6 +834,12 @@ VEC_INT128_LIB_LIST (_PWR7)
 VEC_INT512_LIB_LIST (_PWR7)
 
 VEC_F128_LIB_LIST (_PWR7)
+
+VEC_F64_LIB_LIST (_PWR7)
+
+VEC_F32_LIB_LIST (_PWR7)
+
+VEC_LDBL_LIB_LIST (_PWR7)
 #endif
 
 // POWER8 supports both Endians. So declare PWR8 externs unconditionally.
@@ -212,6 +851,12 @@ VEC_INT512_LIB_LIST (_PWR8)
 
 VEC_F128_LIB_LIST (_PWR8)
 
+VEC_F64_LIB_LIST (_PWR8)
+
+VEC_F32_LIB_LIST (_PWR8)
+
+VEC_LDBL_LIB_LIST (_PWR8)
+
 #ifndef PVECLIB_DISABLE_POWER9
 /* Older distros running Big Endian are unlikely to support PWR9.
  * So declare PWR9 externs only for LE.  */
@@ -223,6 +868,12 @@ VEC_INT128_LIB_LIST (_PWR9)
 VEC_INT512_LIB_LIST (_PWR9)
 
 VEC_F128_LIB_LIST (_PWR9)
+
+VEC_F64_LIB_LIST (_PWR9)
+
+VEC_F32_LIB_LIST (_PWR9)
+
+VEC_LDBL_LIB_LIST (_PWR9)
 #endif
 
 #ifndef PVECLIB_DISABLE_POWER10
@@ -236,6 +887,12 @@ VEC_INT128_LIB_LIST (_PWR10)
 VEC_INT512_LIB_LIST (_PWR10)
 
 VEC_F128_LIB_LIST (_PWR10)
+
+VEC_F64_LIB_LIST (_PWR10)
+
+VEC_F32_LIB_LIST (_PWR10)
+
+VEC_LDBL_LIB_LIST (_PWR10)
 #endif
 
 /* Declare the required static resolvers and ifunc aliases.
@@ -303,6 +960,20 @@ vec_mul512_byMN (__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2,
 		  unsigned long M, unsigned long N)
 __attribute__ ((ifunc ("resolve_vec_mul512_byMN")));
 
+static
+void
+(*resolve_vec_mul512_byMN_parallel (void))
+(__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2,
+	  unsigned long M, unsigned long N)
+{
+  VEC_DYN_RESOLVER(vec_mul512_byMN_parallel);
+}
+
+void
+vec_mul512_byMN_parallel (__VEC_U_512 *p, __VEC_U_512 *m1, __VEC_U_512 *m2,
+		  unsigned long M, unsigned long N)
+__attribute__ ((ifunc ("resolve_vec_mul512_byMN_parallel")));
+
 /* Declare the required static resolvers and ifunc aliases for dynamic
  * selection of CPU specific implementations supporting
  * vec_f128_ppc.h
@@ -313,6 +984,14 @@ VEC_RESOLVER_2 (__binary128, vec_xsmulqpo, __binary128, __binary128);
 VEC_RESOLVER_2 (__binary128, vec_xssubqpo, __binary128, __binary128);
 VEC_RESOLVER_3 (__binary128, vec_xsmaddqpo, __binary128, __binary128, __binary128);
 VEC_RESOLVER_3 (__binary128, vec_xsmsubqpo, __binary128, __binary128, __binary128);
+VEC_RESOLVER_3 (__binary128, vec_xsaddqp_rm, __binary128, __binary128, int);
+VEC_RESOLVER_3 (__binary128, vec_xsdivqp_rm, __binary128, __binary128, int);
+VEC_RESOLVER_3 (__binary128, vec_xsmulqp_rm, __binary128, __binary128, int);
+VEC_RESOLVER_3 (__binary128, vec_xssubqp_rm, __binary128, __binary128, int);
+VEC_RESOLVER_4 (__binary128, vec_xsmaddqp_rm, __binary128, __binary128,
+		__binary128, int);
+VEC_RESOLVER_4 (__binary128, vec_xsmsubqp_rm, __binary128, __binary128,
+		__binary128, int);
 VEC_RESOLVER_1 (__binary128, vec_xscvdpqp, vf64_t);
 VEC_RESOLVER_1 (vf64_t, vec_xscvqpdpo, __binary128);
 VEC_RESOLVER_1 (vui64_t, vec_xscvqpudz, __binary128);
@@ -333,6 +1012,37 @@ VEC_RESOLVER_2 (vui128_t, vec_moduq, vui128_t, vui128_t);
 VEC_RESOLVER_3 (__VEC_U_128RQ, vec_divdqu, vui128_t, vui128_t, vui128_t);
 VEC_RESOLVER_3 (vui128_t, vec_divduq, vui128_t, vui128_t, vui128_t);
 VEC_RESOLVER_3 (vui128_t, vec_modduq, vui128_t, vui128_t, vui128_t);
+VEC_RESOLVER_2 (void, vec_sort_s128, vi128_t *, unsigned long);
+VEC_RESOLVER_2 (void, vec_sort_u128, vui128_t *, unsigned long);
+VEC_RESOLVER_3 (unsigned long, vec_lower_bound_s128, const vi128_t *,
+		unsigned long, vi128_t);
+VEC_RESOLVER_3 (unsigned long, vec_lower_bound_u128, const vui128_t *,
+		unsigned long, vui128_t);
+VEC_RESOLVER_3 (unsigned long, vec_upper_bound_s128, const vi128_t *,
+		unsigned long, vi128_t);
+VEC_RESOLVER_3 (unsigned long, vec_upper_bound_u128, const vui128_t *,
+		unsigned long, vui128_t);
+VEC_RESOLVER_2 (long, vec_htab_erase_u128, vec_htab_t *, vui128_t);
+VEC_RESOLVER_2 (long, vec_htab_find_u128, const vec_htab_t *, vui128_t);
+VEC_RESOLVER_4 (void, vec_htab_find_batch_u128, const vec_htab_t *, long *,
+		const vui128_t *, unsigned long);
+VEC_RESOLVER_2 (int, vec_htab_init_u128, vec_htab_t *, unsigned long);
+VEC_RESOLVER_2 (long, vec_htab_insert_u128, vec_htab_t *, vui128_t);
+VEC_RESOLVER_3 (vui128_t, vec_hash128, const void *, unsigned long,
+		unsigned long long);
+VEC_RESOLVER_4 (void, vec_hash64_batch_u128, unsigned long long *,
+		const vui128_t *, unsigned long, unsigned long long);
+VEC_RESOLVER_4 (vui128_t, vec_prefix_sum_u128, vui128_t *, const vui128_t *,
+		unsigned long, vui128_t);
+VEC_RESOLVER_4 (vui128_t, vec_prefix_sum_u64_u128, vui128_t *,
+		const unsigned long long *, unsigned long, vui128_t);
+VEC_RESOLVER_3 (vui128_t, vec_sum_u128, vui128_t *, const vui128_t *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_pcg64_init, vec_pcg64_t *, vui128_t, vui128_t);
+VEC_RESOLVER_3 (void, vec_pcg64_fill_u64, vec_pcg64_t *, unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_4 (vui128_t, vec_philox4x32_fill_u32, unsigned int *,
+		unsigned long, vui128_t, unsigned long long);
 
 /* Declare the required static resolvers and ifunc aliases for dynamic
  * selection of CPU specific implementations supporting
@@ -344,3 +1054,259 @@ VEC_RESOLVER_2 (vui64_t, vec_divud, vui64_t, vui64_t);
 VEC_RESOLVER_2 (vui64_t, vec_modud, vui64_t, vui64_t);
 VEC_RESOLVER_3 (vui64_t, vec_divdud, vui64_t, vui64_t, vui64_t);
 VEC_RESOLVER_3 (vui64_t, vec_moddud, vui64_t, vui64_t, vui64_t);
+VEC_RESOLVER_2 (void, vec_sort_s64, long long *, unsigned long);
+VEC_RESOLVER_2 (void, vec_sort_u64, unsigned long long *, unsigned long);
+VEC_RESOLVER_3 (void, vec_sort_s64_kv, long long *, unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_sort_u64_kv, unsigned long long *,
+		unsigned long long *, unsigned long);
+VEC_RESOLVER_5 (void, vec_merge_s64, long long *, const long long *,
+		unsigned long, const long long *, unsigned long);
+VEC_RESOLVER_5 (void, vec_merge_u64, unsigned long long *,
+		const unsigned long long *, unsigned long,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_5 (unsigned long, vec_difference_u32, unsigned int *,
+		const unsigned int *, unsigned long,
+		const unsigned int *, unsigned long);
+VEC_RESOLVER_5 (unsigned long, vec_difference_u64, unsigned long long *,
+		const unsigned long long *, unsigned long,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_5 (unsigned long, vec_intersect_u32, unsigned int *,
+		const unsigned int *, unsigned long,
+		const unsigned int *, unsigned long);
+VEC_RESOLVER_5 (unsigned long, vec_intersect_u64, unsigned long long *,
+		const unsigned long long *, unsigned long,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_5 (unsigned long, vec_union_u32, unsigned int *,
+		const unsigned int *, unsigned long,
+		const unsigned int *, unsigned long);
+VEC_RESOLVER_5 (unsigned long, vec_union_u64, unsigned long long *,
+		const unsigned long long *, unsigned long,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_1 (void, vec_htab_free, vec_htab_t *);
+VEC_RESOLVER_2 (long, vec_htab_erase_u64, vec_htab_t *, unsigned long long);
+VEC_RESOLVER_2 (long, vec_htab_find_u64, const vec_htab_t *,
+		unsigned long long);
+VEC_RESOLVER_4 (void, vec_htab_find_batch_u64, const vec_htab_t *, long *,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_2 (int, vec_htab_init_u64, vec_htab_t *, unsigned long);
+VEC_RESOLVER_2 (long, vec_htab_insert_u64, vec_htab_t *, unsigned long long);
+VEC_RESOLVER_3 (unsigned long long, vec_hash64, const void *, unsigned long,
+		unsigned long long);
+VEC_RESOLVER_4 (void, vec_hash64_batch_u32, unsigned long long *,
+		const unsigned int *, unsigned long, unsigned long long);
+VEC_RESOLVER_4 (void, vec_hash64_batch_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long);
+VEC_RESOLVER_4 (unsigned long, vec_bitpack_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int);
+VEC_RESOLVER_4 (void, vec_bitunpack_u32, unsigned int *, const unsigned int *,
+		unsigned long, unsigned int);
+VEC_RESOLVER_5 (unsigned long, vec_bitpack_for_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int,
+		unsigned int);
+VEC_RESOLVER_5 (void, vec_bitunpack_for_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int,
+		unsigned int);
+VEC_RESOLVER_5 (unsigned long, vec_bitpack_delta_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int,
+		unsigned int);
+VEC_RESOLVER_5 (void, vec_bitunpack_delta_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int,
+		unsigned int);
+VEC_RESOLVER_4 (unsigned long, vec_bitpack_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned int);
+VEC_RESOLVER_4 (void, vec_bitunpack_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned int);
+VEC_RESOLVER_5 (unsigned long, vec_bitpack_for_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long,
+		unsigned int);
+VEC_RESOLVER_5 (void, vec_bitunpack_for_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long,
+		unsigned int);
+VEC_RESOLVER_5 (unsigned long, vec_bitpack_delta_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long,
+		unsigned int);
+VEC_RESOLVER_5 (void, vec_bitunpack_delta_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long,
+		unsigned int);
+VEC_RESOLVER_3 (unsigned long, vec_svb_encode_u32, unsigned char *,
+		const unsigned int *, unsigned long);
+VEC_RESOLVER_3 (unsigned long, vec_svb_decode_u32, unsigned int *,
+		const unsigned char *, unsigned long);
+VEC_RESOLVER_3 (unsigned long, vec_leb128_encode_u32, unsigned char *,
+		const unsigned int *, unsigned long);
+VEC_RESOLVER_4 (long, vec_leb128_decode_u32, unsigned int *,
+		const unsigned char *, unsigned long, unsigned long);
+VEC_RESOLVER_3 (unsigned long, vec_leb128_encode_u64, unsigned char *,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_4 (long, vec_leb128_decode_u64, unsigned long long *,
+		const unsigned char *, unsigned long, unsigned long);
+VEC_RESOLVER_4 (unsigned long long, vec_bitmap_and_count, unsigned long long *,
+		const unsigned long long *, const unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_4 (unsigned long, vec_bitmap_and_array_u16, unsigned short *,
+		const unsigned short *, unsigned long,
+		const unsigned long long *);
+VEC_RESOLVER_4 (unsigned long long, vec_bitmap_andnot_count, unsigned long long *,
+		const unsigned long long *, const unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_2 (unsigned long long, vec_bitmap_count, const unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_3 (long, vec_bitmap_next_set, const unsigned long long *,
+		unsigned long, unsigned long);
+VEC_RESOLVER_4 (unsigned long long, vec_bitmap_or_count, unsigned long long *,
+		const unsigned long long *, const unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_2 (unsigned long long, vec_bitmap_rank, const unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_3 (long, vec_bitmap_select, const unsigned long long *,
+		unsigned long, unsigned long long);
+VEC_RESOLVER_3 (void, vec_bitmap_set_array_u16, unsigned long long *,
+		const unsigned short *, unsigned long);
+VEC_RESOLVER_3 (unsigned long, vec_bitmap_to_array_u16, unsigned short *,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_4 (unsigned long long, vec_bitmap_xor_count, unsigned long long *,
+		const unsigned long long *, const unsigned long long *,
+		unsigned long);
+VEC_RESOLVER_4 (unsigned int, vec_prefix_sum_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int);
+VEC_RESOLVER_4 (unsigned int, vec_prefix_sum_excl_u32, unsigned int *,
+		const unsigned int *, unsigned long, unsigned int);
+VEC_RESOLVER_4 (unsigned long long, vec_prefix_sum_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long);
+VEC_RESOLVER_4 (unsigned long long, vec_prefix_sum_excl_u64, unsigned long long *,
+		const unsigned long long *, unsigned long, unsigned long long);
+VEC_RESOLVER_8 (void, vec_q15_biquad, short *, const short *, unsigned long,
+		const short *, short *, unsigned long, int, int);
+VEC_RESOLVER_5 (void, vec_q15_cmul, short *, const short *, const short *,
+		unsigned long, int);
+VEC_RESOLVER_4 (short, vec_q15_dot, const short *, const short *,
+		unsigned long, int);
+VEC_RESOLVER_6 (void, vec_q15_fir, short *, const short *, unsigned long,
+		const short *, unsigned long, int);
+VEC_RESOLVER_5 (void, vec_q31_cmul, int *, const int *, const int *,
+		unsigned long, int);
+VEC_RESOLVER_4 (int, vec_q31_dot, const int *, const int *, unsigned long,
+		int);
+VEC_RESOLVER_6 (void, vec_q31_fir, int *, const int *, unsigned long,
+		const int *, unsigned long, int);
+VEC_RESOLVER_3 (int, vec_dot_s16, const short *, const short *, unsigned long);
+VEC_RESOLVER_3 (long long, vec_dot_s16_s64, const short *, const short *,
+		unsigned long);
+VEC_RESOLVER_3 (int, vec_dot_s8, const signed char *, const signed char *,
+		unsigned long);
+VEC_RESOLVER_5 (void, vec_gemm_pack_a_s16, short *, const short *,
+		unsigned long, unsigned long, unsigned long);
+VEC_RESOLVER_5 (void, vec_gemm_pack_a_s8, signed char *, const signed char *,
+		unsigned long, unsigned long, unsigned long);
+VEC_RESOLVER_5 (void, vec_gemm_pack_b_s16, short *, const short *,
+		unsigned long, unsigned long, unsigned long);
+VEC_RESOLVER_5 (void, vec_gemm_pack_b_s8, unsigned char *, const signed char *,
+		unsigned long, unsigned long, unsigned long);
+VEC_RESOLVER_8 (void, vec_gemm_s16, int *, unsigned long, const short *,
+		const short *, unsigned long, unsigned long, unsigned long,
+		int);
+VEC_RESOLVER_8 (void, vec_gemm_s8, int *, unsigned long, const signed char *,
+		const unsigned char *, unsigned long, unsigned long,
+		unsigned long, int);
+
+/* Declare the required static resolvers and ifunc aliases for dynamic
+ * selection of CPU specific implementations supporting
+ * vec_f64_ppc.h
+ * */
+VEC_RESOLVER_3 (void, vec_rng_uniform_f64, double *,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_3 (void, vec_rng_normal_f64, double *,
+		const unsigned long long *, unsigned long);
+VEC_RESOLVER_3 (void, vec_exp_f64_u10, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_exp_f64_u35, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_log_f64_u10, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_log_f64_u35, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_pow_f64_u10, double *, const double *,
+		const double *, unsigned long);
+VEC_RESOLVER_4 (void, vec_pow_f64_u35, double *, const double *,
+		const double *, unsigned long);
+VEC_RESOLVER_3 (void, vec_sin_f64_u10, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_sin_f64_u35, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_cos_f64_u10, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_cos_f64_u35, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_tanh_f64_u10, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_tanh_f64_u35, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_sigmoid_f64_u10, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_sigmoid_f64_u35, double *, const double *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_frexp_f64, double *, int *, const double *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_ldexp_f64, double *, const double *, const int *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_scalbn_f64, double *, const double *, int,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_ilogb_f64, int *, const double *, unsigned long);
+VEC_RESOLVER_3 (void, vec_logb_f64, double *, const double *, unsigned long);
+VEC_RESOLVER_4 (void, vec_nextafter_f64, double *, const double *,
+		const double *, unsigned long);
+
+/* Declare the required static resolvers and ifunc aliases for dynamic
+ * selection of CPU specific implementations supporting
+ * vec_f32_ppc.h
+ * */
+VEC_RESOLVER_3 (void, vec_exp_f32_u10, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_exp_f32_u35, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_log_f32_u10, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_log_f32_u35, float *, const float *, unsigned long);
+VEC_RESOLVER_4 (void, vec_pow_f32_u10, float *, const float *, const float *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_pow_f32_u35, float *, const float *, const float *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_sin_f32_u10, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_sin_f32_u35, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_cos_f32_u10, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_cos_f32_u35, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_tanh_f32_u10, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_tanh_f32_u35, float *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_sigmoid_f32_u10, float *, const float *,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_sigmoid_f32_u35, float *, const float *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_frexp_f32, float *, int *, const float *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_ldexp_f32, float *, const float *, const int *,
+		unsigned long);
+VEC_RESOLVER_4 (void, vec_scalbn_f32, float *, const float *, int,
+		unsigned long);
+VEC_RESOLVER_3 (void, vec_ilogb_f32, int *, const float *, unsigned long);
+VEC_RESOLVER_3 (void, vec_logb_f32, float *, const float *, unsigned long);
+VEC_RESOLVER_4 (void, vec_nextafter_f32, float *, const float *, const float *,
+		unsigned long);
+
+#if defined (__LONG_DOUBLE_128__) && !defined (__LONG_DOUBLE_IEEE128__)
+/* Declare the required static resolvers and ifunc aliases for dynamic
+ * selection of CPU specific implementations supporting
+ * IBM long double arrays in vec_f64_ppc.h
+ * */
+VEC_RESOLVER_4 (void, vec_add_ldbl, long double *, const long double *,
+		const long double *, unsigned long);
+VEC_RESOLVER_4 (void, vec_sub_ldbl, long double *, const long double *,
+		const long double *, unsigned long);
+VEC_RESOLVER_4 (void, vec_mul_ldbl, long double *, const long double *,
+		const long double *, unsigned long);
+VEC_RESOLVER_4 (void, vec_div_ldbl, long double *, const long double *,
+		const long double *, unsigned long);
+VEC_RESOLVER_3 (void, vec_sqrt_ldbl, long double *, const long double *,
+		unsigned long);
+VEC_RESOLVER_5 (void, vec_madd_ldbl, long double *, const long double *,
+		const long double *, const long double *, unsigned long);
+VEC_RESOLVER_3 (long double, vec_dot_ldbl, const long double *,
+		const long double *, unsigned long);
+#endif
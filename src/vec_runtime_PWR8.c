@@ -24,3 +24,17 @@
 #include "vec_int64_runtime.c"
 #include "vec_int512_runtime.c"
 #include "vec_f128_runtime.c"
+#include "vec_sort_runtime.c"
+#include "vec_set_runtime.c"
+#include "vec_htab_runtime.c"
+#include "vec_hash_runtime.c"
+#include "vec_bitpack_runtime.c"
+#include "vec_varint_runtime.c"
+#include "vec_bitmap_runtime.c"
+#include "vec_scan_runtime.c"
+#include "vec_rng_runtime.c"
+#include "vec_dsp_runtime.c"
+#include "vec_gemm_runtime.c"
+#include "vec_math_runtime.c"
+#include "vec_fpexp_runtime.c"
+#include "vec_ldbl_runtime.c"
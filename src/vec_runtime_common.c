@@ -24,3 +24,4 @@
 
 #include "decpowof2.c"
 #include "tipowof10.c"
+#include "vec_pool_runtime.c"
@@ -0,0 +1,322 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_scan_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Prefix sum (scan) of word, doubleword and quadword arrays.
+ * Included by vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * Each vector is scanned in register with log2(elements) shifted
+ * adds, using vec_sldqi with a zero vector to shift elements toward
+ * the higher element index. The running sum of the previous vector
+ * (its last element) is splatted and added to the next vector. Two
+ * vectors are scanned per iteration so the in register scans of the
+ * second vector overlap the carry of the first.
+ *
+ * The exclusive scans are the inclusive scan minus the input, which
+ * costs one subtract per vector and allows out == in.
+ *
+ * The doubleword to quadword scan zero extends each doubleword
+ * element and accumulates with vec_adduqm, so the running sum of up
+ * to 2^64 elements can not overflow. The quadword sum accumulates a
+ * 256-bit total, using vec_addcuq and vec_addeuqm to propagate the
+ * carry into the high quadword.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+
+/* Shift the elements of x toward the higher element index by b bits,
+ * shifting in zeros. In register order that is a left shift for
+ * little endian and a right shift for big endian.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define __VEC_SCAN_SHE(x, b) \
+  vec_sldqi ((vui128_t) (x), (vui128_t) vec_splat_u32 (0), (b))
+/* The register doubleword holding doubleword element 1 (the last).  */
+#define __VEC_SCAN_DW_LAST 0
+#else
+#define __VEC_SCAN_SHE(x, b) \
+  vec_sldqi ((vui128_t) vec_splat_u32 (0), (vui128_t) (x), (128 - (b)))
+#define __VEC_SCAN_DW_LAST 1
+#endif
+
+/* Inclusive scan of the 4 words of x.  */
+static inline vui32_t
+__vec_scan_w (vui32_t x)
+{
+  x = vec_add (x, (vui32_t) __VEC_SCAN_SHE (x, 32));
+  return vec_add (x, (vui32_t) __VEC_SCAN_SHE (x, 64));
+}
+
+/* Inclusive scan of the 2 doublewords of x.  */
+static inline vui64_t
+__vec_scan_d (vui64_t x)
+{
+  return vec_addudm (x, (vui64_t) __VEC_SCAN_SHE (x, 64));
+}
+
+/* Scan of 8 words at in into 8 words at out. c is the splatted
+ * running sum, the return value the running sum after these words.
+ * If excl, subtract the input from the inclusive sums.  */
+static inline vui32_t
+__vec_scan_w8 (unsigned int *out, const unsigned int *in, vui32_t c,
+	       int excl)
+{
+  vui32_t x0, x1, s0, s1;
+
+  memcpy (&x0, &in[0], sizeof (x0));
+  memcpy (&x1, &in[4], sizeof (x1));
+  s0 = vec_add (__vec_scan_w (x0), c);
+  s1 = __vec_scan_w (x1);
+  c = vec_splat (s0, 3);
+  s1 = vec_add (s1, c);
+  c = vec_splat (s1, 3);
+  if (excl)
+    {
+      s0 = vec_sub (s0, x0);
+      s1 = vec_sub (s1, x1);
+    }
+  memcpy (&out[0], &s0, sizeof (s0));
+  memcpy (&out[4], &s1, sizeof (s1));
+  return c;
+}
+
+static inline vui64_t
+__vec_scan_d4 (unsigned long long *out, const unsigned long long *in,
+	       vui64_t c, int excl)
+{
+  vui64_t x0, x1, s0, s1;
+
+  memcpy (&x0, &in[0], sizeof (x0));
+  memcpy (&x1, &in[2], sizeof (x1));
+  s0 = vec_addudm (__vec_scan_d (x0), c);
+  s1 = __vec_scan_d (x1);
+  c = vec_xxspltd (s0, __VEC_SCAN_DW_LAST);
+  s1 = vec_addudm (s1, c);
+  c = vec_xxspltd (s1, __VEC_SCAN_DW_LAST);
+  if (excl)
+    {
+      s0 = vec_subudm (s0, x0);
+      s1 = vec_subudm (s1, x1);
+    }
+  memcpy (&out[0], &s0, sizeof (s0));
+  memcpy (&out[2], &s1, sizeof (s1));
+  return c;
+}
+
+unsigned int
+__VEC_PWR_IMP (vec_prefix_sum_u32) (unsigned int *out,
+				    const unsigned int *in,
+				    unsigned long n, unsigned int init)
+{
+  vui32_t c = vec_splats (init);
+  unsigned int s;
+  unsigned long i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    c = __vec_scan_w8 (&out[i], &in[i], c, 0);
+  for (s = c[0]; i < n; i++)
+    out[i] = s += in[i];
+  return s;
+}
+
+unsigned int
+__VEC_PWR_IMP (vec_prefix_sum_excl_u32) (unsigned int *out,
+					 const unsigned int *in,
+					 unsigned long n, unsigned int init)
+{
+  vui32_t c = vec_splats (init);
+  unsigned int s, x;
+  unsigned long i;
+
+  for (i = 0; i + 8 <= n; i += 8)
+    c = __vec_scan_w8 (&out[i], &in[i], c, 1);
+  for (s = c[0]; i < n; i++)
+    {
+      x = in[i];
+      out[i] = s;
+      s += x;
+    }
+  return s;
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_prefix_sum_u64) (unsigned long long *out,
+				    const unsigned long long *in,
+				    unsigned long n, unsigned long long init)
+{
+  vui64_t c = vec_splats (init);
+  unsigned long long s;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    c = __vec_scan_d4 (&out[i], &in[i], c, 0);
+  for (s = c[0]; i < n; i++)
+    out[i] = s += in[i];
+  return s;
+}
+
+unsigned long long
+__VEC_PWR_IMP (vec_prefix_sum_excl_u64) (unsigned long long *out,
+					 const unsigned long long *in,
+					 unsigned long n,
+					 unsigned long long init)
+{
+  vui64_t c = vec_splats (init);
+  unsigned long long s, x;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    c = __vec_scan_d4 (&out[i], &in[i], c, 1);
+  for (s = c[0]; i < n; i++)
+    {
+      x = in[i];
+      out[i] = s;
+      s += x;
+    }
+  return s;
+}
+
+/* Zero extend doubleword element 0 and 1 of x to quadwords.  */
+static inline void
+__vec_scan_extd (vui64_t x, vui128_t *e0, vui128_t *e1)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  *e0 = (vui128_t) vec_mrgald ((vui128_t) zero, (vui128_t) x);
+  *e1 = (vui128_t) vec_mrgahd ((vui128_t) zero, (vui128_t) x);
+#else
+  *e0 = (vui128_t) vec_mrgahd ((vui128_t) zero, (vui128_t) x);
+  *e1 = (vui128_t) vec_mrgald ((vui128_t) zero, (vui128_t) x);
+#endif
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_prefix_sum_u64_u128) (vui128_t *out,
+					 const unsigned long long *in,
+					 unsigned long n, vui128_t init)
+{
+  vui128_t s = init;
+  vui128_t e0, e1;
+  vui64_t x;
+  unsigned long i;
+
+  if (out == NULL)
+    {
+      /* Total only. Two independent accumulators of one element
+       * each per vector.  */
+      vui128_t t = (vui128_t) vec_splat_u64 (0);
+
+      for (i = 0; i + 2 <= n; i += 2)
+	{
+	  memcpy (&x, &in[i], sizeof (x));
+	  __vec_scan_extd (x, &e0, &e1);
+	  s = vec_adduqm (s, e0);
+	  t = vec_adduqm (t, e1);
+	}
+      s = vec_adduqm (s, t);
+    }
+  else
+    {
+      /* The sum of the pair is independent of the running sum, so
+       * the dependent chain is one vec_adduqm per 2 elements.  */
+      for (i = 0; i + 2 <= n; i += 2)
+	{
+	  vui128_t p;
+
+	  memcpy (&x, &in[i], sizeof (x));
+	  __vec_scan_extd (x, &e0, &e1);
+	  p = vec_adduqm (e0, e1);
+	  out[i] = vec_adduqm (s, e0);
+	  s = vec_adduqm (s, p);
+	  out[i + 1] = s;
+	}
+    }
+  if (i < n)
+    {
+      __vec_scan_extd (vec_splats (in[i]), &e0, &e1);
+      s = vec_adduqm (s, e0);
+      if (out != NULL)
+	out[i] = s;
+    }
+  return s;
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_prefix_sum_u128) (vui128_t *out, const vui128_t *in,
+				     unsigned long n, vui128_t init)
+{
+  vui128_t s = init;
+  unsigned long i;
+
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      vui128_t x0 = in[i];
+      vui128_t p = vec_adduqm (x0, in[i + 1]);
+
+      out[i] = vec_adduqm (s, x0);
+      s = vec_adduqm (s, p);
+      out[i + 1] = s;
+    }
+  if (i < n)
+    {
+      s = vec_adduqm (s, in[i]);
+      out[i] = s;
+    }
+  return s;
+}
+
+vui128_t
+__VEC_PWR_IMP (vec_sum_u128) (vui128_t *high, const vui128_t *in,
+			      unsigned long n)
+{
+  const vui128_t zero = (vui128_t) vec_splat_u64 (0);
+  vui128_t s0 = zero, s1 = zero;
+  vui128_t h0 = zero, h1 = zero;
+  vui128_t c;
+  unsigned long i;
+
+  /* Two 256-bit accumulators, each the low quadword sum and the high
+   * quadword count of carries.  */
+  for (i = 0; i + 2 <= n; i += 2)
+    {
+      vui128_t x0 = in[i];
+      vui128_t x1 = in[i + 1];
+      vui128_t c0 = vec_addcuq (s0, x0);
+      vui128_t c1 = vec_addcuq (s1, x1);
+
+      s0 = vec_adduqm (s0, x0);
+      s1 = vec_adduqm (s1, x1);
+      h0 = vec_addeuqm (h0, zero, c0);
+      h1 = vec_addeuqm (h1, zero, c1);
+    }
+  if (i < n)
+    {
+      c = vec_addcuq (s0, in[i]);
+      s0 = vec_adduqm (s0, in[i]);
+      h0 = vec_addeuqm (h0, zero, c);
+    }
+  c = vec_addcuq (s0, s1);
+  s0 = vec_adduqm (s0, s1);
+  *high = vec_addeuqm (h0, h1, c);
+  return s0;
+}
@@ -0,0 +1,568 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_set_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Sorted set intersection, union and difference for unsigned word
+ * and doubleword elements. Included by vec_runtime_PWR7.c ...
+ * vec_runtime_PWR10.c.
+ *
+ * Intersection and difference compare a block of a (4 words or 2
+ * doublewords) against all elements of a block of b at once. The
+ * b block is rotated through all element positions (vec_sld or
+ * vec_swapd) and each rotation compared with vec_cmpeq/vec_cmpequd.
+ * The OR of the compares is a mask of the a elements present in the
+ * b block. Selected elements are packed to the front of a vector by
+ * vec_perm, using a permute control indexed by the mask, and stored
+ * unaligned. The block with the smaller last element is retired
+ * (both, if equal).
+ *
+ * If one set is much smaller than the other (__VEC_SET_SKEW) the
+ * elements of the small set are located in the large set by
+ * galloping (exponential then binary) search instead.  */
+
+#include <string.h>
+
+#include <pveclib/vec_int64_ppc.h>
+
+/* Use galloping search if one set is this many times larger.  */
+#define __VEC_SET_SKEW 32
+
+/* Byte indexes (element order) of word element _W.  */
+#define __VEC_SET_W(_W) (4*(_W)), (4*(_W)+1), (4*(_W)+2), (4*(_W)+3)
+/* Byte indexes (element order) of doubleword element _D.  */
+#define __VEC_SET_D(_D) __VEC_SET_W(2*(_D)), __VEC_SET_W(2*(_D)+1)
+
+/* Permute controls packing the word elements selected by mask bits
+ * 0-3 (element 0-3) to the front of the vector.  */
+static const vui8_t __vec_set_pack_u32[16] =
+  {
+    { __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(1), __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(1), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(2), __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(2), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(1), __VEC_SET_W(2), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(1), __VEC_SET_W(2), __VEC_SET_W(0) },
+    { __VEC_SET_W(3), __VEC_SET_W(0), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(3), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(1), __VEC_SET_W(3), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(1), __VEC_SET_W(3), __VEC_SET_W(0) },
+    { __VEC_SET_W(2), __VEC_SET_W(3), __VEC_SET_W(0), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(2), __VEC_SET_W(3), __VEC_SET_W(0) },
+    { __VEC_SET_W(1), __VEC_SET_W(2), __VEC_SET_W(3), __VEC_SET_W(0) },
+    { __VEC_SET_W(0), __VEC_SET_W(1), __VEC_SET_W(2), __VEC_SET_W(3) }
+  };
+
+/* As __vec_set_pack_u32 for doubleword mask bits 0-1.  */
+static const vui8_t __vec_set_pack_u64[4] =
+  {
+    { __VEC_SET_D(0), __VEC_SET_D(0) },
+    { __VEC_SET_D(0), __VEC_SET_D(0) },
+    { __VEC_SET_D(1), __VEC_SET_D(0) },
+    { __VEC_SET_D(0), __VEC_SET_D(1) }
+  };
+
+static const unsigned char __vec_set_count[16] =
+  { 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4 };
+
+/* Return the index of the first element of s[lo..n-1] not less than
+ * key, or n. Probes s[lo], s[lo+1], s[lo+3], s[lo+7] ... until the
+ * key is bracketed, then binary search within the bracket.  */
+static inline unsigned long
+__vec_set_gallop_u32 (const unsigned int *s, unsigned long lo,
+		      unsigned long n, unsigned int key)
+{
+  unsigned long hi = lo, step = 1;
+
+  while (hi < n && s[hi] < key)
+    {
+      lo = hi + 1;
+      hi += step;
+      step <<= 1;
+    }
+  if (hi > n)
+    hi = n;
+
+  while (lo < hi)
+    {
+      unsigned long mid = lo + (hi - lo) / 2;
+      if (s[mid] < key)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+static inline unsigned long
+__vec_set_gallop_u64 (const unsigned long long *s, unsigned long lo,
+		      unsigned long n, unsigned long long key)
+{
+  unsigned long hi = lo, step = 1;
+
+  while (hi < n && s[hi] < key)
+    {
+      lo = hi + 1;
+      hi += step;
+      step <<= 1;
+    }
+  if (hi > n)
+    hi = n;
+
+  while (lo < hi)
+    {
+      unsigned long mid = lo + (hi - lo) / 2;
+      if (s[mid] < key)
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+  return lo;
+}
+
+static inline vui32_t
+__vec_set_ld_u32 (const unsigned int *p)
+{
+  vui32_t v;
+
+  memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+static inline vui64_t
+__vec_set_ld_u64 (const unsigned long long *p)
+{
+  vui64_t v;
+
+  memcpy (&v, p, sizeof (v));
+  return v;
+}
+
+/* Mask of the elements of va equal to any element of vb.
+ * Bit i is set for word element i.  */
+static inline unsigned int
+__vec_set_match_u32 (vui32_t va, vui32_t vb)
+{
+  const vui32_t weight = { 1, 2, 4, 8 };
+  vui32_t m;
+
+  m = (vui32_t) vec_cmpeq (va, vb);
+  m = vec_or (m, (vui32_t) vec_cmpeq (va, vec_sld (vb, vb, 4)));
+  m = vec_or (m, (vui32_t) vec_cmpeq (va, vec_sld (vb, vb, 8)));
+  m = vec_or (m, (vui32_t) vec_cmpeq (va, vec_sld (vb, vb, 12)));
+  /* Gather the element mask bits into every word.  */
+  m = vec_and (m, weight);
+  m = vec_or (m, vec_sld (m, m, 8));
+  m = vec_or (m, vec_sld (m, m, 4));
+  return m[0];
+}
+
+/* Mask of the elements of va equal to any element of vb.
+ * Bit i is set for doubleword element i.  */
+static inline unsigned int
+__vec_set_match_u64 (vui64_t va, vui64_t vb)
+{
+  vui64_t m;
+
+  m = (vui64_t) vec_cmpequd (va, vb);
+  m = vec_or (m, (vui64_t) vec_cmpequd (va, vec_swapd (vb)));
+  return (m[0] & 1) | (m[1] & 2);
+}
+
+/* Store the word elements of va selected by mask at out[o]. Stores
+ * the full vector if out has room for it (o+4 <= cap).
+ * Returns the updated output count.  */
+static inline unsigned long
+__vec_set_emit_u32 (unsigned int *out, unsigned long o, unsigned long cap,
+		    vui32_t va, unsigned int mask)
+{
+  unsigned int cnt = __vec_set_count[mask];
+  vui32_t v;
+
+  v = (vui32_t) vec_perm ((vui8_t) va, (vui8_t) va,
+			  __vec_set_pack_u32[mask]);
+  if (o + 4 <= cap)
+    memcpy (&out[o], &v, sizeof (v));
+  else
+    memcpy (&out[o], &v, cnt * sizeof (unsigned int));
+  return o + cnt;
+}
+
+static inline unsigned long
+__vec_set_emit_u64 (unsigned long long *out, unsigned long o,
+		    unsigned long cap, vui64_t va, unsigned int mask)
+{
+  unsigned int cnt = __vec_set_count[mask];
+  vui64_t v;
+
+  v = (vui64_t) vec_perm ((vui8_t) va, (vui8_t) va,
+			  __vec_set_pack_u64[mask]);
+  if (o + 2 <= cap)
+    memcpy (&out[o], &v, sizeof (v));
+  else
+    memcpy (&out[o], &v, cnt * sizeof (unsigned long long));
+  return o + cnt;
+}
+
+/* Intersection of small set s (ns elements) with large set l by
+ * galloping search in l.  */
+static unsigned long
+__vec_set_gallop_isect_u32 (unsigned int *out, const unsigned int *s,
+			    unsigned long ns, const unsigned int *l,
+			    unsigned long nl)
+{
+  unsigned long i, j = 0, o = 0;
+
+  for (i = 0; i < ns; i++)
+    {
+      j = __vec_set_gallop_u32 (l, j, nl, s[i]);
+      if (j == nl)
+	break;
+      if (l[j] == s[i])
+	out[o++] = s[i];
+    }
+  return o;
+}
+
+static unsigned long
+__vec_set_gallop_isect_u64 (unsigned long long *out,
+			    const unsigned long long *s, unsigned long ns,
+			    const unsigned long long *l, unsigned long nl)
+{
+  unsigned long i, j = 0, o = 0;
+
+  for (i = 0; i < ns; i++)
+    {
+      j = __vec_set_gallop_u64 (l, j, nl, s[i]);
+      if (j == nl)
+	break;
+      if (l[j] == s[i])
+	out[o++] = s[i];
+    }
+  return o;
+}
+
+/* Copy the runs of l between the elements of small set s, inserting
+ * each element of s (union) or dropping the matching element of l
+ * (difference l \ s). The runs are found by galloping search.  */
+static unsigned long
+__vec_set_gallop_runs_u32 (unsigned int *out, const unsigned int *l,
+			   unsigned long nl, const unsigned int *s,
+			   unsigned long ns, int merge)
+{
+  unsigned long i, k, pos = 0, o = 0;
+
+  for (i = 0; i < ns; i++)
+    {
+      k = __vec_set_gallop_u32 (l, pos, nl, s[i]);
+      memcpy (&out[o], &l[pos], (k - pos) * sizeof (unsigned int));
+      o += k - pos;
+      pos = k;
+      if (k < nl && l[k] == s[i])
+	pos++;
+      if (merge)
+	out[o++] = s[i];
+    }
+  memcpy (&out[o], &l[pos], (nl - pos) * sizeof (unsigned int));
+  return o + (nl - pos);
+}
+
+static unsigned long
+__vec_set_gallop_runs_u64 (unsigned long long *out,
+			   const unsigned long long *l, unsigned long nl,
+			   const unsigned long long *s, unsigned long ns,
+			   int merge)
+{
+  unsigned long i, k, pos = 0, o = 0;
+
+  for (i = 0; i < ns; i++)
+    {
+      k = __vec_set_gallop_u64 (l, pos, nl, s[i]);
+      memcpy (&out[o], &l[pos], (k - pos) * sizeof (unsigned long long));
+      o += k - pos;
+      pos = k;
+      if (k < nl && l[k] == s[i])
+	pos++;
+      if (merge)
+	out[o++] = s[i];
+    }
+  memcpy (&out[o], &l[pos], (nl - pos) * sizeof (unsigned long long));
+  return o + (nl - pos);
+}
+
+/* Difference of small set s minus large set l by galloping search
+ * in l.  */
+static unsigned long
+__vec_set_gallop_diff_u32 (unsigned int *out, const unsigned int *s,
+			   unsigned long ns, const unsigned int *l,
+			   unsigned long nl)
+{
+  unsigned long i, j = 0, o = 0;
+
+  for (i = 0; i < ns; i++)
+    {
+      j = __vec_set_gallop_u32 (l, j, nl, s[i]);
+      if (j == nl || l[j] != s[i])
+	out[o++] = s[i];
+    }
+  return o;
+}
+
+static unsigned long
+__vec_set_gallop_diff_u64 (unsigned long long *out,
+			   const unsigned long long *s, unsigned long ns,
+			   const unsigned long long *l, unsigned long nl)
+{
+  unsigned long i, j = 0, o = 0;
+
+  for (i = 0; i < ns; i++)
+    {
+      j = __vec_set_gallop_u64 (l, j, nl, s[i]);
+      if (j == nl || l[j] != s[i])
+	out[o++] = s[i];
+    }
+  return o;
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_intersect_u32) (unsigned int *out, const unsigned int *a,
+				   unsigned long na, const unsigned int *b,
+				   unsigned long nb)
+{
+  unsigned long i = 0, j = 0, o = 0;
+  unsigned long cap = (na < nb) ? na : nb;
+
+  if (na * __VEC_SET_SKEW < nb)
+    return __vec_set_gallop_isect_u32 (out, a, na, b, nb);
+  if (nb * __VEC_SET_SKEW < na)
+    return __vec_set_gallop_isect_u32 (out, b, nb, a, na);
+
+  while (i + 4 <= na && j + 4 <= nb)
+    {
+      vui32_t va = __vec_set_ld_u32 (&a[i]);
+      vui32_t vb = __vec_set_ld_u32 (&b[j]);
+      unsigned int amax = a[i + 3];
+      unsigned int bmax = b[j + 3];
+      unsigned int mask;
+
+      mask = __vec_set_match_u32 (va, vb);
+      if (mask)
+	o = __vec_set_emit_u32 (out, o, cap, va, mask);
+      i += (amax <= bmax) ? 4 : 0;
+      j += (bmax <= amax) ? 4 : 0;
+    }
+  /* Matches with retired blocks are already stored, so the tails
+   * only find new matches.  */
+  for (; i < na; i++)
+    {
+      j = __vec_set_gallop_u32 (b, j, nb, a[i]);
+      if (j == nb)
+	break;
+      if (b[j] == a[i])
+	out[o++] = a[i];
+    }
+  return o;
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_intersect_u64) (unsigned long long *out,
+				   const unsigned long long *a,
+				   unsigned long na,
+				   const unsigned long long *b,
+				   unsigned long nb)
+{
+  unsigned long i = 0, j = 0, o = 0;
+  unsigned long cap = (na < nb) ? na : nb;
+
+  if (na * __VEC_SET_SKEW < nb)
+    return __vec_set_gallop_isect_u64 (out, a, na, b, nb);
+  if (nb * __VEC_SET_SKEW < na)
+    return __vec_set_gallop_isect_u64 (out, b, nb, a, na);
+
+  while (i + 2 <= na && j + 2 <= nb)
+    {
+      vui64_t va = __vec_set_ld_u64 (&a[i]);
+      vui64_t vb = __vec_set_ld_u64 (&b[j]);
+      unsigned long long amax = a[i + 1];
+      unsigned long long bmax = b[j + 1];
+      unsigned int mask;
+
+      mask = __vec_set_match_u64 (va, vb);
+      if (mask)
+	o = __vec_set_emit_u64 (out, o, cap, va, mask);
+      i += (amax <= bmax) ? 2 : 0;
+      j += (bmax <= amax) ? 2 : 0;
+    }
+  for (; i < na; i++)
+    {
+      j = __vec_set_gallop_u64 (b, j, nb, a[i]);
+      if (j == nb)
+	break;
+      if (b[j] == a[i])
+	out[o++] = a[i];
+    }
+  return o;
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_difference_u32) (unsigned int *out, const unsigned int *a,
+				    unsigned long na, const unsigned int *b,
+				    unsigned long nb)
+{
+  unsigned long i = 0, j = 0, o = 0, k;
+  unsigned int found = 0;
+
+  if (na * __VEC_SET_SKEW < nb)
+    return __vec_set_gallop_diff_u32 (out, a, na, b, nb);
+  if (nb * __VEC_SET_SKEW < na)
+    return __vec_set_gallop_runs_u32 (out, a, na, b, nb, 0);
+
+  /* found accumulates the matches of the current a block over the
+   * b blocks it overlaps. The unmatched elements are stored when the
+   * a block is retired.  */
+  while (i + 4 <= na && j + 4 <= nb)
+    {
+      vui32_t va = __vec_set_ld_u32 (&a[i]);
+      vui32_t vb = __vec_set_ld_u32 (&b[j]);
+      unsigned int amax = a[i + 3];
+      unsigned int bmax = b[j + 3];
+
+      found |= __vec_set_match_u32 (va, vb);
+      if (amax <= bmax)
+	{
+	  if (found != 0xf)
+	    o = __vec_set_emit_u32 (out, o, na, va, found ^ 0xf);
+	  found = 0;
+	  i += 4;
+	}
+      j += (bmax <= amax) ? 4 : 0;
+    }
+  /* The current a block may have matched retired b blocks.  */
+  for (k = 0; i < na; i++, k++)
+    {
+      if (k < 4 && (found & (1 << k)))
+	continue;
+      j = __vec_set_gallop_u32 (b, j, nb, a[i]);
+      if (j == nb || b[j] != a[i])
+	out[o++] = a[i];
+    }
+  return o;
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_difference_u64) (unsigned long long *out,
+				    const unsigned long long *a,
+				    unsigned long na,
+				    const unsigned long long *b,
+				    unsigned long nb)
+{
+  unsigned long i = 0, j = 0, o = 0, k;
+  unsigned int found = 0;
+
+  if (na * __VEC_SET_SKEW < nb)
+    return __vec_set_gallop_diff_u64 (out, a, na, b, nb);
+  if (nb * __VEC_SET_SKEW < na)
+    return __vec_set_gallop_runs_u64 (out, a, na, b, nb, 0);
+
+  while (i + 2 <= na && j + 2 <= nb)
+    {
+      vui64_t va = __vec_set_ld_u64 (&a[i]);
+      vui64_t vb = __vec_set_ld_u64 (&b[j]);
+      unsigned long long amax = a[i + 1];
+      unsigned long long bmax = b[j + 1];
+
+      found |= __vec_set_match_u64 (va, vb);
+      if (amax <= bmax)
+	{
+	  if (found != 0x3)
+	    o = __vec_set_emit_u64 (out, o, na, va, found ^ 0x3);
+	  found = 0;
+	  i += 2;
+	}
+      j += (bmax <= amax) ? 2 : 0;
+    }
+  for (k = 0; i < na; i++, k++)
+    {
+      if (k < 2 && (found & (1 << k)))
+	continue;
+      j = __vec_set_gallop_u64 (b, j, nb, a[i]);
+      if (j == nb || b[j] != a[i])
+	out[o++] = a[i];
+    }
+  return o;
+}
+
+/* Union is a two-way merge that drops one of each equal pair. The
+ * element selection and index updates are branch free.  */
+unsigned long
+__VEC_PWR_IMP (vec_union_u32) (unsigned int *out, const unsigned int *a,
+			       unsigned long na, const unsigned int *b,
+			       unsigned long nb)
+{
+  unsigned long i = 0, j = 0, o = 0;
+
+  if (na * __VEC_SET_SKEW < nb)
+    return __vec_set_gallop_runs_u32 (out, b, nb, a, na, 1);
+  if (nb * __VEC_SET_SKEW < na)
+    return __vec_set_gallop_runs_u32 (out, a, na, b, nb, 1);
+
+  while (i < na && j < nb)
+    {
+      unsigned int x = a[i];
+      unsigned int y = b[j];
+
+      out[o++] = (x < y) ? x : y;
+      i += (x <= y);
+      j += (y <= x);
+    }
+  memcpy (&out[o], &a[i], (na - i) * sizeof (unsigned int));
+  o += na - i;
+  memcpy (&out[o], &b[j], (nb - j) * sizeof (unsigned int));
+  return o + (nb - j);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_union_u64) (unsigned long long *out,
+			       const unsigned long long *a, unsigned long na,
+			       const unsigned long long *b, unsigned long nb)
+{
+  unsigned long i = 0, j = 0, o = 0;
+
+  if (na * __VEC_SET_SKEW < nb)
+    return __vec_set_gallop_runs_u64 (out, b, nb, a, na, 1);
+  if (nb * __VEC_SET_SKEW < na)
+    return __vec_set_gallop_runs_u64 (out, a, na, b, nb, 1);
+
+  while (i < na && j < nb)
+    {
+      unsigned long long x = a[i];
+      unsigned long long y = b[j];
+
+      out[o++] = (x < y) ? x : y;
+      i += (x <= y);
+      j += (y <= x);
+    }
+  memcpy (&out[o], &a[i], (na - i) * sizeof (unsigned long long));
+  o += na - i;
+  memcpy (&out[o], &b[j], (nb - j) * sizeof (unsigned long long));
+  return o + (nb - j);
+}
@@ -0,0 +1,745 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_sort_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Array sort and merge built from the in-register sorting networks
+ * of vec_int64_ppc.h. Included by vec_runtime_PWR7.c ...
+ * vec_runtime_PWR10.c, so the PWR7 build gets the single compare
+ * vec_minmaxud() and POWER8 and later vminud/vmaxud.
+ *
+ * Signed keys are sorted as unsigned keys with the sign bit flipped
+ * (bias) on load and flipped back on store.  */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <pveclib/vec_int128_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+
+/* Elements per in-register sorted block (vec_sort32ud).  */
+#define __VEC_SORT_BLOCK 32
+/* Elements per vectorized merge step.  */
+#define __VEC_SORT_MERGE 8
+#define __VEC_SORT_SIGN 0x8000000000000000ULL
+
+static inline vui64_t
+__vec_sort_ld (const unsigned long long *p, vui64_t bias)
+{
+  vui64_t v;
+
+  memcpy (&v, p, sizeof (v));
+  return vec_xor (v, bias);
+}
+
+static inline void
+__vec_sort_st (unsigned long long *p, vui64_t v, vui64_t bias)
+{
+  v = vec_xor (v, bias);
+  memcpy (p, &v, sizeof (v));
+}
+
+/* Key compare-exchange that moves the payload with the key.
+ * Always the single compare form, as the mask is needed for the
+ * payload.  */
+static inline void
+__vec_sort_minmax_kv (vui64_t *ka, vui64_t *kb, vui64_t *pa, vui64_t *pb)
+{
+  vb64_t gtmask = vec_cmpgtud (*ka, *kb);
+  vui64_t t;
+
+  t = vec_selud (*ka, *kb, gtmask);
+  *kb = vec_selud (*kb, *ka, gtmask);
+  *ka = t;
+  t = vec_selud (*pa, *pb, gtmask);
+  *pb = vec_selud (*pb, *pa, gtmask);
+  *pa = t;
+}
+
+/* Key+payload form of vec_bitonic_mergeud().  */
+static inline void
+__vec_sort_merge_kv (vui64_t *k, vui64_t *p, const unsigned int nv)
+{
+  vui64_t xk, yk, xp, yp;
+  unsigned int d, i;
+
+  for (d = nv / 2; d > 0; d /= 2)
+    for (i = 0; i < nv; i++)
+      if ((i & d) == 0)
+	__vec_sort_minmax_kv (&k[i], &k[i + d], &p[i], &p[i + d]);
+
+  for (i = 0; i < nv; i += 2)
+    {
+      xk = vec_mrghd (k[i], k[i + 1]);
+      yk = vec_mrgld (k[i], k[i + 1]);
+      xp = vec_mrghd (p[i], p[i + 1]);
+      yp = vec_mrgld (p[i], p[i + 1]);
+      __vec_sort_minmax_kv (&xk, &yk, &xp, &yp);
+      k[i] = vec_mrghd (xk, yk);
+      k[i + 1] = vec_mrgld (xk, yk);
+      p[i] = vec_mrghd (xp, yp);
+      p[i + 1] = vec_mrgld (xp, yp);
+    }
+}
+
+/* Key+payload form of vec_sortnud_inline().  */
+static inline void
+__vec_sort_sortn_kv (vui64_t *k, vui64_t *p, const unsigned int nv)
+{
+  vui64_t tk[16], tp[16];
+  unsigned int n, j, i, l;
+
+  for (n = 2; n <= nv; n *= 2)
+    for (j = n / 2; j > 0; j /= 2)
+      for (i = 0; i < nv; i++)
+	{
+	  l = i ^ j;
+	  if (l > i)
+	    {
+	      if ((i & n) == 0)
+		__vec_sort_minmax_kv (&k[i], &k[l], &p[i], &p[l]);
+	      else
+		__vec_sort_minmax_kv (&k[l], &k[i], &p[l], &p[i]);
+	    }
+	}
+
+  for (i = 0; i < nv / 2; i++)
+    {
+      tk[i] = vec_mrghd (k[2 * i], k[2 * i + 1]);
+      tk[nv - 1 - i] = vec_swapd (vec_mrgld (k[2 * i], k[2 * i + 1]));
+      tp[i] = vec_mrghd (p[2 * i], p[2 * i + 1]);
+      tp[nv - 1 - i] = vec_swapd (vec_mrgld (p[2 * i], p[2 * i + 1]));
+    }
+  for (i = 0; i < nv; i++)
+    {
+      k[i] = tk[i];
+      p[i] = tp[i];
+    }
+
+  __vec_sort_merge_kv (k, p, nv);
+}
+
+/* Scalar shell sort (Ciura gaps), for short tails and as the
+ * fallback when no temporary buffer is available.  */
+static void
+__vec_sort_shell (unsigned long long *k, unsigned long long *p,
+		  unsigned long n, unsigned long long bias)
+{
+  static const unsigned long gaps[] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+  unsigned long g, i, j, gap;
+  unsigned long long tk, tp = 0;
+
+  for (g = 0; g < (sizeof (gaps) / sizeof (gaps[0])); g++)
+    {
+      gap = gaps[g];
+      for (i = gap; i < n; i++)
+	{
+	  tk = k[i];
+	  if (p)
+	    tp = p[i];
+	  for (j = i; j >= gap && (k[j - gap] ^ bias) > (tk ^ bias); j -= gap)
+	    {
+	      k[j] = k[j - gap];
+	      if (p)
+		p[j] = p[j - gap];
+	    }
+	  k[j] = tk;
+	  if (p)
+	    p[j] = tp;
+	}
+    }
+}
+
+/* Sort each full block of 32 elements in registers, the tail with
+ * the shell sort.  */
+static void
+__vec_sort_blocks (unsigned long long *k, unsigned long long *p,
+		   unsigned long n, unsigned long long bias)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  const vui64_t vsign = CONST_VINT128_DW (__VEC_SORT_SIGN, __VEC_SORT_SIGN);
+  const vui64_t vbias = bias ? vsign : zero;
+  vui64_t vk[16], vp[16];
+  unsigned long i;
+  unsigned int j;
+
+  for (i = 0; (i + __VEC_SORT_BLOCK) <= n; i += __VEC_SORT_BLOCK)
+    {
+      for (j = 0; j < 16; j++)
+	vk[j] = __vec_sort_ld (&k[i + 2 * j], vbias);
+      if (p)
+	{
+	  for (j = 0; j < 16; j++)
+	    vp[j] = __vec_sort_ld (&p[i + 2 * j], zero);
+	  __vec_sort_sortn_kv (vk, vp, 16);
+	  for (j = 0; j < 16; j++)
+	    __vec_sort_st (&p[i + 2 * j], vp[j], zero);
+	}
+      else
+	vec_sort32ud (vk);
+      for (j = 0; j < 16; j++)
+	__vec_sort_st (&k[i + 2 * j], vk[j], vbias);
+    }
+
+  if (i < n)
+    __vec_sort_shell (&k[i], p ? &p[i] : NULL, n - i, bias);
+}
+
+/* Load 8 elements into w[0..3] ascending, or into w[4..7] reversed
+ * (descending) for the second half of a bitonic sequence.  */
+static inline void
+__vec_sort_ld8 (vui64_t *w, const unsigned long long *s, vui64_t bias,
+		int reverse)
+{
+  unsigned int j;
+
+  for (j = 0; j < 4; j++)
+    {
+      if (reverse)
+	w[7 - j] = vec_swapd (__vec_sort_ld (&s[2 * j], bias));
+      else
+	w[j] = __vec_sort_ld (&s[2 * j], bias);
+    }
+}
+
+/* Merge a[0..na) and b[0..nb) into out. While both runs have a full
+ * block left, keep the 8 largest merged elements in registers, load
+ * the next block from the run with the smaller head and emit the 8
+ * smallest. The remainder is a scalar 3-way merge.  */
+static void
+__vec_sort_merge (unsigned long long *ok, unsigned long long *op,
+		  const unsigned long long *ak, const unsigned long long *ap,
+		  unsigned long na,
+		  const unsigned long long *bk, const unsigned long long *bp,
+		  unsigned long nb, unsigned long long bias)
+{
+  const vui64_t zero = vec_splat_u64 (0);
+  const vui64_t vsign = CONST_VINT128_DW (__VEC_SORT_SIGN, __VEC_SORT_SIGN);
+  const vui64_t vbias = bias ? vsign : zero;
+  vui64_t wk[8], wp[8];
+  unsigned long long hk[__VEC_SORT_MERGE], hp[__VEC_SORT_MERGE];
+  unsigned long ia = 0, ib = 0, ih = 0, nh = 0, o = 0;
+  unsigned int j;
+
+  if (na >= __VEC_SORT_MERGE && nb >= __VEC_SORT_MERGE)
+    {
+      __vec_sort_ld8 (wk, ak, vbias, 0);
+      __vec_sort_ld8 (wk, bk, vbias, 1);
+      if (op)
+	{
+	  __vec_sort_ld8 (wp, ap, zero, 0);
+	  __vec_sort_ld8 (wp, bp, zero, 1);
+	}
+      ia = ib = __VEC_SORT_MERGE;
+
+      for (;;)
+	{
+	  if (op)
+	    __vec_sort_merge_kv (wk, wp, 8);
+	  else
+	    vec_bitonic_mergeud (wk, 8);
+	  for (j = 0; j < 4; j++)
+	    {
+	      __vec_sort_st (&ok[o + 2 * j], wk[j], vbias);
+	      wk[j] = wk[j + 4];
+	      if (op)
+		{
+		  __vec_sort_st (&op[o + 2 * j], wp[j], zero);
+		  wp[j] = wp[j + 4];
+		}
+	    }
+	  o += __VEC_SORT_MERGE;
+
+	  if ((ia + __VEC_SORT_MERGE) > na || (ib + __VEC_SORT_MERGE) > nb)
+	    break;
+	  if ((ak[ia] ^ bias) <= (bk[ib] ^ bias))
+	    {
+	      __vec_sort_ld8 (wk, &ak[ia], vbias, 1);
+	      if (op)
+		__vec_sort_ld8 (wp, &ap[ia], zero, 1);
+	      ia += __VEC_SORT_MERGE;
+	    }
+	  else
+	    {
+	      __vec_sort_ld8 (wk, &bk[ib], vbias, 1);
+	      if (op)
+		__vec_sort_ld8 (wp, &bp[ib], zero, 1);
+	      ib += __VEC_SORT_MERGE;
+	    }
+	}
+
+      /* The high half is left in wk[0..3].  */
+      for (j = 0; j < 4; j++)
+	{
+	  __vec_sort_st (&hk[2 * j], wk[j], vbias);
+	  if (op)
+	    __vec_sort_st (&hp[2 * j], wp[j], zero);
+	}
+      nh = __VEC_SORT_MERGE;
+    }
+
+  while (ih < nh || ia < na || ib < nb)
+    {
+      const unsigned long long *sk, *sp;
+      unsigned long *si;
+      unsigned long long best = 0;
+
+      si = NULL;
+      sk = sp = NULL;
+      if (ih < nh)
+	{
+	  si = &ih;
+	  sk = hk;
+	  sp = hp;
+	  best = hk[ih] ^ bias;
+	}
+      if (ia < na && (si == NULL || (ak[ia] ^ bias) < best))
+	{
+	  si = &ia;
+	  sk = ak;
+	  sp = ap;
+	  best = ak[ia] ^ bias;
+	}
+      if (ib < nb && (si == NULL || (bk[ib] ^ bias) < best))
+	{
+	  si = &ib;
+	  sk = bk;
+	  sp = bp;
+	}
+
+      ok[o] = sk[*si];
+      if (op)
+	op[o] = sp[*si];
+      o++;
+      (*si)++;
+    }
+}
+
+static void
+__vec_sort_impl (unsigned long long *k, unsigned long long *p,
+		 unsigned long n, unsigned long long bias)
+{
+  unsigned long long *tk, *tp = NULL;
+  unsigned long long *sk, *sp, *dk, *dp, *x;
+  unsigned long run, i, na, nb;
+
+  if (n < 2)
+    return;
+
+  if (n <= __VEC_SORT_BLOCK)
+    {
+      __vec_sort_blocks (k, p, n, bias);
+      return;
+    }
+
+  tk = malloc (n * sizeof (unsigned long long));
+  if (p && tk)
+    tp = malloc (n * sizeof (unsigned long long));
+  if (tk == NULL || (p && tp == NULL))
+    {
+      free (tk);
+      __vec_sort_shell (k, p, n, bias);
+      return;
+    }
+
+  __vec_sort_blocks (k, p, n, bias);
+
+  sk = k;
+  sp = p;
+  dk = tk;
+  dp = tp;
+  for (run = __VEC_SORT_BLOCK; run < n; run *= 2)
+    {
+      for (i = 0; i < n; i += 2 * run)
+	{
+	  na = ((n - i) < run) ? (n - i) : run;
+	  nb = ((n - i) > run) ? (n - i - run) : 0;
+	  if (nb > run)
+	    nb = run;
+	  if (nb == 0)
+	    {
+	      memcpy (&dk[i], &sk[i], na * sizeof (unsigned long long));
+	      if (p)
+		memcpy (&dp[i], &sp[i], na * sizeof (unsigned long long));
+	    }
+	  else
+	    __vec_sort_merge (&dk[i], p ? &dp[i] : NULL,
+			      &sk[i], p ? &sp[i] : NULL, na,
+			      &sk[i + na], p ? &sp[i + na] : NULL, nb, bias);
+	}
+      x = sk; sk = dk; dk = x;
+      x = sp; sp = dp; dp = x;
+    }
+
+  if (sk != k)
+    {
+      memcpy (k, sk, n * sizeof (unsigned long long));
+      if (p)
+	memcpy (p, sp, n * sizeof (unsigned long long));
+    }
+
+  free (tk);
+  free (tp);
+}
+
+void
+__VEC_PWR_IMP (vec_merge_s64) (long long *out, const long long *a,
+			       unsigned long na, const long long *b,
+			       unsigned long nb)
+{
+  __vec_sort_merge ((unsigned long long *) out, NULL,
+		    (const unsigned long long *) a, NULL, na,
+		    (const unsigned long long *) b, NULL, nb,
+		    __VEC_SORT_SIGN);
+}
+
+void
+__VEC_PWR_IMP (vec_merge_u64) (unsigned long long *out,
+			       const unsigned long long *a, unsigned long na,
+			       const unsigned long long *b, unsigned long nb)
+{
+  __vec_sort_merge (out, NULL, a, NULL, na, b, NULL, nb, 0);
+}
+
+void
+__VEC_PWR_IMP (vec_sort_s64) (long long *array, unsigned long n)
+{
+  __vec_sort_impl ((unsigned long long *) array, NULL, n, __VEC_SORT_SIGN);
+}
+
+void
+__VEC_PWR_IMP (vec_sort_s64_kv) (long long *keys,
+				 unsigned long long *payload,
+				 unsigned long n)
+{
+  __vec_sort_impl ((unsigned long long *) keys, payload, n,
+		   __VEC_SORT_SIGN);
+}
+
+void
+__VEC_PWR_IMP (vec_sort_u64) (unsigned long long *array, unsigned long n)
+{
+  __vec_sort_impl (array, NULL, n, 0);
+}
+
+void
+__VEC_PWR_IMP (vec_sort_u64_kv) (unsigned long long *keys,
+				 unsigned long long *payload,
+				 unsigned long n)
+{
+  __vec_sort_impl (keys, payload, n, 0);
+}
+
+/* Quadword keys. Each vector holds one key, so the compare-exchange
+ * of vec_minmaxuq() works directly across vectors.  */
+
+/* Quadwords per in-register sorted block.  */
+#define __VEC_SORTQ_BLOCK 16
+/* Use the radix sort from this many quadwords.  */
+#define __VEC_SORTQ_RADIX 65536
+
+/* Bitonic sort of v[0..nv) in registers (nv a power of 2).  */
+static inline void
+__vec_sortq_net (vui128_t *v, const unsigned int nv)
+{
+  unsigned int k, j, i, l;
+
+  for (k = 2; k <= nv; k *= 2)
+    for (j = k / 2; j > 0; j /= 2)
+      for (i = 0; i < nv; i++)
+	{
+	  l = i ^ j;
+	  if (l > i)
+	    {
+	      if ((i & k) == 0)
+		vec_minmaxuq (&v[i], &v[l]);
+	      else
+		vec_minmaxuq (&v[l], &v[i]);
+	    }
+	}
+}
+
+static void
+__vec_sortq_shell (vui128_t *k, unsigned long n)
+{
+  static const unsigned long gaps[] = { 701, 301, 132, 57, 23, 10, 4, 1 };
+  unsigned long g, i, j, gap;
+  vui128_t t;
+
+  for (g = 0; g < (sizeof (gaps) / sizeof (gaps[0])); g++)
+    {
+      gap = gaps[g];
+      for (i = gap; i < n; i++)
+	{
+	  t = k[i];
+	  for (j = i; j >= gap && vec_cmpuq_all_gt (k[j - gap], t); j -= gap)
+	    k[j] = k[j - gap];
+	  k[j] = t;
+	}
+    }
+}
+
+/* Branch free merge of a[0..na) and b[0..nb) into out.  */
+static void
+__vec_sortq_merge (vui128_t *out, const vui128_t *a, unsigned long na,
+		   const vui128_t *b, unsigned long nb)
+{
+  unsigned long ia = 0, ib = 0, o = 0;
+  vui128_t va, vb;
+  int gt;
+
+  while (ia < na && ib < nb)
+    {
+      va = a[ia];
+      vb = b[ib];
+      gt = vec_cmpuq_all_gt (va, vb);
+      out[o++] = vec_seluq (va, vb, vec_cmpgtuq (va, vb));
+      ib += gt;
+      ia += 1 - gt;
+    }
+  while (ia < na)
+    out[o++] = a[ia++];
+  while (ib < nb)
+    out[o++] = b[ib++];
+}
+
+static void
+__vec_sortq_mergesort (vui128_t *k, vui128_t *t, unsigned long n)
+{
+  vui128_t v[__VEC_SORTQ_BLOCK];
+  vui128_t *s, *d, *x;
+  unsigned long i, run, na, nb;
+  unsigned int j;
+
+  for (i = 0; (i + __VEC_SORTQ_BLOCK) <= n; i += __VEC_SORTQ_BLOCK)
+    {
+      for (j = 0; j < __VEC_SORTQ_BLOCK; j++)
+	v[j] = k[i + j];
+      __vec_sortq_net (v, __VEC_SORTQ_BLOCK);
+      for (j = 0; j < __VEC_SORTQ_BLOCK; j++)
+	k[i + j] = v[j];
+    }
+  if (i < n)
+    __vec_sortq_shell (&k[i], n - i);
+
+  s = k;
+  d = t;
+  for (run = __VEC_SORTQ_BLOCK; run < n; run *= 2)
+    {
+      for (i = 0; i < n; i += 2 * run)
+	{
+	  na = ((n - i) < run) ? (n - i) : run;
+	  nb = ((n - i) > run) ? (n - i - run) : 0;
+	  if (nb > run)
+	    nb = run;
+	  __vec_sortq_merge (&d[i], &s[i], na, &s[i + na], nb);
+	}
+      x = s; s = d; d = x;
+    }
+
+  if (s != k)
+    memcpy (k, s, n * sizeof (vui128_t));
+}
+
+static inline unsigned int
+__vec_sortq_digit (vui128_t key, unsigned int d)
+{
+  __VEC_U_128 t;
+
+  t.vx1 = key;
+  if (d < 8)
+    return (unsigned int) (t.ulong.lower >> (d * 8)) & 0xff;
+  else
+    return (unsigned int) (t.ulong.upper >> ((d - 8) * 8)) & 0xff;
+}
+
+/* LSD radix sort, 16 passes of 8-bit digits. One read pass builds
+ * all 16 histograms, then digits where every key has the same value
+ * are skipped.  */
+static void
+__vec_sortq_radix (vui128_t *k, vui128_t *t, unsigned long n)
+{
+  unsigned long count[16][256];
+  vui128_t *s, *dst, *x;
+  unsigned long i, sum, c;
+  unsigned int d;
+
+  memset (count, 0, sizeof (count));
+  for (i = 0; i < n; i++)
+    for (d = 0; d < 16; d++)
+      count[d][__vec_sortq_digit (k[i], d)]++;
+
+  s = k;
+  dst = t;
+  for (d = 0; d < 16; d++)
+    {
+      if (count[d][__vec_sortq_digit (s[0], d)] == n)
+	continue;
+
+      for (sum = 0, i = 0; i < 256; i++)
+	{
+	  c = count[d][i];
+	  count[d][i] = sum;
+	  sum += c;
+	}
+      for (i = 0; i < n; i++)
+	dst[count[d][__vec_sortq_digit (s[i], d)]++] = s[i];
+      x = s; s = dst; dst = x;
+    }
+
+  if (s != k)
+    memcpy (k, s, n * sizeof (vui128_t));
+}
+
+/* Flip the sign bit of each key, so signed order is unsigned order.  */
+static void
+__vec_sortq_bias (vui128_t *k, unsigned long n)
+{
+  const vui128_t sign = (vui128_t) CONST_VINT128_DW (0x8000000000000000UL,
+						      0UL);
+  unsigned long i;
+
+  for (i = 0; i < n; i++)
+    k[i] = (vui128_t) vec_xor ((vui32_t) k[i], (vui32_t) sign);
+}
+
+void
+__VEC_PWR_IMP (vec_sort_u128) (vui128_t *array, unsigned long n)
+{
+  vui128_t *t;
+
+  if (n < 2)
+    return;
+
+  if (n <= __VEC_SORTQ_BLOCK)
+    {
+      __vec_sortq_shell (array, n);
+      return;
+    }
+
+  t = malloc (n * sizeof (vui128_t));
+  if (t == NULL)
+    {
+      __vec_sortq_shell (array, n);
+      return;
+    }
+
+  if (n >= __VEC_SORTQ_RADIX)
+    __vec_sortq_radix (array, t, n);
+  else
+    __vec_sortq_mergesort (array, t, n);
+
+  free (t);
+}
+
+void
+__VEC_PWR_IMP (vec_sort_s128) (vi128_t *array, unsigned long n)
+{
+  __vec_sortq_bias ((vui128_t *) array, n);
+  __VEC_PWR_IMP (vec_sort_u128) ((vui128_t *) array, n);
+  __vec_sortq_bias ((vui128_t *) array, n);
+}
+
+/* Branch free search: keep the candidate range [base, base+len],
+ * halving len each step. The two possible next midpoints are
+ * prefetched so the load latency overlaps the compare.  */
+unsigned long
+__VEC_PWR_IMP (vec_lower_bound_u128) (const vui128_t *array,
+				      unsigned long n, vui128_t key)
+{
+  const vui128_t *base = array;
+  unsigned long half;
+
+  if (n == 0)
+    return 0;
+
+  while (n > 1)
+    {
+      half = n / 2;
+      n -= half;
+      __builtin_prefetch (&base[n / 2]);
+      __builtin_prefetch (&base[half + n / 2]);
+      base = vec_cmpuq_all_lt (base[half], key) ? &base[half] : base;
+    }
+  return (unsigned long) (base - array) + vec_cmpuq_all_lt (*base, key);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_upper_bound_u128) (const vui128_t *array,
+				      unsigned long n, vui128_t key)
+{
+  const vui128_t *base = array;
+  unsigned long half;
+
+  if (n == 0)
+    return 0;
+
+  while (n > 1)
+    {
+      half = n / 2;
+      n -= half;
+      __builtin_prefetch (&base[n / 2]);
+      __builtin_prefetch (&base[half + n / 2]);
+      base = vec_cmpuq_all_le (base[half], key) ? &base[half] : base;
+    }
+  return (unsigned long) (base - array) + vec_cmpuq_all_le (*base, key);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_lower_bound_s128) (const vi128_t *array,
+				      unsigned long n, vi128_t key)
+{
+  const vi128_t *base = array;
+  unsigned long half;
+
+  if (n == 0)
+    return 0;
+
+  while (n > 1)
+    {
+      half = n / 2;
+      n -= half;
+      __builtin_prefetch (&base[n / 2]);
+      __builtin_prefetch (&base[half + n / 2]);
+      base = vec_cmpsq_all_lt (base[half], key) ? &base[half] : base;
+    }
+  return (unsigned long) (base - array) + vec_cmpsq_all_lt (*base, key);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_upper_bound_s128) (const vi128_t *array,
+				      unsigned long n, vi128_t key)
+{
+  const vi128_t *base = array;
+  unsigned long half;
+
+  if (n == 0)
+    return 0;
+
+  while (n > 1)
+    {
+      half = n / 2;
+      n -= half;
+      __builtin_prefetch (&base[n / 2]);
+      __builtin_prefetch (&base[half + n / 2]);
+      base = vec_cmpsq_all_le (base[half], key) ? &base[half] : base;
+    }
+  return (unsigned long) (base - array) + vec_cmpsq_all_le (*base, key);
+}
@@ -0,0 +1,444 @@
+/*
+ Copyright (c) [2026] Steven Munroe.
+
+ Licensed under the Apache License, Version 2.0 (the "License");
+ you may not use this file except in compliance with the License.
+ You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+ Unless required by applicable law or agreed to in writing, software
+ distributed under the License is distributed on an "AS IS" BASIS,
+ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ See the License for the specific language governing permissions and
+ limitations under the License.
+
+ vec_varint_runtime.c
+
+ Contributors:
+      Steven Munroe
+      Created on: Oct 18, 2026
+ */
+
+/* Stream-VByte and LEB128 (protobuf) variable length integer codecs.
+ * Included by vec_runtime_PWR7.c ... vec_runtime_PWR10.c.
+ *
+ * Stream-VByte stores a control byte per 4 words (2 bits each, the
+ * byte length - 1) ahead of the data bytes, so decode is a 16 byte
+ * load, one vec_perm from a 256 entry table indexed by the control
+ * byte, and a 16 byte store of 4 words. Encode is the inverse
+ * vec_perm. The permute tables are generated at compile time for
+ * the system endian by the __VEC_SVB_* macros.
+ *
+ * LEB128 stores 7 bits per byte, low order first, with the high bit
+ * set on all but the last byte. The decoder checks 16 bytes at a
+ * time for the common case of 16 single byte values (zero extended
+ * with vec_mergeh/vec_mergel). Otherwise the length of the next
+ * varint is the index of the first byte with the high bit clear,
+ * from vec_cntlz_lsbb_bi (vctzlsbb) on POWER9 and later and a
+ * scalar count trailing zeros of the terminator bits on POWER8 and
+ * earlier, where vctzlsbb must be emulated. The 7-bit groups are
+ * compacted with pextd on POWER10 or shift and mask otherwise.  */
+
+#include <string.h>
+
+#include <pveclib/vec_char_ppc.h>
+#include <pveclib/vec_int32_ppc.h>
+#include <pveclib/vec_int64_ppc.h>
+
+/* Byte length - 1 of value i for control byte c.  */
+#define __VEC_SVB_C(c, i) (((c) >> (2 * (i))) & 3)
+/* Data offset of value i for control byte c.  */
+#define __VEC_SVB_OFF(c, i) ((i) \
+    + (((i) > 0) ? __VEC_SVB_C (c, 0) : 0) \
+    + (((i) > 1) ? __VEC_SVB_C (c, 1) : 0) \
+    + (((i) > 2) ? __VEC_SVB_C (c, 2) : 0))
+#define __VEC_SVB_LEN(c) (__VEC_SVB_OFF (c, 3) + __VEC_SVB_C (c, 3) + 1)
+/* Significance (0 low order) of the byte at offset b of a word.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define __VEC_SVB_SIG(b) (b)
+#else
+#define __VEC_SVB_SIG(b) (3 - (b))
+#endif
+
+/* Decode: byte p of the 4 words is data byte OFF + significance, or
+ * zero (16, selecting from the zero vector).  */
+#define __VEC_SVB_D(c, p) \
+    ((__VEC_SVB_SIG ((p) & 3) <= __VEC_SVB_C (c, (p) >> 2)) \
+     ? __VEC_SVB_OFF (c, (p) >> 2) + __VEC_SVB_SIG ((p) & 3) : 16)
+/* Encode: data byte q is from value i at significance q - OFF.  */
+#define __VEC_SVB_S(i, j) ((4 * (i) + __VEC_SVB_SIG ((j) & 3)) & 15)
+#define __VEC_SVB_EI(c, q, i) \
+    __VEC_SVB_S (i, (q) - __VEC_SVB_OFF (c, i))
+#define __VEC_SVB_E(c, q) \
+    (((q) >= __VEC_SVB_OFF (c, 3)) ? __VEC_SVB_EI (c, q, 3) \
+     : ((q) >= __VEC_SVB_OFF (c, 2)) ? __VEC_SVB_EI (c, q, 2) \
+     : ((q) >= __VEC_SVB_OFF (c, 1)) ? __VEC_SVB_EI (c, q, 1) \
+     : __VEC_SVB_EI (c, q, 0))
+
+#define __VEC_SVB_ROW(_M, c) \
+  { _M (c, 0), _M (c, 1), _M (c, 2), _M (c, 3), \
+    _M (c, 4), _M (c, 5), _M (c, 6), _M (c, 7), \
+    _M (c, 8), _M (c, 9), _M (c, 10), _M (c, 11), \
+    _M (c, 12), _M (c, 13), _M (c, 14), _M (c, 15) }
+#define __VEC_SVB_DROW(c) __VEC_SVB_ROW (__VEC_SVB_D, c)
+#define __VEC_SVB_EROW(c) __VEC_SVB_ROW (__VEC_SVB_E, c)
+#define __VEC_SVB_R4(_R, c) _R (c), _R (c + 1), _R (c + 2), _R (c + 3)
+#define __VEC_SVB_R16(_R, c) __VEC_SVB_R4 (_R, c), \
+    __VEC_SVB_R4 (_R, c + 4), __VEC_SVB_R4 (_R, c + 8), \
+    __VEC_SVB_R4 (_R, c + 12)
+#define __VEC_SVB_R64(_R, c) __VEC_SVB_R16 (_R, c), \
+    __VEC_SVB_R16 (_R, c + 16), __VEC_SVB_R16 (_R, c + 32), \
+    __VEC_SVB_R16 (_R, c + 48)
+#define __VEC_SVB_R256(_R) __VEC_SVB_R64 (_R, 0), \
+    __VEC_SVB_R64 (_R, 64), __VEC_SVB_R64 (_R, 128), \
+    __VEC_SVB_R64 (_R, 192)
+
+static const vui8_t __vec_svb_dec[256] = { __VEC_SVB_R256 (__VEC_SVB_DROW) };
+static const vui8_t __vec_svb_enc[256] = { __VEC_SVB_R256 (__VEC_SVB_EROW) };
+static const unsigned char __vec_svb_len[256] =
+  { __VEC_SVB_R256 (__VEC_SVB_LEN) };
+
+/* Byte length - 1 (0-3) of a Stream-VByte value.  */
+static inline unsigned int
+__vec_svb_code (unsigned int v)
+{
+  return (v > 0xffffff) + (v > 0xffff) + (v > 0xff);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_svb_encode_u32) (unsigned char *out,
+				    const unsigned int *in, unsigned long n)
+{
+  unsigned char *ctl = out;
+  unsigned char *data = out + (n + 3) / 4;
+  unsigned long i;
+
+  for (i = 0; i + 4 <= n; i += 4)
+    {
+      unsigned int c;
+      vui8_t v;
+
+      c = __vec_svb_code (in[i]) | (__vec_svb_code (in[i + 1]) << 2)
+	  | (__vec_svb_code (in[i + 2]) << 4)
+	  | (__vec_svb_code (in[i + 3]) << 6);
+      memcpy (&v, &in[i], sizeof (v));
+      /* Within vec_svb_bound_u32(n) as at least 16 bytes are
+       * reserved for each remaining group.  */
+      v = vec_perm (v, v, __vec_svb_enc[c]);
+      memcpy (data, &v, sizeof (v));
+      *ctl++ = c;
+      data += __vec_svb_len[c];
+    }
+  if (i < n)
+    {
+      unsigned int c = 0, k;
+
+      for (k = 0; i + k < n; k++)
+	{
+	  unsigned int v = in[i + k];
+	  unsigned int code = __vec_svb_code (v);
+	  unsigned int j;
+
+	  for (j = 0; j <= code; j++)
+	    *data++ = (unsigned char) (v >> (8 * j));
+	  c |= code << (2 * k);
+	}
+      *ctl = c;
+    }
+  return data - out;
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_svb_decode_u32) (unsigned int *out,
+				    const unsigned char *in, unsigned long n)
+{
+  const vui8_t zero = vec_splat_u8 (0);
+  const unsigned char *ctl = in;
+  const unsigned char *data = in + (n + 3) / 4;
+  unsigned long i, g = 0;
+
+  /* Each group has at least 4 data bytes, so while 4 full groups
+   * remain the 16 byte load stays within the encoded data.  */
+  for (i = 0; i + 16 <= n; i += 4)
+    {
+      unsigned int c = ctl[g++];
+      vui8_t v;
+
+      memcpy (&v, data, sizeof (v));
+      v = vec_perm (v, zero, __vec_svb_dec[c]);
+      memcpy (&out[i], &v, sizeof (v));
+      data += __vec_svb_len[c];
+    }
+  for (; i < n; i += 4, g++)
+    {
+      unsigned int c = ctl[g], k;
+
+      for (k = 0; k < 4 && i + k < n; k++)
+	{
+	  unsigned int code = __VEC_SVB_C (c, k);
+	  unsigned int v = 0, j;
+
+	  for (j = 0; j <= code; j++)
+	    v |= (unsigned int) *data++ << (8 * j);
+	  out[i + k] = v;
+	}
+    }
+  return data - in;
+}
+
+/* Read 8 bytes as a little endian doubleword.  */
+static inline unsigned long long
+__vec_leb128_r8 (const unsigned char *p)
+{
+  unsigned long long x;
+
+  memcpy (&x, p, sizeof (x));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap64 (x);
+#endif
+  return x;
+}
+
+static inline void
+__vec_leb128_w8 (unsigned char *p, unsigned long long x)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  x = __builtin_bswap64 (x);
+#endif
+  memcpy (p, &x, sizeof (x));
+}
+
+/* Compact the low 7 bits of each byte of x.  */
+static inline unsigned long long
+__vec_leb128_pext (unsigned long long x)
+{
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 11)
+  return __builtin_pextd (x, 0x7f7f7f7f7f7f7f7fULL);
+#else
+  x &= 0x7f7f7f7f7f7f7f7fULL;
+  x = (x & 0x007f007f007f007fULL) | ((x & 0x7f007f007f007f00ULL) >> 1);
+  x = (x & 0x00003fff00003fffULL) | ((x & 0x3fff00003fff0000ULL) >> 2);
+  return (x & 0x000000000fffffffULL) | ((x & 0x0fffffff00000000ULL) >> 4);
+#endif
+}
+
+/* Spread the low 56 bits of v to 7 bits per byte.  */
+static inline unsigned long long
+__vec_leb128_pdep (unsigned long long v)
+{
+#if defined (_ARCH_PWR10) && (__GNUC__ >= 11)
+  return __builtin_pdepd (v, 0x7f7f7f7f7f7f7f7fULL);
+#else
+  unsigned long long x;
+
+  x = (v & 0x000000000fffffffULL) | ((v & 0x00fffffff0000000ULL) << 4);
+  x = (x & 0x00003fff00003fffULL) | ((x & 0x0fffc0000fffc000ULL) << 2);
+  return (x & 0x007f007f007f007fULL) | ((x & 0x3f803f803f803f80ULL) << 1);
+#endif
+}
+
+/* Value of the varint of len (1-10) bytes at p, with at least 16
+ * bytes readable.  */
+static inline unsigned long long
+__vec_leb128_val (const unsigned char *p, unsigned int len)
+{
+  unsigned long long x = __vec_leb128_r8 (p);
+
+  if (len < 8)
+    return __vec_leb128_pext (x & ((1ULL << (8 * len)) - 1));
+  x = __vec_leb128_pext (x);
+  if (len > 8)
+    x |= (unsigned long long) (p[8] & 0x7f) << 56;
+  if (len > 9)
+    x |= (unsigned long long) p[9] << 63;
+  return x;
+}
+
+/* Decode n varints from len bytes at in. If wide store doublewords
+ * else words (truncating, as protobuf int32).  */
+static inline long __attribute__((always_inline))
+__vec_leb128_decode (void *out, const unsigned char *in, unsigned long len,
+		     unsigned long n, const int wide)
+{
+  const vui8_t hibit = vec_splats ((unsigned char) 0x80);
+  const vui8_t zero = vec_splat_u8 (0);
+  const unsigned char *p = in, *end = in + len;
+  unsigned long long *out64 = out;
+  unsigned int *out32 = out;
+  unsigned long i = 0;
+
+  while (i < n)
+    {
+      unsigned long long v;
+      unsigned int l;
+
+      if (end - p >= 16)
+	{
+	  vui8_t b;
+
+	  memcpy (&b, p, sizeof (b));
+	  if (i + 16 <= n && vec_all_lt (b, hibit))
+	    {
+	      /* 16 single byte values.  */
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+	      vui16_t h0 = (vui16_t) vec_mergeh (b, zero);
+	      vui16_t h1 = (vui16_t) vec_mergel (b, zero);
+	      vui32_t w0 = (vui32_t) vec_mergeh (h0, (vui16_t) zero);
+	      vui32_t w1 = (vui32_t) vec_mergel (h0, (vui16_t) zero);
+	      vui32_t w2 = (vui32_t) vec_mergeh (h1, (vui16_t) zero);
+	      vui32_t w3 = (vui32_t) vec_mergel (h1, (vui16_t) zero);
+#else
+	      vui16_t h0 = (vui16_t) vec_mergeh (zero, b);
+	      vui16_t h1 = (vui16_t) vec_mergel (zero, b);
+	      vui32_t w0 = (vui32_t) vec_mergeh ((vui16_t) zero, h0);
+	      vui32_t w1 = (vui32_t) vec_mergel ((vui16_t) zero, h0);
+	      vui32_t w2 = (vui32_t) vec_mergeh ((vui16_t) zero, h1);
+	      vui32_t w3 = (vui32_t) vec_mergel ((vui16_t) zero, h1);
+#endif
+	      if (wide)
+		{
+		  vui32_t w[4] = { w0, w1, w2, w3 };
+		  int k;
+
+		  for (k = 0; k < 4; k++)
+		    {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+		      vui64_t d0 = (vui64_t) vec_mergeh (w[k], (vui32_t) zero);
+		      vui64_t d1 = (vui64_t) vec_mergel (w[k], (vui32_t) zero);
+#else
+		      vui64_t d0 = (vui64_t) vec_mergeh ((vui32_t) zero, w[k]);
+		      vui64_t d1 = (vui64_t) vec_mergel ((vui32_t) zero, w[k]);
+#endif
+		      memcpy (&out64[i + 4 * k], &d0, sizeof (d0));
+		      memcpy (&out64[i + 4 * k + 2], &d1, sizeof (d1));
+		    }
+		}
+	      else
+		{
+		  memcpy (&out32[i], &w0, sizeof (w0));
+		  memcpy (&out32[i + 4], &w1, sizeof (w1));
+		  memcpy (&out32[i + 8], &w2, sizeof (w2));
+		  memcpy (&out32[i + 12], &w3, sizeof (w3));
+		}
+	      p += 16;
+	      i += 16;
+	      continue;
+	    }
+#if defined (_ARCH_PWR9)
+	  l = vec_cntlz_lsbb_bi ((vui8_t) vec_cmplt (b, hibit)) + 1;
+#else
+	  {
+	    unsigned long long t;
+
+	    t = ~__vec_leb128_r8 (p) & 0x8080808080808080ULL;
+	    if (t != 0)
+	      l = __builtin_ctzll (t) / 8 + 1;
+	    else
+	      l = (p[8] < 0x80) ? 9 : (p[9] < 0x80) ? 10 : 11;
+	  }
+#endif
+	  if (l > 10)
+	    return -1;
+	  v = __vec_leb128_val (p, l);
+	  p += l;
+	}
+      else
+	{
+	  unsigned int s = 0;
+
+	  v = 0;
+	  do
+	    {
+	      if (p == end || s >= 70)
+		return -1;
+	      v |= (unsigned long long) (*p & 0x7f) << s;
+	      s += 7;
+	    }
+	  while (*p++ & 0x80);
+	}
+      if (wide)
+	out64[i] = v;
+      else
+	out32[i] = (unsigned int) v;
+      i++;
+    }
+  return p - in;
+}
+
+/* Encode n doublewords (wide) or words from in to out, with room
+ * for 10 (wide) or 5 bytes per value.  */
+static inline unsigned long __attribute__((always_inline))
+__vec_leb128_encode (unsigned char *out, const void *in, unsigned long n,
+		     const int wide)
+{
+  const unsigned long long *in64 = in;
+  const unsigned int *in32 = in;
+  const unsigned long cap = (wide ? 10 : 5) * n;
+  unsigned long i, o = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      unsigned long long v = wide ? in64[i] : in32[i];
+      unsigned int bits = 64 - __builtin_clzll (v | 1);
+      unsigned int l = (bits + 6) / 7;
+      unsigned long long x;
+
+      if (l <= 8)
+	{
+	  x = __vec_leb128_pdep (v)
+	      | (0x8080808080808080ULL & ((1ULL << (8 * l - 8)) - 1));
+	  if (o + 8 <= cap)
+	    __vec_leb128_w8 (out + o, x);
+	  else
+	    {
+	      unsigned int k;
+
+	      for (k = 0; k < l; k++)
+		out[o + k] = (unsigned char) (x >> (8 * k));
+	    }
+	}
+      else
+	{
+	  x = __vec_leb128_pdep (v) | 0x8080808080808080ULL;
+	  __vec_leb128_w8 (out + o, x);
+	  out[o + 8] = ((v >> 56) & 0x7f) | ((l > 9) ? 0x80 : 0);
+	  if (l > 9)
+	    out[o + 9] = (unsigned char) (v >> 63);
+	}
+      o += l;
+    }
+  return o;
+}
+
+long
+__VEC_PWR_IMP (vec_leb128_decode_u32) (unsigned int *out,
+				       const unsigned char *in,
+				       unsigned long len, unsigned long n)
+{
+  return __vec_leb128_decode (out, in, len, n, 0);
+}
+
+long
+__VEC_PWR_IMP (vec_leb128_decode_u64) (unsigned long long *out,
+				       const unsigned char *in,
+				       unsigned long len, unsigned long n)
+{
+  return __vec_leb128_decode (out, in, len, n, 1);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_leb128_encode_u32) (unsigned char *out,
+				       const unsigned int *in,
+				       unsigned long n)
+{
+  return __vec_leb128_encode (out, in, n, 0);
+}
+
+unsigned long
+__VEC_PWR_IMP (vec_leb128_encode_u64) (unsigned char *out,
+				       const unsigned long long *in,
+				       unsigned long n)
+{
+  return __vec_leb128_encode (out, in, n, 1);
+}